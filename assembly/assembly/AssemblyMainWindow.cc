@@ -18,6 +18,9 @@
 #include <AssemblyLogFileView.h>
 #include <AssemblyParameters.h>
 #include <AssemblyUtilities.h>
+#ifdef NOUEYE
+#include <AssemblyUEyeFakeCamera.h>
+#endif
 
 #include <string>
 
@@ -105,8 +108,8 @@ AssemblyMainWindow::AssemblyMainWindow(const QString& outputdir_path, const QStr
       config->getValue<std::string>("LStepExpressDevice"),
       config->getValue<std::string>("LStepExpressDevice_ver"),
       config->getValue<std::string>("LStepExpressDevice_iver"),
-      1000,
-      1000
+      config->getValue<int>("LStepExpressModel_updateInterval"      , 1000),
+      config->getValue<int>("LStepExpressModel_motionUpdateInterval", 1000)
     );
 
     motion_manager_ = new LStepExpressMotionManager(motion_model_);
@@ -129,6 +132,15 @@ AssemblyMainWindow::AssemblyMainWindow(const QString& outputdir_path, const QStr
       NQLog("AssemblyMainWindow", NQLog::Critical) << "initialization error: null pointer to AssemblyVUEyeCamera object (camera_ID=" << camera_ID_ << ")";
       NQLog("AssemblyMainWindow", NQLog::Critical) << "---------------------------------------------------------------------------------";
     }
+#ifdef NOUEYE
+    else
+    {
+      // simulated camera: the field of view follows the position of the (fake) motion stage
+      AssemblyUEyeFakeCamera* const fake_camera = qobject_cast<AssemblyUEyeFakeCamera*>(camera_);
+
+      if(fake_camera != nullptr){ fake_camera->setMotionModel(motion_model_); }
+    }
+#endif
     /// -------------------
 
     /// Vacuum Manager
@@ -174,9 +186,14 @@ AssemblyMainWindow::AssemblyMainWindow(const QString& outputdir_path, const QStr
     connect(thresholder_view_, SIGNAL(adaptiveThreshold_request(int)), thresholder_, SLOT(update_image_binary_adaptiveThreshold(int)));
     connect(thresholder_view_, SIGNAL(loaded_image_raw(cv::Mat))     , thresholder_, SLOT(update_image_raw(cv::Mat)));
 
+    connect(thresholder_view_, SIGNAL(threshold_preview_request        (int)), thresholder_, SLOT(preview_image_binary_threshold        (int)));
+    connect(thresholder_view_, SIGNAL(adaptiveThreshold_preview_request(int)), thresholder_, SLOT(preview_image_binary_adaptiveThreshold(int)));
+
     connect(thresholder_, SIGNAL(updated_image_raw   (cv::Mat)), thresholder_view_, SLOT(update_image_raw   (cv::Mat)));
     connect(thresholder_, SIGNAL(updated_image_binary(cv::Mat)), thresholder_view_, SLOT(update_image_binary(cv::Mat)));
 
+    connect(thresholder_, SIGNAL(updated_image_binary_preview(cv::Mat)), thresholder_view_, SLOT(update_image_binary_preview(cv::Mat)));
+
     NQLog("AssemblyMainWindow", NQLog::Message) << "added view " << tabname_ImageThresholding;
     // ---------------------------------------------------------
 
@@ -321,7 +338,7 @@ AssemblyMainWindow::AssemblyMainWindow(const QString& outputdir_path, const QStr
     controls_tab->addTab(toolbox_view_, tabname_Toolbox);
 
     // multi-pickup tester
-    multipickup_tester_ = new AssemblyMultiPickupTester(motion_manager_);
+    multipickup_tester_ = new AssemblyMultiPickupTester(motion_manager_, outputdir_path+"/AssemblyMultiPickupTester");
 
     connect(toolbox_view_->MultiPickupTester_Widget(), SIGNAL(multipickup_request(AssemblyMultiPickupTester::Configuration)), this, SLOT(start_multiPickupTest(AssemblyMultiPickupTester::Configuration)));
 
@@ -564,6 +581,16 @@ void AssemblyMainWindow::connect_images()
   connect(image_view_->autofocus_emergencyStop_button(), SIGNAL(clicked()), zfocus_finder_, SLOT(emergencyStop()));
   connect(image_view_->autofocus_emergencyStop_button(), SIGNAL(clicked()), image_ctr_    , SLOT(restore_autofocus_settings()));
 
+  // live view: frames of the continuous capture go to the image view only
+  connect(image_ctr_, SIGNAL(frame_acquired(cv::Mat)), image_view_, SLOT(update_image(cv::Mat)));
+
+  ApplicationConfig* config = ApplicationConfig::instance();
+
+  if((config != nullptr) && config->getValue<bool>("camera_streaming", false))
+  {
+    image_ctr_->enable_streaming();
+  }
+
   NQLog("AssemblyMainWindow", NQLog::Message) << "connect_images"
      << ": enabled images in application view(s)";
 
@@ -584,6 +611,11 @@ void AssemblyMainWindow::disconnect_images()
 
   disconnect(image_view_->autofocus_button(), SIGNAL(clicked()), image_ctr_, SLOT(acquire_autofocused_image()));
 
+  // streaming is stopped first: the view receives the copy of the last frame (release_frame), and gives back the buffer of the camera
+  image_ctr_->disable_streaming();
+
+  disconnect(image_ctr_, SIGNAL(frame_acquired(cv::Mat)), image_view_, SLOT(update_image(cv::Mat)));
+
   NQLog("AssemblyMainWindow", NQLog::Message) << "disconnect_images"
      << ": disabled images in application view(s)";
 
@@ -738,7 +770,10 @@ void AssemblyMainWindow::start_multiPickupTest(const AssemblyMultiPickupTester::
   // measurement
   connect(multipickup_tester_, SIGNAL(measurement_request()), image_ctr_, SLOT(acquire_image()));
 
+  connect(image_ctr_, SIGNAL(image_acquired()), multipickup_tester_, SLOT(acquired_measurement()));
+
   connect(finder_, SIGNAL(updated_image_master()), finder_view_->PatRec_exe_button(), SLOT(click()));
+  connect(finder_, SIGNAL(PatRec_results(double, double, double)), multipickup_tester_, SLOT(update_PatRec_results(double, double, double)));
   connect(finder_, SIGNAL(PatRec_exitcode(int)), multipickup_tester_, SLOT(finish_measurement(int)));
   // ---
 
@@ -764,7 +799,10 @@ void AssemblyMainWindow::disconnect_multiPickupTest()
   // measurement
   disconnect(multipickup_tester_, SIGNAL(measurement_request()), image_ctr_, SLOT(acquire_image()));
 
+  disconnect(image_ctr_, SIGNAL(image_acquired()), multipickup_tester_, SLOT(acquired_measurement()));
+
   disconnect(finder_, SIGNAL(updated_image_master()), finder_view_->PatRec_exe_button(), SLOT(click()));
+  disconnect(finder_, SIGNAL(PatRec_results(double, double, double)), multipickup_tester_, SLOT(update_PatRec_results(double, double, double)));
   disconnect(finder_, SIGNAL(PatRec_exitcode(int)), multipickup_tester_, SLOT(finish_measurement(int)));
   // ---
 
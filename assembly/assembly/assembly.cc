@@ -17,6 +17,7 @@
 
 #include <AssemblyMainWindow.h>
 #include <AssemblyUtilities.h>
+#include <AssemblyArtifactWriter.h>
 
 #include <string>
 
@@ -93,6 +94,11 @@ int main(int argc, char** argv)
 
     mainWindow.show();
 
-    return app.exec();
+    const int app_exit_code = app.exec();
+
+    // write pending debug artifacts while their sources still exist
+    AssemblyArtifactWriter::instance()->flush();
+
+    return app_exit_code;
     // ----------------------
 }
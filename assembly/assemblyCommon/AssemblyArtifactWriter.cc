@@ -0,0 +1,226 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <nqlogger.h>
+#include <ApplicationConfig.h>
+
+#include <AssemblyArtifactWriter.h>
+#include <AssemblyUtilities.h>
+
+#include <algorithm>
+
+AssemblyArtifactWriter* AssemblyArtifactWriter::instance()
+{
+  static AssemblyArtifactWriter writer;
+
+  return &writer;
+}
+
+AssemblyArtifactWriter::AssemblyArtifactWriter() :
+  level_(Summary),
+  queue_size_(32),
+  busy_(0),
+  dropped_(0),
+  stop_(false)
+{
+  int N_threads(2);
+
+  ApplicationConfig* config = ApplicationConfig::instance();
+  if(config != nullptr)
+  {
+    level_      = Level(std::max(int(Off), std::min(int(Full), config->getValue<int>("AssemblyArtifactWriter_level", int(Summary)))));
+    queue_size_ = std::max(1, config->getValue<int>("AssemblyArtifactWriter_queueSize", 32));
+    N_threads   = std::max(1, config->getValue<int>("AssemblyArtifactWriter_threads"  ,  2));
+  }
+  else
+  {
+    NQLog("AssemblyArtifactWriter", NQLog::Warning) << "initialization"
+       << ": ApplicationConfig::instance() not initialized (null pointer), using default settings";
+  }
+
+  for(int i=0; i<N_threads; ++i)
+  {
+    workers_.emplace_back(&AssemblyArtifactWriter::run, this);
+  }
+
+  NQLog("AssemblyArtifactWriter", NQLog::Debug) << "constructed"
+     << " (level=" << int(level_) << ", queue size=" << queue_size_ << ", threads=" << N_threads << ")";
+}
+
+//
+// pending artifacts are written before the workers are stopped
+//
+AssemblyArtifactWriter::~AssemblyArtifactWriter()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    stop_ = true;
+  }
+
+  queue_cond_.notify_all();
+
+  for(auto& i_worker : workers_)
+  {
+    if(i_worker.joinable()){ i_worker.join(); }
+  }
+}
+
+//
+// the image is copied, so the caller can reuse its buffer right away
+//
+void AssemblyArtifactWriter::write_image(const Level lvl, const std::string& path, const cv::Mat& img)
+{
+  if(this->enabled(lvl) == false){ return; }
+
+  const cv::Mat img_copy = img.clone();
+
+  Item item;
+  item.level_ = lvl;
+  item.name_  = path;
+  item.job_   = [path, img_copy](){ assembly::cv_imwrite(path, img_copy); };
+  item.plot_  = false;
+
+  this->enqueue(std::move(item));
+}
+
+//
+// "job" draws and saves the plot; it must only capture copies of the data to be plotted
+//
+void AssemblyArtifactWriter::write_plot(const Level lvl, const std::string& name, const std::function<void()>& job, QObject* receiver, const char* method)
+{
+  if(this->enabled(lvl) == false){ return; }
+
+  Item item;
+  item.level_ = lvl;
+  item.name_  = name;
+  item.job_   = job;
+  item.plot_  = true;
+
+  if((receiver != nullptr) && (method != nullptr))
+  {
+    item.receiver_ = receiver;
+    item.method_   = method;
+  }
+
+  this->enqueue(std::move(item));
+}
+
+void AssemblyArtifactWriter::enqueue(Item&& item)
+{
+  std::string dropped_name("");
+  unsigned long dropped_count(0);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if(queue_.size() >= queue_size_)
+    {
+      // drop the oldest intermediate artifact, or the oldest summary artifact not shown in the GUI;
+      // if all the queued artifacts are shown in the GUI, the queue exceeds its size
+      auto it_drop = std::find_if(queue_.begin(), queue_.end(), [](const Item& i_item){ return (i_item.level_ == Full); });
+
+      if(it_drop == queue_.end())
+      {
+        it_drop = std::find_if(queue_.begin(), queue_.end(), [](const Item& i_item){ return i_item.method_.empty(); });
+      }
+
+      if(it_drop != queue_.end())
+      {
+        dropped_name  = it_drop->name_;
+        dropped_count = ++dropped_;
+
+        queue_.erase(it_drop);
+      }
+    }
+
+    queue_.emplace_back(std::move(item));
+  }
+
+  queue_cond_.notify_one();
+
+  if(dropped_count > 0)
+  {
+    NQLog("AssemblyArtifactWriter", ((dropped_count == 1) ? NQLog::Warning : NQLog::Spam)) << "enqueue"
+       << ": queue full, dropped artifact " << dropped_name << " (" << dropped_count << " dropped in total)";
+  }
+}
+
+void AssemblyArtifactWriter::flush()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  idle_cond_.wait(lock, [this](){ return (queue_.empty() && (busy_ == 0)); });
+}
+
+unsigned long AssemblyArtifactWriter::dropped() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  return dropped_;
+}
+
+void AssemblyArtifactWriter::run()
+{
+  while(true)
+  {
+    Item item;
+
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+
+      queue_cond_.wait(lock, [this](){ return (stop_ || (queue_.empty() == false)); });
+
+      if(queue_.empty()){ return; }
+
+      item = std::move(queue_.front());
+      queue_.pop_front();
+
+      ++busy_;
+    }
+
+    if(item.plot_)
+    {
+      std::lock_guard<std::mutex> plot_lock(plot_mutex_);
+
+      item.job_();
+    }
+    else
+    {
+      item.job_();
+    }
+
+    // the receiver may have been destroyed meanwhile (e.g. artifacts written at exit)
+    if(item.method_.empty() == false)
+    {
+      QObject* const receiver = item.receiver_.data();
+
+      if(receiver != nullptr)
+      {
+        QMetaObject::invokeMethod(receiver, item.method_.c_str(), Qt::QueuedConnection, Q_ARG(QString, QString::fromStdString(item.name_)));
+      }
+      else
+      {
+        NQLog("AssemblyArtifactWriter", NQLog::Spam) << "run"
+           << ": receiver of " << item.name_ << " no longer exists, not notified";
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+
+      --busy_;
+    }
+
+    idle_cond_.notify_all();
+  }
+}
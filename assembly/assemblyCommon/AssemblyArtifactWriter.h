@@ -0,0 +1,112 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ASSEMBLYARTIFACTWRITER_H
+#define ASSEMBLYARTIFACTWRITER_H
+
+/*  Description:
+ *   Background writer for the debug artifacts (images and plots) of the vision routines:
+ *    - artifacts are queued and written (incl. PNG encoding) by worker threads,
+ *      so that the vision routines do not wait for the disk
+ *    - the queue is bounded: when it is full, the oldest artifact is dropped
+ *      (intermediate artifacts first, then summary artifacts);
+ *      plots shown in the GUI (with a receiver of their path) are never dropped
+ *    - the path of a plot is passed to its receiver (queued, in the thread of the receiver) once the plot is written,
+ *      and only if the receiver still exists
+ *    - the level of detail (off / summary / full) is set in the application configuration
+ */
+
+#include <string>
+#include <deque>
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <QObject>
+#include <QPointer>
+
+#include <opencv2/opencv.hpp>
+
+class AssemblyArtifactWriter
+{
+ public:
+
+  enum Level {
+    Off     = 0, // no artifacts
+    Summary = 1, // results of each routine (e.g. PatRec result image, FOM plot, best-focus image)
+    Full    = 2  // all intermediate images (e.g. rotated master images of PatRec, images of every z-focus step)
+  };
+
+  static AssemblyArtifactWriter* instance();
+
+  virtual ~AssemblyArtifactWriter();
+
+  Level level() const { return level_; }
+
+  bool enabled(const Level lvl) const { return ((level_ != Off) && (lvl <= level_)); }
+
+  void write_image(const Level, const std::string&, const cv::Mat&);
+
+  // receiver/method: slot taking the path of the plot (QString), invoked once the plot is written
+  void write_plot(const Level, const std::string&, const std::function<void()>&, QObject* receiver=nullptr, const char* method=nullptr);
+
+  void flush();
+
+  unsigned long dropped() const;
+
+ protected:
+
+  explicit AssemblyArtifactWriter();
+
+  class Item {
+
+   public:
+    Level                 level_;
+    std::string           name_;
+    std::function<void()> job_;
+    bool                  plot_;
+
+    QPointer<QObject>     receiver_;
+    std::string           method_;
+  };
+
+  void enqueue(Item&&);
+
+  void run();
+
+  Level level_;
+
+  unsigned int queue_size_;
+
+  std::deque<Item> queue_;
+
+  std::vector<std::thread> workers_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable queue_cond_;
+  std::condition_variable idle_cond_;
+
+  // ROOT graphics is not thread-safe: plots are produced one at a time
+  std::mutex plot_mutex_;
+
+  unsigned int busy_;
+  unsigned long dropped_;
+  bool stop_;
+
+ private:
+  AssemblyArtifactWriter(const AssemblyArtifactWriter&) = delete;
+  AssemblyArtifactWriter& operator=(const AssemblyArtifactWriter&) = delete;
+};
+
+#endif // ASSEMBLYARTIFACTWRITER_H
@@ -36,12 +36,50 @@ AssemblyAssembly::AssemblyAssembly(const LStepExpressMotionManager* const motion
 
  , use_smartMove_(false)
  , in_action_(false)
+ , vacuum_in_action_(false)
+
+ , step_graph_(nullptr)
 
  , PSSPlusSpacersToMaPSAPosition_isRegistered_(false)
  , PSSPlusSpacersToMaPSAPosition_X_(0.)
  , PSSPlusSpacersToMaPSAPosition_Y_(0.)
  , PSSPlusSpacersToMaPSAPosition_Z_(0.)
  , PSSPlusSpacersToMaPSAPosition_A_(0.)
+
+ , param_CameraFocusOnAssemblyStage_Z_                         (AssemblyParameters::handle("CameraFocusOnAssemblyStage_Z"))
+ , param_CameraFocusOnGluingStage_Z_                           (AssemblyParameters::handle("CameraFocusOnGluingStage_Z"))
+ , param_Depth_SpacerSlots_                                    (AssemblyParameters::handle("Depth_SpacerSlots"))
+ , param_FromCameraBestFocusToPickupHeight_dZ_                 (AssemblyParameters::handle("FromCameraBestFocusToPickupHeight_dZ"))
+ , param_FromPSPEdgeToPSPRefPoint_dX_                          (AssemblyParameters::handle("FromPSPEdgeToPSPRefPoint_dX"))
+ , param_FromPSPEdgeToPSPRefPoint_dY_                          (AssemblyParameters::handle("FromPSPEdgeToPSPRefPoint_dY"))
+ , param_FromPSPRefPointToPSSRefPoint_dX_                      (AssemblyParameters::handle("FromPSPRefPointToPSSRefPoint_dX"))
+ , param_FromPSPRefPointToPSSRefPoint_dY_                      (AssemblyParameters::handle("FromPSPRefPointToPSSRefPoint_dY"))
+ , param_FromPSSPlusSpacersToMaPSAPositionToGluingStage_dX_    (AssemblyParameters::handle("FromPSSPlusSpacersToMaPSAPositionToGluingStage_dX"))
+ , param_FromPSSPlusSpacersToMaPSAPositionToGluingStage_dY_    (AssemblyParameters::handle("FromPSSPlusSpacersToMaPSAPositionToGluingStage_dY"))
+ , param_FromPlatformRefPointCalibrationBaseplateToPSPEdge_dX_ (AssemblyParameters::handle("FromPlatformRefPointCalibrationBaseplateToPSPEdge_dX"))
+ , param_FromPlatformRefPointCalibrationBaseplateToPSPEdge_dY_ (AssemblyParameters::handle("FromPlatformRefPointCalibrationBaseplateToPSPEdge_dY"))
+ , param_FromPlatformRefPointCalibrationSpacersToSpacerEdge_dX_(AssemblyParameters::handle("FromPlatformRefPointCalibrationSpacersToSpacerEdge_dX"))
+ , param_FromPlatformRefPointCalibrationSpacersToSpacerEdge_dY_(AssemblyParameters::handle("FromPlatformRefPointCalibrationSpacersToSpacerEdge_dY"))
+ , param_FromSensorRefPointToSensorPickup_dX_                  (AssemblyParameters::handle("FromSensorRefPointToSensorPickup_dX"))
+ , param_FromSensorRefPointToSensorPickup_dY_                  (AssemblyParameters::handle("FromSensorRefPointToSensorPickup_dY"))
+ , param_FromSpacerEdgeToPSSRefPoint_dX_                       (AssemblyParameters::handle("FromSpacerEdgeToPSSRefPoint_dX"))
+ , param_FromSpacerEdgeToPSSRefPoint_dY_                       (AssemblyParameters::handle("FromSpacerEdgeToPSSRefPoint_dY"))
+ , param_PlatformRefPointCalibrationBaseplate_A_               (AssemblyParameters::handle("PlatformRefPointCalibrationBaseplate_A"))
+ , param_PlatformRefPointCalibrationBaseplate_X_               (AssemblyParameters::handle("PlatformRefPointCalibrationBaseplate_X"))
+ , param_PlatformRefPointCalibrationBaseplate_Y_               (AssemblyParameters::handle("PlatformRefPointCalibrationBaseplate_Y"))
+ , param_PlatformRefPointCalibrationSpacers_A_                 (AssemblyParameters::handle("PlatformRefPointCalibrationSpacers_A"))
+ , param_PlatformRefPointCalibrationSpacers_X_                 (AssemblyParameters::handle("PlatformRefPointCalibrationSpacers_X"))
+ , param_PlatformRefPointCalibrationSpacers_Y_                 (AssemblyParameters::handle("PlatformRefPointCalibrationSpacers_Y"))
+ , param_RefPointSensor_A_                                     (AssemblyParameters::handle("RefPointSensor_A"))
+ , param_RefPointSensor_X_                                     (AssemblyParameters::handle("RefPointSensor_X"))
+ , param_RefPointSensor_Y_                                     (AssemblyParameters::handle("RefPointSensor_Y"))
+ , param_RefPointSensor_Z_                                     (AssemblyParameters::handle("RefPointSensor_Z"))
+ , param_Thickness_Baseplate_                                  (AssemblyParameters::handle("Thickness_Baseplate"))
+ , param_Thickness_GlueLayer_                                  (AssemblyParameters::handle("Thickness_GlueLayer"))
+ , param_Thickness_MPA_                                        (AssemblyParameters::handle("Thickness_MPA"))
+ , param_Thickness_PSP_                                        (AssemblyParameters::handle("Thickness_PSP"))
+ , param_Thickness_PSS_                                        (AssemblyParameters::handle("Thickness_PSS"))
+ , param_Thickness_Spacer_                                     (AssemblyParameters::handle("Thickness_Spacer"))
 {
   // validate pointers to controllers
   this->motion();
@@ -65,6 +103,76 @@ AssemblyAssembly::AssemblyAssembly(const LStepExpressMotionManager* const motion
   // (1: PSs to Spacers, 2: PSs+Spacers to MaPSA)
   pickup1_Z_ = config->getValue<double>("AssemblyAssembly_pickup1_Z");
   pickup2_Z_ = config->getValue<double>("AssemblyAssembly_pickup2_Z");
+
+  step_graph_ = new AssemblyStepGraph(this);
+
+  // maximum duration of an automatic step of the graph (seconds, 0: no timeout)
+  step_graph_->set_step_timeout(config->getValue<double>("AssemblyStepGraph_stepTimeout", 600.));
+
+  this->build_step_graph();
+}
+
+//
+// PS module assembly as a graph of steps (same steps as in AssemblyAssemblyView):
+// motion steps share the "motion" resource (one motion at a time),
+// vacuum steps share the "vacuum" resource (ConradManager toggles one line at a time),
+// so a vacuum toggle runs concurrently with the motion steps that do not depend on it;
+// a step failing (step_failed) or exceeding the step timeout aborts the graph
+//
+void AssemblyAssembly::build_step_graph()
+{
+  AssemblyStepGraph* const g = step_graph_;
+
+  const QStringList motion({"motion"});
+  const QStringList vacuum({"vacuum"});
+
+  // [1] PS-s Alignment and Pickup
+  g->add_manual_step("PlacePSS", "Place PS-s on Assembly Platform", {});
+  g->add_step("EnableVacuumPSS"             , this, SLOT(EnableVacuumBaseplate_start())       , SIGNAL(EnableVacuumBaseplate_finished())       , {"PlacePSS"}, vacuum, SIGNAL(step_failed(QString)));
+  g->add_step("GoToSensorMarkerPreAlignment", this, SLOT(GoToSensorMarkerPreAlignment_start()), SIGNAL(GoToSensorMarkerPreAlignment_finished()), {"PlacePSS"}, motion, SIGNAL(step_failed(QString)));
+  g->add_manual_step("AlignPSS", "Align PS-s to Motion Stage (Go to \"Alignment\" Tab)", {"EnableVacuumPSS", "GoToSensorMarkerPreAlignment"}, {"motion", "camera"});
+  g->add_step("GoFromSensorMarkerToPickupXY", this, SLOT(GoFromSensorMarkerToPickupXY_start()), SIGNAL(GoFromSensorMarkerToPickupXY_finished()), {"AlignPSS"}, motion, SIGNAL(step_failed(QString)));
+  g->add_step("LowerPickupToolOntoPSS"      , this, SLOT(LowerPickupToolOntoPSS_start())      , SIGNAL(LowerPickupToolOntoPSS_finished())      , {"GoFromSensorMarkerToPickupXY"}, motion, SIGNAL(step_failed(QString)));
+  g->add_step("EnableVacuumPickupTool"      , this, SLOT(EnableVacuumPickupTool_start())      , SIGNAL(EnableVacuumPickupTool_finished())      , {"LowerPickupToolOntoPSS"}, vacuum, SIGNAL(step_failed(QString)));
+  g->add_step("DisableVacuumPSS"            , this, SLOT(DisableVacuumBaseplate_start())      , SIGNAL(DisableVacuumBaseplate_finished())      , {"EnableVacuumPickupTool"}, vacuum, SIGNAL(step_failed(QString)));
+  g->add_step("PickupPSS"                   , this, SLOT(PickupPSS_start())                   , SIGNAL(PickupPSS_finished())                   , {"DisableVacuumPSS"}, motion, SIGNAL(step_failed(QString)));
+
+  // [2] PS-s to Spacers
+  g->add_manual_step("PlaceSpacers", "Dispense Glue on Spacers and Place them on Assembly Platform", {"PickupPSS"});
+  g->add_step("GoToXYAPositionToGluePSSToSpacers", this, SLOT(GoToXYAPositionToGluePSSToSpacers_start()), SIGNAL(GoToXYAPositionToGluePSSToSpacers_finished()), {"PlaceSpacers"}, motion, SIGNAL(step_failed(QString)));
+  g->add_step("EnableVacuumSpacers"              , this, SLOT(EnableVacuumSpacers_start())              , SIGNAL(EnableVacuumSpacers_finished())              , {"PlaceSpacers"}, vacuum, SIGNAL(step_failed(QString)));
+  g->add_step("LowerPSSOntoSpacers"              , this, SLOT(LowerPSSOntoSpacers_start())              , SIGNAL(LowerPSSOntoSpacers_finished())              , {"GoToXYAPositionToGluePSSToSpacers", "EnableVacuumSpacers"}, motion, SIGNAL(step_failed(QString)));
+  g->add_manual_step("CurePSSToSpacers", "Wait for Glue To Cure (approx. 20 min)", {"LowerPSSOntoSpacers"});
+  g->add_step("DisableVacuumSpacers"             , this, SLOT(DisableVacuumSpacers_start())             , SIGNAL(DisableVacuumSpacers_finished())             , {"CurePSSToSpacers"}, vacuum, SIGNAL(step_failed(QString)));
+  g->add_step("PickupPSSPlusSpacers"             , this, SLOT(PickupPSSPlusSpacers_start())             , SIGNAL(PickupPSSPlusSpacers_finished())             , {"DisableVacuumSpacers"}, motion, SIGNAL(step_failed(QString)));
+
+  // [3] PS-s + Spacers to MaPSA
+  g->add_manual_step("PlaceMaPSA", "Place MaPSA on Assembly Platform", {"PickupPSSPlusSpacers"});
+  g->add_step("EnableVacuumMaPSA"                , this, SLOT(EnableVacuumBaseplate_start())       , SIGNAL(EnableVacuumBaseplate_finished())       , {"PlaceMaPSA"}, vacuum, SIGNAL(step_failed(QString)));
+  g->add_step("GoToSensorMarkerPreAlignment_PSP" , this, SLOT(GoToSensorMarkerPreAlignment_start()), SIGNAL(GoToSensorMarkerPreAlignment_finished()), {"PlaceMaPSA"}, motion, SIGNAL(step_failed(QString)));
+  g->add_manual_step("AlignPSP", "Align PS-p to Motion Stage (Go to \"Alignment\" Tab)", {"EnableVacuumMaPSA", "GoToSensorMarkerPreAlignment_PSP"}, {"motion", "camera"});
+  g->add_step("GoFromSensorMarkerToPickupXY_PSP" , this, SLOT(GoFromSensorMarkerToPickupXY_start()), SIGNAL(GoFromSensorMarkerToPickupXY_finished()), {"AlignPSP"}, motion, SIGNAL(step_failed(QString)));
+  g->add_step("ApplyPSPToPSSXYOffset"            , this, SLOT(ApplyPSPToPSSXYOffset_start())       , SIGNAL(ApplyPSPToPSSXYOffset_finished())       , {"GoFromSensorMarkerToPickupXY_PSP"}, motion, SIGNAL(step_failed(QString)));
+  g->add_step("RegisterPSSPlusSpacersToMaPSAPosition", this, SLOT(RegisterPSSPlusSpacersToMaPSAPosition_start()), SIGNAL(RegisterPSSPlusSpacersToMaPSAPosition_finished()), {"ApplyPSPToPSSXYOffset"}, motion, SIGNAL(step_failed(QString)));
+  g->add_step("GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY", this, SLOT(GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_start()), SIGNAL(GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_finished()), {"RegisterPSSPlusSpacersToMaPSAPosition"}, motion, SIGNAL(step_failed(QString)));
+  g->add_step("LowerPSSPlusSpacersOntoGluingStage"   , this, SLOT(LowerPSSPlusSpacersOntoGluingStage_start())   , SIGNAL(LowerPSSPlusSpacersOntoGluingStage_finished())   , {"GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY"}, motion, SIGNAL(step_failed(QString)));
+  g->add_step("ReturnToPSSPlusSpacersToMaPSAPosition", this, SLOT(ReturnToPSSPlusSpacersToMaPSAPosition_start()), SIGNAL(ReturnToPSSPlusSpacersToMaPSAPosition_finished()), {"LowerPSSPlusSpacersOntoGluingStage"}, motion, SIGNAL(step_failed(QString)));
+  g->add_step("LowerPSSPlusSpacersOntoMaPSA"         , this, SLOT(LowerPSSPlusSpacersOntoMaPSA_start())         , SIGNAL(LowerPSSPlusSpacersOntoMaPSA_finished())         , {"ReturnToPSSPlusSpacersToMaPSAPosition"}, motion, SIGNAL(step_failed(QString)));
+  g->add_manual_step("CurePSSPlusSpacersToMaPSA", "Wait for Glue To Cure (approx. 20 min)", {"LowerPSSPlusSpacersOntoMaPSA"});
+  g->add_step("DisableVacuumMaPSA"                   , this, SLOT(DisableVacuumBaseplate_start())               , SIGNAL(DisableVacuumBaseplate_finished())               , {"CurePSSPlusSpacersToMaPSA"}, vacuum, SIGNAL(step_failed(QString)));
+  g->add_step("PickupSensorAssembly"                 , this, SLOT(PickupSensorAssembly_start())                 , SIGNAL(PickupSensorAssembly_finished())                 , {"DisableVacuumMaPSA"}, motion, SIGNAL(step_failed(QString)));
+
+  // [4] Sensor Assembly to Baseplate
+  g->add_manual_step("PlaceBaseplate", "Dispense Glue on Baseplate and Place it on Assembly Platform", {"PickupSensorAssembly"});
+  g->add_step("EnableVacuumBaseplate"                         , this, SLOT(EnableVacuumBaseplate_start())                         , SIGNAL(EnableVacuumBaseplate_finished())                         , {"PlaceBaseplate"}, vacuum, SIGNAL(step_failed(QString)));
+  g->add_step("GoToXYAPositionToGlueSensorAssemblyToBaseplate", this, SLOT(GoToXYAPositionToGlueSensorAssemblyToBaseplate_start()), SIGNAL(GoToXYAPositionToGlueSensorAssemblyToBaseplate_finished()), {"PlaceBaseplate"}, motion, SIGNAL(step_failed(QString)));
+  g->add_step("LowerSensorAssemblyOntoBaseplate"              , this, SLOT(LowerSensorAssemblyOntoBaseplate_start())              , SIGNAL(LowerSensorAssemblyOntoBaseplate_finished())              , {"EnableVacuumBaseplate", "GoToXYAPositionToGlueSensorAssemblyToBaseplate"}, motion, SIGNAL(step_failed(QString)));
+  g->add_manual_step("CureSensorAssemblyToBaseplate", "Wait for Glue To Cure (approx. 20 min)", {"LowerSensorAssemblyOntoBaseplate"});
+  g->add_step("DisableVacuumPickupTool"                       , this, SLOT(DisableVacuumPickupTool_start())                       , SIGNAL(DisableVacuumPickupTool_finished())                       , {"CureSensorAssemblyToBaseplate"}, vacuum, SIGNAL(step_failed(QString)));
+  g->add_step("LiftUpPickupTool"                              , this, SLOT(LiftUpPickupTool_start())                              , SIGNAL(LiftUpPickupTool_finished())                              , {"DisableVacuumPickupTool"}, motion, SIGNAL(step_failed(QString)));
+  g->add_manual_step("RemovePins", "Remove Pins from Baseplate", {"LiftUpPickupTool"});
+  g->add_step("DisableVacuumBaseplate"                        , this, SLOT(DisableVacuumBaseplate_start())                        , SIGNAL(DisableVacuumBaseplate_finished())                        , {"RemovePins"}, vacuum, SIGNAL(step_failed(QString)));
+  g->add_manual_step("RemoveModule", "Remove PS Module from Assembly Platform", {"DisableVacuumBaseplate"});
 }
 
 const LStepExpressMotionManager* AssemblyAssembly::motion() const
@@ -154,6 +262,11 @@ void AssemblyAssembly::GoToSensorMarkerPreAlignment_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "GoToSensorMarkerPreAlignment_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "GoToSensorMarkerPreAlignment_start"
+       << ": emitting signal \"step_failed(GoToSensorMarkerPreAlignment_start)\"";
+
+    emit step_failed("GoToSensorMarkerPreAlignment_start");
+
     return;
   }
 
@@ -164,6 +277,11 @@ void AssemblyAssembly::GoToSensorMarkerPreAlignment_start()
     NQLog("AssemblyAssembly", NQLog::Critical) << "GoToSensorMarkerPreAlignment_start"
        << ": failed to update content of AssemblyParameters, no action taken";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "GoToSensorMarkerPreAlignment_start"
+       << ": emitting signal \"step_failed(GoToSensorMarkerPreAlignment_start)\"";
+
+    emit step_failed("GoToSensorMarkerPreAlignment_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "GoToSensorMarkerPreAlignment_finish"
        << ": emitting signal \"GoToSensorMarkerPreAlignment_finished\"";
 
@@ -172,10 +290,12 @@ void AssemblyAssembly::GoToSensorMarkerPreAlignment_start()
     return;
   }
 
-  const double x0 = this->parameters()->get("RefPointSensor_X");
-  const double y0 = this->parameters()->get("RefPointSensor_Y");
-  const double z0 = this->parameters()->get("RefPointSensor_Z");
-  const double a0 = this->parameters()->get("RefPointSensor_A");
+  const std::shared_ptr<const AssemblyParameters::Snapshot> params = this->parameters()->snapshot();
+
+  const double x0 = params->get(param_RefPointSensor_X_);
+  const double y0 = params->get(param_RefPointSensor_Y_);
+  const double z0 = params->get(param_RefPointSensor_Z_);
+  const double a0 = params->get(param_RefPointSensor_A_);
 
   connect(this, SIGNAL(move_absolute_request(double, double, double, double)), motion_, SLOT(moveAbsolute(double, double, double, double)));
   connect(motion_, SIGNAL(motion_finished()), this, SLOT(GoToSensorMarkerPreAlignment_finish()));
@@ -210,11 +330,16 @@ void AssemblyAssembly::GoToSensorMarkerPreAlignment_finish()
 // ----------------------------------------------------------------------------------------------------
 void AssemblyAssembly::EnableVacuumPickupTool_start()
 {
-  if(in_action_){
+  if(vacuum_in_action_){
 
     NQLog("AssemblyAssembly", NQLog::Warning) << "EnableVacuumPickupTool_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "EnableVacuumPickupTool_start"
+       << ": emitting signal \"step_failed(EnableVacuumPickupTool_start)\"";
+
+    emit step_failed("EnableVacuumPickupTool_start");
+
     return;
   }
 
@@ -224,7 +349,7 @@ void AssemblyAssembly::EnableVacuumPickupTool_start()
   connect(this->vacuum(), SIGNAL(vacuum_toggled()), this, SLOT(EnableVacuumPickupTool_finish()));
   connect(this->vacuum(), SIGNAL(vacuum_error  ()), this, SLOT(EnableVacuumPickupTool_finish()));
 
-  in_action_ = true;
+  vacuum_in_action_ = true;
 
   NQLog("AssemblyAssembly", NQLog::Spam) << "EnableVacuumPickupTool_start"
      << ": emitting signal \"vacuum_ON_request(" << vacuum_pickup_ << ")\"";
@@ -240,7 +365,7 @@ void AssemblyAssembly::EnableVacuumPickupTool_finish()
   disconnect(this->vacuum(), SIGNAL(vacuum_toggled()), this, SLOT(EnableVacuumPickupTool_finish()));
   disconnect(this->vacuum(), SIGNAL(vacuum_error  ()), this, SLOT(EnableVacuumPickupTool_finish()));
 
-  if(in_action_){ in_action_ = false; }
+  if(vacuum_in_action_){ vacuum_in_action_ = false; }
 
   NQLog("AssemblyAssembly", NQLog::Spam) << "EnableVacuumPickupTool_finish"
      << ": emitting signal \"EnableVacuumPickupTool_finished\"";
@@ -257,11 +382,16 @@ void AssemblyAssembly::EnableVacuumPickupTool_finish()
 // ----------------------------------------------------------------------------------------------------
 void AssemblyAssembly::DisableVacuumPickupTool_start()
 {
-  if(in_action_){
+  if(vacuum_in_action_){
 
     NQLog("AssemblyAssembly", NQLog::Warning) << "DisableVacuumPickupTool_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "DisableVacuumPickupTool_start"
+       << ": emitting signal \"step_failed(DisableVacuumPickupTool_start)\"";
+
+    emit step_failed("DisableVacuumPickupTool_start");
+
     return;
   }
 
@@ -271,7 +401,7 @@ void AssemblyAssembly::DisableVacuumPickupTool_start()
   connect(this->vacuum(), SIGNAL(vacuum_toggled ()), this, SLOT(DisableVacuumPickupTool_finish()));
   connect(this->vacuum(), SIGNAL(vacuum_error   ()), this, SLOT(DisableVacuumPickupTool_finish()));
 
-  in_action_ = true;
+  vacuum_in_action_ = true;
 
   NQLog("AssemblyAssembly", NQLog::Spam) << "DisableVacuumPickupTool_start"
      << ": emitting signal \"vacuum_OFF_request(" << vacuum_pickup_ << ")\"";
@@ -287,7 +417,7 @@ void AssemblyAssembly::DisableVacuumPickupTool_finish()
   disconnect(this->vacuum(), SIGNAL(vacuum_toggled ()), this, SLOT(DisableVacuumPickupTool_finish()));
   disconnect(this->vacuum(), SIGNAL(vacuum_error   ()), this, SLOT(DisableVacuumPickupTool_finish()));
 
-  if(in_action_){ in_action_ = false; }
+  if(vacuum_in_action_){ vacuum_in_action_ = false; }
 
   NQLog("AssemblyAssembly", NQLog::Spam) << "DisableVacuumPickupTool_finish"
      << ": emitting signal \"DisableVacuumPickupTool_finished\"";
@@ -304,11 +434,16 @@ void AssemblyAssembly::DisableVacuumPickupTool_finish()
 // ----------------------------------------------------------------------------------------------------
 void AssemblyAssembly::EnableVacuumSpacers_start()
 {
-  if(in_action_){
+  if(vacuum_in_action_){
 
     NQLog("AssemblyAssembly", NQLog::Warning) << "EnableVacuumSpacers_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "EnableVacuumSpacers_start"
+       << ": emitting signal \"step_failed(EnableVacuumSpacers_start)\"";
+
+    emit step_failed("EnableVacuumSpacers_start");
+
     return;
   }
 
@@ -318,7 +453,7 @@ void AssemblyAssembly::EnableVacuumSpacers_start()
   connect(this->vacuum(), SIGNAL(vacuum_toggled()), this, SLOT(EnableVacuumSpacers_finish()));
   connect(this->vacuum(), SIGNAL(vacuum_error  ()), this, SLOT(EnableVacuumSpacers_finish()));
 
-  in_action_ = true;
+  vacuum_in_action_ = true;
 
   NQLog("AssemblyAssembly", NQLog::Spam) << "EnableVacuumSpacers_start"
      << ": emitting signal \"vacuum_ON_request(" << vacuum_spacer_ << ")\"";
@@ -334,7 +469,7 @@ void AssemblyAssembly::EnableVacuumSpacers_finish()
   disconnect(this->vacuum(), SIGNAL(vacuum_toggled()), this, SLOT(EnableVacuumSpacers_finish()));
   disconnect(this->vacuum(), SIGNAL(vacuum_error  ()), this, SLOT(EnableVacuumSpacers_finish()));
 
-  if(in_action_){ in_action_ = false; }
+  if(vacuum_in_action_){ vacuum_in_action_ = false; }
 
   NQLog("AssemblyAssembly", NQLog::Spam) << "EnableVacuumSpacers_finish"
      << ": emitting signal \"EnableVacuumSpacers_finished\"";
@@ -351,11 +486,16 @@ void AssemblyAssembly::EnableVacuumSpacers_finish()
 // ----------------------------------------------------------------------------------------------------
 void AssemblyAssembly::DisableVacuumSpacers_start()
 {
-  if(in_action_){
+  if(vacuum_in_action_){
 
     NQLog("AssemblyAssembly", NQLog::Warning) << "DisableVacuumSpacers_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "DisableVacuumSpacers_start"
+       << ": emitting signal \"step_failed(DisableVacuumSpacers_start)\"";
+
+    emit step_failed("DisableVacuumSpacers_start");
+
     return;
   }
 
@@ -365,7 +505,7 @@ void AssemblyAssembly::DisableVacuumSpacers_start()
   connect(this->vacuum(), SIGNAL(vacuum_toggled ()), this, SLOT(DisableVacuumSpacers_finish()));
   connect(this->vacuum(), SIGNAL(vacuum_error   ()), this, SLOT(DisableVacuumSpacers_finish()));
 
-  in_action_ = true;
+  vacuum_in_action_ = true;
 
   NQLog("AssemblyAssembly", NQLog::Spam) << "DisableVacuumSpacers_start"
      << ": emitting signal \"vacuum_OFF_request(" << vacuum_spacer_ << ")\"";
@@ -381,7 +521,7 @@ void AssemblyAssembly::DisableVacuumSpacers_finish()
   disconnect(this->vacuum(), SIGNAL(vacuum_toggled ()), this, SLOT(DisableVacuumSpacers_finish()));
   disconnect(this->vacuum(), SIGNAL(vacuum_error   ()), this, SLOT(DisableVacuumSpacers_finish()));
 
-  if(in_action_){ in_action_ = false; }
+  if(vacuum_in_action_){ vacuum_in_action_ = false; }
 
   NQLog("AssemblyAssembly", NQLog::Spam) << "DisableVacuumSpacers_finish"
      << ": emitting signal \"DisableVacuumSpacers_finished\"";
@@ -398,11 +538,16 @@ void AssemblyAssembly::DisableVacuumSpacers_finish()
 // ----------------------------------------------------------------------------------------------------
 void AssemblyAssembly::EnableVacuumBaseplate_start()
 {
-  if(in_action_){
+  if(vacuum_in_action_){
 
     NQLog("AssemblyAssembly", NQLog::Warning) << "EnableVacuumBaseplate_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "EnableVacuumBaseplate_start"
+       << ": emitting signal \"step_failed(EnableVacuumBaseplate_start)\"";
+
+    emit step_failed("EnableVacuumBaseplate_start");
+
     return;
   }
 
@@ -412,7 +557,7 @@ void AssemblyAssembly::EnableVacuumBaseplate_start()
   connect(this->vacuum(), SIGNAL(vacuum_toggled()), this, SLOT(EnableVacuumBaseplate_finish()));
   connect(this->vacuum(), SIGNAL(vacuum_error  ()), this, SLOT(EnableVacuumBaseplate_finish()));
 
-  in_action_ = true;
+  vacuum_in_action_ = true;
 
   NQLog("AssemblyAssembly", NQLog::Spam) << "EnableVacuumBaseplate_start"
      << ": emitting signal \"vacuum_ON_request(" << vacuum_basepl_ << ")\"";
@@ -428,7 +573,7 @@ void AssemblyAssembly::EnableVacuumBaseplate_finish()
   disconnect(this->vacuum(), SIGNAL(vacuum_toggled()), this, SLOT(EnableVacuumBaseplate_finish()));
   disconnect(this->vacuum(), SIGNAL(vacuum_error  ()), this, SLOT(EnableVacuumBaseplate_finish()));
 
-  if(in_action_){ in_action_ = false; }
+  if(vacuum_in_action_){ vacuum_in_action_ = false; }
 
   NQLog("AssemblyAssembly", NQLog::Spam) << "EnableVacuumBaseplate_finish"
      << ": emitting signal \"EnableVacuumBaseplate_finished\"";
@@ -445,11 +590,16 @@ void AssemblyAssembly::EnableVacuumBaseplate_finish()
 // ----------------------------------------------------------------------------------------------------
 void AssemblyAssembly::DisableVacuumBaseplate_start()
 {
-  if(in_action_){
+  if(vacuum_in_action_){
 
     NQLog("AssemblyAssembly", NQLog::Warning) << "DisableVacuumBaseplate_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "DisableVacuumBaseplate_start"
+       << ": emitting signal \"step_failed(DisableVacuumBaseplate_start)\"";
+
+    emit step_failed("DisableVacuumBaseplate_start");
+
     return;
   }
 
@@ -459,7 +609,7 @@ void AssemblyAssembly::DisableVacuumBaseplate_start()
   connect(this->vacuum(), SIGNAL(vacuum_toggled ()), this, SLOT(DisableVacuumBaseplate_finish()));
   connect(this->vacuum(), SIGNAL(vacuum_error   ()), this, SLOT(DisableVacuumBaseplate_finish()));
 
-  in_action_ = true;
+  vacuum_in_action_ = true;
 
   NQLog("AssemblyAssembly", NQLog::Spam) << "DisableVacuumBaseplate_start"
      << ": emitting signal \"vacuum_OFF_request(" << vacuum_basepl_ << ")\"";
@@ -475,7 +625,7 @@ void AssemblyAssembly::DisableVacuumBaseplate_finish()
   disconnect(this->vacuum(), SIGNAL(vacuum_toggled ()), this, SLOT(DisableVacuumBaseplate_finish()));
   disconnect(this->vacuum(), SIGNAL(vacuum_error   ()), this, SLOT(DisableVacuumBaseplate_finish()));
 
-  if(in_action_){ in_action_ = false; }
+  if(vacuum_in_action_){ vacuum_in_action_ = false; }
 
   NQLog("AssemblyAssembly", NQLog::Spam) << "DisableVacuumBaseplate_finish"
      << ": emitting signal \"DisableVacuumBaseplate_finished\"";
@@ -497,6 +647,11 @@ void AssemblyAssembly::GoFromSensorMarkerToPickupXY_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "GoFromSensorMarkerToPickupXY_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "GoFromSensorMarkerToPickupXY_start"
+       << ": emitting signal \"step_failed(GoFromSensorMarkerToPickupXY_start)\"";
+
+    emit step_failed("GoFromSensorMarkerToPickupXY_start");
+
     return;
   }
 
@@ -507,6 +662,11 @@ void AssemblyAssembly::GoFromSensorMarkerToPickupXY_start()
     NQLog("AssemblyAssembly", NQLog::Critical) << "GoFromSensorMarkerToPickupXY_start"
        << ": failed to update content of AssemblyParameters, no action taken";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "GoFromSensorMarkerToPickupXY_start"
+       << ": emitting signal \"step_failed(GoFromSensorMarkerToPickupXY_start)\"";
+
+    emit step_failed("GoFromSensorMarkerToPickupXY_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "GoFromSensorMarkerToPickupXY_finish"
        << ": emitting signal \"GoFromSensorMarkerToPickupXY_finished\"";
 
@@ -515,8 +675,10 @@ void AssemblyAssembly::GoFromSensorMarkerToPickupXY_start()
     return;
   }
 
-  const double dx0 = this->parameters()->get("FromSensorRefPointToSensorPickup_dX");
-  const double dy0 = this->parameters()->get("FromSensorRefPointToSensorPickup_dY");
+  const std::shared_ptr<const AssemblyParameters::Snapshot> params = this->parameters()->snapshot();
+
+  const double dx0 = params->get(param_FromSensorRefPointToSensorPickup_dX_);
+  const double dy0 = params->get(param_FromSensorRefPointToSensorPickup_dY_);
   const double dz0 = 0.0;
   const double da0 = 0.0;
 
@@ -558,6 +720,11 @@ void AssemblyAssembly::LowerPickupToolOntoPSS_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "LowerPickupToolOntoPSS_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPickupToolOntoPSS_start"
+       << ": emitting signal \"step_failed(LowerPickupToolOntoPSS_start)\"";
+
+    emit step_failed("LowerPickupToolOntoPSS_start");
+
     return;
   }
 
@@ -570,6 +737,11 @@ void AssemblyAssembly::LowerPickupToolOntoPSS_start()
       NQLog("AssemblyAssembly", NQLog::Critical) << "LowerPickupToolOntoPSS_start"
          << ": failed to update content of AssemblyParameters, no action taken";
 
+      NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPickupToolOntoPSS_start"
+         << ": emitting signal \"step_failed(LowerPickupToolOntoPSS_start)\"";
+
+      emit step_failed("LowerPickupToolOntoPSS_start");
+
       NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPickupToolOntoPSS_finish"
          << ": emitting signal \"LowerPickupToolOntoPSS_finished\"";
 
@@ -578,9 +750,11 @@ void AssemblyAssembly::LowerPickupToolOntoPSS_start()
       return;
     }
 
+    const std::shared_ptr<const AssemblyParameters::Snapshot> params = this->parameters()->snapshot();
+
     const double dx0 = 0.0;
     const double dy0 = 0.0;
-    const double dz0 = this->parameters()->get("FromCameraBestFocusToPickupHeight_dZ");
+    const double dz0 = params->get(param_FromCameraBestFocusToPickupHeight_dZ_);
     const double da0 = 0.0;
 
     connect(this, SIGNAL(move_relative_request(double, double, double, double)), smart_motion_, SLOT(move_relative(double, double, double, double)));
@@ -602,6 +776,11 @@ void AssemblyAssembly::LowerPickupToolOntoPSS_start()
     msgBox.setText(tr("AssemblyAssembly::LowerPickupToolOntoPSS_start -- please enable \"smartMove\" mode (tick box in top-left corner of Assembly tab), required for this step"));
     msgBox.exec();
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPickupToolOntoPSS_start"
+       << ": emitting signal \"step_failed(LowerPickupToolOntoPSS_start)\"";
+
+    emit step_failed("LowerPickupToolOntoPSS_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPickupToolOntoPSS_finish"
        << ": emitting signal \"LowerPickupToolOntoPSS_finished\"";
 
@@ -638,6 +817,11 @@ void AssemblyAssembly::PickupPSS_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "PickupPSS_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "PickupPSS_start"
+       << ": emitting signal \"step_failed(PickupPSS_start)\"";
+
+    emit step_failed("PickupPSS_start");
+
     return;
   }
 
@@ -651,6 +835,11 @@ void AssemblyAssembly::PickupPSS_start()
     NQLog("AssemblyAssembly", NQLog::Critical) << "PickupPSS_start"
        << ": invalid (non-positive) value for vertical upward movement for pickup #1 (dz=" << dz0 << "), no action taken";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "PickupPSS_start"
+       << ": emitting signal \"step_failed(PickupPSS_start)\"";
+
+    emit step_failed("PickupPSS_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "PickupPSS_finish"
        << ": emitting signal \"PickupPSS_finished\"";
 
@@ -697,6 +886,11 @@ void AssemblyAssembly::GoToXYAPositionToGluePSSToSpacers_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "GoToXYAPositionToGluePSSToSpacers_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "GoToXYAPositionToGluePSSToSpacers_start"
+       << ": emitting signal \"step_failed(GoToXYAPositionToGluePSSToSpacers_start)\"";
+
+    emit step_failed("GoToXYAPositionToGluePSSToSpacers_start");
+
     return;
   }
 
@@ -707,6 +901,11 @@ void AssemblyAssembly::GoToXYAPositionToGluePSSToSpacers_start()
     NQLog("AssemblyAssembly", NQLog::Critical) << "GoToXYAPositionToGluePSSToSpacers_start"
        << ": failed to update content of AssemblyParameters, no action taken";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "GoToXYAPositionToGluePSSToSpacers_start"
+       << ": emitting signal \"step_failed(GoToXYAPositionToGluePSSToSpacers_start)\"";
+
+    emit step_failed("GoToXYAPositionToGluePSSToSpacers_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "GoToXYAPositionToGluePSSToSpacers_finish"
        << ": emitting signal \"GoToXYAPositionToGluePSSToSpacers_finished\"";
 
@@ -715,24 +914,26 @@ void AssemblyAssembly::GoToXYAPositionToGluePSSToSpacers_start()
     return;
   }
 
+  const std::shared_ptr<const AssemblyParameters::Snapshot> params = this->parameters()->snapshot();
+
   const double dx0 =
-     this->parameters()->get("PlatformRefPointCalibrationSpacers_X")
-   + this->parameters()->get("FromPlatformRefPointCalibrationSpacersToSpacerEdge_dX")
-   + this->parameters()->get("FromSpacerEdgeToPSSRefPoint_dX")
-   + this->parameters()->get("FromSensorRefPointToSensorPickup_dX")
+     params->get(param_PlatformRefPointCalibrationSpacers_X_)
+   + params->get(param_FromPlatformRefPointCalibrationSpacersToSpacerEdge_dX_)
+   + params->get(param_FromSpacerEdgeToPSSRefPoint_dX_)
+   + params->get(param_FromSensorRefPointToSensorPickup_dX_)
    - motion_->get_position_X();
 
   const double dy0 =
-     this->parameters()->get("PlatformRefPointCalibrationSpacers_Y")
-   + this->parameters()->get("FromPlatformRefPointCalibrationSpacersToSpacerEdge_dY")
-   + this->parameters()->get("FromSpacerEdgeToPSSRefPoint_dY")
-   + this->parameters()->get("FromSensorRefPointToSensorPickup_dY")
+     params->get(param_PlatformRefPointCalibrationSpacers_Y_)
+   + params->get(param_FromPlatformRefPointCalibrationSpacersToSpacerEdge_dY_)
+   + params->get(param_FromSpacerEdgeToPSSRefPoint_dY_)
+   + params->get(param_FromSensorRefPointToSensorPickup_dY_)
    - motion_->get_position_Y();
 
   const double dz0 = 0.0;
 
   const double da0 =
-     this->parameters()->get("PlatformRefPointCalibrationSpacers_A")
+     params->get(param_PlatformRefPointCalibrationSpacers_A_)
    - motion_->get_position_A();
 
   connect(this, SIGNAL(move_relative_request(double, double, double, double)), motion_, SLOT(moveRelative(double, double, double, double)));
@@ -773,6 +974,11 @@ void AssemblyAssembly::LowerPSSOntoSpacers_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "LowerPSSOntoSpacers_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPSSOntoSpacers_start"
+       << ": emitting signal \"step_failed(LowerPSSOntoSpacers_start)\"";
+
+    emit step_failed("LowerPSSOntoSpacers_start");
+
     return;
   }
 
@@ -785,6 +991,11 @@ void AssemblyAssembly::LowerPSSOntoSpacers_start()
       NQLog("AssemblyAssembly", NQLog::Critical) << "LowerPSSOntoSpacers_start"
          << ": failed to update content of AssemblyParameters, no action taken";
 
+      NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPSSOntoSpacers_start"
+         << ": emitting signal \"step_failed(LowerPSSOntoSpacers_start)\"";
+
+      emit step_failed("LowerPSSOntoSpacers_start");
+
       NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPSSOntoSpacers_finish"
          << ": emitting signal \"LowerPSSOntoSpacers_finished\"";
 
@@ -793,16 +1004,18 @@ void AssemblyAssembly::LowerPSSOntoSpacers_start()
       return;
     }
 
+    const std::shared_ptr<const AssemblyParameters::Snapshot> params = this->parameters()->snapshot();
+
     const double dx0 = 0.0;
     const double dy0 = 0.0;
 
     const double dz0 =
-        this->parameters()->get("CameraFocusOnAssemblyStage_Z")
-      - this->parameters()->get("Depth_SpacerSlots")
-      + this->parameters()->get("Thickness_Spacer")
-      + this->parameters()->get("FromCameraBestFocusToPickupHeight_dZ")
-      + this->parameters()->get("Thickness_PSS")
-      + this->parameters()->get("Thickness_GlueLayer")
+        params->get(param_CameraFocusOnAssemblyStage_Z_)
+      - params->get(param_Depth_SpacerSlots_)
+      + params->get(param_Thickness_Spacer_)
+      + params->get(param_FromCameraBestFocusToPickupHeight_dZ_)
+      + params->get(param_Thickness_PSS_)
+      + params->get(param_Thickness_GlueLayer_)
       - motion_->get_position_Z();
 
     const double da0 = 0.0;
@@ -826,6 +1039,11 @@ void AssemblyAssembly::LowerPSSOntoSpacers_start()
     msgBox.setText(tr("AssemblyAssembly::LowerPSSOntoSpacers_start -- please enable \"smartMove\" mode (tick box in top-left corner of Assembly tab), required for this step"));
     msgBox.exec();
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPSSOntoSpacers_start"
+       << ": emitting signal \"step_failed(LowerPSSOntoSpacers_start)\"";
+
+    emit step_failed("LowerPSSOntoSpacers_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPSSOntoSpacers_finish"
        << ": emitting signal \"LowerPSSOntoSpacers_finished\"";
 
@@ -862,6 +1080,11 @@ void AssemblyAssembly::ApplyPSPToPSSXYOffset_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "ApplyPSPToPSSXYOffset_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "ApplyPSPToPSSXYOffset_start"
+       << ": emitting signal \"step_failed(ApplyPSPToPSSXYOffset_start)\"";
+
+    emit step_failed("ApplyPSPToPSSXYOffset_start");
+
     return;
   }
 
@@ -872,6 +1095,11 @@ void AssemblyAssembly::ApplyPSPToPSSXYOffset_start()
     NQLog("AssemblyAssembly", NQLog::Critical) << "ApplyPSPToPSSXYOffset_start"
        << ": failed to update content of AssemblyParameters, no action taken";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "ApplyPSPToPSSXYOffset_start"
+       << ": emitting signal \"step_failed(ApplyPSPToPSSXYOffset_start)\"";
+
+    emit step_failed("ApplyPSPToPSSXYOffset_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "ApplyPSPToPSSXYOffset_finish"
        << ": emitting signal \"ApplyPSPToPSSXYOffset_finished\"";
 
@@ -880,8 +1108,10 @@ void AssemblyAssembly::ApplyPSPToPSSXYOffset_start()
     return;
   }
 
-  const double dx0 = this->parameters()->get("FromPSPRefPointToPSSRefPoint_dX");
-  const double dy0 = this->parameters()->get("FromPSPRefPointToPSSRefPoint_dY");
+  const std::shared_ptr<const AssemblyParameters::Snapshot> params = this->parameters()->snapshot();
+
+  const double dx0 = params->get(param_FromPSPRefPointToPSSRefPoint_dX_);
+  const double dy0 = params->get(param_FromPSPRefPointToPSSRefPoint_dY_);
   const double dz0 = 0.0;
   const double da0 = 0.0;
 
@@ -923,6 +1153,11 @@ void AssemblyAssembly::RegisterPSSPlusSpacersToMaPSAPosition_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "RegisterPSSPlusSpacersToMaPSAPosition_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "RegisterPSSPlusSpacersToMaPSAPosition_start"
+       << ": emitting signal \"step_failed(RegisterPSSPlusSpacersToMaPSAPosition_start)\"";
+
+    emit step_failed("RegisterPSSPlusSpacersToMaPSAPosition_start");
+
     return;
   }
 
@@ -973,6 +1208,11 @@ void AssemblyAssembly::GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointX
     NQLog("AssemblyAssembly", NQLog::Warning) << "GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_start"
+       << ": emitting signal \"step_failed(GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_start)\"";
+
+    emit step_failed("GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_start");
+
     return;
   }
 
@@ -985,6 +1225,11 @@ void AssemblyAssembly::GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointX
       NQLog("AssemblyAssembly", NQLog::Critical) << "GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_start"
          << ": failed to update content of AssemblyParameters, no action taken";
 
+      NQLog("AssemblyAssembly", NQLog::Spam) << "GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_start"
+         << ": emitting signal \"step_failed(GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_start)\"";
+
+      emit step_failed("GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_start");
+
       NQLog("AssemblyAssembly", NQLog::Spam) << "GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_finish"
          << ": emitting signal \"GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_finished\"";
 
@@ -993,8 +1238,10 @@ void AssemblyAssembly::GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointX
       return;
     }
 
-    const double dx0 = this->parameters()->get("FromPSSPlusSpacersToMaPSAPositionToGluingStage_dX");
-    const double dy0 = this->parameters()->get("FromPSSPlusSpacersToMaPSAPositionToGluingStage_dY");
+    const std::shared_ptr<const AssemblyParameters::Snapshot> params = this->parameters()->snapshot();
+
+    const double dx0 = params->get(param_FromPSSPlusSpacersToMaPSAPositionToGluingStage_dX_);
+    const double dy0 = params->get(param_FromPSSPlusSpacersToMaPSAPositionToGluingStage_dY_);
     const double dz0 = 0.0;
     const double da0 = 0.0;
 
@@ -1017,6 +1264,11 @@ void AssemblyAssembly::GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointX
     msgBox.setText(tr("AssemblyAssembly::GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_start -- please enable \"smartMove\" mode (tick box in top-left corner of Assembly tab), required for this step"));
     msgBox.exec();
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_start"
+       << ": emitting signal \"step_failed(GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_start)\"";
+
+    emit step_failed("GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_finish"
        << ": emitting signal \"GoFromPSSPlusSpacersToMaPSAPositionToGluingStageRefPointXY_finished\"";
 
@@ -1053,6 +1305,11 @@ void AssemblyAssembly::LowerPSSPlusSpacersOntoGluingStage_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "LowerPSSPlusSpacersOntoGluingStage_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPSSPlusSpacersOntoGluingStage_start"
+       << ": emitting signal \"step_failed(LowerPSSPlusSpacersOntoGluingStage_start)\"";
+
+    emit step_failed("LowerPSSPlusSpacersOntoGluingStage_start");
+
     return;
   }
 
@@ -1065,6 +1322,11 @@ void AssemblyAssembly::LowerPSSPlusSpacersOntoGluingStage_start()
       NQLog("AssemblyAssembly", NQLog::Critical) << "LowerPSSPlusSpacersOntoGluingStage_start"
          << ": failed to update content of AssemblyParameters, no action taken";
 
+      NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPSSPlusSpacersOntoGluingStage_start"
+         << ": emitting signal \"step_failed(LowerPSSPlusSpacersOntoGluingStage_start)\"";
+
+      emit step_failed("LowerPSSPlusSpacersOntoGluingStage_start");
+
       NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPSSPlusSpacersOntoGluingStage_finish"
          << ": emitting signal \"LowerPSSPlusSpacersOntoGluingStage_finished\"";
 
@@ -1073,16 +1335,18 @@ void AssemblyAssembly::LowerPSSPlusSpacersOntoGluingStage_start()
       return;
     }
 
+    const std::shared_ptr<const AssemblyParameters::Snapshot> params = this->parameters()->snapshot();
+
     const double dx0 = 0.0;
     const double dy0 = 0.0;
 
     const double dz0 =
-        this->parameters()->get("CameraFocusOnGluingStage_Z")
-      + this->parameters()->get("FromCameraBestFocusToPickupHeight_dZ")
-      + this->parameters()->get("Thickness_PSS")
-      + this->parameters()->get("Thickness_GlueLayer")
-      + this->parameters()->get("Thickness_Spacer")
-      + this->parameters()->get("Thickness_GlueLayer")
+        params->get(param_CameraFocusOnGluingStage_Z_)
+      + params->get(param_FromCameraBestFocusToPickupHeight_dZ_)
+      + params->get(param_Thickness_PSS_)
+      + params->get(param_Thickness_GlueLayer_)
+      + params->get(param_Thickness_Spacer_)
+      + params->get(param_Thickness_GlueLayer_)
       - motion_->get_position_Z();
 
     const double da0 = 0.0;
@@ -1106,6 +1370,11 @@ void AssemblyAssembly::LowerPSSPlusSpacersOntoGluingStage_start()
     msgBox.setText(tr("AssemblyAssembly::LowerPSSPlusSpacersOntoGluingStage_start -- please enable \"smartMove\" mode (tick box in top-left corner of Assembly tab), required for this step"));
     msgBox.exec();
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPSSPlusSpacersOntoGluingStage_start"
+       << ": emitting signal \"step_failed(LowerPSSPlusSpacersOntoGluingStage_start)\"";
+
+    emit step_failed("LowerPSSPlusSpacersOntoGluingStage_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPSSPlusSpacersOntoGluingStage_finish"
        << ": emitting signal \"LowerPSSPlusSpacersOntoGluingStage_finished\"";
 
@@ -1142,6 +1411,11 @@ void AssemblyAssembly::ReturnToPSSPlusSpacersToMaPSAPosition_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "ReturnToPSSPlusSpacersToMaPSAPosition_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "ReturnToPSSPlusSpacersToMaPSAPosition_start"
+       << ": emitting signal \"step_failed(ReturnToPSSPlusSpacersToMaPSAPosition_start)\"";
+
+    emit step_failed("ReturnToPSSPlusSpacersToMaPSAPosition_start");
+
     return;
   }
 
@@ -1154,6 +1428,11 @@ void AssemblyAssembly::ReturnToPSSPlusSpacersToMaPSAPosition_start()
     msgBox.setText(tr("AssemblyAssembly::ReturnToPSSPlusSpacersToMaPSAPosition_start -- \"PSS+Spacers To MaPSA\" position not registered, but mandatory for this step (see button in \"Assembly\" tab)"));
     msgBox.exec();
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "ReturnToPSSPlusSpacersToMaPSAPosition_start"
+       << ": emitting signal \"step_failed(ReturnToPSSPlusSpacersToMaPSAPosition_start)\"";
+
+    emit step_failed("ReturnToPSSPlusSpacersToMaPSAPosition_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "ReturnToPSSPlusSpacersToMaPSAPosition_finish"
        << ": emitting signal \"ReturnToPSSPlusSpacersToMaPSAPosition_finished\"";
 
@@ -1174,6 +1453,11 @@ void AssemblyAssembly::ReturnToPSSPlusSpacersToMaPSAPosition_start()
       NQLog("AssemblyAssembly", NQLog::Critical) << "ReturnToPSSPlusSpacersToMaPSAPosition_start"
          << ": invalid (non-positive) value for vertical upward movement (dz=" << dz0 << "), no action taken";
 
+      NQLog("AssemblyAssembly", NQLog::Spam) << "ReturnToPSSPlusSpacersToMaPSAPosition_start"
+         << ": emitting signal \"step_failed(ReturnToPSSPlusSpacersToMaPSAPosition_start)\"";
+
+      emit step_failed("ReturnToPSSPlusSpacersToMaPSAPosition_start");
+
       NQLog("AssemblyAssembly", NQLog::Spam) << "ReturnToPSSPlusSpacersToMaPSAPosition_finish"
          << ": emitting signal \"ReturnToPSSPlusSpacersToMaPSAPosition_finished\"";
 
@@ -1201,6 +1485,11 @@ void AssemblyAssembly::ReturnToPSSPlusSpacersToMaPSAPosition_start()
     msgBox.setText(tr("AssemblyAssembly::ReturnToPSSPlusSpacersToMaPSAPosition_start -- please enable \"smartMove\" mode (tick box in top-left corner of Assembly tab), required for this step"));
     msgBox.exec();
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "ReturnToPSSPlusSpacersToMaPSAPosition_start"
+       << ": emitting signal \"step_failed(ReturnToPSSPlusSpacersToMaPSAPosition_start)\"";
+
+    emit step_failed("ReturnToPSSPlusSpacersToMaPSAPosition_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "ReturnToPSSPlusSpacersToMaPSAPosition_finish"
        << ": emitting signal \"ReturnToPSSPlusSpacersToMaPSAPosition_finished\"";
 
@@ -1237,6 +1526,11 @@ void AssemblyAssembly::LowerPSSPlusSpacersOntoMaPSA_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "LowerPSSPlusSpacersOntoMaPSA_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPSSPlusSpacersOntoMaPSA_start"
+       << ": emitting signal \"step_failed(LowerPSSPlusSpacersOntoMaPSA_start)\"";
+
+    emit step_failed("LowerPSSPlusSpacersOntoMaPSA_start");
+
     return;
   }
 
@@ -1249,6 +1543,11 @@ void AssemblyAssembly::LowerPSSPlusSpacersOntoMaPSA_start()
       NQLog("AssemblyAssembly", NQLog::Critical) << "LowerPSSPlusSpacersOntoMaPSA_start"
          << ": failed to update content of AssemblyParameters, no action taken";
 
+      NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPSSPlusSpacersOntoMaPSA_start"
+         << ": emitting signal \"step_failed(LowerPSSPlusSpacersOntoMaPSA_start)\"";
+
+      emit step_failed("LowerPSSPlusSpacersOntoMaPSA_start");
+
       NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPSSPlusSpacersOntoMaPSA_finish"
          << ": emitting signal \"LowerPSSPlusSpacersOntoMaPSA_finished\"";
 
@@ -1257,16 +1556,18 @@ void AssemblyAssembly::LowerPSSPlusSpacersOntoMaPSA_start()
       return;
     }
 
+    const std::shared_ptr<const AssemblyParameters::Snapshot> params = this->parameters()->snapshot();
+
     const double dx0 = 0.0;
     const double dy0 = 0.0;
 
     const double dz0 =
-        this->parameters()->get("FromCameraBestFocusToPickupHeight_dZ")
-      + this->parameters()->get("Thickness_PSS")
-      + this->parameters()->get("Thickness_GlueLayer")
-      + this->parameters()->get("Thickness_Spacer")
-      + this->parameters()->get("Thickness_GlueLayer")
-      + this->parameters()->get("Thickness_MPA");
+        params->get(param_FromCameraBestFocusToPickupHeight_dZ_)
+      + params->get(param_Thickness_PSS_)
+      + params->get(param_Thickness_GlueLayer_)
+      + params->get(param_Thickness_Spacer_)
+      + params->get(param_Thickness_GlueLayer_)
+      + params->get(param_Thickness_MPA_);
 
     const double da0 = 0.0;
 
@@ -1289,6 +1590,11 @@ void AssemblyAssembly::LowerPSSPlusSpacersOntoMaPSA_start()
     msgBox.setText(tr("AssemblyAssembly::LowerPSSPlusSpacersOntoMaPSA_start -- please enable \"smartMove\" mode (tick box in top-left corner of Assembly tab), required for this step"));
     msgBox.exec();
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPSSPlusSpacersOntoMaPSA_start"
+       << ": emitting signal \"step_failed(LowerPSSPlusSpacersOntoMaPSA_start)\"";
+
+    emit step_failed("LowerPSSPlusSpacersOntoMaPSA_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "LowerPSSPlusSpacersOntoMaPSA_finish"
        << ": emitting signal \"LowerPSSPlusSpacersOntoMaPSA_finished\"";
 
@@ -1325,6 +1631,11 @@ void AssemblyAssembly::PickupPSSPlusSpacers_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "PickupPSSPlusSpacers_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "PickupPSSPlusSpacers_start"
+       << ": emitting signal \"step_failed(PickupPSSPlusSpacers_start)\"";
+
+    emit step_failed("PickupPSSPlusSpacers_start");
+
     return;
   }
 
@@ -1338,6 +1649,11 @@ void AssemblyAssembly::PickupPSSPlusSpacers_start()
     NQLog("AssemblyAssembly", NQLog::Critical) << "PickupPSSPlusSpacers_start"
        << ": invalid (non-positive) value for vertical upward movement for pickup #1 (dz=" << dz0 << "), no action taken";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "PickupPSSPlusSpacers_start"
+       << ": emitting signal \"step_failed(PickupPSSPlusSpacers_start)\"";
+
+    emit step_failed("PickupPSSPlusSpacers_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "PickupPSSPlusSpacers_finish"
        << ": emitting signal \"PickupPSSPlusSpacers_finished\"";
 
@@ -1384,6 +1700,11 @@ void AssemblyAssembly::LiftUpPickupTool_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "LiftUpPickupTool_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "LiftUpPickupTool_start"
+       << ": emitting signal \"step_failed(LiftUpPickupTool_start)\"";
+
+    emit step_failed("LiftUpPickupTool_start");
+
     return;
   }
 
@@ -1397,6 +1718,11 @@ void AssemblyAssembly::LiftUpPickupTool_start()
     NQLog("AssemblyAssembly", NQLog::Critical) << "LiftUpPickupTool_start"
        << ": invalid (non-positive) value for vertical upward movement for pickup #2 (dz=" << dz0 << "), no action taken";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "LiftUpPickupTool_start"
+       << ": emitting signal \"step_failed(LiftUpPickupTool_start)\"";
+
+    emit step_failed("LiftUpPickupTool_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "LiftUpPickupTool_finish"
        << ": emitting signal \"LiftUpPickupTool_finished\"";
 
@@ -1443,6 +1769,11 @@ void AssemblyAssembly::PickupSensorAssembly_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "PickupSensorAssembly_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "PickupSensorAssembly_start"
+       << ": emitting signal \"step_failed(PickupSensorAssembly_start)\"";
+
+    emit step_failed("PickupSensorAssembly_start");
+
     return;
   }
 
@@ -1456,6 +1787,11 @@ void AssemblyAssembly::PickupSensorAssembly_start()
     NQLog("AssemblyAssembly", NQLog::Critical) << "PickupSensorAssembly_start"
        << ": invalid (non-positive) value for vertical upward movement for pickup #1 (dz=" << dz0 << "), no action taken";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "PickupSensorAssembly_start"
+       << ": emitting signal \"step_failed(PickupSensorAssembly_start)\"";
+
+    emit step_failed("PickupSensorAssembly_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "PickupSensorAssembly_finish"
        << ": emitting signal \"PickupSensorAssembly_finished\"";
 
@@ -1502,6 +1838,11 @@ void AssemblyAssembly::GoToXYAPositionToGlueSensorAssemblyToBaseplate_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "GoToXYAPositionToGlueSensorAssemblyToBaseplate_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "GoToXYAPositionToGlueSensorAssemblyToBaseplate_start"
+       << ": emitting signal \"step_failed(GoToXYAPositionToGlueSensorAssemblyToBaseplate_start)\"";
+
+    emit step_failed("GoToXYAPositionToGlueSensorAssemblyToBaseplate_start");
+
     return;
   }
 
@@ -1512,6 +1853,11 @@ void AssemblyAssembly::GoToXYAPositionToGlueSensorAssemblyToBaseplate_start()
     NQLog("AssemblyAssembly", NQLog::Critical) << "GoToXYAPositionToGlueSensorAssemblyToBaseplate_start"
        << ": failed to update content of AssemblyParameters, no action taken";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "GoToXYAPositionToGlueSensorAssemblyToBaseplate_start"
+       << ": emitting signal \"step_failed(GoToXYAPositionToGlueSensorAssemblyToBaseplate_start)\"";
+
+    emit step_failed("GoToXYAPositionToGlueSensorAssemblyToBaseplate_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "GoToXYAPositionToGlueSensorAssemblyToBaseplate_finish"
        << ": emitting signal \"GoToXYAPositionToGlueSensorAssemblyToBaseplate_finished\"";
 
@@ -1520,26 +1866,28 @@ void AssemblyAssembly::GoToXYAPositionToGlueSensorAssemblyToBaseplate_start()
     return;
   }
 
+  const std::shared_ptr<const AssemblyParameters::Snapshot> params = this->parameters()->snapshot();
+
   const double dx0 =
-     this->parameters()->get("PlatformRefPointCalibrationBaseplate_X")
-   + this->parameters()->get("FromPlatformRefPointCalibrationBaseplateToPSPEdge_dX")
-   + this->parameters()->get("FromPSPEdgeToPSPRefPoint_dX")
-   + this->parameters()->get("FromPSPRefPointToPSSRefPoint_dX")
-   + this->parameters()->get("FromSensorRefPointToSensorPickup_dX")
+     params->get(param_PlatformRefPointCalibrationBaseplate_X_)
+   + params->get(param_FromPlatformRefPointCalibrationBaseplateToPSPEdge_dX_)
+   + params->get(param_FromPSPEdgeToPSPRefPoint_dX_)
+   + params->get(param_FromPSPRefPointToPSSRefPoint_dX_)
+   + params->get(param_FromSensorRefPointToSensorPickup_dX_)
    - motion_->get_position_X();
 
   const double dy0 =
-     this->parameters()->get("PlatformRefPointCalibrationBaseplate_Y")
-   + this->parameters()->get("FromPlatformRefPointCalibrationBaseplateToPSPEdge_dY")
-   + this->parameters()->get("FromPSPEdgeToPSPRefPoint_dY")
-   + this->parameters()->get("FromPSPRefPointToPSSRefPoint_dY")
-   + this->parameters()->get("FromSensorRefPointToSensorPickup_dY")
+     params->get(param_PlatformRefPointCalibrationBaseplate_Y_)
+   + params->get(param_FromPlatformRefPointCalibrationBaseplateToPSPEdge_dY_)
+   + params->get(param_FromPSPEdgeToPSPRefPoint_dY_)
+   + params->get(param_FromPSPRefPointToPSSRefPoint_dY_)
+   + params->get(param_FromSensorRefPointToSensorPickup_dY_)
    - motion_->get_position_Y();
 
   const double dz0 = 0.0;
 
   const double da0 =
-     this->parameters()->get("PlatformRefPointCalibrationBaseplate_A")
+     params->get(param_PlatformRefPointCalibrationBaseplate_A_)
    - motion_->get_position_A();
 
   connect(this, SIGNAL(move_relative_request(double, double, double, double)), motion_, SLOT(moveRelative(double, double, double, double)));
@@ -1580,6 +1928,11 @@ void AssemblyAssembly::LowerSensorAssemblyOntoBaseplate_start()
     NQLog("AssemblyAssembly", NQLog::Warning) << "LowerSensorAssemblyOntoBaseplate_start"
        << ": logic error, an assembly step is still in progress, will not take further action";
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "LowerSensorAssemblyOntoBaseplate_start"
+       << ": emitting signal \"step_failed(LowerSensorAssemblyOntoBaseplate_start)\"";
+
+    emit step_failed("LowerSensorAssemblyOntoBaseplate_start");
+
     return;
   }
 
@@ -1592,6 +1945,11 @@ void AssemblyAssembly::LowerSensorAssemblyOntoBaseplate_start()
       NQLog("AssemblyAssembly", NQLog::Critical) << "LowerSensorAssemblyOntoBaseplate_start"
          << ": failed to update content of AssemblyParameters, no action taken";
 
+      NQLog("AssemblyAssembly", NQLog::Spam) << "LowerSensorAssemblyOntoBaseplate_start"
+         << ": emitting signal \"step_failed(LowerSensorAssemblyOntoBaseplate_start)\"";
+
+      emit step_failed("LowerSensorAssemblyOntoBaseplate_start");
+
       NQLog("AssemblyAssembly", NQLog::Spam) << "LowerSensorAssemblyOntoBaseplate_finish"
          << ": emitting signal \"LowerSensorAssemblyOntoBaseplate_finished\"";
 
@@ -1600,20 +1958,22 @@ void AssemblyAssembly::LowerSensorAssemblyOntoBaseplate_start()
       return;
     }
 
+    const std::shared_ptr<const AssemblyParameters::Snapshot> params = this->parameters()->snapshot();
+
     const double dx0 = 0.0;
     const double dy0 = 0.0;
 
     const double dz0 =
-        this->parameters()->get("CameraFocusOnAssemblyStage_Z")
-      + this->parameters()->get("FromCameraBestFocusToPickupHeight_dZ")
-      + this->parameters()->get("Thickness_PSS")
-      + this->parameters()->get("Thickness_GlueLayer")
-      + this->parameters()->get("Thickness_Spacer")
-      + this->parameters()->get("Thickness_GlueLayer")
-      + this->parameters()->get("Thickness_MPA")
-      + this->parameters()->get("Thickness_PSP")
-      + this->parameters()->get("Thickness_GlueLayer")
-      + this->parameters()->get("Thickness_Baseplate")
+        params->get(param_CameraFocusOnAssemblyStage_Z_)
+      + params->get(param_FromCameraBestFocusToPickupHeight_dZ_)
+      + params->get(param_Thickness_PSS_)
+      + params->get(param_Thickness_GlueLayer_)
+      + params->get(param_Thickness_Spacer_)
+      + params->get(param_Thickness_GlueLayer_)
+      + params->get(param_Thickness_MPA_)
+      + params->get(param_Thickness_PSP_)
+      + params->get(param_Thickness_GlueLayer_)
+      + params->get(param_Thickness_Baseplate_)
       - motion_->get_position_Z();
 
     const double da0 = 0.0;
@@ -1637,6 +1997,11 @@ void AssemblyAssembly::LowerSensorAssemblyOntoBaseplate_start()
     msgBox.setText(tr("AssemblyAssembly::LowerSensorAssemblyOntoBaseplate_start -- please enable \"smartMove\" mode (tick box in top-left corner of Assembly tab), required for this step"));
     msgBox.exec();
 
+    NQLog("AssemblyAssembly", NQLog::Spam) << "LowerSensorAssemblyOntoBaseplate_start"
+       << ": emitting signal \"step_failed(LowerSensorAssemblyOntoBaseplate_start)\"";
+
+    emit step_failed("LowerSensorAssemblyOntoBaseplate_start");
+
     NQLog("AssemblyAssembly", NQLog::Spam) << "LowerSensorAssemblyOntoBaseplate_finish"
        << ": emitting signal \"LowerSensorAssemblyOntoBaseplate_finished\"";
 
@@ -20,6 +20,7 @@
 
 #include <AssemblySmartMotionManager.h>
 #include <AssemblyParameters.h>
+#include <AssemblyStepGraph.h>
 
 #include <vector>
 
@@ -38,6 +39,8 @@ class AssemblyAssembly : public QObject
 
   const AssemblySmartMotionManager* smart_motion() const;
 
+  AssemblyStepGraph* step_graph() const { return step_graph_; }
+
  protected:
 
   const LStepExpressMotionManager* const motion_;
@@ -53,7 +56,14 @@ class AssemblyAssembly : public QObject
   double pickup2_Z_;
 
   bool use_smartMove_;
+
+  // motion and vacuum steps are gated separately, so that they can run concurrently
   bool in_action_;
+  bool vacuum_in_action_;
+
+  AssemblyStepGraph* step_graph_;
+
+  void build_step_graph();
 
   bool   PSSPlusSpacersToMaPSAPosition_isRegistered_;
   double PSSPlusSpacersToMaPSAPosition_X_;
@@ -61,6 +71,42 @@ class AssemblyAssembly : public QObject
   double PSSPlusSpacersToMaPSAPosition_Z_;
   double PSSPlusSpacersToMaPSAPosition_A_;
 
+  // handles of the assembly parameters used by the assembly steps (read from one snapshot per step)
+  const AssemblyParameters::Handle param_CameraFocusOnAssemblyStage_Z_;
+  const AssemblyParameters::Handle param_CameraFocusOnGluingStage_Z_;
+  const AssemblyParameters::Handle param_Depth_SpacerSlots_;
+  const AssemblyParameters::Handle param_FromCameraBestFocusToPickupHeight_dZ_;
+  const AssemblyParameters::Handle param_FromPSPEdgeToPSPRefPoint_dX_;
+  const AssemblyParameters::Handle param_FromPSPEdgeToPSPRefPoint_dY_;
+  const AssemblyParameters::Handle param_FromPSPRefPointToPSSRefPoint_dX_;
+  const AssemblyParameters::Handle param_FromPSPRefPointToPSSRefPoint_dY_;
+  const AssemblyParameters::Handle param_FromPSSPlusSpacersToMaPSAPositionToGluingStage_dX_;
+  const AssemblyParameters::Handle param_FromPSSPlusSpacersToMaPSAPositionToGluingStage_dY_;
+  const AssemblyParameters::Handle param_FromPlatformRefPointCalibrationBaseplateToPSPEdge_dX_;
+  const AssemblyParameters::Handle param_FromPlatformRefPointCalibrationBaseplateToPSPEdge_dY_;
+  const AssemblyParameters::Handle param_FromPlatformRefPointCalibrationSpacersToSpacerEdge_dX_;
+  const AssemblyParameters::Handle param_FromPlatformRefPointCalibrationSpacersToSpacerEdge_dY_;
+  const AssemblyParameters::Handle param_FromSensorRefPointToSensorPickup_dX_;
+  const AssemblyParameters::Handle param_FromSensorRefPointToSensorPickup_dY_;
+  const AssemblyParameters::Handle param_FromSpacerEdgeToPSSRefPoint_dX_;
+  const AssemblyParameters::Handle param_FromSpacerEdgeToPSSRefPoint_dY_;
+  const AssemblyParameters::Handle param_PlatformRefPointCalibrationBaseplate_A_;
+  const AssemblyParameters::Handle param_PlatformRefPointCalibrationBaseplate_X_;
+  const AssemblyParameters::Handle param_PlatformRefPointCalibrationBaseplate_Y_;
+  const AssemblyParameters::Handle param_PlatformRefPointCalibrationSpacers_A_;
+  const AssemblyParameters::Handle param_PlatformRefPointCalibrationSpacers_X_;
+  const AssemblyParameters::Handle param_PlatformRefPointCalibrationSpacers_Y_;
+  const AssemblyParameters::Handle param_RefPointSensor_A_;
+  const AssemblyParameters::Handle param_RefPointSensor_X_;
+  const AssemblyParameters::Handle param_RefPointSensor_Y_;
+  const AssemblyParameters::Handle param_RefPointSensor_Z_;
+  const AssemblyParameters::Handle param_Thickness_Baseplate_;
+  const AssemblyParameters::Handle param_Thickness_GlueLayer_;
+  const AssemblyParameters::Handle param_Thickness_MPA_;
+  const AssemblyParameters::Handle param_Thickness_PSP_;
+  const AssemblyParameters::Handle param_Thickness_PSS_;
+  const AssemblyParameters::Handle param_Thickness_Spacer_;
+
  public slots:
 
   void use_smartMove(const int);
@@ -140,6 +186,9 @@ class AssemblyAssembly : public QObject
 
  signals:
 
+  // failure of a step (name of its start slot, e.g. "PickupPSS_start"): the step will not emit its finished signal
+  void step_failed(const QString&);
+
   // motion
   void move_absolute_request(const double, const double, const double, const double);
   void move_relative_request(const double, const double, const double, const double);
@@ -20,12 +20,17 @@
 #include <QHBoxLayout>
 #include <QToolBox>
 #include <QLabel>
+#include <QMessageBox>
 
 AssemblyAssemblyView::AssemblyAssemblyView(const AssemblyAssembly* const assembly, QWidget* parent)
  : QWidget(parent)
 
  , smartMove_checkbox_(nullptr)
 
+ , graph_start_button_(nullptr)
+ , graph_stop_button_(nullptr)
+ , graph_dryRun_checkbox_(nullptr)
+
  , wid_CalibRotStage_(nullptr)
  , wid_PSSAlignm_(nullptr)
  , wid_PSSToSpacers_(nullptr)
@@ -54,6 +59,41 @@ AssemblyAssemblyView::AssemblyAssemblyView(const AssemblyAssembly* const assembl
   connect(smartMove_checkbox_, SIGNAL(stateChanged(int)), assembly, SLOT(use_smartMove(int)));
 
   smartMove_checkbox_->setChecked(true);
+
+  // run of the whole sequence (AssemblyStepGraph): independent steps run concurrently
+  graph_start_button_ = new QPushButton(tr("Run Assembly Sequence"));
+  graph_stop_button_  = new QPushButton(tr("Stop Assembly Sequence"));
+  graph_stop_button_->setEnabled(false);
+
+  opts_lay->addWidget(graph_start_button_);
+  opts_lay->addWidget(graph_stop_button_);
+
+#ifdef USE_FAKEIO
+  // dry run (manual steps skipped, smartMove without confirmation): only with fake devices
+  graph_dryRun_checkbox_ = new QCheckBox(tr("Dry Run (skip manual steps)"));
+
+  opts_lay->addWidget(graph_dryRun_checkbox_);
+#endif
+
+  AssemblyStepGraph* const graph = assembly->step_graph();
+
+  connect(graph_start_button_, SIGNAL(clicked()), this, SLOT(start_step_graph()));
+  connect(graph_stop_button_ , SIGNAL(clicked()), graph, SLOT(stop()));
+
+  connect(this, SIGNAL(step_graph_start_request(bool)), graph, SLOT(start(bool)));
+  connect(this, SIGNAL(manual_step_confirmed(QString)), graph, SLOT(confirm_manual_step(QString)));
+
+  // queued: the operator is asked once the graph has started all the steps it can start
+  connect(graph, SIGNAL(manual_step_request(QString, QString)), this, SLOT(confirm_manual_step(QString, QString)), Qt::QueuedConnection);
+
+  connect(graph, SIGNAL(run_finished()), this, SLOT(finish_step_graph()));
+  connect(graph, SIGNAL(run_stopped ()), this, SLOT(finish_step_graph()));
+  connect(graph, SIGNAL(run_failed(QString, QString)), this, SLOT(abort_step_graph(QString, QString)));
+
+  if(assembly->smart_motion() != nullptr)
+  {
+    connect(this, SIGNAL(smartMove_confirmation_request(bool)), assembly->smart_motion(), SLOT(enable_confirmation(bool)));
+  }
   //// -------------------------------------------------
 
   QToolBox* toolbox = new QToolBox;
@@ -624,6 +664,69 @@ AssemblyAssemblyView::AssemblyAssemblyView(const AssemblyAssembly* const assembl
   //// -----------------------------------------------
 
 }
+
+void AssemblyAssemblyView::start_step_graph()
+{
+  const bool dry_run = (graph_dryRun_checkbox_ != nullptr) && graph_dryRun_checkbox_->isChecked();
+
+  if(dry_run)
+  {
+    // the lowering steps require smartMove; in a dry run, its fine steps are applied without confirmation
+    smartMove_checkbox_->setChecked(true);
+
+    NQLog("AssemblyAssemblyView", NQLog::Spam) << "start_step_graph"
+       << ": emitting signal \"smartMove_confirmation_request(0)\"";
+
+    emit smartMove_confirmation_request(false);
+  }
+
+  graph_start_button_->setEnabled(false);
+  graph_stop_button_ ->setEnabled(true);
+
+  if(graph_dryRun_checkbox_ != nullptr){ graph_dryRun_checkbox_->setEnabled(false); }
+
+  NQLog("AssemblyAssemblyView", NQLog::Spam) << "start_step_graph"
+     << ": emitting signal \"step_graph_start_request(" << dry_run << ")\"";
+
+  emit step_graph_start_request(dry_run);
+}
+
+void AssemblyAssemblyView::finish_step_graph()
+{
+  NQLog("AssemblyAssemblyView", NQLog::Spam) << "finish_step_graph"
+     << ": emitting signal \"smartMove_confirmation_request(1)\"";
+
+  emit smartMove_confirmation_request(true);
+
+  graph_start_button_->setEnabled(true);
+  graph_stop_button_ ->setEnabled(false);
+
+  if(graph_dryRun_checkbox_ != nullptr){ graph_dryRun_checkbox_->setEnabled(true); }
+}
+
+void AssemblyAssemblyView::abort_step_graph(const QString& name, const QString& reason)
+{
+  this->finish_step_graph();
+
+  QMessageBox msgBox;
+  msgBox.setIcon(QMessageBox::Critical);
+  msgBox.setText(tr("Assembly sequence aborted, step \"")+name+tr("\" failed: ")+reason);
+  msgBox.setInformativeText(tr("Check the log, restore a safe state of the setup and restart the sequence."));
+  msgBox.exec();
+}
+
+void AssemblyAssemblyView::confirm_manual_step(const QString& name, const QString& text)
+{
+  QMessageBox msgBox;
+  msgBox.setText(tr("Manual assembly step: ")+text);
+  msgBox.setInformativeText(tr("Click \"OK\" when the step is completed."));
+  msgBox.exec();
+
+  NQLog("AssemblyAssemblyView", NQLog::Spam) << "confirm_manual_step"
+     << ": emitting signal \"manual_step_confirmed(" << name.toStdString() << ")\"";
+
+  emit manual_step_confirmed(name);
+}
 // ====================================================================================================
 
 AssemblyAssemblyActionWidget::AssemblyAssemblyActionWidget(QWidget* parent)
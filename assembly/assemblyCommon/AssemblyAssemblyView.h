@@ -35,6 +35,10 @@ class AssemblyAssemblyView : public QWidget
 
   QCheckBox* smartMove_checkbox_;
 
+  QPushButton* graph_start_button_;
+  QPushButton* graph_stop_button_;
+  QCheckBox*   graph_dryRun_checkbox_;
+
   QWidget* wid_CalibRotStage_;
   QWidget* wid_PSSAlignm_;
   QWidget* wid_PSSToSpacers_;
@@ -42,6 +46,21 @@ class AssemblyAssemblyView : public QWidget
   QWidget* wid_PSToBasep_;
 
   uint assembly_step_N_;
+
+ public slots:
+
+  void start_step_graph();
+  void finish_step_graph();
+  void abort_step_graph(const QString&, const QString&);
+
+  void confirm_manual_step(const QString&, const QString&);
+
+ signals:
+
+  void step_graph_start_request(const bool);
+  void manual_step_confirmed(const QString&);
+
+  void smartMove_confirmation_request(const bool);
 };
 // ====================================================================================================
 
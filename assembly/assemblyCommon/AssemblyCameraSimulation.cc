@@ -0,0 +1,159 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#include <nqlogger.h>
+
+#include <AssemblyCameraSimulation.h>
+#include <AssemblyUtilities.h>
+
+#include <cmath>
+#include <algorithm>
+
+AssemblyCameraSimulation::Configuration::Configuration() :
+  mosaic_path(""),
+  mosaic_mm_per_pixel(0.0012),
+  mosaic_centerX(0.),
+  mosaic_centerY(0.),
+  width(2560),
+  height(1920),
+  mm_per_pixel_row(0.0012),
+  mm_per_pixel_col(0.0012),
+  camera_angle(0.),
+  rotation_centerX(0.),
+  rotation_centerY(0.),
+  focal_Z(0.),
+  blur_per_mm(200.),
+  blur_max(20.),
+  noise(2.)
+{
+}
+
+AssemblyCameraSimulation::AssemblyCameraSimulation(const Configuration& conf) :
+  configuration_(conf),
+  rng_(0x12345)
+{
+  if(configuration_.mosaic_path.empty() == false)
+  {
+    mosaic_ = assembly::cv_imread(configuration_.mosaic_path, CV_LOAD_IMAGE_GRAYSCALE);
+  }
+
+  if(mosaic_.empty() || (configuration_.mosaic_mm_per_pixel <= 0.) || (configuration_.mm_per_pixel_row <= 0.) || (configuration_.mm_per_pixel_col <= 0.))
+  {
+    NQLog("AssemblyCameraSimulation", NQLog::Critical) << "initialization error"
+       << ": invalid mosaic image (" << configuration_.mosaic_path << ") or pixel size, simulation disabled";
+
+    mosaic_ = cv::Mat();
+
+    return;
+  }
+
+  // the region outside the mosaic has the average gray level of the mosaic
+  fill_value_ = cv::mean(mosaic_);
+
+  NQLog("AssemblyCameraSimulation", NQLog::Message) << "initialization"
+     << ": mosaic " << configuration_.mosaic_path << " (" << mosaic_.cols << "x" << mosaic_.rows << " pixels)";
+}
+
+//
+// defocus blur: sigma [pixels] proportional to the distance from the focal plane
+//
+double AssemblyCameraSimulation::blur_sigma(const double z) const
+{
+  return std::min(configuration_.blur_max, configuration_.blur_per_mm * std::fabs(z - configuration_.focal_Z));
+}
+
+cv::Mat AssemblyCameraSimulation::render(const std::vector<double>& positions)
+{
+  if(positions.size() != 4){ return cv::Mat(); }
+
+  return this->render(positions.at(0), positions.at(1), positions.at(2), positions.at(3));
+}
+
+//
+// the image is computed with a single affine warp, from image pixels to mosaic pixels:
+//  (1) image pixel -> position in the camera frame [mm] (rows count downwards)
+//  (2) camera frame -> motion-stage frame (rotation by the camera angle), plus stage position (X, Y)
+//  (3) rotation by -A around the rotation center: position on the object at A=0
+//  (4) position on the object -> mosaic pixel
+//
+cv::Mat AssemblyCameraSimulation::render(const double x, const double y, const double z, const double a)
+{
+  if(this->ready() == false){ return cv::Mat(); }
+
+  const Configuration& conf = configuration_;
+
+  const cv::Matx33d T_img(
+    conf.mm_per_pixel_col, 0., -conf.mm_per_pixel_col * conf.width  / 2.,
+    0., -conf.mm_per_pixel_row, +conf.mm_per_pixel_row * conf.height / 2.,
+    0., 0., 1.
+  );
+
+  const double cos_cam = std::cos(conf.camera_angle * (M_PI/180.));
+  const double sin_cam = std::sin(conf.camera_angle * (M_PI/180.));
+
+  const cv::Matx33d T_stage(
+    cos_cam, -sin_cam, x,
+    sin_cam,  cos_cam, y,
+    0., 0., 1.
+  );
+
+  const double cos_a = std::cos(-a * (M_PI/180.));
+  const double sin_a = std::sin(-a * (M_PI/180.));
+
+  const double cx = conf.rotation_centerX;
+  const double cy = conf.rotation_centerY;
+
+  const cv::Matx33d T_rot(
+    cos_a, -sin_a, cx - (cos_a * cx) + (sin_a * cy),
+    sin_a,  cos_a, cy - (sin_a * cx) - (cos_a * cy),
+    0., 0., 1.
+  );
+
+  const cv::Matx33d T_mosaic(
+    1. / conf.mosaic_mm_per_pixel, 0., (mosaic_.cols / 2.) - (conf.mosaic_centerX / conf.mosaic_mm_per_pixel),
+    0., -1. / conf.mosaic_mm_per_pixel, (mosaic_.rows / 2.) + (conf.mosaic_centerY / conf.mosaic_mm_per_pixel),
+    0., 0., 1.
+  );
+
+  const cv::Matx33d T = T_mosaic * T_rot * T_stage * T_img;
+
+  const cv::Matx23d M(
+    T(0, 0), T(0, 1), T(0, 2),
+    T(1, 0), T(1, 1), T(1, 2)
+  );
+
+  cv::Mat img;
+  cv::warpAffine(mosaic_, img, cv::Mat(M), cv::Size(conf.width, conf.height), cv::INTER_LINEAR | cv::WARP_INVERSE_MAP, cv::BORDER_CONSTANT, fill_value_);
+
+  const double sigma = this->blur_sigma(z);
+
+  if(sigma > 0.3)
+  {
+    cv::GaussianBlur(img, img, cv::Size(0, 0), sigma);
+  }
+
+  if(conf.noise > 0.)
+  {
+    cv::Mat img_16s;
+    img.convertTo(img_16s, CV_16S);
+
+    cv::Mat noise(img.size(), CV_16S);
+    rng_.fill(noise, cv::RNG::NORMAL, 0., conf.noise);
+
+    img_16s += noise;
+
+    img_16s.convertTo(img, CV_8U);
+  }
+
+  return img;
+}
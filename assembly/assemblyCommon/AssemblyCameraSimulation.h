@@ -0,0 +1,86 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef ASSEMBLYCAMERASIMULATION_H
+#define ASSEMBLYCAMERASIMULATION_H
+
+/*  Description:
+ *   Simulated field of view of the camera, for tests of the vision routines without hardware:
+ *    - the image is cut out of a large mosaic of the object plane (synthetic or recorded image),
+ *      following the X/Y position (translation) and the A position (rotation around a fixed center) of the motion stage
+ *    - the distance of the Z position from the focal plane is modelled as a Gaussian blur
+ *    - Gaussian noise is added to every image
+ *   The conventions are the ones of AssemblyObjectFinderPatRec:
+ *   the camera frame is rotated by AngleOfCameraFrameInRefFrame_dA in the motion-stage frame,
+ *   and the image rows count downwards
+ */
+
+#include <string>
+#include <vector>
+
+#include <opencv2/opencv.hpp>
+
+class AssemblyCameraSimulation
+{
+ public:
+
+  class Configuration {
+
+   public:
+    explicit Configuration();
+    virtual ~Configuration() {}
+
+    std::string mosaic_path;
+    double mosaic_mm_per_pixel;
+    double mosaic_centerX; // motion-stage X [mm] of the mosaic center
+    double mosaic_centerY; // motion-stage Y [mm] of the mosaic center
+
+    int    width;
+    int    height;
+    double mm_per_pixel_row;
+    double mm_per_pixel_col;
+    double camera_angle;   // angle of the camera frame in the motion-stage frame [deg]
+
+    double rotation_centerX;
+    double rotation_centerY;
+
+    double focal_Z;        // Z position of the focal plane [mm]
+    double blur_per_mm;    // sigma of the defocus blur [pixels] per mm of distance from the focal plane
+    double blur_max;       // maximum sigma of the defocus blur [pixels]
+
+    double noise;          // sigma of the Gaussian noise [gray levels]
+  };
+
+  explicit AssemblyCameraSimulation(const Configuration&);
+  virtual ~AssemblyCameraSimulation() {}
+
+  const Configuration& configuration() const { return configuration_; }
+
+  bool ready() const { return (mosaic_.empty() == false); }
+
+  cv::Mat render(const double x, const double y, const double z, const double a);
+  cv::Mat render(const std::vector<double>&);
+
+  double blur_sigma(const double z) const;
+
+ protected:
+
+  Configuration configuration_;
+
+  cv::Mat mosaic_;
+  cv::Scalar fill_value_;
+
+  cv::RNG rng_;
+};
+
+#endif // ASSEMBLYCAMERASIMULATION_H
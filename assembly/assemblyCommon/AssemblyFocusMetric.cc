@@ -0,0 +1,184 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <AssemblyFocusMetric.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+AssemblyFocusMetric::AssemblyFocusMetric(const Method method, const double roi_fraction, const int downscale) :
+  method_(method),
+  roi_fraction_(std::max(0.01, std::min(1., roi_fraction))),
+  downscale_(std::max(1, downscale))
+{
+}
+
+std::string AssemblyFocusMetric::method_name(const Method method)
+{
+  switch(method)
+  {
+    case VarianceOfLaplacian: return "VarianceOfLaplacian";
+    case Tenengrad          : return "Tenengrad";
+    case NormalizedVariance : return "NormalizedVariance";
+  }
+
+  return "";
+}
+
+cv::Rect AssemblyFocusMetric::roi(const cv::Size& img_size) const
+{
+  const int w = std::max(1, int(std::lround(img_size.width  * roi_fraction_)));
+  const int h = std::max(1, int(std::lround(img_size.height * roi_fraction_)));
+
+  return cv::Rect((img_size.width - w) / 2, (img_size.height - h) / 2, w, h);
+}
+
+//
+// ROI of the image (no copy), converted to gray levels and downscaled if needed
+//
+cv::Mat AssemblyFocusMetric::prepared_image(const cv::Mat& img) const
+{
+  cv::Mat img_prep = img(this->roi(img.size()));
+
+  if(img_prep.channels() == 3)
+  {
+    cv::Mat img_gs;
+    cv::cvtColor(img_prep, img_gs, CV_BGR2GRAY);
+
+    img_prep = img_gs;
+  }
+
+  if(img_prep.depth() != CV_8U)
+  {
+    cv::Mat img_32f;
+    img_prep.convertTo(img_32f, CV_32F);
+
+    img_prep = img_32f;
+  }
+
+  if(downscale_ > 1)
+  {
+    cv::Mat img_ds;
+    cv::resize(img_prep, img_ds, cv::Size(), 1./downscale_, 1./downscale_, cv::INTER_AREA);
+
+    img_prep = img_ds;
+  }
+
+  return img_prep;
+}
+
+double AssemblyFocusMetric::value(const cv::Mat& img) const
+{
+  if(img.empty()){ return 0.; }
+
+  const cv::Mat img_prep = this->prepared_image(img);
+
+  switch(method_)
+  {
+    case VarianceOfLaplacian: return AssemblyFocusMetric::variance_of_laplacian(img_prep);
+    case Tenengrad          : return AssemblyFocusMetric::tenengrad            (img_prep);
+    case NormalizedVariance : return AssemblyFocusMetric::normalized_variance  (img_prep);
+  }
+
+  return 0.;
+}
+
+//
+// the Laplacian of an 8-bit image is within [-1020, 1020],
+// so it is computed exactly with 16-bit integers (same value as in double precision)
+// REF: https://docs.opencv.org/2.4/doc/tutorials/imgproc/imgtrans/laplace_operator/laplace_operator.html
+//
+double AssemblyFocusMetric::variance_of_laplacian(const cv::Mat& img)
+{
+  cv::Mat img_lap;
+  cv::Laplacian(img, img_lap, (img.depth() == CV_8U) ? CV_16S : CV_32F);
+
+  cv::Scalar mean, std_dev;
+  cv::meanStdDev(img_lap, mean, std_dev);
+
+  return (std_dev.val[0] * std_dev.val[0]);
+}
+
+double AssemblyFocusMetric::tenengrad(const cv::Mat& img)
+{
+  const int ddepth = (img.depth() == CV_8U) ? CV_16S : CV_32F;
+
+  cv::Mat img_dx, img_dy;
+  cv::Sobel(img, img_dx, ddepth, 1, 0);
+  cv::Sobel(img, img_dy, ddepth, 0, 1);
+
+  return (cv::norm(img_dx, cv::NORM_L2SQR) + cv::norm(img_dy, cv::NORM_L2SQR)) / double(img.total());
+}
+
+double AssemblyFocusMetric::normalized_variance(const cv::Mat& img)
+{
+  cv::Scalar mean, std_dev;
+  cv::meanStdDev(img, mean, std_dev);
+
+  return (mean.val[0] > 0.) ? ((std_dev.val[0] * std_dev.val[0]) / mean.val[0]) : 0.;
+}
+
+//
+// comparison of the focus discriminants on a z-stack (z-positions and images):
+// for every method, on the full image and on the ROI (at full and reduced resolution),
+// computing time per image, best-focus position and its distance to the reference
+// (variance of the Laplacian on the full image), and peak contrast (max/median of the discriminant)
+//
+void AssemblyFocusMetric::benchmark(std::ostream& out, const std::vector<double>& zposis, const std::vector<cv::Mat>& imgs, const double roi_fraction)
+{
+  const unsigned int N = std::min(zposis.size(), imgs.size());
+
+  if(N == 0){ return; }
+
+  typedef std::chrono::steady_clock clock;
+
+  const std::vector<Method> methods({VarianceOfLaplacian, Tenengrad, NormalizedVariance});
+
+  const std::vector<std::pair<double, int> > roi_settings({{1., 1}, {roi_fraction, 1}, {roi_fraction, 2}, {roi_fraction, 4}});
+
+  out << "# images=" << N << " size=" << imgs.at(0).cols << "x" << imgs.at(0).rows << "\n";
+  out << "# method roi_fraction downscale time_ms_per_image best_z delta_best_z_wrt_reference peak_contrast\n";
+
+  double zposi_best_ref(0.);
+
+  for(const auto& i_method : methods)
+  {
+    for(const auto& i_roi : roi_settings)
+    {
+      const AssemblyFocusMetric metric(i_method, i_roi.first, i_roi.second);
+
+      std::vector<double> values(N, 0.);
+
+      const clock::time_point t0 = clock::now();
+
+      for(unsigned int i=0; i<N; ++i){ values.at(i) = metric.value(imgs.at(i)); }
+
+      const double time_ms = std::chrono::duration<double, std::milli>(clock::now() - t0).count() / N;
+
+      const unsigned int idx_best = std::max_element(values.begin(), values.end()) - values.begin();
+
+      const double zposi_best = zposis.at(idx_best);
+
+      if((i_method == VarianceOfLaplacian) && (i_roi.first == 1.) && (i_roi.second == 1)){ zposi_best_ref = zposi_best; }
+
+      std::vector<double> values_sorted(values);
+      std::nth_element(values_sorted.begin(), values_sorted.begin() + N/2, values_sorted.end());
+
+      const double median = values_sorted.at(N/2);
+
+      out << AssemblyFocusMetric::method_name(i_method) << " " << metric.roi_fraction() << " " << metric.downscale()
+          << " " << time_ms << " " << zposi_best << " " << (zposi_best - zposi_best_ref)
+          << " " << ((median > 0.) ? (values.at(idx_best) / median) : 0.) << "\n";
+    }
+  }
+}
@@ -0,0 +1,68 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ASSEMBLYFOCUSMETRIC_H
+#define ASSEMBLYFOCUSMETRIC_H
+
+/*  Description:
+ *   Image-focus discriminants for the auto-focusing:
+ *    - variance of the Laplacian, Tenengrad (energy of the Sobel gradient), normalized gray-level variance
+ *    - computed on a region of interest centered on the image (fraction of the image size),
+ *      optionally on the ROI downscaled by an integer factor
+ *    - 8-bit images are processed with 16-bit integer kernels, other images in single precision
+ */
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include <opencv2/opencv.hpp>
+
+class AssemblyFocusMetric
+{
+ public:
+
+  enum Method {
+    VarianceOfLaplacian = 0,
+    Tenengrad           = 1,
+    NormalizedVariance  = 2
+  };
+
+  explicit AssemblyFocusMetric(const Method method=VarianceOfLaplacian, const double roi_fraction=1., const int downscale=1);
+  virtual ~AssemblyFocusMetric() {}
+
+  Method method()       const { return method_; }
+  double roi_fraction() const { return roi_fraction_; }
+  int    downscale()    const { return downscale_; }
+
+  static std::string method_name(const Method);
+
+  cv::Rect roi(const cv::Size&) const;
+
+  double value(const cv::Mat&) const;
+
+  static void benchmark(std::ostream&, const std::vector<double>&, const std::vector<cv::Mat>&, const double roi_fraction);
+
+ protected:
+
+  cv::Mat prepared_image(const cv::Mat&) const;
+
+  static double variance_of_laplacian(const cv::Mat&);
+  static double tenengrad            (const cv::Mat&);
+  static double normalized_variance  (const cv::Mat&);
+
+  Method method_;
+  double roi_fraction_;
+  int    downscale_;
+};
+
+#endif // ASSEMBLYFOCUSMETRIC_H
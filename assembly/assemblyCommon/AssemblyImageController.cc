@@ -21,7 +21,8 @@ AssemblyImageController::AssemblyImageController(const AssemblyVUEyeCamera* came
   zfocus_finder_(zfocus_finder),
   is_enabled_(false),
   autofocus_is_enabled_(false),
-  autofocus_to_be_disabled_(false)
+  autofocus_to_be_disabled_(false),
+  streaming_is_enabled_(false)
 {
   if(camera_manager_ == nullptr)
   {
@@ -48,6 +49,11 @@ AssemblyImageController::AssemblyImageController(const AssemblyVUEyeCamera* came
   connect(this           , SIGNAL(image())               , camera_manager_, SLOT(acquireImage()));
   connect(camera_manager_, SIGNAL(imageAcquired(cv::Mat)), this           , SLOT(retrieve_image(cv::Mat)));
 
+  connect(this           , SIGNAL(start_streaming()), camera_manager_, SLOT(startStreaming()));
+  connect(this           , SIGNAL(stop_streaming()) , camera_manager_, SLOT(stopStreaming()));
+
+  connect(camera_manager_, SIGNAL(streamingStopped()), this, SLOT(release_frame()));
+
   NQLog("AssemblyImageController", NQLog::Debug) << "constructed";
 }
 
@@ -69,6 +75,8 @@ void AssemblyImageController::disable()
 {
   is_enabled_ = false;
 
+  this->disable_streaming();
+
   NQLog("AssemblyImageController", NQLog::Spam) << "disable"
      << ": emitting signal \"close_camera\"";
 
@@ -194,3 +202,74 @@ void AssemblyImageController::restore_autofocus_settings()
 
   emit autofocused_image_acquired();
 }
+
+void AssemblyImageController::enable_streaming()
+{
+  if(streaming_is_enabled_){ return; }
+
+  connect(camera_manager_, SIGNAL(frameAvailable()), this, SLOT(retrieve_frame()));
+
+  streaming_is_enabled_ = true;
+
+  NQLog("AssemblyImageController", NQLog::Spam) << "enable_streaming"
+     << ": emitting signal \"start_streaming\"";
+
+  emit start_streaming();
+}
+
+void AssemblyImageController::disable_streaming()
+{
+  if(streaming_is_enabled_ == false){ return; }
+
+  disconnect(camera_manager_, SIGNAL(frameAvailable()), this, SLOT(retrieve_frame()));
+
+  streaming_is_enabled_ = false;
+
+  NQLog("AssemblyImageController", NQLog::Spam) << "disable_streaming"
+     << ": emitting signal \"stop_streaming\"";
+
+  emit stop_streaming();
+
+  // the frame on display is replaced right away (no frame is retrieved anymore),
+  // so that the consumers connected now receive the copy
+  this->release_frame();
+}
+
+//
+// takes the latest frame of the camera (frames which arrived in the meantime are skipped):
+// the image is passed without copy, and holds a reference to the frame,
+// so the buffer of the camera stays valid as long as a consumer keeps the image
+//
+void AssemblyImageController::retrieve_frame()
+{
+  if(camera_manager_->isStreaming() == false){ return; }
+
+  const AssemblyVUEyeCamera::FramePtr frame = camera_manager_->latestFrame();
+
+  if((frame == nullptr) || (frame == frame_)){ return; }
+
+  frame_ = frame;
+
+  NQLog("AssemblyImageController", NQLog::Spam) << "retrieve_frame"
+     << ": emitting signal \"frame_acquired\"";
+
+  emit frame_acquired(AssemblyVUEyeCamera::sharedImage(frame_));
+}
+
+//
+// at the end of the streaming, the buffer of the frame on display has to go back to the camera:
+// the consumers are given a copy of the last frame, which replaces the images they keep
+//
+void AssemblyImageController::release_frame()
+{
+  if(frame_ == nullptr){ return; }
+
+  const cv::Mat img = frame_->image().clone();
+
+  frame_.reset();
+
+  NQLog("AssemblyImageController", NQLog::Spam) << "release_frame"
+     << ": emitting signal \"frame_acquired\"";
+
+  emit frame_acquired(img);
+}
@@ -35,6 +35,7 @@ class AssemblyImageController : public QObject
 
     bool is_enabled()           const { return is_enabled_; }
     bool autofocus_is_enabled() const { return autofocus_is_enabled_; }
+    bool streaming_is_enabled() const { return streaming_is_enabled_; }
 
     const AssemblyVUEyeCamera* camera_manager() const { return camera_manager_; }
 
@@ -47,6 +48,11 @@ class AssemblyImageController : public QObject
     bool autofocus_is_enabled_;
     bool autofocus_to_be_disabled_;
 
+    bool streaming_is_enabled_;
+
+    // frame on display: its buffer is held until the next frame is retrieved
+    AssemblyVUEyeCamera::FramePtr frame_;
+
   public slots:
 
     void  enable();
@@ -65,6 +71,12 @@ class AssemblyImageController : public QObject
     void acquire_autofocused_image();
     void restore_autofocus_settings();
 
+    void  enable_streaming();
+    void disable_streaming();
+
+    void retrieve_frame();
+    void release_frame();
+
   signals:
 
     void  open_camera();
@@ -83,6 +95,11 @@ class AssemblyImageController : public QObject
 
     void autofocused_image_request();
     void autofocused_image_acquired();
+
+    void start_streaming();
+    void stop_streaming();
+
+    void frame_acquired(const cv::Mat&);
 };
 
 #endif // ASSEMBLYIMAGECONTROLLER_H
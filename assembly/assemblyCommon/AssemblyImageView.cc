@@ -33,6 +33,7 @@ AssemblyImageView::AssemblyImageView(QWidget* parent) :
   img_load_button_(nullptr),
   img_save_button_(nullptr),
   img_celi_button_(nullptr),
+  image_modified_(false),
 
   // auto-focusing
   autofocus_ueye_(nullptr),
@@ -192,26 +193,14 @@ AssemblyImageView::AssemblyImageView(QWidget* parent) :
   //// --------------------------------------------------
 }
 
-void AssemblyImageView::update_image(const cv::Mat& img, const bool update_image_raw)
+//
+// no copy: a streamed image shares the buffer of its camera frame, and holds a reference to it
+// (AssemblyVUEyeCamera::sharedImage), which keeps the memory of the buffer valid, also after the camera is closed;
+// the buffer only goes back to the camera when the image is replaced (at the latest by the copy sent at the end of the streaming)
+//
+void AssemblyImageView::update_image(const cv::Mat& img)
 {
-  if(img.channels() == 1)
-  {
-    cv::Mat img_color;
-    cv::cvtColor(img, img_color, cv::COLOR_GRAY2BGR);
-
-    image_ = img_color.clone();
-  }
-  else
-  {
-    image_ = img.clone();
-  }
-
-  if(update_image_raw)
-  {
-    image_raw_ = image_.clone();
-
-    image_modified_ = false;
-  }
+  image_ = img;
 
   NQLog("AssemblyImageView", NQLog::Spam) << "update_image"
      << ": emitting signal \"image_updated\"";
@@ -253,7 +242,24 @@ void AssemblyImageView::save_image()
   const QString filename = QFileDialog::getSaveFileName(this, tr("Save Image"), QString::fromStdString(Config::CMSTkModLabBasePath+"/share/assembly"), tr("PNG Files (*.png);;All Files (*)"));
   if(filename.isNull() || filename.isEmpty()){ return; }
 
-  assembly::cv_imwrite(filename, image_);
+  cv::Mat img;
+
+  if(image_.channels() == 1)
+  {
+    cv::cvtColor(image_, img, cv::COLOR_GRAY2BGR);
+  }
+  else
+  {
+    img = image_.clone();
+  }
+
+  if(image_modified_)
+  {
+    line(img, cv::Point(   img.cols/2.0, 0), cv::Point(img.cols/2.0, img.rows    ), cv::Scalar(255,0,0), 2, 8, 0);
+    line(img, cv::Point(0, img.rows/2.0   ), cv::Point(img.cols    , img.rows/2.0), cv::Scalar(255,0,0), 2, 8, 0);
+  }
+
+  assembly::cv_imwrite(filename, img);
 
   return;
 }
@@ -278,29 +284,17 @@ void AssemblyImageView::save_image_zscan()
 
 void AssemblyImageView::modify_image_centerlines()
 {
-  if(image_raw_.empty())
+  if(image_.empty())
   {
     NQLog("AssemblyImageView", NQLog::Warning) << "modify_image_centerlines"
-       << ": input raw image is empty, no action taken";
+       << ": input image is empty, no action taken";
 
     return;
   }
 
-  cv::Mat img = image_raw_.clone();
-
-  if(image_modified_ == false)
-  {
-    line(img, cv::Point(   img.cols/2.0, 0), cv::Point(img.cols/2.0, img.rows    ), cv::Scalar(255,0,0), 2, 8, 0);
-    line(img, cv::Point(0, img.rows/2.0   ), cv::Point(img.cols    , img.rows/2.0), cv::Scalar(255,0,0), 2, 8, 0);
-
-    image_modified_ = true;
+  image_modified_ = (image_modified_ == false);
 
-    this->update_image(img, false);
-  }
-  else
-  {
-    this->update_image(img, true);
-  }
+  img_ueye_->setCenterLines(image_modified_);
 
   return;
 }
@@ -54,8 +54,8 @@ class AssemblyImageView : public QWidget
   QPushButton* img_save_button_;
   QPushButton* img_celi_button_;
 
+  // displayed image (no copy), center lines drawn by the view as an overlay
   cv::Mat image_;
-  cv::Mat image_raw_;
 
   bool image_modified_;
   // -------------------
@@ -75,7 +75,7 @@ class AssemblyImageView : public QWidget
 
  public slots:
 
-  void update_image(const cv::Mat&, const bool update_image_raw=true);
+  void update_image(const cv::Mat&);
 
   void load_image();
   void save_image();
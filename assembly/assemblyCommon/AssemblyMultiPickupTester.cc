@@ -14,12 +14,34 @@
 #include <ApplicationConfig.h>
 
 #include <AssemblyMultiPickupTester.h>
+#include <AssemblyUtilities.h>
 
-AssemblyMultiPickupTester::AssemblyMultiPickupTester(const LStepExpressMotionManager* motion_manager, QObject* parent)
+#include <sstream>
+#include <iomanip>
+#include <cmath>
+
+AssemblyMultiPickupTester::AssemblyMultiPickupTester(const LStepExpressMotionManager* motion_manager, const QString& output_dir_prepath, QObject* parent)
  : QObject(parent)
 
  , motion_manager_(motion_manager)
  , motion_manager_enabled_(false)
+
+ , pipeline_(true)
+
+ , output_dir_prepath_(output_dir_prepath)
+ , output_dir_("")
+ , exe_counter_(0)
+
+ , last_pickup_duration_(0.)
+
+ , PatRec_results_available_(false)
+ , PatRec_dX_(0.)
+ , PatRec_dY_(0.)
+ , PatRec_angle_(0.)
+
+ , finishing_(false)
+
+ , failed_measurements_(0)
 {
   if(motion_manager_ == nullptr)
   {
@@ -45,9 +67,12 @@ AssemblyMultiPickupTester::AssemblyMultiPickupTester(const LStepExpressMotionMan
 
   use_vacuumBP_  = config->getValue<bool>("AssemblyMultiPickupTester_useBaseplateVacuum");
 
+  pipeline_      = config->getValue<bool>("AssemblyMultiPickupTester_pipelineMeasurements", true);
+
   this->reset();
 
-  NQLog("AssemblyMultiPickupTester", NQLog::Debug) << "constructed";
+  NQLog("AssemblyMultiPickupTester", NQLog::Debug) << "constructed"
+     << " (pipelined measurements=" << pipeline_ << ")";
 }
 
 AssemblyMultiPickupTester::~AssemblyMultiPickupTester()
@@ -101,11 +126,90 @@ void AssemblyMultiPickupTester::reset()
   pickup_done_ = false;
   picked_up_   = false;
 
+  pending_cycles_.clear();
+
+  PatRec_results_available_ = false;
+
+  finishing_ = false;
+
+  if(results_file_.is_open()){ results_file_.close(); }
+
   this->disconnect_motion_manager();
 }
 
+//
+// reset of the statistics and creation of the output directory of the test
+// (one sub-directory per test, named after the execution counter)
+//
+void AssemblyMultiPickupTester::initialize_test()
+{
+  stats_dX_   .clear();
+  stats_dY_   .clear();
+  stats_angle_.clear();
+
+  failed_measurements_ = 0;
+
+  pending_cycles_.clear();
+
+  PatRec_results_available_ = false;
+
+  finishing_ = false;
+
+  last_pickup_duration_ = 0.;
+
+  time_test_start_ = clock::now();
+
+  if(results_file_.is_open()){ results_file_.close(); }
+
+  output_dir_ = "";
+
+  if(output_dir_prepath_ == ""){ return; }
+
+  bool  output_dir_exists(true);
+  while(output_dir_exists)
+  {
+    ++exe_counter_;
+
+    std::string exe_counter_str = std::to_string(exe_counter_);
+
+    if(exe_counter_ < 1e3)
+    {
+      std::stringstream exe_counter_strss;
+      exe_counter_strss << std::setw(3) << std::setfill('0') << exe_counter_;
+      exe_counter_str = exe_counter_strss.str();
+    }
+
+    output_dir_ = output_dir_prepath_.toStdString()+"/"+exe_counter_str+"/";
+
+    output_dir_exists = assembly::DirectoryExists(output_dir_);
+  }
+
+  assembly::QDir_mkpath(output_dir_);
+
+  results_file_.open(output_dir_+"/results.csv");
+
+  if(results_file_.is_open() == false)
+  {
+    NQLog("AssemblyMultiPickupTester", NQLog::Warning) << "initialize_test"
+       << ": failed to open output file " << output_dir_+"/results.csv" << ", results will not be saved";
+
+    return;
+  }
+
+  results_file_ << "cycle,exit_code,dX_mm,dY_mm,angle_deg,time_s,measurement_motion_s,PatRec_s,pickup_s" << std::endl;
+
+  NQLog("AssemblyMultiPickupTester", NQLog::Spam) << "initialize_test"
+     << ": created output file: " << output_dir_+"/results.csv";
+}
+
 void AssemblyMultiPickupTester::start_measurement()
 {
+  if(itera_counter_ == 0){ this->initialize_test(); }
+
+  current_cycle_.index_           = itera_counter_;
+  current_cycle_.time_start_      = clock::now();
+  current_cycle_.pickup_duration_ = last_pickup_duration_;
+
   NQLog("AssemblyMultiPickupTester", NQLog::Message) << "start_measurement: -------------------------------";
   NQLog("AssemblyMultiPickupTester", NQLog::Message) << "start_measurement: initializing measurement [#" << itera_counter_ << "]";
   NQLog("AssemblyMultiPickupTester", NQLog::Message) << "start_measurement: -------------------------------";
@@ -124,10 +228,77 @@ void AssemblyMultiPickupTester::start_measurement()
   emit move_relative(0., 0., dz, 0.);
 }
 
+//
+// image of the current cycle acquired: in pipelined mode, the next pickup starts right away
+// and the result of PatRec is collected later (finish_measurement)
+//
+void AssemblyMultiPickupTester::acquired_measurement()
+{
+  QMutexLocker ml(&mutex_);
+
+  if((mode_ != AssemblyMultiPickupTester::Mode_measurement) || (move_ != AssemblyMultiPickupTester::Movement_None))
+  {
+    NQLog("AssemblyMultiPickupTester", NQLog::Spam) << "acquired_measurement"
+       << ": image not requested by the multi-pickup test, ignored";
+
+    return;
+  }
+
+  mode_ = AssemblyMultiPickupTester::Mode_None;
+
+  current_cycle_.time_image_ = clock::now();
+
+  pending_cycles_.push_back(current_cycle_);
+
+  if(pipeline_)
+  {
+    ++itera_counter_;
+
+    NQLog("AssemblyMultiPickupTester", NQLog::Spam) << "acquired_measurement"
+       << ": emitting signal \"measurement_finished\" (" << pending_cycles_.size() << " PatRec result(s) pending)";
+
+    emit measurement_finished();
+  }
+}
+
+void AssemblyMultiPickupTester::update_PatRec_results(const double dX, const double dY, const double angle)
+{
+  QMutexLocker ml(&mutex_);
+
+  PatRec_dX_    = dX;
+  PatRec_dY_    = dY;
+  PatRec_angle_ = angle;
+
+  PatRec_results_available_ = true;
+}
+
 void AssemblyMultiPickupTester::finish_measurement(const int exit_code)
 {
   QMutexLocker ml(&mutex_);
 
+  if(pending_cycles_.empty())
+  {
+    NQLog("AssemblyMultiPickupTester", NQLog::Warning) << "finish_measurement"
+       << ": PatRec result without pending measurement of the multi-pickup test, ignored";
+
+    PatRec_results_available_ = false;
+
+    return;
+  }
+
+  const Cycle cycle = pending_cycles_.front();
+  pending_cycles_.pop_front();
+
+  this->record_measurement(cycle, exit_code);
+
+  if(pipeline_)
+  {
+    // the pickup of the next cycle is already running: failed measurements are only recorded
+    if(finishing_ && pending_cycles_.empty()){ this->finish_test(); }
+
+    return;
+  }
+
   if(exit_code != 0)
   {
     NQLog("AssemblyMultiPickupTester", NQLog::Critical) << "finish_measurement"
@@ -151,22 +322,120 @@ void AssemblyMultiPickupTester::finish_measurement(const int exit_code)
   emit measurement_finished();
 }
 
+void AssemblyMultiPickupTester::record_measurement(const Cycle& cycle, const int exit_code)
+{
+  const clock::time_point time_now = clock::now();
+
+  const double time_elapsed     = std::chrono::duration<double>(time_now          - time_test_start_  ).count();
+  const double time_measurement = std::chrono::duration<double>(cycle.time_image_ - cycle.time_start_).count();
+  const double time_PatRec      = std::chrono::duration<double>(time_now          - cycle.time_image_).count();
+
+  const bool valid = ((exit_code == 0) && PatRec_results_available_);
+
+  PatRec_results_available_ = false;
+
+  if(valid)
+  {
+    stats_dX_   .add(cycle.index_, PatRec_dX_);
+    stats_dY_   .add(cycle.index_, PatRec_dY_);
+    stats_angle_.add(cycle.index_, PatRec_angle_);
+
+    NQLog("AssemblyMultiPickupTester", NQLog::Message) << "record_measurement: [#" << cycle.index_ << "]"
+       << " dX=" << PatRec_dX_ << " mm, dY=" << PatRec_dY_ << " mm, angle=" << PatRec_angle_ << " deg"
+       << " (measurement motion=" << time_measurement << " s, PatRec=" << time_PatRec << " s)";
+
+    NQLog("AssemblyMultiPickupTester", NQLog::Message) << "record_measurement: [#" << cycle.index_ << "]"
+       << " mean (sigma, drift/cycle):"
+       << " dX=" << stats_dX_.mean() << " (" << std::sqrt(stats_dX_.variance()) << ", " << stats_dX_.slope() << ") mm"
+       << ", dY=" << stats_dY_.mean() << " (" << std::sqrt(stats_dY_.variance()) << ", " << stats_dY_.slope() << ") mm"
+       << ", angle=" << stats_angle_.mean() << " (" << std::sqrt(stats_angle_.variance()) << ", " << stats_angle_.slope() << ") deg";
+  }
+  else
+  {
+    ++failed_measurements_;
+
+    NQLog("AssemblyMultiPickupTester", NQLog::Warning) << "record_measurement: [#" << cycle.index_ << "]"
+       << " measurement failed (exit code " << exit_code << "), excluded from the statistics";
+  }
+
+  if(results_file_.is_open())
+  {
+    results_file_ << cycle.index_ << "," << exit_code;
+
+    if(valid){ results_file_ << "," << PatRec_dX_ << "," << PatRec_dY_ << "," << PatRec_angle_; }
+    else     { results_file_ << ",nan,nan,nan"; }
+
+    results_file_ << "," << time_elapsed << "," << time_measurement << "," << time_PatRec << "," << cycle.pickup_duration_ << std::endl;
+  }
+}
+
+void AssemblyMultiPickupTester::finish_test()
+{
+  const double time_total = std::chrono::duration<double>(clock::now() - time_test_start_).count();
+
+  const unsigned int N_measurements = stats_dX_.count() + failed_measurements_;
+
+  std::stringstream summary;
+
+  summary << "measurements: " << N_measurements << " (failed: " << failed_measurements_ << ")\n";
+  summary << "total time: " << time_total << " s";
+  if(N_measurements > 0){ summary << " (" << (time_total / N_measurements) << " s per cycle)"; }
+  summary << "\n";
+  summary << "dX    [mm] : mean=" << stats_dX_   .mean() << " sigma=" << std::sqrt(stats_dX_   .variance()) << " drift/cycle=" << stats_dX_   .slope() << "\n";
+  summary << "dY    [mm] : mean=" << stats_dY_   .mean() << " sigma=" << std::sqrt(stats_dY_   .variance()) << " drift/cycle=" << stats_dY_   .slope() << "\n";
+  summary << "angle [deg]: mean=" << stats_angle_.mean() << " sigma=" << std::sqrt(stats_angle_.variance()) << " drift/cycle=" << stats_angle_.slope() << "\n";
+
+  std::string line;
+  while(std::getline(summary, line))
+  {
+    NQLog("AssemblyMultiPickupTester", NQLog::Message) << "finish_test: " << line;
+  }
+
+  if(output_dir_ != "")
+  {
+    std::ofstream txtfile(output_dir_+"/summary.txt");
+
+    if(txtfile.is_open())
+    {
+      txtfile << summary.str();
+      txtfile.close();
+
+      NQLog("AssemblyMultiPickupTester", NQLog::Spam) << "finish_test"
+         << ": created output file: " << output_dir_+"/summary.txt";
+    }
+  }
+
+  NQLog("AssemblyMultiPickupTester", NQLog::Spam) << "finish_test"
+     << ": emitting signal \"test_finished\"";
+
+  this->reset();
+
+  emit test_finished();
+}
+
 void AssemblyMultiPickupTester::start_pickup()
 {
   if(itera_counter_ > conf_.iterations())
   {
-    NQLog("AssemblyMultiPickupTester", NQLog::Spam) << "start_pickup"
-       << ": emitting signal \"test_finished\"";
+    if(pending_cycles_.empty() == false)
+    {
+      NQLog("AssemblyMultiPickupTester", NQLog::Message) << "start_pickup"
+         << ": last pickup completed, waiting for " << pending_cycles_.size() << " pending PatRec result(s)";
 
-    this->reset();
+      finishing_ = true;
 
-    emit test_finished();
+      return;
+    }
+
+    this->finish_test();
 
     return;
   }
 
   mode_ = AssemblyMultiPickupTester::Mode_pickup;
 
+  time_pickup_start_ = clock::now();
+
   vacuum_on_   = false;
   vacuumBP_on_ = true;
   pickup_done_ = false;
@@ -289,6 +558,8 @@ void AssemblyMultiPickupTester::setup_next_step()
 
             this->disconnect_motion_manager();
 
+            last_pickup_duration_ = std::chrono::duration<double>(clock::now() - time_pickup_start_).count();
+
             emit pickup_finished();
           }
         }
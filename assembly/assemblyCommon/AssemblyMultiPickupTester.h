@@ -13,7 +13,22 @@
 #ifndef ASSEMBLYMULTIPICKUPTESTER_H
 #define ASSEMBLYMULTIPICKUPTESTER_H
 
+/*  Description:
+ *   Multi-pickup test (repeated pickups of the same object, each followed by a PatRec measurement):
+ *    - in pipelined mode, the pickup of cycle N+1 starts as soon as the image of cycle N is acquired,
+ *      while the PatRec of cycle N runs in the thread of the object finder
+ *    - per-cycle results (dX, dY, angle and timings) are streamed to a CSV file in the output directory
+ *    - running mean, standard deviation and drift (slope vs cycle number) of dX, dY and angle
+ *      are updated after every cycle and summarized at the end of the test
+ */
+
 #include <LStepExpressMotionManager.h>
+#include <Ringbuffer.h>
+
+#include <string>
+#include <fstream>
+#include <deque>
+#include <chrono>
 
 class AssemblyMultiPickupTester : public QObject
 {
@@ -21,7 +36,7 @@ class AssemblyMultiPickupTester : public QObject
 
  public:
 
-  explicit AssemblyMultiPickupTester(const LStepExpressMotionManager*, QObject* parent=nullptr);
+  explicit AssemblyMultiPickupTester(const LStepExpressMotionManager*, const QString& output_dir_prepath="", QObject* parent=nullptr);
   virtual ~AssemblyMultiPickupTester();
 
   const LStepExpressMotionManager* motion_manager() const { return motion_manager_; }
@@ -66,6 +81,11 @@ class AssemblyMultiPickupTester : public QObject
 
   void set_configuration(const Configuration& conf){ conf_ = conf; }
 
+  // mean, standard deviation and linear drift (slope vs cycle number) of a quantity, in O(1) per cycle
+  const RunningStatistics& statistics_dX()    const { return stats_dX_; }
+  const RunningStatistics& statistics_dY()    const { return stats_dY_; }
+  const RunningStatistics& statistics_angle() const { return stats_angle_; }
+
  private:
   Q_DISABLE_COPY(AssemblyMultiPickupTester)
 
@@ -104,9 +124,56 @@ class AssemblyMultiPickupTester : public QObject
   bool pickup_done_;
   bool picked_up_;
 
+  typedef std::chrono::steady_clock clock;
+
+  class Cycle
+  {
+   public:
+    int               index_;
+    clock::time_point time_start_;      // start of the measurement motion
+    clock::time_point time_image_;      // image acquired
+    double            pickup_duration_; // duration of the preceding pickup [s]
+  };
+
+  bool pipeline_;
+
+  QString output_dir_prepath_;
+  std::string output_dir_;
+  int exe_counter_;
+
+  std::ofstream results_file_;
+
+  clock::time_point time_test_start_;
+  clock::time_point time_pickup_start_;
+
+  Cycle current_cycle_;
+  double last_pickup_duration_;
+
+  // measurements waiting for the result of PatRec (in order of acquisition)
+  std::deque<Cycle> pending_cycles_;
+
+  bool   PatRec_results_available_;
+  double PatRec_dX_;
+  double PatRec_dY_;
+  double PatRec_angle_;
+
+  bool finishing_;
+
+  unsigned int failed_measurements_;
+
+  RunningStatistics stats_dX_;
+  RunningStatistics stats_dY_;
+  RunningStatistics stats_angle_;
+
+  void initialize_test();
+  void record_measurement(const Cycle&, const int exit_code);
+  void finish_test();
+
  public slots:
 
   void start_measurement();
+  void acquired_measurement();
+  void update_PatRec_results(const double, const double, const double);
   void finish_measurement(const int exit_code=0);
   void start_pickup();
   void setup_next_step();
@@ -24,6 +24,12 @@ AssemblyObjectAligner::AssemblyObjectAligner(const LStepExpressMotionManager* co
 
  , motion_manager_(motion_manager)
  , motion_manager_enabled_(false)
+
+ , use_prediction_(false)
+ , prediction_windowXY_(0.)
+ , prediction_windowAngle_(0.)
+
+ , param_AngleOfCameraFrame_(AssemblyParameters::handle("AngleOfCameraFrameInRefFrame_dA"))
 {
   if(motion_manager_ == nullptr)
   {
@@ -35,10 +41,33 @@ AssemblyObjectAligner::AssemblyObjectAligner(const LStepExpressMotionManager* co
 
   qRegisterMetaType<AssemblyObjectAligner::Configuration>("AssemblyObjectAligner::Configuration");
 
+  ApplicationConfig* config = ApplicationConfig::instance();
+  if(config != nullptr)
+  {
+    use_prediction_         = bool(config->getValue<int>("AssemblyObjectAligner_usePrediction", 0));
+    prediction_windowXY_    = config->getValue<double>("AssemblyObjectAligner_predictionWindowXY"   , 0.10);
+    prediction_windowAngle_ = config->getValue<double>("AssemblyObjectAligner_predictionWindowAngle", 0.20);
+
+    if((prediction_windowXY_ <= 0.) || (prediction_windowAngle_ <= 0.))
+    {
+      NQLog("AssemblyObjectAligner", NQLog::Warning) << "initialization"
+         << ": invalid windows for the predicted PatRec (XY=" << prediction_windowXY_ << ", angle=" << prediction_windowAngle_ << "), prediction disabled";
+
+      use_prediction_ = false;
+    }
+  }
+  else
+  {
+    NQLog("AssemblyObjectAligner", NQLog::Warning) << "initialization"
+       << ": ApplicationConfig::instance() not initialized (null pointer), prediction of PatRec results disabled";
+  }
+
   configuration_.reset();
 
   this->reset();
 
+  this->reset_prediction();
+
   connect(this, SIGNAL(nextAlignmentStep(double, double, double)), this, SLOT(run_alignment(double, double, double)));
 
   connect(this, SIGNAL(motion_completed()), this, SLOT(launch_next_alignment_step()));
@@ -113,9 +142,88 @@ void AssemblyObjectAligner::reset()
 
   obj_angle_deg_ = 0.;
 
+  patrec_angle1_ = 0.;
+
   return;
 }
 
+void AssemblyObjectAligner::reset_prediction()
+{
+  prediction_valid_ = false;
+
+  prediction_angle1_ = 0.;
+  prediction_angle2_ = 0.;
+
+  prediction_dX2_ = 0.;
+  prediction_dY2_ = 0.;
+
+  prediction_rotation_ = 0.;
+
+  prediction_shift1_valid_ = false;
+
+  prediction_shift1_dX_ = 0.;
+  prediction_shift1_dY_ = 0.;
+
+  return;
+}
+
+//
+// results of the current iteration (PatRec #2 and rotation to be applied), used as prediction in the next one
+//
+void AssemblyObjectAligner::update_prediction(const double patrec_dX2, const double patrec_dY2, const double patrec_angle2, const double rotation)
+{
+  prediction_valid_ = true;
+
+  prediction_angle1_ = patrec_angle1_;
+  prediction_angle2_ = patrec_angle2;
+
+  prediction_dX2_ = patrec_dX2;
+  prediction_dY2_ = patrec_dY2;
+
+  prediction_rotation_ = rotation;
+
+  return;
+}
+
+//
+// configuration of the PatRec of marker-1 (marker-2), with the results expected from the previous iteration:
+//  - marker-1: the platform was moved back to marker-1 and rotated, the marker is shifted by the rotation
+//    (once measured, the shift per degree is used), its angle changes by up to the rotation
+//  - marker-2: same offset as in the previous iteration, same angle relative to marker-1
+//
+AssemblyObjectFinderPatRec::Configuration AssemblyObjectAligner::PatRec_configuration(const int marker) const
+{
+  AssemblyObjectFinderPatRec::Configuration conf = (marker == 1) ? this->configuration().PatRecOne_configuration : this->configuration().PatRecTwo_configuration;
+
+  if((use_prediction_ == false) || (prediction_valid_ == false)){ return conf; }
+
+  conf.prediction_enabled_  = true;
+  conf.prediction_windowXY_ = prediction_windowXY_;
+
+  if(marker == 1)
+  {
+    conf.prediction_dX_ = prediction_shift1_valid_ ? (prediction_shift1_dX_ * prediction_rotation_) : 0.;
+    conf.prediction_dY_ = prediction_shift1_valid_ ? (prediction_shift1_dY_ * prediction_rotation_) : 0.;
+
+    conf.prediction_angle_       = prediction_angle1_;
+    conf.prediction_windowAngle_ = prediction_windowAngle_ + std::fabs(prediction_rotation_);
+  }
+  else
+  {
+    conf.prediction_dX_ = prediction_dX2_;
+    conf.prediction_dY_ = prediction_dY2_;
+
+    conf.prediction_angle_       = patrec_angle1_ + (prediction_angle2_ - prediction_angle1_);
+    conf.prediction_windowAngle_ = prediction_windowAngle_;
+  }
+
+  NQLog("AssemblyObjectAligner", NQLog::Spam) << "PatRec_configuration"
+     << ": predicted PatRec #" << marker << ": dX=" << conf.prediction_dX_ << ", dY=" << conf.prediction_dY_
+     << ", angle=" << conf.prediction_angle_ << " (+-" << conf.prediction_windowAngle_ << ")";
+
+  return conf;
+}
+
 void AssemblyObjectAligner::update_configuration(const AssemblyObjectAligner::Configuration& conf)
 {
   if(conf.is_valid() == false)
@@ -217,6 +325,8 @@ void AssemblyObjectAligner::execute()
 {
   alignment_step_ = 0;
 
+  this->reset_prediction();
+
   this->run_alignment(0., 0., 0.);
 }
 
@@ -268,7 +378,7 @@ void AssemblyObjectAligner::run_alignment(const double patrec_dX, const double p
 
     ++alignment_step_;
 
-    emit PatRec_request(this->configuration().PatRecOne_configuration);
+    emit PatRec_request(this->PatRec_configuration(1));
   }
   // Step #2: move to marker-2
   else if(alignment_step_ == 2)
@@ -280,6 +390,17 @@ void AssemblyObjectAligner::run_alignment(const double patrec_dX, const double p
     posi_x1_ = motion_manager_->get_position_X() + patrec_dX;
     posi_y1_ = motion_manager_->get_position_Y() + patrec_dY;
 
+    patrec_angle1_ = patrec_angle;
+
+    // shift of marker-1 due to the rotation applied after the previous iteration
+    if(prediction_valid_ && (prediction_rotation_ != 0.))
+    {
+      prediction_shift1_valid_ = true;
+
+      prediction_shift1_dX_ = patrec_dX / prediction_rotation_;
+      prediction_shift1_dY_ = patrec_dY / prediction_rotation_;
+    }
+
     NQLog("AssemblyObjectAligner", NQLog::Message) << "run_alignment: step [" << alignment_step_ << "]";
     NQLog("AssemblyObjectAligner", NQLog::Message) << "run_alignment: step [" << alignment_step_ << "]: motion-stage X = " << motion_manager_->get_position_X();
     NQLog("AssemblyObjectAligner", NQLog::Message) << "run_alignment: step [" << alignment_step_ << "]: motion-stage Y = " << motion_manager_->get_position_Y();
@@ -295,13 +416,13 @@ void AssemblyObjectAligner::run_alignment(const double patrec_dX, const double p
     const double obj_deltaX = this->configuration().object_deltaX;
     const double obj_deltaY = this->configuration().object_deltaY;
 
-    const AssemblyParameters* const params = AssemblyParameters::instance(false);
+    const std::shared_ptr<const AssemblyParameters::Snapshot> params = AssemblyParameters::instance(false)->snapshot();
 
     // angle from marker's outer edge to best-match position in the camera ref-frame
     //   - the 90.0 deg offset corresponds to the angle spanned by the marker (L-shape)
     const double patrec_angle_full = (patrec_angle + 90.0);
 
-    const double camera_offset_dA = params->get("AngleOfCameraFrameInRefFrame_dA");
+    const double camera_offset_dA = params->get(param_AngleOfCameraFrame_);
 
     double dX_1to2, dY_1to2;
     assembly::rotation2D_deg(dX_1to2, dY_1to2, (patrec_angle_full + camera_offset_dA), obj_deltaX, obj_deltaY);
@@ -355,7 +476,7 @@ void AssemblyObjectAligner::run_alignment(const double patrec_dX, const double p
 
     ++alignment_step_;
 
-    emit PatRec_request(this->configuration().PatRecTwo_configuration);
+    emit PatRec_request(this->PatRec_configuration(2));
   }
   // Step #5: move back to marker-1
   else if(alignment_step_ == 5)
@@ -453,6 +574,8 @@ void AssemblyObjectAligner::run_alignment(const double patrec_dX, const double p
           NQLog("AssemblyObjectAligner", NQLog::Spam) << "run_alignment: step [" << alignment_step_ << "]"
              << ": emitting signal \"move_relative(" << dX << ", " << dY << ", 0, " << delta_angle_deg << ")\"";
 
+          this->update_prediction(patrec_dX, patrec_dY, patrec_angle, delta_angle_deg);
+
           this->reset();
 
           this->move_relative(dX, dY, 0.0, delta_angle_deg);
@@ -473,6 +596,8 @@ void AssemblyObjectAligner::run_alignment(const double patrec_dX, const double p
           NQLog("AssemblyObjectAligner", NQLog::Spam) << "run_alignment: step [" << alignment_step_ << "]"
              << ": emitting signal \"move_relative(" << dX << ", " << dY << ", 0, " << rot_deg << ")\"";
 
+          this->update_prediction(patrec_dX, patrec_dY, patrec_angle, rot_deg);
+
           this->reset();
 
           this->move_relative(dX, dY, 0.0, rot_deg);
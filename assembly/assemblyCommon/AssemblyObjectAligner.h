@@ -15,6 +15,7 @@
 
 #include <LStepExpressMotionManager.h>
 #include <AssemblyObjectFinderPatRec.h>
+#include <AssemblyParameters.h>
 
 #include <QObject>
 
@@ -83,6 +84,32 @@ class AssemblyObjectAligner : public QObject
 
     double obj_angle_deg_;
 
+    double patrec_angle1_;
+
+    // prediction of the PatRec results from the previous iteration of the alignment
+    bool   use_prediction_;
+    double prediction_windowXY_;
+    double prediction_windowAngle_;
+
+    bool   prediction_valid_;
+    double prediction_angle1_;
+    double prediction_angle2_;
+    double prediction_dX2_, prediction_dY2_;
+    double prediction_rotation_;
+
+    // shift of marker-1 in the field of view per degree of rotation of the platform [mm/deg]
+    bool   prediction_shift1_valid_;
+    double prediction_shift1_dX_, prediction_shift1_dY_;
+
+    // handle of the assembly parameter of the camera-frame angle (read from one snapshot per alignment step)
+    const AssemblyParameters::Handle param_AngleOfCameraFrame_;
+
+    void reset_prediction();
+
+    void update_prediction(const double, const double, const double, const double);
+
+    AssemblyObjectFinderPatRec::Configuration PatRec_configuration(const int) const;
+
   public slots:
 
     void update_configuration(const Configuration&);
@@ -16,9 +16,14 @@
 #include <AssemblyObjectFinderPatRec.h>
 #include <AssemblyParameters.h>
 #include <AssemblyUtilities.h>
+#include <AssemblyArtifactWriter.h>
 
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <chrono>
 
 #include <QFile>
 #include <QTextStream>
@@ -41,8 +46,21 @@ AssemblyObjectFinderPatRec::AssemblyObjectFinderPatRec(AssemblyThresholder* cons
 
   save_subdir_images_(true),
 
+  use_template_bank_(false),
+  benchmark_template_bank_(false),
+
+  template_bank_cache_dir_(assembly::QtCacheDirectory()+"/AssemblyTemplateBank"),
+  template_bank_cache_size_(8),
+
   updated_img_master_(false),
-  updated_img_master_PatRec_(false)
+  updated_img_master_PatRec_(false),
+
+  param_SubPixelRefinement_    (AssemblyParameters::handle("PatRecSubPixelRefinement")),
+  param_AngleFitNeighbours_    (AssemblyParameters::handle("PatRecAngleFitNeighbours")),
+  param_PyramidLevels_         (AssemblyParameters::handle("PatRecPyramidLevels")),
+  param_PyramidCandidates_     (AssemblyParameters::handle("PatRecPyramidCandidates")),
+  param_PredictionFOMTolerance_(AssemblyParameters::handle("PatRecPredictionFOMTolerance")),
+  param_AngleOfCameraFrame_    (AssemblyParameters::handle("AngleOfCameraFrameInRefFrame_dA"))
 {
   if(thresholder_ == nullptr)
   {
@@ -70,6 +88,11 @@ AssemblyObjectFinderPatRec::AssemblyObjectFinderPatRec(AssemblyThresholder* cons
   mm_per_pixel_row_ = config->getValue<double>("mm_per_pixel_row");
   mm_per_pixel_col_ = config->getValue<double>("mm_per_pixel_col");
 
+  use_template_bank_       = bool(config->getValue<int>("AssemblyObjectFinderPatRec_useTemplateBank"      , 0));
+  benchmark_template_bank_ = bool(config->getValue<int>("AssemblyObjectFinderPatRec_benchmarkTemplateBank", 0));
+
+  template_bank_cache_size_ = std::max(1, config->getValue<int>("AssemblyObjectFinderPatRec_templateBankCacheSize", int(template_bank_cache_size_)));
+
   NQLog("AssemblyObjectFinderPatRec", NQLog::Debug) << "constructed";
 }
 
@@ -78,6 +101,14 @@ AssemblyObjectFinderPatRec::~AssemblyObjectFinderPatRec()
   NQLog("AssemblyObjectFinderPatRec", NQLog::Debug) << "destructed";
 }
 
+void AssemblyObjectFinderPatRec::show_angscan_plot(const QString& filepath)
+{
+  NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "show_angscan_plot"
+     << ": emitting signal \"PatRec_res_image_angscan(" << filepath.toStdString() << ")\"";
+
+  emit PatRec_res_image_angscan(filepath);
+}
+
 void AssemblyObjectFinderPatRec::Configuration::reset()
 {
   template_filepath_ = "";
@@ -91,6 +122,15 @@ void AssemblyObjectFinderPatRec::Configuration::reset()
   angles_prescan_vec_.clear();
   angles_finemax_  = -1.0;
   angles_finestep_ = -1.0;
+
+  prediction_enabled_     = false;
+  prediction_dX_          = 0.;
+  prediction_dY_          = 0.;
+  prediction_angle_       = 0.;
+  prediction_windowXY_    = -1.0;
+  prediction_windowAngle_ = -1.0;
+
+  pyramid_levels_ = -1;
 }
 
 bool AssemblyObjectFinderPatRec::Configuration::is_valid() const
@@ -119,6 +159,12 @@ bool AssemblyObjectFinderPatRec::Configuration::is_valid() const
 
   if(angles_finestep_ > angles_finemax_){ return false; }
 
+  if(prediction_enabled_)
+  {
+    if(prediction_windowXY_    <= 0.){ return false; }
+    if(prediction_windowAngle_ <= 0.){ return false; }
+  }
+
   return true;
 }
 
@@ -362,7 +408,10 @@ void AssemblyObjectFinderPatRec::template_matching(const AssemblyObjectFinderPat
     output_dir_exists = assembly::DirectoryExists(output_dir);
   }
 
-  output_subdir = save_subdir_images_ ? output_dir+output_subdir_name_ : "";
+  AssemblyArtifactWriter* const artifacts = AssemblyArtifactWriter::instance();
+
+  // the rotated master images are only saved in "full" artifact mode
+  output_subdir = (save_subdir_images_ && artifacts->enabled(AssemblyArtifactWriter::Full)) ? output_dir+output_subdir_name_ : "";
 
   const double angle_fine_min  = -1.0 * conf.angles_finemax_;
   const double angle_fine_max  = +1.0 * conf.angles_finemax_;
@@ -389,20 +438,20 @@ void AssemblyObjectFinderPatRec::template_matching(const AssemblyObjectFinderPat
   const std::string filepath_img_master_PatRec = output_dir+"/image_master_PatRec.png";
   const std::string filepath_img_templa_PatRec = output_dir+"/image_template_PatRec.png";
 
-  assembly::cv_imwrite(filepath_img_master, img_master);
+  artifacts->write_image(AssemblyArtifactWriter::Summary, filepath_img_master, img_master);
 
   NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "template_matching"
-     << ": saved master image to " << filepath_img_master;
+     << ": queued master image for " << filepath_img_master;
 
-  assembly::cv_imwrite(filepath_img_master_PatRec, img_master_PatRec);
+  artifacts->write_image(AssemblyArtifactWriter::Full, filepath_img_master_PatRec, img_master_PatRec);
 
   NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "template_matching"
-     << ": saved PatRec-input master image to " << filepath_img_master_PatRec;
+     << ": queued PatRec-input master image for " << filepath_img_master_PatRec;
 
-  assembly::cv_imwrite(filepath_img_templa_PatRec, img_templa_PatRec);
+  artifacts->write_image(AssemblyArtifactWriter::Full, filepath_img_templa_PatRec, img_templa_PatRec);
 
   NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "template_matching"
-     << ": saved PatRec-input template image to " << filepath_img_templa_PatRec;
+     << ": queued PatRec-input template image for " << filepath_img_templa_PatRec;
   // -----------
 
   // --- Template Matching
@@ -424,93 +473,361 @@ void AssemblyObjectFinderPatRec::template_matching(const AssemblyObjectFinderPat
   const int match_method = CV_TM_SQDIFF_NORMED;
   const bool use_minFOM = ((match_method  == CV_TM_SQDIFF) || (match_method == CV_TM_SQDIFF_NORMED));
 
-  NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "template_matching" << ": initiated matching routine with angular scan";
+  // parameters are read from one snapshot, so they cannot change during the execution
+  const std::shared_ptr<const AssemblyParameters::Snapshot> params = AssemblyParameters::instance(false)->snapshot();
+
+  const bool subpixel_refinement = bool(params->get(param_SubPixelRefinement_));
 
-  // First, get angle-prescan angle: best guess of central value for finer angular scan
-  double angle_prescan(-9999.);
+  const int angle_fit_neighbours = std::max(1, int(params->get(param_AngleFitNeighbours_)));
+
+  double    best_FOM  (0.);
+  double    best_angle(0.);
+  cv::Point best_matchLoc;
+
+  std::vector<std::pair<double, double> > vec_angleNfom;
+
+  //
+  // predicted search (e.g. second and later iterations of the alignment):
+  //   the template is only matched in a window around the predicted position and angle,
+  //   the full search below is used if no prediction is given, or if the predicted search is not confirmed
+  //
+  bool predicted_search(false);
 
-  if(prescan_angles.size() > 0)
+  if(conf.prediction_enabled_)
   {
-    double best_FOM(0.);
+    const double reference_FOM = reference_FOMs_.value(conf.template_filepath_, -1.);
+
+    const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+
+    predicted_search = this->PatRec_predicted(best_FOM, best_angle, best_matchLoc, vec_angleNfom, conf, img_master_PatRec, img_templa_PatRec_gs, match_method, reference_FOM, *params);
+
+    const double time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+    NQLog("AssemblyObjectFinderPatRec", NQLog::Message) << "template_matching"
+       << ": predicted search " << (predicted_search ? "accepted" : "rejected, running full search") << " (" << time_ms << " ms)"
+       << ": best_angle=" << best_angle << ", best_FOM=" << best_FOM << ", reference FOM=" << reference_FOM;
+  }
 
-    for(unsigned int i=0; i<prescan_angles.size(); ++i)
+  if(predicted_search == false)
+  {
+    //
+    // coarse-to-fine search:
+    //   the angular scans run on master and template images downscaled by a Gaussian pyramid,
+    //   then the best (angle, position) candidates of the coarse scan are refined level by level
+    //   in small windows around their position, up to the full resolution;
+    //   with zero pyramid levels, the angular scans are done exhaustively at full resolution
+    //
+    int pyramid_levels = std::max(0, (conf.pyramid_levels_ >= 0) ? conf.pyramid_levels_ : int(params->get(param_PyramidLevels_)));
+
+    const unsigned int pyramid_candidates = std::max(1, int(params->get(param_PyramidCandidates_)));
+
+    // the template must keep enough structure at the coarsest level
+    while((pyramid_levels > 0) && ((std::min(img_templa_PatRec_gs.cols, img_templa_PatRec_gs.rows) >> pyramid_levels) < 16))
     {
-      const double i_angle = prescan_angles.at(i);
+      --pyramid_levels;
+
+      NQLog("AssemblyObjectFinderPatRec", NQLog::Warning) << "template_matching"
+         << ": template image too small for the requested pyramid depth, reduced number of pyramid levels to " << pyramid_levels;
+    }
 
-      double i_FOM(0.);
-      cv::Point i_matchLoc;
+    std::vector<cv::Mat> pyr_master(1, img_master_PatRec);
+    std::vector<cv::Mat> pyr_templa(1, img_templa_PatRec_gs);
 
-      this->PatRec(i_FOM, i_matchLoc, img_master_PatRec, img_templa_PatRec_gs, i_angle, match_method);
+    for(int i_level=1; i_level<=pyramid_levels; ++i_level)
+    {
+      cv::Mat i_master, i_templa;
 
-      const bool update = (i==0) || (use_minFOM ? (i_FOM < best_FOM) : (i_FOM > best_FOM));
+      cv::pyrDown(pyr_master.back(), i_master);
+      cv::pyrDown(pyr_templa.back(), i_templa);
 
-      if(update){ best_FOM = i_FOM; angle_prescan = i_angle; }
+      pyr_master.emplace_back(i_master);
+      pyr_templa.emplace_back(i_templa);
     }
-  }
-  else
-  {
-    NQLog("AssemblyObjectFinderPatRec", NQLog::Critical) << "template_matching"
-       << ": empty list of pre-scan angles, stopping Pattern Recognition";
 
-    return;
-  }
+    // images used in the angular scans (coarsest pyramid level)
+    const cv::Mat& img_master_scan = pyr_master.back();
+    const cv::Mat& img_templa_scan = pyr_templa.back();
 
-  NQLog("AssemblyObjectFinderPatRec", NQLog::Message) << "template_matching" << ": pre-scan estimate of best-angle yields best-angle=" << angle_prescan;
-  // ----------------
+    NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "template_matching" << ": initiated matching routine with angular scan"
+       << " (pyramid levels=" << pyramid_levels << ", master image " << img_master_scan.cols << "x" << img_master_scan.rows << ")";
 
-  NQLog("AssemblyObjectFinderPatRec", NQLog::Message) << "template_matching" << ": angular scan parameters"
-     << "(min="<< angle_prescan+angle_fine_min << ", max=" << angle_prescan+angle_fine_max << ", step=" << angle_fine_step << ")";
+    // angles of the fine scan, relative to the best angle of the pre-scan
+    std::vector<double> fine_offsets;
+    if(angle_fine_step > 0.)
+    {
+      for(double angle_fine=angle_fine_min; angle_fine<=angle_fine_max; angle_fine += angle_fine_step)
+      {
+        fine_offsets.emplace_back(angle_fine);
+      }
+    }
 
-  if(angle_fine_step == 0.)
-  {
-    NQLog("AssemblyObjectFinderPatRec", NQLog::Critical) << "template_matching"
-       << ": invalid value of step-angle for fine angular scan (zero), stopping routine";
+    // rotated-template bank for the pre-scan and for the fine scan around any pre-scan angle,
+    // loaded from (or saved to) the disk cache
+    AssemblyTemplateBank bank;
 
-    NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "template_matching"
-       << ": emitting signal \"PatRec_exitcode(1)\"";
+    const std::vector<double> bank_angles = AssemblyTemplateBank::union_angles(prescan_angles, fine_offsets);
 
-    emit PatRec_exitcode(1);
+    if(use_template_bank_)
+    {
+      bank.prepare(conf.template_filepath_, img_templa_scan, pyramid_levels, bank_angles, template_bank_cache_dir_, template_bank_cache_size_);
 
-    return;
-  }
+      NQLog("AssemblyObjectFinderPatRec", NQLog::Message) << "template_matching"
+         << ": using rotated-template bank for the angular scans (" << bank_angles.size() << " angles, "
+         << (bank.loaded_from_cache() ? "loaded from cache" : "created") << ")";
+    }
 
-  const int N_rotations = (2 * int((angle_fine_max-angle_fine_min) / angle_fine_step));
+    // First, get angle-prescan angle: best guess of central value for finer angular scan
+    double angle_prescan(-9999.);
 
-  std::vector<std::pair<double, double> > vec_angleNfom;
-  vec_angleNfom.reserve(N_rotations);
+    if(prescan_angles.size() > 0)
+    {
+      std::vector<double>    prescan_FOMs;
+      std::vector<cv::Point> prescan_matchLocs;
 
-  double    best_FOM  (0.);
-  double    best_angle(0.);
-  cv::Point best_matchLoc;
+      this->PatRec_angularScan(prescan_FOMs, prescan_matchLocs, img_master_scan, img_templa_scan, prescan_angles, match_method, "", use_template_bank_ ? &bank : nullptr);
 
-  for(double angle_fine=angle_fine_min; angle_fine<=angle_fine_max; angle_fine += angle_fine_step)
-  {
-    const unsigned int scan_counter = vec_angleNfom.size();
+      double prescan_best_FOM(0.);
 
-    const double i_angle = angle_prescan + angle_fine;
+      for(unsigned int i=0; i<prescan_angles.size(); ++i)
+      {
+        const double i_FOM = prescan_FOMs.at(i);
 
-    double i_FOM(0.);
-    cv::Point i_matchLoc;
+        const bool update = (i==0) || (use_minFOM ? (i_FOM < prescan_best_FOM) : (i_FOM > prescan_best_FOM));
 
-    this->PatRec(i_FOM, i_matchLoc, img_master_PatRec, img_templa_PatRec_gs, i_angle, match_method, output_subdir);
+        if(update){ prescan_best_FOM = i_FOM; angle_prescan = prescan_angles.at(i); }
+      }
+    }
+    else
+    {
+      NQLog("AssemblyObjectFinderPatRec", NQLog::Critical) << "template_matching"
+         << ": empty list of pre-scan angles, stopping Pattern Recognition";
 
-    const bool update = (scan_counter == 0) || (use_minFOM ? (i_FOM < best_FOM) : (i_FOM > best_FOM));
+      return;
+    }
 
-    if(update)
+    NQLog("AssemblyObjectFinderPatRec", NQLog::Message) << "template_matching" << ": pre-scan estimate of best-angle yields best-angle=" << angle_prescan;
+    // ----------------
+
+    NQLog("AssemblyObjectFinderPatRec", NQLog::Message) << "template_matching" << ": angular scan parameters"
+       << "(min="<< angle_prescan+angle_fine_min << ", max=" << angle_prescan+angle_fine_max << ", step=" << angle_fine_step << ")";
+
+    if(angle_fine_step == 0.)
     {
-      best_FOM      = i_FOM;
-      best_angle    = i_angle;
-      best_matchLoc = i_matchLoc;
+      NQLog("AssemblyObjectFinderPatRec", NQLog::Critical) << "template_matching"
+         << ": invalid value of step-angle for fine angular scan (zero), stopping routine";
+
+      NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "template_matching"
+         << ": emitting signal \"PatRec_exitcode(1)\"";
+
+      emit PatRec_exitcode(1);
+
+      return;
     }
 
-    vec_angleNfom.emplace_back(std::make_pair(i_angle, i_FOM));
+    std::vector<double> fine_angles;
+    for(const auto& angle_fine : fine_offsets)
+    {
+      fine_angles.emplace_back(angle_prescan + angle_fine);
+    }
 
-    NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "template_matching"
-       << ": angular scan: [" << scan_counter << "] angle=" << i_angle << ", FOM=" << i_FOM;
+    // the angles are matched in parallel; the best match is selected afterwards in scan order,
+    // so that the result does not depend on the order in which the workers finish
+    std::vector<double>    fine_FOMs;
+    std::vector<cv::Point> fine_matchLocs;
+
+    this->PatRec_angularScan(fine_FOMs, fine_matchLocs, img_master_scan, img_templa_scan, fine_angles, match_method, output_subdir, use_template_bank_ ? &bank : nullptr);
+
+    if(benchmark_template_bank_)
+    {
+      this->benchmark_templateBank(output_dir, conf.template_filepath_, img_master_scan, img_templa_scan, pyramid_levels, fine_angles, bank_angles, match_method);
+    }
+
+    vec_angleNfom.clear();
+    vec_angleNfom.reserve(fine_angles.size());
+
+    for(unsigned int scan_counter=0; scan_counter<fine_angles.size(); ++scan_counter)
+    {
+      const double i_angle = fine_angles.at(scan_counter);
+      const double i_FOM   = fine_FOMs  .at(scan_counter);
+
+      const bool update = (scan_counter == 0) || (use_minFOM ? (i_FOM < best_FOM) : (i_FOM > best_FOM));
+
+      if(update)
+      {
+        best_FOM      = i_FOM;
+        best_angle    = i_angle;
+        best_matchLoc = fine_matchLocs.at(scan_counter);
+      }
+
+      vec_angleNfom.emplace_back(std::make_pair(i_angle, i_FOM));
+
+      NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "template_matching"
+         << ": angular scan: [" << scan_counter << "] angle=" << i_angle << ", FOM=" << i_FOM;
+    }
+
+    NQLog("AssemblyObjectFinderPatRec", NQLog::Message) << "template_matching"
+       << ": angular scan completed: best_angle=" << best_angle;
+
+    if(pyramid_levels > 0)
+    {
+      // candidates of the coarse scan, best FOM first (ties keep the scan order)
+      std::vector<unsigned int> candidates(fine_angles.size());
+      std::iota(candidates.begin(), candidates.end(), 0);
+
+      std::stable_sort(candidates.begin(), candidates.end(), [&fine_FOMs, use_minFOM](const unsigned int i, const unsigned int j)
+      {
+        return use_minFOM ? (fine_FOMs.at(i) < fine_FOMs.at(j)) : (fine_FOMs.at(i) > fine_FOMs.at(j));
+      });
+
+      // half-width [pixels] of the search window, in pixels of the coarser level:
+      // covers the rounding of the position at the coarser level, and the sub-pixel shifts of pyrDown;
+      // at each finer level, the window is widened accordingly (same area of the object plane)
+      const int refine_margin = 4;
+
+      const cv::Point2f center_coarse(img_master_scan  .cols/2.0F, img_master_scan  .rows/2.0F);
+      const cv::Point2f center_full  (img_master_PatRec.cols/2.0F, img_master_PatRec.rows/2.0F);
+
+      // the neighbouring angles of a candidate match at about the same position:
+      // keep the best candidate of each position (position of the template center), up to the requested number of candidates
+      {
+        std::vector<cv::Point2f> centers;
+
+        std::vector<unsigned int> candidates_distinct;
+
+        for(const auto& i_cand : candidates)
+        {
+          if(candidates_distinct.size() >= pyramid_candidates){ break; }
+
+          const cv::Point2f i_center = this->RotateMatchLoc(center_coarse, fine_matchLocs.at(i_cand), fine_angles.at(i_cand), 0., img_templa_scan.size())
+                                     + cv::Point2f(img_templa_scan.cols/2.0F, img_templa_scan.rows/2.0F);
+
+          const bool distinct = std::none_of(centers.begin(), centers.end(), [&i_center, refine_margin](const cv::Point2f& j_center)
+          {
+            return (std::fabs(i_center.x - j_center.x) <= refine_margin) && (std::fabs(i_center.y - j_center.y) <= refine_margin);
+          });
+
+          if(distinct)
+          {
+            centers.emplace_back(i_center);
+
+            candidates_distinct.emplace_back(i_cand);
+          }
+        }
+
+        candidates = candidates_distinct;
+      }
+
+      std::vector<cv::Scalar> fill_values;
+      for(const auto& i_master : pyr_master){ fill_values.emplace_back(cv::mean(i_master)); }
+
+      PatRecWorkspace workspace;
+
+      // full-resolution position (top-left corner, master-image frame) and angle of each refined candidate
+      std::vector<std::pair<cv::Point, double> > refined;
+
+      for(unsigned int i_cand=0; i_cand<candidates.size(); ++i_cand)
+      {
+        const double i_angle = fine_angles.at(candidates.at(i_cand));
+
+        // top-left corner of the template in the rotated master image of the coarsest level
+        cv::Point i_loc = this->RotatePoint(center_coarse, fine_matchLocs.at(candidates.at(i_cand)), i_angle);
+
+        double i_FOM(0.);
+
+        for(int i_level=pyramid_levels-1; i_level>=0; --i_level)
+        {
+          i_loc *= 2;
+
+          const int i_margin = refine_margin << (pyramid_levels - 1 - i_level);
+
+          this->PatRec_refine(i_FOM, i_loc, pyr_master.at(i_level), pyr_templa.at(i_level), i_angle, match_method, i_margin, fill_values.at(i_level), workspace);
+        }
+
+        NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "template_matching"
+           << ": pyramid refinement: candidate [" << i_cand << "] angle=" << i_angle
+           << ", coarse FOM=" << fine_FOMs.at(candidates.at(i_cand)) << ", refined FOM=" << i_FOM;
+
+        refined.emplace_back(std::make_pair(cv::Point(this->RotatePoint(center_full, i_loc, -i_angle)), i_angle));
+      }
+
+      //
+      // final pass over all the scan angles at full resolution, in a window around each refined candidate:
+      // the coarse FOM(angle) can be too flat to single out the best angle or position among the candidates;
+      // the position of a candidate is carried to the other angles through the center of the template
+      // (the top-left corner moves with the angle); the best FOM(angle) values of this pass replace the coarse ones in the output plot
+      //
+      const int final_margin = refine_margin << (pyramid_levels - 1);
+
+      vec_angleNfom.clear();
+
+      for(unsigned int scan_counter=0; scan_counter<fine_angles.size(); ++scan_counter)
+      {
+        const double i_angle = fine_angles.at(scan_counter);
+
+        double i_best_FOM(0.);
+
+        for(unsigned int i_cand=0; i_cand<refined.size(); ++i_cand)
+        {
+          cv::Point i_loc = this->RotateMatchLoc(center_full, refined.at(i_cand).first, refined.at(i_cand).second, i_angle, img_templa_PatRec_gs.size());
+
+          double i_FOM(0.);
+
+          this->PatRec_refine(i_FOM, i_loc, img_master_PatRec, img_templa_PatRec_gs, i_angle, match_method, final_margin, fill_values.at(0), workspace);
+
+          if((i_cand == 0) || (use_minFOM ? (i_FOM < i_best_FOM) : (i_FOM > i_best_FOM))){ i_best_FOM = i_FOM; }
+
+          const bool update = ((scan_counter == 0) && (i_cand == 0)) || (use_minFOM ? (i_FOM < best_FOM) : (i_FOM > best_FOM));
+
+          if(update)
+          {
+            best_FOM      = i_FOM;
+            best_angle    = i_angle;
+            best_matchLoc = this->RotatePoint(center_full, i_loc, -i_angle);
+          }
+        }
+
+        vec_angleNfom.emplace_back(std::make_pair(i_angle, i_best_FOM));
+      }
+
+      NQLog("AssemblyObjectFinderPatRec", NQLog::Message) << "template_matching"
+         << ": pyramid refinement completed (" << refined.size() << " candidate positions): best_angle=" << best_angle << ", best_FOM=" << best_FOM;
+    }
+
+    // reference for the predicted searches with this template
+    reference_FOMs_[conf.template_filepath_] = best_FOM;
   }
 
-  NQLog("AssemblyObjectFinderPatRec", NQLog::Message) << "template_matching"
-     << ": angular scan completed: best_angle=" << best_angle;
+  //
+  // sub-step angle and sub-pixel position of the best match:
+  //   the angle is the minimum (maximum) of a parabola fitted to FOM(angle) around the best angle of the scan,
+  //   then the template is matched at that angle in a small window around the best position,
+  //   and the position is interpolated on the resulting match surface
+  //
+  double      best_angle_subpix(best_angle);
+  cv::Point2f best_matchLoc_subpix(best_matchLoc.x, best_matchLoc.y);
+
+  if(subpixel_refinement)
+  {
+    best_angle_subpix = this->PatRec_fitAngle(vec_angleNfom, best_angle, angle_fit_neighbours, use_minFOM);
+
+    const cv::Point2f center_full(img_master_PatRec.cols/2.0F, img_master_PatRec.rows/2.0F);
+
+    cv::Point i_loc = this->RotateMatchLoc(center_full, best_matchLoc, best_angle, best_angle_subpix, img_templa_PatRec_gs.size());
+
+    double i_FOM(0.);
+
+    cv::Point2f i_loc_subpix;
+
+    PatRecWorkspace workspace;
+
+    this->PatRec_refine(i_FOM, i_loc, img_master_PatRec, img_templa_PatRec_gs, best_angle_subpix, match_method, 2, cv::mean(img_master_PatRec), workspace, &i_loc_subpix);
+
+    best_matchLoc_subpix = this->RotatePoint(center_full, i_loc_subpix, -best_angle_subpix);
+
+    NQLog("AssemblyObjectFinderPatRec", NQLog::Message) << "template_matching"
+       << ": sub-pixel refinement: angle=" << best_angle_subpix << " (scan: " << best_angle << ")"
+       << ", position=(" << best_matchLoc_subpix.x << ", " << best_matchLoc_subpix.y << ") (scan: " << best_matchLoc.x << ", " << best_matchLoc.y << ")";
+  }
 
   // copy of master image
   cv::Mat img_master_copy = img_master.clone();
@@ -536,54 +853,55 @@ void AssemblyObjectFinderPatRec::template_matching(const AssemblyObjectFinderPat
   // ----------------------------------------
 
   // FOM(angle) plot
+  //  - drawn and saved by the artifact writer (ROOT graphics runs there, one plot at a time)
+  //  - the plot is shown in the GUI once the PNG file exists
   if(vec_angleNfom.size() > 0)
   {
-    TCanvas c1("FOM", "Rotation extraction", 200, 10, 700, 500);
-
-    TGraph gr_scan;
-    for(unsigned int idx=0; idx<vec_angleNfom.size(); ++idx)
-    {
-      gr_scan.SetPoint(idx, vec_angleNfom.at(idx).first, vec_angleNfom.at(idx).second);
-    }
-
-//    gr_scan.Fit("pol6");
-
-    gr_scan.Draw("AC*");
-    gr_scan.SetName("PatRec_FOM");
-    gr_scan.GetHistogram()->GetXaxis()->SetTitle("angle (degrees)");
-    gr_scan.GetHistogram()->GetYaxis()->SetTitle("PatRec FOM");
-    gr_scan.GetHistogram()->SetTitle("");
-
-    TGraph gr_best;
-    gr_best.SetPoint(0, best_angle, best_FOM);
-    gr_best.SetMarkerColor(2);
-    gr_best.SetMarkerStyle(22);
-    gr_best.SetMarkerSize(3);
-    gr_best.Draw("PSAME");
-    gr_best.SetName("PatRec_FOM_best");
-
     const std::string filepath_FOM_base = output_dir+"/RotationExtraction";
 
     const std::string filepath_FOM_png  = filepath_FOM_base+".png";
     const std::string filepath_FOM_root = filepath_FOM_base+".root";
 
-    c1.SaveAs(filepath_FOM_png.c_str());
-
-    TFile o_file(filepath_FOM_root.c_str(), "recreate");
-    o_file.cd();
-    gr_scan.Write();
-    gr_best.Write();
-    o_file.Close();
-
-    NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "template_matching"
-       << ": emitting signal \"PatRec_res_image_angscan(" << filepath_FOM_png << ")\"";
-
-    emit PatRec_res_image_angscan(QString::fromStdString(filepath_FOM_png));
+    // shown in the GUI once written (show_angscan_plot, in the thread of the finder)
+    artifacts->write_plot(AssemblyArtifactWriter::Summary, filepath_FOM_png, [vec_angleNfom, best_angle, best_FOM, filepath_FOM_png, filepath_FOM_root]()
+    {
+      TCanvas c1("FOM", "Rotation extraction", 200, 10, 700, 500);
+
+      TGraph gr_scan;
+      for(unsigned int idx=0; idx<vec_angleNfom.size(); ++idx)
+      {
+        gr_scan.SetPoint(idx, vec_angleNfom.at(idx).first, vec_angleNfom.at(idx).second);
+      }
+
+//      gr_scan.Fit("pol6");
+
+      gr_scan.Draw("AC*");
+      gr_scan.SetName("PatRec_FOM");
+      gr_scan.GetHistogram()->GetXaxis()->SetTitle("angle (degrees)");
+      gr_scan.GetHistogram()->GetYaxis()->SetTitle("PatRec FOM");
+      gr_scan.GetHistogram()->SetTitle("");
+
+      TGraph gr_best;
+      gr_best.SetPoint(0, best_angle, best_FOM);
+      gr_best.SetMarkerColor(2);
+      gr_best.SetMarkerStyle(22);
+      gr_best.SetMarkerSize(3);
+      gr_best.Draw("PSAME");
+      gr_best.SetName("PatRec_FOM_best");
+
+      c1.SaveAs(filepath_FOM_png.c_str());
+
+      TFile o_file(filepath_FOM_root.c_str(), "recreate");
+      o_file.cd();
+      gr_scan.Write();
+      gr_best.Write();
+      o_file.Close();
+    }, this, "show_angscan_plot");
   }
   // ---
 
   const std::string filepath_img_master_copy = output_dir+"/image_master_PatRec_edited.png";
-  assembly::cv_imwrite(filepath_img_master_copy, img_master_copy);
+  artifacts->write_image(AssemblyArtifactWriter::Summary, filepath_img_master_copy, img_master_copy);
 
   NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "template_matching"
      << ": emitting signal \"PatRec_res_image_master_edited()\"";
@@ -598,8 +916,8 @@ void AssemblyObjectFinderPatRec::template_matching(const AssemblyObjectFinderPat
   {
     QTextStream txts(&txtfile);
 
-    txts << "# best_matchLoc.x best_matchLoc.y best_angle\n";
-    txts << best_matchLoc.x << " " << best_matchLoc.y << " " << best_angle << "\n";
+    txts << "# best_matchLoc.x best_matchLoc.y best_angle (sub-pixel/sub-step) scan_matchLoc.x scan_matchLoc.y scan_angle (scan grid)\n";
+    txts << best_matchLoc_subpix.x << " " << best_matchLoc_subpix.y << " " << best_angle_subpix << " " << best_matchLoc.x << " " << best_matchLoc.y << " " << best_angle << "\n";
   }
 
   NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "template_matching"
@@ -625,23 +943,21 @@ void AssemblyObjectFinderPatRec::template_matching(const AssemblyObjectFinderPat
   //   in order to convert this to a normal XY ref-frame,
   //   we invert the sign of the value on the Y-axis.
   //
-  const AssemblyParameters* const params = AssemblyParameters::instance(false);
+  const double angle_FromCameraXYtoRefFrameXY_deg = params->get(param_AngleOfCameraFrame_);
 
-  const double angle_FromCameraXYtoRefFrameXY_deg = params->get("AngleOfCameraFrameInRefFrame_dA");
-
-  const double dX_0 = +1.0 * (best_matchLoc.x - (img_master_copy.cols / 2.0)) * mm_per_pixel_col_;
-  const double dY_0 = -1.0 * (best_matchLoc.y - (img_master_copy.rows / 2.0)) * mm_per_pixel_row_;
+  const double dX_0 = +1.0 * (best_matchLoc_subpix.x - (img_master_copy.cols / 2.0)) * mm_per_pixel_col_;
+  const double dY_0 = -1.0 * (best_matchLoc_subpix.y - (img_master_copy.rows / 2.0)) * mm_per_pixel_row_;
 
   NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "template_matching"
-     << ": best matching position in pixels x = " << best_matchLoc.x << ", y = " << best_matchLoc.y << "\"";
+     << ": best matching position in pixels x = " << best_matchLoc_subpix.x << ", y = " << best_matchLoc_subpix.y << "\"";
 
   double patrec_dX, patrec_dY;
   assembly::rotation2D_deg(patrec_dX, patrec_dY, angle_FromCameraXYtoRefFrameXY_deg, dX_0, dY_0);
 
   NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "template_matching"
-     << ": emitting signal \"PatRec_results(" << patrec_dX << ", " << patrec_dY << ", " << best_angle << ")\"";
+     << ": emitting signal \"PatRec_results(" << patrec_dX << ", " << patrec_dY << ", " << best_angle_subpix << ")\"";
 
-  emit PatRec_results(patrec_dX, patrec_dY, best_angle);
+  emit PatRec_results(patrec_dX, patrec_dY, best_angle_subpix);
 
   // -----------------------------
 
@@ -657,10 +973,110 @@ void AssemblyObjectFinderPatRec::template_matching(const AssemblyObjectFinderPat
   return;
 }
 
-void AssemblyObjectFinderPatRec::PatRec(double& fom, cv::Point& match_loc, const cv::Mat& img_master_PatRec, const cv::Mat& img_templa_PatRec, const double angle, const int match_method, const std::string& out_dir) const
+//
+// worker of the parallel angular scan:
+// every worker handles a contiguous block of angles with its own scratch images,
+// and stores the results at the index of the angle, so no locking is needed
+//
+class AssemblyObjectFinderPatRec::AngularScanBody : public cv::ParallelLoopBody
+{
+ public:
+
+  AngularScanBody(const AssemblyObjectFinderPatRec* const finder, std::vector<double>& foms, std::vector<cv::Point>& match_locs,
+                  const cv::Mat& img_master_PatRec, const cv::Mat& img_templa_PatRec, const std::vector<double>& angles,
+                  const int match_method, const std::string& out_dir, const AssemblyTemplateBank* const bank, const int N_stripes) :
+    finder_(finder),
+    foms_(foms),
+    match_locs_(match_locs),
+    img_master_PatRec_(img_master_PatRec),
+    img_templa_PatRec_(img_templa_PatRec),
+    angles_(angles),
+    match_method_(match_method),
+    out_dir_(out_dir),
+    fill_value_(cv::mean(img_master_PatRec)),
+    bank_(bank),
+    N_stripes_(N_stripes)
+  {
+    // squared master image, shared by all the workers of the template-bank matching
+    if(bank_ != nullptr)
+    {
+      img_master_PatRec.convertTo(img_master_PatRec_sq_, CV_32FC1);
+
+      img_master_PatRec_sq_ = img_master_PatRec_sq_.mul(img_master_PatRec_sq_);
+    }
+  }
+
+  virtual void operator()(const cv::Range& stripes) const
+  {
+    const int N_angles = angles_.size();
+
+    const int i_begin = (stripes.start * N_angles) / N_stripes_;
+    const int i_end   = (stripes.end   * N_angles) / N_stripes_;
+
+    AssemblyObjectFinderPatRec::PatRecWorkspace workspace;
+
+    for(int i=i_begin; i<i_end; ++i)
+    {
+      const AssemblyTemplateBank::Entry* const bank_entry = (bank_ != nullptr) ? bank_->entry(angles_.at(i)) : nullptr;
+
+      if(bank_entry != nullptr)
+      {
+        finder_->PatRec_templateBank(foms_.at(i), match_locs_.at(i), img_master_PatRec_, img_master_PatRec_sq_, *bank_entry, match_method_, workspace);
+      }
+      else
+      {
+        finder_->PatRec(foms_.at(i), match_locs_.at(i), img_master_PatRec_, img_templa_PatRec_, angles_.at(i), match_method_, fill_value_, workspace, out_dir_);
+      }
+    }
+  }
+
+ protected:
+
+  const AssemblyObjectFinderPatRec* const finder_;
+
+  std::vector<double>&    foms_;
+  std::vector<cv::Point>& match_locs_;
+
+  const cv::Mat& img_master_PatRec_;
+  const cv::Mat& img_templa_PatRec_;
+
+  const std::vector<double>& angles_;
+
+  const int         match_method_;
+  const std::string out_dir_;
+
+  const cv::Scalar fill_value_;
+
+  const AssemblyTemplateBank* const bank_;
+
+  cv::Mat img_master_PatRec_sq_;
+
+  const int N_stripes_;
+};
+
+void AssemblyObjectFinderPatRec::PatRec_angularScan(std::vector<double>& foms, std::vector<cv::Point>& match_locs, const cv::Mat& img_master_PatRec, const cv::Mat& img_templa_PatRec, const std::vector<double>& angles, const int match_method, const std::string& out_dir, const AssemblyTemplateBank* const bank) const
+{
+  foms      .assign(angles.size(), 0.);
+  match_locs.assign(angles.size(), cv::Point());
+
+  if(angles.empty()){ return; }
+
+  const int N_stripes = std::max(1, std::min(int(angles.size()), cv::getNumThreads()));
+
+  // the template bank only supports the SQDIFF methods
+  const bool use_bank = (bank != nullptr) && ((match_method == CV_TM_SQDIFF) || (match_method == CV_TM_SQDIFF_NORMED));
+
+  const AngularScanBody scan_body(this, foms, match_locs, img_master_PatRec, img_templa_PatRec, angles, match_method, out_dir, use_bank ? bank : nullptr, N_stripes);
+
+  cv::parallel_for_(cv::Range(0, N_stripes), scan_body, N_stripes);
+
+  return;
+}
+
+void AssemblyObjectFinderPatRec::PatRec(double& fom, cv::Point& match_loc, const cv::Mat& img_master_PatRec, const cv::Mat& img_templa_PatRec, const double angle, const int match_method, const cv::Scalar& fill_value, PatRecWorkspace& workspace, const std::string& out_dir) const
 {
   // rotated master image
-  cv::Mat img_master_PatRec_rot;
+  cv::Mat& img_master_PatRec_rot = workspace.img_master_PatRec_rot_;
 
   const cv::Point2f src_center(img_master_PatRec.cols/2.0F, img_master_PatRec.rows/2.0F);
 
@@ -674,23 +1090,21 @@ void AssemblyObjectFinderPatRec::PatRec(double& fom, cv::Point& match_loc, const
 
   const cv::Mat rot_mat = cv::getRotationMatrix2D(src_center, angle_master, 1.0);
 
-  const cv::Scalar avgPixelIntensity = cv::mean(img_master_PatRec);
-
-  warpAffine(img_master_PatRec, img_master_PatRec_rot, rot_mat, img_master_PatRec.size(), cv::INTER_NEAREST, cv::BORDER_CONSTANT, avgPixelIntensity);
+  warpAffine(img_master_PatRec, img_master_PatRec_rot, rot_mat, img_master_PatRec.size(), cv::INTER_NEAREST, cv::BORDER_CONSTANT, fill_value);
 
   if(out_dir != "")
   {
     const std::string filepath_img_master_PatRec_rot = out_dir+"/image_master_PatRec_Rotation_"+std::to_string(angle_master)+".png";
 
-    assembly::cv_imwrite(filepath_img_master_PatRec_rot, img_master_PatRec_rot);
+    AssemblyArtifactWriter::instance()->write_image(AssemblyArtifactWriter::Full, filepath_img_master_PatRec_rot, img_master_PatRec_rot);
 
     NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "PatRec"
-       << ": saved rotated input master image for PatRec to " << filepath_img_master_PatRec_rot;
+       << ": queued rotated input master image for PatRec for " << filepath_img_master_PatRec_rot;
   }
   // -----------
 
   // matrix with PatRec Figure-Of-Merit values
-  cv::Mat result_mat;
+  cv::Mat& result_mat = workspace.result_mat_;
   result_mat.create((img_master_PatRec.rows-img_templa_PatRec.rows+1), (img_master_PatRec.cols-img_templa_PatRec.cols+1), CV_32FC1);
 
   matchTemplate(img_master_PatRec_rot, img_templa_PatRec, result_mat, match_method);
@@ -713,6 +1127,371 @@ void AssemblyObjectFinderPatRec::PatRec(double& fom, cv::Point& match_loc, const
   return;
 }
 
+//
+// matching of a rotated template of the template bank against the (unrotated) master image:
+// the masked squared difference is expanded as  sum(I^2 M) - 2 sum(I T) + sum(T^2),
+// with the rotated template T zeroed outside its validity mask M,
+// so that it only requires two cross-correlations (without mask) of the master image;
+// only the SQDIFF methods are supported (any other method falls back to the master-image rotation in PatRec_angularScan)
+//
+void AssemblyObjectFinderPatRec::PatRec_templateBank(double& fom, cv::Point& match_loc, const cv::Mat& img_master_PatRec, const cv::Mat& img_master_PatRec_sq, const AssemblyTemplateBank::Entry& entry, const int match_method, PatRecWorkspace& workspace) const
+{
+  cv::Mat& result_mat = workspace.result_mat_;
+  cv::Mat& energy_mat = workspace.energy_mat_;
+
+  entry.mask_.convertTo(workspace.mask_, CV_32FC1, 1./255.);
+
+  matchTemplate(img_master_PatRec   , entry.template_, result_mat, CV_TM_CCORR);
+  matchTemplate(img_master_PatRec_sq, workspace.mask_, energy_mat, CV_TM_CCORR);
+
+  // squared difference
+  cv::addWeighted(energy_mat, 1., result_mat, -2., entry.energy_, result_mat);
+
+  if(match_method == CV_TM_SQDIFF_NORMED)
+  {
+    // normalization, as in matchTemplate: FOM=1 where the master image is empty, and FOM<=1
+    cv::max(energy_mat, 0., energy_mat);
+    cv::sqrt(energy_mat * entry.energy_, energy_mat);
+
+    const cv::Mat empty_region = (energy_mat <= 0.);
+
+    energy_mat.setTo(cv::Scalar(1.), empty_region);
+
+    cv::divide(result_mat, energy_mat, result_mat);
+
+    result_mat.setTo(cv::Scalar(1.), empty_region);
+
+    cv::min(result_mat, 1., result_mat);
+  }
+
+  double minVal, maxVal;
+  cv::Point minLoc, maxLoc;
+
+  minMaxLoc(result_mat, &minVal, &maxVal, &minLoc, &maxLoc, cv::Mat());
+
+  fom = minVal;
+
+  // top-left corner of the (unrotated) template in the master image
+  match_loc = cv::Point2f(minLoc.x + entry.origin_.x, minLoc.y + entry.origin_.y);
+
+  return;
+}
+
+//
+// comparison of the rotated-template bank with the rotation of the master image, on the angles of the fine scan:
+// timing of both scans (and of the creation/loading of the template bank on the grid "bank_angles") and best matches, written to PatRec_benchmark.txt
+//
+void AssemblyObjectFinderPatRec::benchmark_templateBank(const std::string& output_dir, const QString& template_filepath, const cv::Mat& img_master_PatRec, const cv::Mat& img_templa_PatRec, const int pyramid_level, const std::vector<double>& angles, const std::vector<double>& bank_angles, const int match_method) const
+{
+  if(angles.empty()){ return; }
+
+  typedef std::chrono::steady_clock clock;
+
+  const auto elapsed_ms = [](const clock::time_point& t0){ return std::chrono::duration<double, std::milli>(clock::now() - t0).count(); };
+
+  const bool use_minFOM = ((match_method  == CV_TM_SQDIFF) || (match_method == CV_TM_SQDIFF_NORMED));
+
+  const auto best_index = [use_minFOM](const std::vector<double>& foms)
+  {
+    return (use_minFOM ? std::min_element(foms.begin(), foms.end()) : std::max_element(foms.begin(), foms.end())) - foms.begin();
+  };
+
+  std::vector<double>    foms_master, foms_bank;
+  std::vector<cv::Point> locs_master, locs_bank;
+
+  clock::time_point t0 = clock::now();
+  this->PatRec_angularScan(foms_master, locs_master, img_master_PatRec, img_templa_PatRec, angles, match_method);
+  const double time_master = elapsed_ms(t0);
+
+  // template bank created from scratch (no cache), then loaded from the cache
+  AssemblyTemplateBank bank;
+
+  t0 = clock::now();
+  bank.prepare(template_filepath, img_templa_PatRec, pyramid_level, bank_angles);
+  const double time_bank_create = elapsed_ms(t0);
+
+  t0 = clock::now();
+  bank.prepare(template_filepath, img_templa_PatRec, pyramid_level, bank_angles, template_bank_cache_dir_, template_bank_cache_size_);
+  const double time_bank_load = elapsed_ms(t0);
+
+  t0 = clock::now();
+  this->PatRec_angularScan(foms_bank, locs_bank, img_master_PatRec, img_templa_PatRec, angles, match_method, "", &bank);
+  const double time_bank = elapsed_ms(t0);
+
+  const unsigned int idx_master = best_index(foms_master);
+  const unsigned int idx_bank   = best_index(foms_bank);
+
+  std::stringstream bench_ss;
+  bench_ss << "# angles=" << angles.size() << " master=" << img_master_PatRec.cols << "x" << img_master_PatRec.rows
+           << " template=" << img_templa_PatRec.cols << "x" << img_templa_PatRec.rows << " threads=" << cv::getNumThreads() << "\n";
+  bench_ss << "# method time_ms best_angle best_FOM best_matchLoc.x best_matchLoc.y\n";
+  bench_ss << "master_rotation " << time_master << " " << angles.at(idx_master) << " " << foms_master.at(idx_master) << " " << locs_master.at(idx_master).x << " " << locs_master.at(idx_master).y << "\n";
+  bench_ss << "template_bank "   << time_bank   << " " << angles.at(idx_bank)   << " " << foms_bank  .at(idx_bank)   << " " << locs_bank  .at(idx_bank)  .x << " " << locs_bank  .at(idx_bank)  .y << "\n";
+  bench_ss << "# template bank: creation " << time_bank_create << " ms, " << (bank.loaded_from_cache() ? "loading from cache " : "re-creation ") << time_bank_load << " ms\n";
+
+  NQLog("AssemblyObjectFinderPatRec", NQLog::Message) << "benchmark_templateBank"
+     << ": master rotation " << time_master << " ms (best angle=" << angles.at(idx_master) << "), template bank " << time_bank
+     << " ms (best angle=" << angles.at(idx_bank) << "), bank creation " << time_bank_create << " ms, bank loading " << time_bank_load << " ms";
+
+  const QString txt_file_path = QString::fromStdString(output_dir+"/PatRec_benchmark.txt");
+
+  QFile txtfile(txt_file_path);
+  if(txtfile.open(QIODevice::WriteOnly | QIODevice::Text) == true)
+  {
+    QTextStream txts(&txtfile);
+
+    txts << QString::fromStdString(bench_ss.str());
+  }
+
+  return;
+}
+
+//
+// search restricted to the predicted result of the configuration:
+// the template is matched at full resolution in a window around the predicted position (PatRec_refine),
+// for the angles within the angle window around the predicted angle;
+// the result is rejected if the best match is at the edge of the position or angle window,
+// if there is no reference FOM (full search) for the template, or if the best FOM is worse than the reference
+// by more than the tolerance factor PatRecPredictionFOMTolerance (e.g. the marker is not in the window)
+//
+bool AssemblyObjectFinderPatRec::PatRec_predicted(double& best_FOM, double& best_angle, cv::Point& best_matchLoc, std::vector<std::pair<double, double> >& vec_angleNfom, const Configuration& conf, const cv::Mat& img_master_PatRec, const cv::Mat& img_templa_PatRec, const int match_method, const double reference_FOM, const AssemblyParameters::Snapshot& params) const
+{
+  const double FOM_tolerance = params.get(param_PredictionFOMTolerance_);
+
+  // predicted position of the template (top-left corner) in the master image: inverse of the conversion of the PatRec results
+  double dX_0, dY_0;
+  assembly::rotation2D_deg(dX_0, dY_0, -1.0 * params.get(param_AngleOfCameraFrame_), conf.prediction_dX_, conf.prediction_dY_);
+
+  const cv::Point2f center_full(img_master_PatRec.cols/2.0F, img_master_PatRec.rows/2.0F);
+
+  const cv::Point2f predicted_loc(center_full.x + (dX_0 / mm_per_pixel_col_), center_full.y - (dY_0 / mm_per_pixel_row_));
+
+  const int margin = int(std::ceil(conf.prediction_windowXY_ / std::min(mm_per_pixel_row_, mm_per_pixel_col_)));
+
+  const int max_x = img_master_PatRec.cols - img_templa_PatRec.cols;
+  const int max_y = img_master_PatRec.rows - img_templa_PatRec.rows;
+
+  if((2*margin >= max_x) && (2*margin >= max_y))
+  {
+    NQLog("AssemblyObjectFinderPatRec", NQLog::Spam) << "PatRec_predicted"
+       << ": position window (+-" << margin << " pixels) not smaller than the image, no predicted search";
+
+    return false;
+  }
+
+  // at least 5 angles, so that the best angle can be inside the window
+  const double angle_step = std::min(conf.angles_finestep_, conf.prediction_windowAngle_ / 2.);
+
+  std::vector<double> angles;
+  for(double i_angle=-conf.prediction_windowAngle_; i_angle<=(conf.prediction_windowAngle_ + 1e-6); i_angle += angle_step)
+  {
+    angles.emplace_back(conf.prediction_angle_ + i_angle);
+  }
+
+  const bool use_minFOM = ((match_method  == CV_TM_SQDIFF) || (match_method == CV_TM_SQDIFF_NORMED));
+
+  const cv::Scalar fill_value = cv::mean(img_master_PatRec);
+
+  PatRecWorkspace workspace;
+
+  vec_angleNfom.clear();
+  vec_angleNfom.reserve(angles.size());
+
+  unsigned int idx_best(0);
+
+  bool best_at_edge(false);
+
+  for(unsigned int i=0; i<angles.size(); ++i)
+  {
+    const double i_angle = angles.at(i);
+
+    // predicted top-left corner of the template in the rotated master image
+    const cv::Point loc_pred = this->RotatePoint(center_full, predicted_loc, i_angle);
+
+    cv::Point i_loc = loc_pred;
+
+    double i_FOM(0.);
+
+    this->PatRec_refine(i_FOM, i_loc, img_master_PatRec, img_templa_PatRec, i_angle, match_method, margin, fill_value, workspace);
+
+    const bool update = (i == 0) || (use_minFOM ? (i_FOM < best_FOM) : (i_FOM > best_FOM));
+
+    if(update)
+    {
+      idx_best      = i;
+      best_FOM      = i_FOM;
+      best_angle    = i_angle;
+      best_matchLoc = this->RotatePoint(center_full, i_loc, -i_angle);
+
+      // edge of the window (the borders of the image are not edges of the window)
+      best_at_edge = ((i_loc.x <= (loc_pred.x - margin)) && (i_loc.x > 0)) || ((i_loc.x >= (loc_pred.x + margin)) && (i_loc.x < max_x))
+                  || ((i_loc.y <= (loc_pred.y - margin)) && (i_loc.y > 0)) || ((i_loc.y >= (loc_pred.y + margin)) && (i_loc.y < max_y));
+    }
+
+    vec_angleNfom.emplace_back(std::make_pair(i_angle, i_FOM));
+  }
+
+  if(best_at_edge)
+  {
+    NQLog("AssemblyObjectFinderPatRec", NQLog::Message) << "PatRec_predicted"
+       << ": best match at the edge of the position window (+-" << margin << " pixels)";
+
+    return false;
+  }
+
+  if((idx_best == 0) || (idx_best == (angles.size()-1)))
+  {
+    NQLog("AssemblyObjectFinderPatRec", NQLog::Message) << "PatRec_predicted"
+       << ": best match at the edge of the angle window (" << angles.front() << ", " << angles.back() << ")";
+
+    return false;
+  }
+
+  if(reference_FOM < 0.)
+  {
+    NQLog("AssemblyObjectFinderPatRec", NQLog::Message) << "PatRec_predicted"
+       << ": no reference FOM for this template (no full search yet)";
+
+    return false;
+  }
+
+  if(use_minFOM ? (best_FOM > (reference_FOM * FOM_tolerance)) : (best_FOM < (reference_FOM / FOM_tolerance)))
+  {
+    NQLog("AssemblyObjectFinderPatRec", NQLog::Message) << "PatRec_predicted"
+       << ": best FOM (" << best_FOM << ") not compatible with the reference FOM (" << reference_FOM << ", tolerance factor " << FOM_tolerance << ")";
+
+    return false;
+  }
+
+  return true;
+}
+
+//
+// matching of the template at a single angle, restricted to a window of the rotated master image:
+// only the window around the predicted position "match_loc" (top-left corner of the template in the rotated master image)
+// is rotated and matched, and "match_loc" is updated to the best position inside the window;
+// the FOM values are identical to the ones of the full-image matching in PatRec
+//
+void AssemblyObjectFinderPatRec::PatRec_refine(double& fom, cv::Point& match_loc, const cv::Mat& img_master_PatRec, const cv::Mat& img_templa_PatRec, const double angle, const int match_method, const int margin, const cv::Scalar& fill_value, PatRecWorkspace& workspace, cv::Point2f* const match_loc_subpixel) const
+{
+  // range of template positions in the window, inside the master image
+  const int max_x = img_master_PatRec.cols - img_templa_PatRec.cols;
+  const int max_y = img_master_PatRec.rows - img_templa_PatRec.rows;
+
+  const int x0 = std::max(0, std::min(max_x, match_loc.x - margin));
+  const int x1 = std::max(0, std::min(max_x, match_loc.x + margin));
+  const int y0 = std::max(0, std::min(max_y, match_loc.y - margin));
+  const int y1 = std::max(0, std::min(max_y, match_loc.y + margin));
+
+  const cv::Size window_size((x1-x0) + img_templa_PatRec.cols, (y1-y0) + img_templa_PatRec.rows);
+
+  // same rotation as in PatRec, shifted to the window origin
+  const cv::Point2f src_center(img_master_PatRec.cols/2.0F, img_master_PatRec.rows/2.0F);
+
+  cv::Mat rot_mat = cv::getRotationMatrix2D(src_center, -1.0 * angle, 1.0);
+  rot_mat.at<double>(0, 2) -= x0;
+  rot_mat.at<double>(1, 2) -= y0;
+
+  cv::Mat& img_master_PatRec_rot = workspace.img_master_PatRec_rot_;
+
+  warpAffine(img_master_PatRec, img_master_PatRec_rot, rot_mat, window_size, cv::INTER_NEAREST, cv::BORDER_CONSTANT, fill_value);
+
+  cv::Mat& result_mat = workspace.result_mat_;
+
+  matchTemplate(img_master_PatRec_rot, img_templa_PatRec, result_mat, match_method);
+
+  double minVal, maxVal;
+  cv::Point minLoc, maxLoc;
+
+  minMaxLoc(result_mat, &minVal, &maxVal, &minLoc, &maxLoc, cv::Mat());
+
+  const bool use_minFOM = ((match_method  == CV_TM_SQDIFF) || (match_method == CV_TM_SQDIFF_NORMED));
+
+  if(use_minFOM){ match_loc = minLoc; fom = minVal; }
+  else          { match_loc = maxLoc; fom = maxVal; }
+
+  //
+  // sub-pixel position: vertex of the parabola through the optimum and its two neighbours, separately along x and y
+  // (the SQDIFF surfaces go down to zero, so a Gaussian fit in log scale is not applicable);
+  // no correction at the border of the window, or if the surface is not curved towards the optimum
+  //
+  if(match_loc_subpixel != nullptr)
+  {
+    const auto vertex = [use_minFOM](const float f_m, const float f_0, const float f_p)
+    {
+      const double curv = (f_m - 2.*f_0 + f_p);
+
+      if(use_minFOM ? (curv <= 0.) : (curv >= 0.)){ return 0.; }
+
+      return std::max(-0.5, std::min(0.5, 0.5 * (f_m - f_p) / curv));
+    };
+
+    const int x = match_loc.x;
+    const int y = match_loc.y;
+
+    double dx(0.), dy(0.);
+
+    if((x > 0) && (x < (result_mat.cols-1))){ dx = vertex(result_mat.at<float>(y, x-1), result_mat.at<float>(y, x), result_mat.at<float>(y, x+1)); }
+    if((y > 0) && (y < (result_mat.rows-1))){ dy = vertex(result_mat.at<float>(y-1, x), result_mat.at<float>(y, x), result_mat.at<float>(y+1, x)); }
+
+    *match_loc_subpixel = cv::Point2f(x0 + x + dx, y0 + y + dy);
+  }
+
+  match_loc += cv::Point(x0, y0);
+
+  return;
+}
+
+//
+// sub-step angle of the best match:
+// least-squares parabola through FOM(angle) at the best angle of the scan and at up to "neighbours" scan angles on each side;
+// the FOM(angle) of the fine scan is flat and noisy (nearest-neighbour rotation), so more than three points are used;
+// the scan angle is returned if the best angle is at the edge of the scan, or if the parabola is not curved towards the optimum
+//
+double AssemblyObjectFinderPatRec::PatRec_fitAngle(const std::vector<std::pair<double, double> >& vec_angleNfom, const double best_angle, const int neighbours, const bool use_minFOM) const
+{
+  const int N = vec_angleNfom.size();
+
+  int idx_best(-1);
+  for(int i=0; i<N; ++i)
+  {
+    if(std::fabs(vec_angleNfom.at(i).first - best_angle) < 1e-6){ idx_best = i; break; }
+  }
+
+  if((idx_best <= 0) || (idx_best >= (N-1))){ return best_angle; }
+
+  const int i_min = std::max(0  , idx_best - neighbours);
+  const int i_max = std::min(N-1, idx_best + neighbours);
+
+  // FOM = c0 + c1 * (angle - best_angle) + c2 * (angle - best_angle)^2
+  cv::Mat A(i_max-i_min+1, 3, CV_64FC1);
+  cv::Mat b(i_max-i_min+1, 1, CV_64FC1);
+
+  for(int i=i_min; i<=i_max; ++i)
+  {
+    const double x = vec_angleNfom.at(i).first - best_angle;
+
+    A.at<double>(i-i_min, 0) = 1.;
+    A.at<double>(i-i_min, 1) = x;
+    A.at<double>(i-i_min, 2) = x*x;
+
+    b.at<double>(i-i_min, 0) = vec_angleNfom.at(i).second;
+  }
+
+  cv::Mat c;
+  if(cv::solve(A, b, c, cv::DECOMP_SVD) == false){ return best_angle; }
+
+  const double c1 = c.at<double>(1, 0);
+  const double c2 = c.at<double>(2, 0);
+
+  if(use_minFOM ? (c2 <= 0.) : (c2 >= 0.)){ return best_angle; }
+
+  const double angle_lo = vec_angleNfom.at(i_min).first;
+  const double angle_hi = vec_angleNfom.at(i_max).first;
+
+  return std::max(std::min(angle_lo, angle_hi), std::min(std::max(angle_lo, angle_hi), best_angle - c1 / (2. * c2)));
+}
+
 cv::Point2f AssemblyObjectFinderPatRec::RotatePoint(const cv::Point2f& p, const double deg) const
 {
   const double rad = deg * (M_PI/180.);
@@ -734,6 +1513,21 @@ cv::Point2f AssemblyObjectFinderPatRec::RotatePoint(const cv::Point2f& cen_pt, c
   return fin_pt;
 }
 
+//
+// top-left corner of the template in the master image rotated by "deg",
+// for the template matched at the position "loc" (top-left corner, master-image frame) at the angle "loc_deg":
+// the template center is kept, as the top-left corner moves with the angle
+//
+cv::Point2f AssemblyObjectFinderPatRec::RotateMatchLoc(const cv::Point2f& cen_pt, const cv::Point2f& loc, const double loc_deg, const double deg, const cv::Size& templ_size) const
+{
+  const cv::Point2f half_size(templ_size.width/2.0F, templ_size.height/2.0F);
+
+  // template center in the master-image frame
+  const cv::Point2f templ_center = loc + this->RotatePoint(half_size, -loc_deg);
+
+  return (this->RotatePoint(cen_pt, templ_center, deg) - half_size);
+}
+
 void AssemblyObjectFinderPatRec::draw_RotatedRect(cv::Mat& image, const cv::Point& orig, const double rect_size_x, const double rect_size_y, const double angle, const cv::Scalar& rect_color) const
 {
   const cv::Point2f orig2f(orig.x, orig.y);
@@ -14,10 +14,13 @@
 #define ASSEMBLYOBJECTFINDERPATREC_H
 
 #include <AssemblyThresholder.h>
+#include <AssemblyTemplateBank.h>
+#include <AssemblyParameters.h>
 
 #include <QObject>
 #include <QString>
 #include <QMutex>
+#include <QMap>
 
 #include <opencv2/opencv.hpp>
 
@@ -58,6 +61,18 @@ class AssemblyObjectFinderPatRec : public QObject
     std::vector<double> angles_prescan_vec_;
     double              angles_finemax_;
     double              angles_finestep_;
+
+    // predicted result (same units and ref-frame as the PatRec results, e.g. from a previous iteration of the alignment):
+    // if enabled, the search is restricted to a window around it, with a fallback to the full search
+    bool   prediction_enabled_;
+    double prediction_dX_;
+    double prediction_dY_;
+    double prediction_angle_;
+    double prediction_windowXY_;    // half-width of the position window [mm]
+    double prediction_windowAngle_; // half-width of the angle window [deg]
+
+    // number of levels of the coarse-to-fine search (-1: parameter PatRecPyramidLevels)
+    int pyramid_levels_;
   };
 
  private:
@@ -79,6 +94,13 @@ class AssemblyObjectFinderPatRec : public QObject
 
   bool save_subdir_images_;
 
+  // match rotated templates from a (cached) template bank, instead of rotating the master image for every angle
+  bool use_template_bank_;
+  bool benchmark_template_bank_;
+
+  QString template_bank_cache_dir_;
+  unsigned int template_bank_cache_size_;
+
   cv::Mat img_master_;        // original master image
   cv::Mat img_master_PatRec_; // master image used in PatRec (example: binary/post-thresholding version of original master image)
 
@@ -88,10 +110,48 @@ class AssemblyObjectFinderPatRec : public QObject
   bool updated_img_master_;
   bool updated_img_master_PatRec_;
 
-  void PatRec(double&, cv::Point&, const cv::Mat&, const cv::Mat&, const double, const int, const std::string& out_dir="") const;
+  // best FOM of the last full search, per template: reference to accept the result of a predicted search
+  QMap<QString, double> reference_FOMs_;
+
+  // handles of the assembly parameters used by PatRec (read from one snapshot per PatRec execution)
+  const AssemblyParameters::Handle param_SubPixelRefinement_;
+  const AssemblyParameters::Handle param_AngleFitNeighbours_;
+  const AssemblyParameters::Handle param_PyramidLevels_;
+  const AssemblyParameters::Handle param_PyramidCandidates_;
+  const AssemblyParameters::Handle param_PredictionFOMTolerance_;
+  const AssemblyParameters::Handle param_AngleOfCameraFrame_;
+
+  // scratch images of one PatRec worker, reused across angles
+  class PatRecWorkspace {
+
+   public:
+    cv::Mat img_master_PatRec_rot_;
+    cv::Mat result_mat_;
+
+    // template-bank matching
+    cv::Mat mask_;
+    cv::Mat energy_mat_;
+  };
+
+  class AngularScanBody;
+
+  void PatRec(double&, cv::Point&, const cv::Mat&, const cv::Mat&, const double, const int, const cv::Scalar&, PatRecWorkspace&, const std::string& out_dir="") const;
+
+  void PatRec_templateBank(double&, cv::Point&, const cv::Mat&, const cv::Mat&, const AssemblyTemplateBank::Entry&, const int, PatRecWorkspace&) const;
+
+  void PatRec_angularScan(std::vector<double>&, std::vector<cv::Point>&, const cv::Mat&, const cv::Mat&, const std::vector<double>&, const int, const std::string& out_dir="", const AssemblyTemplateBank* const bank=nullptr) const;
+
+  bool PatRec_predicted(double&, double&, cv::Point&, std::vector<std::pair<double, double> >&, const Configuration&, const cv::Mat&, const cv::Mat&, const int, const double, const AssemblyParameters::Snapshot&) const;
+
+  void PatRec_refine(double&, cv::Point&, const cv::Mat&, const cv::Mat&, const double, const int, const int, const cv::Scalar&, PatRecWorkspace&, cv::Point2f* const match_loc_subpixel=nullptr) const;
+
+  double PatRec_fitAngle(const std::vector<std::pair<double, double> >&, const double, const int, const bool) const;
 
   cv::Point2f RotatePoint(const cv::Point2f&, const double) const;
   cv::Point2f RotatePoint(const cv::Point2f&, const cv::Point2f&, const double) const;
+  cv::Point2f RotateMatchLoc(const cv::Point2f&, const cv::Point2f&, const double, const double, const cv::Size&) const;
+
+  void benchmark_templateBank(const std::string&, const QString&, const cv::Mat&, const cv::Mat&, const int, const std::vector<double>&, const std::vector<double>&, const int) const;
 
   void draw_RotatedRect(cv::Mat&, const cv::Point&, const double, const double, const double, const cv::Scalar&) const;
 
@@ -104,6 +164,10 @@ class AssemblyObjectFinderPatRec : public QObject
 
   void template_matching(const Configuration&, const cv::Mat&, const cv::Mat&, const cv::Mat&);
 
+ protected slots:
+
+  void show_angscan_plot(const QString&);
+
  signals:
 
   void updated_image_master(const cv::Mat&);
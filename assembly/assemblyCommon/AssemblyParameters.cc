@@ -25,9 +25,13 @@
 
 AssemblyParameters* AssemblyParameters::instance_ = nullptr;
 
+std::mutex AssemblyParameters::registry_mutex_;
+std::map<std::string, AssemblyParameters::Handle> AssemblyParameters::registry_;
+
 AssemblyParameters::AssemblyParameters(const std::string& file_path, QObject* parent)
  : QObject(parent)
  , view_(nullptr)
+ , snapshot_(std::make_shared<const Snapshot>())
 {
   NQLog("AssemblyParameters", NQLog::Debug) << "constructed";
 
@@ -62,7 +66,7 @@ AssemblyParameters* AssemblyParameters::instance(const bool permissive)
   return instance_;
 }
 
-void AssemblyParameters::issue_key_error(const std::string& key) const
+void AssemblyParameters::issue_key_error(const std::string& key)
 {
   NQLog("AssemblyParameters", NQLog::Critical) << "issue_key_error"
      << " [issue_key_error::getValue] ** ERROR: failed to get value for key: " << key;
@@ -70,16 +74,158 @@ void AssemblyParameters::issue_key_error(const std::string& key) const
   assembly::kill_application(tr("[AssemblyParameters::issue_key_error]"), tr("Failed to find value for key: \"%1\"\n. Aborting.").arg(QString(key.c_str())));
 }
 
+//
+// handles are never removed from the registry, so they stay valid when the parameters are updated
+//
+AssemblyParameters::Handle AssemblyParameters::handle(const std::string& key)
+{
+  std::lock_guard<std::mutex> lock(registry_mutex_);
+
+  const auto it = registry_.find(key);
+
+  if(it != registry_.end()){ return it->second; }
+
+  const Handle h = registry_.size();
+
+  registry_[key] = h;
+
+  return h;
+}
+
+double AssemblyParameters::get(const Handle h) const
+{
+  return this->snapshot()->get(h);
+}
+
 double AssemblyParameters::get(const std::string& key) const
 {
-  if(map_double_.find(key) == map_double_.end())
+  return this->snapshot()->get(key);
+}
+
+bool AssemblyParameters::Snapshot::has(const Handle h) const
+{
+  return ((h < valid_.size()) && valid_.at(h));
+}
+
+bool AssemblyParameters::Snapshot::has(const std::string& key) const
+{
+  const auto it = handles_.find(key);
+
+  return ((it != handles_.end()) && this->has(it->second));
+}
+
+double AssemblyParameters::Snapshot::get(const Handle h) const
+{
+  if(this->has(h) == false)
+  {
+    std::string key("");
+    {
+      std::lock_guard<std::mutex> lock(AssemblyParameters::registry_mutex_);
+
+      for(const auto& i_pair : AssemblyParameters::registry_)
+      {
+        if(i_pair.second == h){ key = i_pair.first; break; }
+      }
+    }
+
+    AssemblyParameters::issue_key_error(key);
+
+    return -1.;
+  }
+
+  return values_[h];
+}
+
+double AssemblyParameters::Snapshot::get(const std::string& key) const
+{
+  const auto it = handles_.find(key);
+
+  if(it == handles_.end())
   {
-    this->issue_key_error(key);
+    AssemblyParameters::issue_key_error(key);
 
     return -1.;
   }
 
-  return map_double_.at(key);
+  return this->get(it->second);
+}
+
+//
+// default values of the parameters added after the first parameter files,
+// added (with a warning) when they are missing from a parameter file or from the view,
+// so that a missing key does not stop the application when it is read (e.g. in the PatRec thread);
+// the defaults reproduce the behaviour from before these parameters:
+//  - PatRecPyramidLevels          : 0, exhaustive angular scan at full resolution
+//  - PatRecPyramidCandidates      : 5, candidates refined by the coarse-to-fine search (only used with PatRecPyramidLevels > 0)
+//  - PatRecSubPixelRefinement     : 0, position and angle of the best match on the scan grid
+//  - PatRecAngleFitNeighbours     : 3, neighbouring angles of the sub-step angle fit (only used with PatRecSubPixelRefinement)
+//  - PatRecPredictionFOMTolerance : 1.5, acceptance of the predicted searches of the alignment
+//
+void AssemblyParameters::add_defaults(std::map<std::string, double>& map_double, const std::string& caller) const
+{
+  const std::map<std::string, double> defaults = {
+    {"PatRecPyramidLevels"         , 0.},
+    {"PatRecPyramidCandidates"     , 5.},
+    {"PatRecSubPixelRefinement"    , 0.},
+    {"PatRecAngleFitNeighbours"    , 3.},
+    {"PatRecPredictionFOMTolerance", 1.5},
+  };
+
+  for(const auto& i_pair : defaults)
+  {
+    if(map_double.find(i_pair.first) != map_double.end()){ continue; }
+
+    NQLog("AssemblyParameters", NQLog::Warning) << caller
+       << ": missing assembly parameter \"" << i_pair.first << "\", using default value " << i_pair.second;
+
+    map_double[i_pair.first] = i_pair.second;
+  }
+}
+
+//
+// the new snapshot replaces the current one atomically (readers holding the old snapshot keep using it);
+// parameter_changed is emitted for every new or modified value
+//
+void AssemblyParameters::publish()
+{
+  for(const auto& i_pair : map_double_){ AssemblyParameters::handle(i_pair.first); }
+
+  std::shared_ptr<Snapshot> snap = std::make_shared<Snapshot>();
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+
+    snap->handles_ = registry_;
+  }
+
+  snap->values_.assign(snap->handles_.size(), 0.);
+  snap->valid_ .assign(snap->handles_.size(), false);
+
+  for(const auto& i_pair : map_double_)
+  {
+    const Handle h = snap->handles_.at(i_pair.first);
+
+    snap->values_.at(h) = i_pair.second;
+    snap->valid_ .at(h) = true;
+  }
+
+  const std::shared_ptr<const Snapshot> snap_old = this->snapshot();
+
+  std::atomic_store(&snapshot_, std::shared_ptr<const Snapshot>(snap));
+
+  for(const auto& i_pair : map_double_)
+  {
+    if(snap_old->has(i_pair.first) && (snap_old->get(i_pair.first) == i_pair.second)){ continue; }
+
+    NQLog("AssemblyParameters", NQLog::Spam) << "publish"
+       << ": emitting signal \"parameter_changed(" << i_pair.first << ", " << i_pair.second << ")\"";
+
+    emit parameter_changed(QString::fromStdString(i_pair.first), i_pair.second);
+  }
+
+  NQLog("AssemblyParameters", NQLog::Spam) << "publish"
+     << ": emitting signal \"parameters_updated\"";
+
+  emit parameters_updated();
 }
 
 void AssemblyParameters::set_view(const AssemblyParametersView* const view)
@@ -96,6 +242,8 @@ void AssemblyParameters::set_view(const AssemblyParametersView* const view)
   {
     disconnect(view_, SIGNAL(read_from_file_request(QString)), this, SLOT(read_from_file(QString)));
     disconnect(view_, SIGNAL( write_to_file_request(QString)), this, SLOT( write_to_file(QString)));
+
+    disconnect(this, SIGNAL(parameter_changed(QString, double)), view_, SLOT(update_entry(QString, double)));
   }
 
   view_ = view;
@@ -103,6 +251,8 @@ void AssemblyParameters::set_view(const AssemblyParametersView* const view)
   connect(view_, SIGNAL(read_from_file_request(QString)), this, SLOT(read_from_file(QString)));
   connect(view_, SIGNAL( write_to_file_request(QString)), this, SLOT( write_to_file(QString)));
 
+  connect(this, SIGNAL(parameter_changed(QString, double)), view_, SLOT(update_entry(QString, double)));
+
   return;
 }
 
@@ -174,6 +324,10 @@ void AssemblyParameters::read_from_file(const std::string& f_path)
     map_double_[i_key] = i_val_double;
   }
 
+  this->add_defaults(map_double_, "read_from_file");
+
+  this->publish();
+
   return;
 }
 
@@ -189,13 +343,13 @@ bool AssemblyParameters::update()
 
   const auto& map_str = view_->entries_map();
 
-  map_double_.clear();
+  std::map<std::string, double> map_double;
 
   for(const auto& i_pair : map_str)
   {
     const std::string& i_key = i_pair.first;
 
-    if(map_double_.find(i_key) != map_double_.end())
+    if(map_double.find(i_key) != map_double.end())
     {
       NQLog("AssemblyParameters", NQLog::Warning) << "update"
          << ": duplicate assembly parameter \"" << i_key << "\", parameter value will be overwritten";
@@ -214,8 +368,15 @@ bool AssemblyParameters::update()
       return false;
     }
 
-    map_double_[i_key] = i_val_double;
+    map_double[i_key] = i_val_double;
   }
 
+  this->add_defaults(map_double, "update");
+
+  // the parameters are replaced only if all the entries of the view are valid
+  map_double_ = map_double;
+
+  this->publish();
+
   return true;
 }
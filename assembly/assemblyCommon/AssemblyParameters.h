@@ -17,10 +17,19 @@
  *    - contains parameters for assembly procedure
  *    - can read params from file and write them to file
  *    - params can be updated via AssemblyParametersView
+ *    - parameters added after the first parameter files have default values (see add_defaults),
+ *      so that older parameter files can still be used
+ *    - keys can be resolved once to handles (index of the key in a registry shared by all instances)
+ *    - the values are published as immutable snapshots (atomic shared pointer):
+ *      a caller holding a snapshot reads a consistent set of parameters without locks,
+ *      while the parameters are updated from file or from the view
  */
 
 #include <string>
 #include <map>
+#include <vector>
+#include <memory>
+#include <mutex>
 
 #include <AssemblyParametersView.h>
 
@@ -39,11 +48,42 @@ class AssemblyParameters : public QObject
   static AssemblyParameters* instance(const std::string&, QObject* parent=nullptr);
   static AssemblyParameters* instance(const bool permissive=true);
 
-  void issue_key_error(const std::string&) const;
+  static void issue_key_error(const std::string&);
 
+  typedef std::size_t Handle;
+
+  static Handle handle(const std::string&);
+
+  class Snapshot
+  {
+   public:
+
+    explicit Snapshot() {}
+    virtual ~Snapshot() {}
+
+    bool has(const Handle) const;
+    bool has(const std::string&) const;
+
+    double get(const Handle) const;
+    double get(const std::string&) const;
+
+   protected:
+
+    friend class AssemblyParameters;
+
+    std::map<std::string, Handle> handles_;
+
+    std::vector<double> values_;
+    std::vector<bool>   valid_;
+  };
+
+  std::shared_ptr<const Snapshot> snapshot() const { return std::atomic_load(&snapshot_); }
+
+  double get(const Handle) const;
   double get(const std::string&) const;
 
-  const std::map<std::string, double>& map_double() const { return map_double_; }
+  // copy of the current values, to be taken in the thread of this object (e.g. to fill the view)
+  std::map<std::string, double> map_double() const { return map_double_; }
 
   void set_view(const AssemblyParametersView* const);
 
@@ -60,6 +100,15 @@ class AssemblyParameters : public QObject
 
   std::map<std::string, double> map_double_;
 
+  std::shared_ptr<const Snapshot> snapshot_;
+
+  static std::mutex registry_mutex_;
+  static std::map<std::string, Handle> registry_;
+
+  void add_defaults(std::map<std::string, double>&, const std::string&) const;
+
+  void publish();
+
  public slots:
 
   void write_to_file(const QString&);
@@ -69,6 +118,9 @@ class AssemblyParameters : public QObject
   void read_from_file(const std::string&);
 
  signals:
+
+  void parameter_changed(const QString&, const double);
+  void parameters_updated();
 };
 
 #endif // ASSEMBLYPARAMETERS_H
@@ -397,6 +397,73 @@ AssemblyParametersView::AssemblyParametersView(QWidget* parent)
 
   //// ---------------------
 
+  row_index = -1;
+
+  //// IMAGE ANALYSIS ------
+  imag_wid_ = new QWidget;
+
+  toolbox->addItem(imag_wid_, tr("Pattern Recognition"));
+
+  QGridLayout* imag_lay = new QGridLayout;
+  imag_wid_->setLayout(imag_lay);
+
+  // pattern recognition: depth of the image pyramid for the coarse-to-fine search
+  ++row_index;
+
+  tmp_tag = "PatRecPyramidLevels";
+  tmp_des = "Number of Image-Pyramid Levels for Coarse-To-Fine Search (0 = exhaustive search) :";
+
+  map_lineEdit_[tmp_tag] = new QLineEdit(tr(""));
+
+  imag_lay->addWidget(new QLabel(tmp_des), row_index, 0, Qt::AlignLeft);
+  imag_lay->addWidget(this->get(tmp_tag) , row_index, 1, Qt::AlignRight);
+
+  // pattern recognition: number of coarse-scan candidates refined at full resolution
+  ++row_index;
+
+  tmp_tag = "PatRecPyramidCandidates";
+  tmp_des = "Number of Coarse-Search Candidates Refined at Full Resolution :";
+
+  map_lineEdit_[tmp_tag] = new QLineEdit(tr(""));
+
+  imag_lay->addWidget(new QLabel(tmp_des), row_index, 0, Qt::AlignLeft);
+  imag_lay->addWidget(this->get(tmp_tag) , row_index, 1, Qt::AlignRight);
+
+  // pattern recognition: sub-pixel position and sub-step angle
+  ++row_index;
+
+  tmp_tag = "PatRecSubPixelRefinement";
+  tmp_des = "Sub-Pixel Position and Sub-Step Angle of Best Match (1 = enabled) :";
+
+  map_lineEdit_[tmp_tag] = new QLineEdit(tr(""));
+
+  imag_lay->addWidget(new QLabel(tmp_des), row_index, 0, Qt::AlignLeft);
+  imag_lay->addWidget(this->get(tmp_tag) , row_index, 1, Qt::AlignRight);
+
+  // pattern recognition: neighbouring angles used in the fit of FOM(angle)
+  ++row_index;
+
+  tmp_tag = "PatRecAngleFitNeighbours";
+  tmp_des = "Number of Neighbouring Angles (per side) in Fit of FOM(angle) :";
+
+  map_lineEdit_[tmp_tag] = new QLineEdit(tr(""));
+
+  imag_lay->addWidget(new QLabel(tmp_des), row_index, 0, Qt::AlignLeft);
+  imag_lay->addWidget(this->get(tmp_tag) , row_index, 1, Qt::AlignRight);
+
+  // pattern recognition: acceptance of the predicted search
+  ++row_index;
+
+  tmp_tag = "PatRecPredictionFOMTolerance";
+  tmp_des = "Predicted Search: Max. Ratio of FOM to FOM of Last Full Search :";
+
+  map_lineEdit_[tmp_tag] = new QLineEdit(tr(""));
+
+  imag_lay->addWidget(new QLabel(tmp_des), row_index, 0, Qt::AlignLeft);
+  imag_lay->addWidget(this->get(tmp_tag) , row_index, 1, Qt::AlignRight);
+
+  //// ---------------------
+
   layout->addStretch(1);
 
   QHBoxLayout* paramIO_lay = new QHBoxLayout;
@@ -516,6 +583,23 @@ void AssemblyParametersView::copy_values(const std::map<std::string, double>& ma
   return;
 }
 
+void AssemblyParametersView::update_entry(const QString& key, const double val)
+{
+  const std::string key_str = key.toStdString();
+
+  if(this->has(key_str) == false)
+  {
+    NQLog("AssemblyParametersView", NQLog::Spam) << "update_entry"
+       << ": no entry for parameter \"" << key_str << "\", no action taken";
+
+    return;
+  }
+
+  this->setText(key_str, val);
+
+  return;
+}
+
 void AssemblyParametersView::setText(const std::string& key, const double val)
 {
   QLineEdit* const ptr = this->get(key);
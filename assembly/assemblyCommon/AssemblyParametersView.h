@@ -61,6 +61,8 @@ class AssemblyParametersView : public QWidget
 
   void transmit_entries();
 
+  void update_entry(const QString&, const double);
+
  signals:
 
   void read_from_file_request(const QString&);
@@ -29,6 +29,8 @@ AssemblySmartMotionManager::AssemblySmartMotionManager(const LStepExpressMotionM
  , motion_index_(-1)
 
  , smartMotions_N_(0)
+
+ , confirmation_enabled_(true)
 {
   if(motion_manager_ == nullptr)
   {
@@ -102,6 +104,7 @@ void AssemblySmartMotionManager::enable_motion_manager(const bool arg)
     connect(this, SIGNAL(move_absolute_request(double, double, double, double)), motion_manager_, SLOT(moveAbsolute(double, double, double, double)));
 
     connect(this, SIGNAL(motion_request(LStepExpressMotion)), motion_manager_, SLOT(appendMotion(LStepExpressMotion)));
+    connect(this, SIGNAL(motions_request(QQueue<LStepExpressMotion>)), motion_manager_, SLOT(appendMotions(QQueue<LStepExpressMotion>)));
 
     connect(motion_manager_, SIGNAL(motion_finished()), this, SLOT(next_step()));
 
@@ -116,6 +119,7 @@ void AssemblySmartMotionManager::enable_motion_manager(const bool arg)
     disconnect(this, SIGNAL(move_absolute_request(double, double, double, double)), motion_manager_, SLOT(moveAbsolute(double, double, double, double)));
 
     disconnect(this, SIGNAL(motion_request(LStepExpressMotion)), motion_manager_, SLOT(appendMotion(LStepExpressMotion)));
+    disconnect(this, SIGNAL(motions_request(QQueue<LStepExpressMotion>)), motion_manager_, SLOT(appendMotions(QQueue<LStepExpressMotion>)));
 
     disconnect(motion_manager_, SIGNAL(motion_finished()), this, SLOT(next_step()));
 
@@ -167,6 +171,13 @@ void AssemblySmartMotionManager::move_relative(const double dx0, const double dy
 
 void AssemblySmartMotionManager::next_step()
 {
+  if(motion_index_ >= 0)
+  {
+    NQLog("AssemblySmartMotionManager", NQLog::Spam) << "next_step"
+       << ": motion " << (1 + motion_index_) << " of " << motions_.size()
+       << " completed in " << (1e3 * motion_manager_->last_motion_duration()) << " ms";
+  }
+
   if(motion_index_ == (motions_.size() - 1))
   {
     motions_.clear();
@@ -177,7 +188,7 @@ void AssemblySmartMotionManager::next_step()
 
     emit motion_completed();
   }
-  else if(motion_index_ >= (motions_.size() - 1 - smartMotions_N_))
+  else if(confirmation_enabled_ && (motion_index_ >= (motions_.size() - 1 - smartMotions_N_)))
   {
     ++motion_index_;
 
@@ -185,14 +196,35 @@ void AssemblySmartMotionManager::next_step()
   }
   else
   {
-    ++motion_index_;
+    // motions before the confirmation window (all motions, if confirmation is disabled) are requested together,
+    // so that the motion manager can merge them into a single controller command
+    const int motions_confirmed_N = confirmation_enabled_ ? smartMotions_N_ : 0;
 
-    const LStepExpressMotion& motion = motions_.at(motion_index_);
+    QQueue<LStepExpressMotion> motions;
 
-    emit motion_request(motion);
+    while(motion_index_ < (motions_.size() - 1 - motions_confirmed_N))
+    {
+      ++motion_index_;
+
+      motions.enqueue(motions_.at(motion_index_));
+    }
+
+    emit motions_request(motions);
   }
 }
 
+//
+// without confirmation, the fine steps are applied without asking the operator
+// (only meant for dry runs of the assembly sequence with the fake devices)
+//
+void AssemblySmartMotionManager::enable_confirmation(const bool arg)
+{
+  confirmation_enabled_ = arg;
+
+  NQLog("AssemblySmartMotionManager", NQLog::Message) << "enable_confirmation(" << arg << ")"
+     << ": confirmation of the smartMove steps " << (confirmation_enabled_ ? "enabled" : "disabled");
+}
+
 void AssemblySmartMotionManager::smartMove_window(const LStepExpressMotion& motion)
 {
   QMessageBox msgBox;
@@ -43,6 +43,8 @@ class AssemblySmartMotionManager : public QObject
 
   std::vector<double> smartMove_steps_dZ_;
 
+  bool confirmation_enabled_;
+
   QQueue<LStepExpressMotion> motions_;
 
   void smartMove_window(const LStepExpressMotion&);
@@ -51,6 +53,8 @@ class AssemblySmartMotionManager : public QObject
 
   void enable_motion_manager(const bool);
 
+  void enable_confirmation(const bool);
+
   void    connect_motion_manager() { this->enable_motion_manager(true) ; }
   void disconnect_motion_manager() { this->enable_motion_manager(false); }
 
@@ -65,6 +69,7 @@ class AssemblySmartMotionManager : public QObject
   void move_absolute_request(const double, const double, const double, const double);
 
   void motion_request(const LStepExpressMotion&);
+  void motions_request(const QQueue<LStepExpressMotion>&);
 
   void motion_completed();
 };
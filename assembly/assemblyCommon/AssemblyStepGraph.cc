@@ -0,0 +1,544 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#include <nqlogger.h>
+
+#include <AssemblyStepGraph.h>
+
+#include <chrono>
+#include <sstream>
+#include <iomanip>
+
+AssemblyStepGraphStep::AssemblyStepGraphStep(const QString& name, const QString& text, const QObject* qobject, const char* start_slot, const char* stop_signal,
+                                             const QStringList& dependencies, const QStringList& resources, const char* fail_signal, QObject* parent)
+ : QObject(parent)
+
+ , started_(false)
+ , finished_(false)
+ , failed_(false)
+ , start_time_(0.)
+ , finish_time_(0.)
+
+ , name_(name)
+ , text_(text)
+
+ , qobject_(qobject)
+ , start_slot_ (start_slot  ? start_slot  : "")
+ , stop_signal_(stop_signal ? stop_signal : "")
+ , fail_signal_(fail_signal ? fail_signal : "")
+
+ , dependencies_(dependencies)
+ , resources_(resources)
+
+ , timer_(nullptr)
+{
+  timer_ = new QTimer(this);
+  timer_->setSingleShot(true);
+
+  connect(timer_, SIGNAL(timeout()), this, SLOT(timeout()));
+}
+
+//
+// same connections as AssemblyAssemblyActionWidget: the stop signal is connected only while the step runs,
+// so the same assembly step can appear several times in the graph
+//
+void AssemblyStepGraphStep::start(const int timeout_msec)
+{
+  if(qobject_ == nullptr){ return; }
+
+  connect(this, SIGNAL(action_request()), qobject_, start_slot_.constData());
+
+  connect(qobject_, stop_signal_.constData(), this, SLOT(finish()));
+
+  if(fail_signal_.isEmpty() == false)
+  {
+    connect(qobject_, fail_signal_.constData(), this, SLOT(fail_request(QString)));
+  }
+
+  // started before the request, the step can complete synchronously
+  if(timeout_msec > 0){ timer_->start(timeout_msec); }
+
+  emit action_request();
+}
+
+void AssemblyStepGraphStep::disconnect_action()
+{
+  timer_->stop();
+
+  if(qobject_ != nullptr)
+  {
+    disconnect(this, SIGNAL(action_request()), qobject_, start_slot_.constData());
+
+    disconnect(qobject_, stop_signal_.constData(), this, SLOT(finish()));
+
+    if(fail_signal_.isEmpty() == false)
+    {
+      disconnect(qobject_, fail_signal_.constData(), this, SLOT(fail_request(QString)));
+    }
+  }
+}
+
+void AssemblyStepGraphStep::finish()
+{
+  this->disconnect_action();
+
+  emit finished(name_);
+}
+
+void AssemblyStepGraphStep::fail(const QString& reason)
+{
+  this->disconnect_action();
+
+  emit failed(name_, reason);
+}
+
+//
+// the fail signal is shared by all the steps of the object,
+// it carries the name of the start slot which failed (e.g. "PickupPSS_start")
+//
+void AssemblyStepGraphStep::fail_request(const QString& source)
+{
+  const QString slot_name = QString::fromLatin1(start_slot_.mid(1, start_slot_.indexOf('(') - 1));
+
+  if(source != slot_name){ return; }
+
+  this->fail("failure reported by "+source);
+}
+
+void AssemblyStepGraphStep::timeout()
+{
+  this->fail("not completed after "+QString::number(timer_->interval() / 1000.)+" s");
+}
+// ====================================================================================================
+
+AssemblyStepGraph::AssemblyStepGraph(QObject* parent)
+ : QObject(parent)
+
+ , running_(false)
+ , dry_run_(false)
+ , stop_requested_(false)
+
+ , step_timeout_(0.)
+
+ , scheduling_(false)
+ , reschedule_(false)
+
+ , run_start_time_(0.)
+ , run_finish_time_(0.)
+{
+}
+
+double AssemblyStepGraph::time()
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+AssemblyStepGraphStep* AssemblyStepGraph::step(const QString& name) const
+{
+  for(const auto& i_step : steps_)
+  {
+    if(i_step->name() == name){ return i_step; }
+  }
+
+  return nullptr;
+}
+
+void AssemblyStepGraph::set_step_timeout(const double seconds)
+{
+  step_timeout_ = (seconds > 0.) ? seconds : 0.;
+}
+
+bool AssemblyStepGraph::add_step(const QString& name, const QObject* qobject, const char* start_slot, const char* stop_signal,
+                                 const QStringList& dependencies, const QStringList& resources, const char* fail_signal)
+{
+  if(qobject == nullptr)
+  {
+    NQLog("AssemblyStepGraph", NQLog::Warning) << "add_step(" << name.toStdString() << ")"
+       << ": invalid (NULL) pointer to QObject, step not added";
+
+    return false;
+  }
+
+  if(running_ || (this->step(name) != nullptr))
+  {
+    NQLog("AssemblyStepGraph", NQLog::Warning) << "add_step(" << name.toStdString() << ")"
+       << ": graph is running, or step with same name already exists, step not added";
+
+    return false;
+  }
+
+  for(const auto& i_dep : dependencies)
+  {
+    if(this->step(i_dep) == nullptr)
+    {
+      NQLog("AssemblyStepGraph", NQLog::Warning) << "add_step(" << name.toStdString() << ")"
+         << ": dependency \"" << i_dep.toStdString() << "\" not declared before this step, step not added";
+
+      return false;
+    }
+  }
+
+  AssemblyStepGraphStep* new_step = new AssemblyStepGraphStep(name, "", qobject, start_slot, stop_signal, dependencies, resources, fail_signal, this);
+
+  connect(new_step, SIGNAL(finished(QString))        , this, SLOT(finish_step(QString)));
+  connect(new_step, SIGNAL(failed(QString, QString)), this, SLOT(fail_step(QString, QString)));
+
+  steps_.emplace_back(new_step);
+
+  return true;
+}
+
+bool AssemblyStepGraph::add_manual_step(const QString& name, const QString& text, const QStringList& dependencies, const QStringList& resources)
+{
+  if(running_ || (this->step(name) != nullptr))
+  {
+    NQLog("AssemblyStepGraph", NQLog::Warning) << "add_manual_step(" << name.toStdString() << ")"
+       << ": graph is running, or step with same name already exists, step not added";
+
+    return false;
+  }
+
+  for(const auto& i_dep : dependencies)
+  {
+    if(this->step(i_dep) == nullptr)
+    {
+      NQLog("AssemblyStepGraph", NQLog::Warning) << "add_manual_step(" << name.toStdString() << ")"
+         << ": dependency \"" << i_dep.toStdString() << "\" not declared before this step, step not added";
+
+      return false;
+    }
+  }
+
+  AssemblyStepGraphStep* new_step = new AssemblyStepGraphStep(name, text, nullptr, nullptr, nullptr, dependencies, resources, nullptr, this);
+
+  connect(new_step, SIGNAL(finished(QString)), this, SLOT(finish_step(QString)));
+
+  steps_.emplace_back(new_step);
+
+  return true;
+}
+
+void AssemblyStepGraph::start(const bool dry_run)
+{
+  if(running_)
+  {
+    NQLog("AssemblyStepGraph", NQLog::Warning) << "start"
+       << ": logic error, graph is already running, no action taken";
+
+    return;
+  }
+
+#ifndef USE_FAKEIO
+  if(dry_run)
+  {
+    NQLog("AssemblyStepGraph", NQLog::Critical) << "start"
+       << ": dry run (manual steps skipped) only available with fake devices, graph not started";
+
+    NQLog("AssemblyStepGraph", NQLog::Spam) << "start"
+       << ": emitting signal \"run_stopped\"";
+
+    emit run_stopped();
+
+    return;
+  }
+#endif
+
+  for(auto& i_step : steps_)
+  {
+    i_step->started_     = false;
+    i_step->finished_    = false;
+    i_step->failed_      = false;
+    i_step->start_time_  = 0.;
+    i_step->finish_time_ = 0.;
+  }
+
+  busy_resources_.clear();
+
+  running_        = true;
+  dry_run_        = dry_run;
+  stop_requested_ = false;
+
+  failed_step_   .clear();
+  failure_reason_.clear();
+
+  run_start_time_  = AssemblyStepGraph::time();
+  run_finish_time_ = run_start_time_;
+
+  NQLog("AssemblyStepGraph", NQLog::Message) << "start"
+     << ": running graph of " << steps_.size() << " steps" << (dry_run_ ? " (dry run, manual steps skipped)" : "");
+
+  this->schedule();
+}
+
+//
+// steps already started are completed, no further step is started
+//
+void AssemblyStepGraph::stop()
+{
+  if(running_ == false){ return; }
+
+  stop_requested_ = true;
+
+  NQLog("AssemblyStepGraph", NQLog::Message) << "stop"
+     << ": stop requested, waiting for the running steps to complete";
+
+  this->close_manual_steps();
+
+  this->schedule();
+}
+
+// manual steps waiting for the operator are not waited for
+void AssemblyStepGraph::close_manual_steps()
+{
+  for(auto& i_step : steps_)
+  {
+    if(i_step->manual() && i_step->started_ && (i_step->finished_ == false)){ i_step->finish(); }
+  }
+}
+
+void AssemblyStepGraph::confirm_manual_step(const QString& name)
+{
+  AssemblyStepGraphStep* const manual_step = this->step(name);
+
+  if((manual_step == nullptr) || (manual_step->manual() == false) || (manual_step->started_ == false) || manual_step->finished_)
+  {
+    NQLog("AssemblyStepGraph", NQLog::Warning) << "confirm_manual_step(" << name.toStdString() << ")"
+       << ": no manual step with this name is waiting for confirmation, no action taken";
+
+    return;
+  }
+
+  manual_step->finish();
+}
+
+bool AssemblyStepGraph::startable(const AssemblyStepGraphStep* a_step) const
+{
+  if(a_step->started_){ return false; }
+
+  for(const auto& i_dep : a_step->dependencies())
+  {
+    if(this->step(i_dep)->finished_ == false){ return false; }
+  }
+
+  for(const auto& i_res : a_step->resources())
+  {
+    if(busy_resources_.contains(i_res)){ return false; }
+  }
+
+  return true;
+}
+
+//
+// steps can complete synchronously inside start() (e.g. vacuum already in the requested state),
+// in which case the scheduling loop is repeated instead of being entered recursively
+//
+void AssemblyStepGraph::schedule()
+{
+  if(running_ == false){ return; }
+
+  if(scheduling_){ reschedule_ = true; return; }
+
+  scheduling_ = true;
+
+  do
+  {
+    reschedule_ = false;
+
+    if(stop_requested_){ break; }
+
+    for(auto& i_step : steps_)
+    {
+      // a step can fail synchronously inside start()
+      if(stop_requested_){ break; }
+
+      if(this->startable(i_step) == false){ continue; }
+
+      for(const auto& i_res : i_step->resources()){ busy_resources_.insert(i_res); }
+
+      i_step->started_    = true;
+      i_step->start_time_ = AssemblyStepGraph::time();
+
+      NQLog("AssemblyStepGraph", NQLog::Spam) << "schedule"
+         << ": emitting signal \"step_started(" << i_step->name().toStdString() << ")\"";
+
+      emit step_started(i_step->name());
+
+      if(i_step->manual())
+      {
+        if(dry_run_)
+        {
+          i_step->finish();
+        }
+        else
+        {
+          NQLog("AssemblyStepGraph", NQLog::Spam) << "schedule"
+             << ": emitting signal \"manual_step_request(" << i_step->name().toStdString() << ")\"";
+
+          emit manual_step_request(i_step->name(), i_step->text());
+        }
+      }
+      else
+      {
+        i_step->start(int(step_timeout_ * 1000.));
+      }
+    }
+  }
+  while(reschedule_);
+
+  scheduling_ = false;
+
+  bool any_running(false), all_finished(true);
+
+  for(const auto& i_step : steps_)
+  {
+    any_running  |= (i_step->started_ && (i_step->finished_ == false) && (i_step->failed_ == false));
+    all_finished &= i_step->finished_;
+  }
+
+  if(all_finished || (stop_requested_ && (any_running == false)))
+  {
+    this->finish_run();
+  }
+  else if(any_running == false)
+  {
+    NQLog("AssemblyStepGraph", NQLog::Critical) << "schedule"
+       << ": logic error, no step running and no step can be started, stopping graph";
+
+    stop_requested_ = true;
+
+    this->finish_run();
+  }
+}
+
+void AssemblyStepGraph::finish_step(const QString& name)
+{
+  AssemblyStepGraphStep* const done_step = this->step(name);
+
+  if((running_ == false) || (done_step == nullptr) || (done_step->started_ == false) || done_step->finished_){ return; }
+
+  done_step->finished_    = true;
+  done_step->finish_time_ = AssemblyStepGraph::time();
+
+  for(const auto& i_res : done_step->resources()){ busy_resources_.remove(i_res); }
+
+  NQLog("AssemblyStepGraph", NQLog::Spam) << "finish_step"
+     << ": emitting signal \"step_finished(" << name.toStdString() << ")\"";
+
+  emit step_finished(name);
+
+  this->schedule();
+}
+
+//
+// a failed step aborts the run: no further step is started,
+// the steps already running are completed before run_failed is emitted
+//
+void AssemblyStepGraph::fail_step(const QString& name, const QString& reason)
+{
+  AssemblyStepGraphStep* const failed_step = this->step(name);
+
+  if((running_ == false) || (failed_step == nullptr) || (failed_step->started_ == false) || failed_step->finished_ || failed_step->failed_){ return; }
+
+  failed_step->failed_      = true;
+  failed_step->finish_time_ = AssemblyStepGraph::time();
+
+  for(const auto& i_res : failed_step->resources()){ busy_resources_.remove(i_res); }
+
+  NQLog("AssemblyStepGraph", NQLog::Critical) << "fail_step"
+     << ": step \"" << name.toStdString() << "\" failed (" << reason.toStdString() << "), aborting graph";
+
+  if(failed_step_.isEmpty())
+  {
+    failed_step_    = name;
+    failure_reason_ = reason;
+  }
+
+  stop_requested_ = true;
+
+  NQLog("AssemblyStepGraph", NQLog::Spam) << "fail_step"
+     << ": emitting signal \"step_failed(" << name.toStdString() << ")\"";
+
+  emit step_failed(name, reason);
+
+  this->close_manual_steps();
+
+  this->schedule();
+}
+
+void AssemblyStepGraph::finish_run()
+{
+  running_ = false;
+
+  run_finish_time_ = AssemblyStepGraph::time();
+
+  NQLog("AssemblyStepGraph", NQLog::Message) << "finish_run"
+     << ": timing profile" << (dry_run_ ? " (dry run)" : "") << "\n" << this->profile().toStdString();
+
+  if(failed_step_.isEmpty() == false)
+  {
+    NQLog("AssemblyStepGraph", NQLog::Spam) << "finish_run"
+       << ": emitting signal \"run_failed(" << failed_step_.toStdString() << ")\"";
+
+    emit run_failed(failed_step_, failure_reason_);
+  }
+  else if(stop_requested_)
+  {
+    NQLog("AssemblyStepGraph", NQLog::Spam) << "finish_run"
+       << ": emitting signal \"run_stopped\"";
+
+    emit run_stopped();
+  }
+  else
+  {
+    NQLog("AssemblyStepGraph", NQLog::Spam) << "finish_run"
+       << ": emitting signal \"run_finished\"";
+
+    emit run_finished();
+  }
+}
+
+double AssemblyStepGraph::cycle_time() const
+{
+  return ((running_ ? AssemblyStepGraph::time() : run_finish_time_) - run_start_time_);
+}
+
+//
+// start time (w.r.t. the start of the run) and duration of every completed step,
+// total cycle time, and sum of the durations of the automatic steps (cycle time if run one after another)
+//
+QString AssemblyStepGraph::profile() const
+{
+  std::stringstream ss;
+
+  ss << std::fixed << std::setprecision(2);
+
+  double sum_auto(0.);
+
+  for(const auto& i_step : steps_)
+  {
+    if(i_step->finished_ == false){ continue; }
+
+    const double duration = i_step->finish_time_ - i_step->start_time_;
+
+    if(i_step->manual() == false){ sum_auto += duration; }
+
+    ss << "  " << std::setw(60) << std::left << i_step->name().toStdString()
+       << " start=" << std::setw(8) << std::right << (i_step->start_time_ - run_start_time_) << " s"
+       << " duration=" << std::setw(8) << std::right << duration << " s"
+       << (i_step->manual() ? " (manual)" : "") << "\n";
+  }
+
+  ss << "  cycle time = " << this->cycle_time() << " s, sum of automatic steps = " << sum_auto << " s";
+
+  return QString::fromStdString(ss.str());
+}
@@ -0,0 +1,182 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef ASSEMBLYSTEPGRAPH_H
+#define ASSEMBLYSTEPGRAPH_H
+
+/*  Description:
+ *   Executor of a graph of assembly steps:
+ *    - an automatic step is started through a slot and completed by a signal (as the assembly-step widgets)
+ *    - a manual step is completed by the operator (confirm_manual_step), or right away in a dry run (fake devices only)
+ *    - every step declares the steps it depends on (declared before it, so the graph has no cycles)
+ *      and the resources it uses (e.g. "motion", "vacuum", "camera"): a step is started as soon as
+ *      its dependencies are completed and its resources are free, so independent steps run concurrently
+ *    - the start time and the duration of every step are recorded (timing profile of the run)
+ *    - an automatic step fails if its object reports a failure of its start slot (fail signal),
+ *      or if it does not complete within the step timeout: the run is then aborted (run_failed)
+ */
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QByteArray>
+#include <QSet>
+#include <QTimer>
+
+#include <vector>
+
+class AssemblyStepGraphStep : public QObject
+{
+ Q_OBJECT
+
+ public:
+
+  explicit AssemblyStepGraphStep(const QString& name, const QString& text, const QObject* qobject, const char* start_slot, const char* stop_signal,
+                                 const QStringList& dependencies, const QStringList& resources, const char* fail_signal=nullptr, QObject* parent=nullptr);
+  virtual ~AssemblyStepGraphStep() {}
+
+  const QString& name() const { return name_; }
+  const QString& text() const { return text_; }
+
+  bool manual() const { return (qobject_ == nullptr); }
+
+  const QStringList& dependencies() const { return dependencies_; }
+  const QStringList& resources()    const { return resources_; }
+
+  void start(const int timeout_msec=0);
+
+  // state of the current run
+  bool   started_;
+  bool   finished_;
+  bool   failed_;
+  double start_time_;
+  double finish_time_;
+
+ protected:
+
+  const QString name_;
+  const QString text_;
+
+  const QObject* const qobject_;
+  const QByteArray start_slot_;
+  const QByteArray stop_signal_;
+  const QByteArray fail_signal_;
+
+  const QStringList dependencies_;
+  const QStringList resources_;
+
+  QTimer* timer_;
+
+  void disconnect_action();
+
+ public slots:
+
+  void finish();
+  void fail(const QString&);
+
+ protected slots:
+
+  void fail_request(const QString&);
+  void timeout();
+
+ signals:
+
+  void action_request();
+  void finished(const QString&);
+  void failed(const QString&, const QString&);
+};
+// ====================================================================================================
+
+class AssemblyStepGraph : public QObject
+{
+ Q_OBJECT
+
+ public:
+
+  explicit AssemblyStepGraph(QObject* parent=nullptr);
+  virtual ~AssemblyStepGraph() {}
+
+  bool add_step(const QString& name, const QObject*, const char* start_slot, const char* stop_signal,
+                const QStringList& dependencies, const QStringList& resources, const char* fail_signal=nullptr);
+
+  bool add_manual_step(const QString& name, const QString& text, const QStringList& dependencies, const QStringList& resources=QStringList());
+
+  const std::vector<AssemblyStepGraphStep*>& steps() const { return steps_; }
+
+  bool running() const { return running_; }
+  bool dry_run() const { return dry_run_; }
+
+  // maximum duration of an automatic step, in seconds (0: no timeout)
+  void   set_step_timeout(const double);
+  double step_timeout() const { return step_timeout_; }
+
+  double cycle_time() const;
+  QString profile() const;
+
+ protected:
+
+  AssemblyStepGraphStep* step(const QString&) const;
+
+  bool startable(const AssemblyStepGraphStep*) const;
+
+  void schedule();
+  void close_manual_steps();
+  void finish_run();
+
+  static double time();
+
+  std::vector<AssemblyStepGraphStep*> steps_;
+
+  QSet<QString> busy_resources_;
+
+  bool running_;
+  bool dry_run_;
+  bool stop_requested_;
+
+  double step_timeout_;
+
+  QString failed_step_;
+  QString failure_reason_;
+
+  bool scheduling_;
+  bool reschedule_;
+
+  double run_start_time_;
+  double run_finish_time_;
+
+ public slots:
+
+  void start(const bool dry_run=false);
+  void stop();
+
+  void confirm_manual_step(const QString&);
+
+ protected slots:
+
+  void finish_step(const QString&);
+  void fail_step(const QString&, const QString&);
+
+ signals:
+
+  void step_started (const QString&);
+  void step_finished(const QString&);
+  void step_failed  (const QString& name, const QString& reason);
+
+  void manual_step_request(const QString& name, const QString& text);
+
+  void run_finished();
+  void run_stopped();
+  void run_failed(const QString& name, const QString& reason);
+};
+
+#endif // ASSEMBLYSTEPGRAPH_H
@@ -0,0 +1,318 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <nqlogger.h>
+
+#include <AssemblyTemplateBank.h>
+#include <AssemblyUtilities.h>
+
+#include <cmath>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+#include <utime.h>
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QCryptographicHash>
+
+AssemblyTemplateBank::AssemblyTemplateBank() :
+  key_(""),
+  loaded_from_cache_(false)
+{
+}
+
+std::string AssemblyTemplateBank::cache_key(const QString& template_filepath, const int pyramid_level, const std::vector<double>& angles)
+{
+  QFile template_file(template_filepath);
+
+  if(template_file.open(QIODevice::ReadOnly) == false)
+  {
+    return "";
+  }
+
+  const QByteArray template_hash = QCryptographicHash::hash(template_file.readAll(), QCryptographicHash::Md5).toHex();
+
+  std::stringstream grid_ss;
+  grid_ss << "level=" << pyramid_level << ";angles=" << std::setprecision(9);
+  for(const auto& i_angle : angles){ grid_ss << i_angle << ","; }
+
+  const QByteArray grid_hash = QCryptographicHash::hash(QByteArray(grid_ss.str().c_str()), QCryptographicHash::Md5).toHex();
+
+  return std::string(template_hash.constData())+"_"+std::string(grid_hash.left(12).constData());
+}
+
+//
+// angles of all the possible scans: the pre-scan angles, and every pre-scan angle plus every fine-scan offset;
+// a single bank on this grid serves the pre-scan and the fine scan around any pre-scan result,
+// so the number of cached banks does not grow with the angles found by the pre-scan
+//
+std::vector<double> AssemblyTemplateBank::union_angles(const std::vector<double>& prescan_angles, const std::vector<double>& fine_offsets)
+{
+  std::vector<double> angles(prescan_angles);
+
+  for(const auto& i_prescan : prescan_angles)
+  {
+    for(const auto& i_offset : fine_offsets)
+    {
+      angles.emplace_back(i_prescan + i_offset);
+    }
+  }
+
+  std::sort(angles.begin(), angles.end());
+
+  angles.erase(std::unique(angles.begin(), angles.end(), [](const double a, const double b){ return (std::fabs(a - b) < 1e-6); }), angles.end());
+
+  return angles;
+}
+
+//
+// keeps the "max_files" most recently used banks in the cache directory
+// (cached banks are touched when loaded), and removes the others
+//
+void AssemblyTemplateBank::prune_cache(const QString& cache_dir, const unsigned int max_files)
+{
+  const QFileInfoList cache_files = QDir(cache_dir).entryInfoList(QStringList("*.yml.gz"), QDir::Files, QDir::Time);
+
+  for(int i=int(max_files); i<cache_files.size(); ++i)
+  {
+    // temporary files of concurrent sessions are left alone
+    if(cache_files.at(i).fileName().endsWith(".tmp.yml.gz")){ continue; }
+
+    if(QFile::remove(cache_files.at(i).absoluteFilePath()))
+    {
+      NQLog("AssemblyTemplateBank", NQLog::Spam) << "prune_cache"
+         << ": removed least recently used template bank " << cache_files.at(i).absoluteFilePath();
+    }
+  }
+}
+
+bool AssemblyTemplateBank::prepare(const QString& template_filepath, const cv::Mat& img_template, const int pyramid_level, const std::vector<double>& angles, const QString& cache_dir, const unsigned int cache_size)
+{
+  entries_.clear();
+
+  loaded_from_cache_ = false;
+
+  if(img_template.empty() || (img_template.type() != CV_8UC1))
+  {
+    NQLog("AssemblyTemplateBank", NQLog::Critical) << "prepare"
+       << ": invalid template image (empty, or not a single-channel 8-bit image), no template bank created";
+
+    return false;
+  }
+
+  key_ = AssemblyTemplateBank::cache_key(template_filepath, pyramid_level, angles);
+
+  const bool use_cache = ((cache_dir != "") && (key_ != ""));
+
+  const QString cache_filepath = use_cache ? (cache_dir+"/"+QString::fromStdString(key_)+".yml.gz") : QString("");
+
+  if(use_cache && assembly::IsFile(cache_filepath))
+  {
+    bool valid_cache = this->read_cache(cache_filepath) && (entries_.size() == angles.size());
+
+    for(unsigned int i=0; valid_cache && (i<angles.size()); ++i)
+    {
+      valid_cache = (std::fabs(entries_.at(i).angle_ - angles.at(i)) < 1e-6);
+    }
+
+    if(valid_cache)
+    {
+      loaded_from_cache_ = true;
+
+      // last use of the bank, for the pruning of the cache directory
+      ::utime(cache_filepath.toStdString().c_str(), nullptr);
+
+      NQLog("AssemblyTemplateBank", NQLog::Spam) << "prepare"
+         << ": loaded " << entries_.size() << " rotated templates from " << cache_filepath;
+
+      return true;
+    }
+
+    NQLog("AssemblyTemplateBank", NQLog::Warning) << "prepare"
+       << ": invalid template-bank cache file, template bank will be recreated: " << cache_filepath;
+
+    entries_.clear();
+  }
+
+  entries_.reserve(angles.size());
+
+  for(const auto& i_angle : angles)
+  {
+    entries_.emplace_back(this->rotated_entry(img_template, i_angle));
+  }
+
+  NQLog("AssemblyTemplateBank", NQLog::Spam) << "prepare"
+     << ": created " << entries_.size() << " rotated templates (key=" << key_ << ")";
+
+  if(use_cache)
+  {
+    assembly::QDir_mkpath(cache_dir);
+
+    if(this->write_cache(cache_filepath))
+    {
+      NQLog("AssemblyTemplateBank", NQLog::Spam) << "prepare"
+         << ": saved template bank to " << cache_filepath;
+
+      if(cache_size > 0){ AssemblyTemplateBank::prune_cache(cache_dir, cache_size); }
+    }
+    else
+    {
+      NQLog("AssemblyTemplateBank", NQLog::Warning) << "prepare"
+         << ": failed to save template bank to " << cache_filepath;
+    }
+  }
+
+  return true;
+}
+
+const AssemblyTemplateBank::Entry* AssemblyTemplateBank::entry(const double angle) const
+{
+  for(const auto& i_entry : entries_)
+  {
+    if(std::fabs(i_entry.angle_ - angle) < 1e-6){ return &i_entry; }
+  }
+
+  return nullptr;
+}
+
+//
+// the template is rotated by "angle" around its center with the same interpolation used for the master image in PatRec,
+// into an image large enough to contain the whole rotated template;
+// the pixels outside the original template area are zeroed, and excluded from the matching by the validity mask
+//
+AssemblyTemplateBank::Entry AssemblyTemplateBank::rotated_entry(const cv::Mat& img_template, const double angle) const
+{
+  Entry entry;
+  entry.angle_ = angle;
+
+  const cv::Point2f center(img_template.cols/2.0F, img_template.rows/2.0F);
+
+  cv::Mat rot_mat = cv::getRotationMatrix2D(center, angle, 1.0);
+
+  // bounding box of the rotated template
+  const std::vector<cv::Point2f> corners({cv::Point2f(0, 0), cv::Point2f(img_template.cols, 0), cv::Point2f(0, img_template.rows), cv::Point2f(img_template.cols, img_template.rows)});
+
+  double x_min(+1e10), x_max(-1e10), y_min(+1e10), y_max(-1e10);
+
+  for(const auto& i_corner : corners)
+  {
+    const double x = rot_mat.at<double>(0, 0) * i_corner.x + rot_mat.at<double>(0, 1) * i_corner.y + rot_mat.at<double>(0, 2);
+    const double y = rot_mat.at<double>(1, 0) * i_corner.x + rot_mat.at<double>(1, 1) * i_corner.y + rot_mat.at<double>(1, 2);
+
+    x_min = std::min(x_min, x);
+    x_max = std::max(x_max, x);
+    y_min = std::min(y_min, y);
+    y_max = std::max(y_max, y);
+  }
+
+  const double x0 = std::floor(x_min);
+  const double y0 = std::floor(y_min);
+
+  rot_mat.at<double>(0, 2) -= x0;
+  rot_mat.at<double>(1, 2) -= y0;
+
+  const cv::Size rot_size(int(std::ceil(x_max) - x0), int(std::ceil(y_max) - y0));
+
+  cv::warpAffine(img_template, entry.template_, rot_mat, rot_size, cv::INTER_NEAREST, cv::BORDER_CONSTANT, cv::Scalar(0));
+
+  cv::warpAffine(cv::Mat(img_template.size(), CV_8UC1, cv::Scalar(255)), entry.mask_, rot_mat, rot_size, cv::INTER_NEAREST, cv::BORDER_CONSTANT, cv::Scalar(0));
+
+  entry.template_.setTo(cv::Scalar(0), (entry.mask_ == 0));
+
+  entry.origin_ = cv::Point2f(rot_mat.at<double>(0, 2), rot_mat.at<double>(1, 2));
+
+  entry.energy_ = cv::norm(entry.template_, cv::NORM_L2SQR);
+
+  return entry;
+}
+
+bool AssemblyTemplateBank::read_cache(const QString& filepath)
+{
+  entries_.clear();
+
+  cv::FileStorage fs(filepath.toStdString(), cv::FileStorage::READ);
+
+  if(fs.isOpened() == false){ return false; }
+
+  std::string key("");
+  fs["key"] >> key;
+
+  if(key != key_){ return false; }
+
+  const cv::FileNode entries_node = fs["entries"];
+
+  if(entries_node.type() != cv::FileNode::SEQ){ return false; }
+
+  for(cv::FileNodeIterator it = entries_node.begin(); it != entries_node.end(); ++it)
+  {
+    Entry entry;
+
+    float origin_x(0.), origin_y(0.);
+
+    (*it)["angle"]    >> entry.angle_;
+    (*it)["origin_x"] >> origin_x;
+    (*it)["origin_y"] >> origin_y;
+    (*it)["template"] >> entry.template_;
+    (*it)["mask"]     >> entry.mask_;
+
+    if(entry.template_.empty() || (entry.mask_.size() != entry.template_.size())){ return false; }
+
+    entry.origin_ = cv::Point2f(origin_x, origin_y);
+
+    entry.energy_ = cv::norm(entry.template_, cv::NORM_L2SQR);
+
+    entries_.emplace_back(entry);
+  }
+
+  return true;
+}
+
+//
+// the cache file is written under a temporary name and renamed afterwards,
+// so that concurrent sessions never read a partially-written file
+//
+bool AssemblyTemplateBank::write_cache(const QString& filepath) const
+{
+  const QString tmp_filepath = filepath+".tmp.yml.gz";
+
+  {
+    cv::FileStorage fs(tmp_filepath.toStdString(), cv::FileStorage::WRITE);
+
+    if(fs.isOpened() == false){ return false; }
+
+    fs << "key" << key_;
+
+    fs << "entries" << "[";
+
+    for(const auto& i_entry : entries_)
+    {
+      fs << "{";
+      fs << "angle"    << i_entry.angle_;
+      fs << "origin_x" << i_entry.origin_.x;
+      fs << "origin_y" << i_entry.origin_.y;
+      fs << "template" << i_entry.template_;
+      fs << "mask"     << i_entry.mask_;
+      fs << "}";
+    }
+
+    fs << "]";
+
+    fs.release();
+  }
+
+  QFile::remove(filepath);
+
+  return QFile::rename(tmp_filepath, filepath);
+}
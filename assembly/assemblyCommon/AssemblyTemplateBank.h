@@ -0,0 +1,77 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ASSEMBLYTEMPLATEBANK_H
+#define ASSEMBLYTEMPLATEBANK_H
+
+/*  Description:
+ *   Bank of PatRec template images pre-rotated by every angle of the angular scan,
+ *   with the validity mask of each rotated template;
+ *   banks are cached on disk, keyed by the hash of the template file and by the angle grid,
+ *   and the least recently used banks are removed from the cache directory
+ */
+
+#include <QString>
+
+#include <string>
+#include <vector>
+
+#include <opencv2/opencv.hpp>
+
+class AssemblyTemplateBank
+{
+ public:
+
+  class Entry {
+
+   public:
+    double      angle_;    // angle of the template with respect to the master image [deg]
+    cv::Mat     template_; // rotated template (CV_8UC1), zero outside the validity mask
+    cv::Mat     mask_;     // validity mask of the rotated template (CV_8UC1): 255 inside the area of the original template, 0 in the corners
+    cv::Point2f origin_;   // top-left corner of the original template in the rotated-template image
+    double      energy_;   // sum of the squared template values
+  };
+
+  explicit AssemblyTemplateBank();
+  virtual ~AssemblyTemplateBank() {}
+
+  bool prepare(const QString&, const cv::Mat&, const int, const std::vector<double>&, const QString& cache_dir="", const unsigned int cache_size=8);
+
+  const std::string& key() const { return key_; }
+
+  const std::vector<Entry>& entries() const { return entries_; }
+
+  const Entry* entry(const double) const;
+
+  bool loaded_from_cache() const { return loaded_from_cache_; }
+
+  static std::string cache_key(const QString&, const int, const std::vector<double>&);
+
+  static std::vector<double> union_angles(const std::vector<double>&, const std::vector<double>&);
+
+  static void prune_cache(const QString&, const unsigned int);
+
+ protected:
+
+  Entry rotated_entry(const cv::Mat&, const double) const;
+
+  bool read_cache (const QString&);
+  bool write_cache(const QString&) const;
+
+  std::string key_;
+
+  std::vector<Entry> entries_;
+
+  bool loaded_from_cache_;
+};
+
+#endif // ASSEMBLYTEMPLATEBANK_H
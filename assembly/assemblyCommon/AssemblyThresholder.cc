@@ -11,22 +11,54 @@
 /////////////////////////////////////////////////////////////////////////////////
 
 #include <nqlogger.h>
+#include <ApplicationConfig.h>
 
 #include <AssemblyThresholder.h>
 
+#include <algorithm>
+
 AssemblyThresholder::AssemblyThresholder(QObject* parent) :
   QObject(parent),
 
 //  method_(AssemblyThresholder::ThresholdingMethod::undefined),
 
   updated_img_raw_(false),
-  updated_img_bin_(false)
+  updated_img_bin_(false),
+
+  img_raw_id_(0),
+  preview_seq_(0),
+
+  preview_downscale_(4),
+
+  preview_pending_(false),
+  preview_stop_(false)
 {
+  ApplicationConfig* config = ApplicationConfig::instance();
+  if(config != nullptr)
+  {
+    preview_downscale_ = std::max(1, config->getValue<int>("AssemblyThresholder_previewDownscale", 4));
+  }
+
+  // previews are checked against the current raw/binary images, and applied, in the thread of the thresholder
+  connect(this, SIGNAL(preview_computed(cv::Mat, bool, ulong, ulong)), this, SLOT(apply_preview(cv::Mat, bool, ulong, ulong)), Qt::QueuedConnection);
+
+  preview_worker_ = std::thread(&AssemblyThresholder::run_previews, this);
+
   NQLog("AssemblyThresholder", NQLog::Debug) << "constructed";
 }
 
 AssemblyThresholder::~AssemblyThresholder()
 {
+  {
+    std::lock_guard<std::mutex> lock(preview_mutex_);
+
+    preview_stop_ = true;
+  }
+
+  preview_cond_.notify_all();
+
+  if(preview_worker_.joinable()){ preview_worker_.join(); }
+
   NQLog("AssemblyThresholder", NQLog::Debug) << "destructed";
 }
 
@@ -51,6 +83,17 @@ void AssemblyThresholder::update_image_raw(const cv::Mat& img)
 
 //  mutex_.unlock();
 
+  {
+    std::lock_guard<std::mutex> lock(preview_mutex_);
+
+    preview_img_raw_ = img_raw_;
+
+    img_raw_gs_       = cv::Mat();
+    img_raw_gs_small_ = cv::Mat();
+
+    ++img_raw_id_;
+  }
+
   NQLog("AssemblyThresholder", NQLog::Spam) << "update_image_raw"
      << ": emitting signal \"updated_image_raw\"";
 
@@ -69,6 +112,17 @@ void AssemblyThresholder::delete_image_raw()
 
 //  mutex_.unlock();
 
+  {
+    std::lock_guard<std::mutex> lock(preview_mutex_);
+
+    preview_img_raw_ = cv::Mat();
+
+    img_raw_gs_       = cv::Mat();
+    img_raw_gs_small_ = cv::Mat();
+
+    ++img_raw_id_;
+  }
+
   return;
 }
 
@@ -84,7 +138,14 @@ void AssemblyThresholder::update_image_binary_threshold(const int threshold_valu
 
 //  mutex_.lock();
 
-  img_bin_ = this->get_image_binary_threshold(img_raw_, threshold_value);
+  // pending and running previews are outdated by this result
+  this->supersede_previews();
+
+  cv::Mat img_gs, img_gs_small;
+  unsigned long img_raw_id(0);
+  this->grayscale_images(img_gs, img_gs_small, img_raw_id);
+
+  img_bin_ = this->get_image_binary_threshold(img_gs, threshold_value);
 
   if(updated_img_bin_ == false){ updated_img_bin_ = true; }
 
@@ -100,7 +161,7 @@ void AssemblyThresholder::update_image_binary_threshold(const int threshold_valu
 cv::Mat AssemblyThresholder::get_image_binary_threshold(const cv::Mat& img, const int threshold) const
 {
   // greyscale image
-  cv::Mat img_gs(img.size(), img.type());
+  cv::Mat img_gs;
 
   if(img.channels() > 1)
   {
@@ -109,7 +170,7 @@ cv::Mat AssemblyThresholder::get_image_binary_threshold(const cv::Mat& img, cons
   }
   else
   {
-    img_gs = img.clone();
+    img_gs = img;
   }
 
   // binary image
@@ -149,7 +210,14 @@ void AssemblyThresholder::update_image_binary_adaptiveThreshold(const int blocks
 
 //  mutex_.lock();
 
-  img_bin_ = this->get_image_binary_adaptiveThreshold(img_raw_, blocksize_value);
+  // pending and running previews are outdated by this result
+  this->supersede_previews();
+
+  cv::Mat img_gs, img_gs_small;
+  unsigned long img_raw_id(0);
+  this->grayscale_images(img_gs, img_gs_small, img_raw_id);
+
+  img_bin_ = this->get_image_binary_adaptiveThreshold(img_gs, blocksize_value);
 
   if(updated_img_bin_ == false){ updated_img_bin_ = true; }
 
@@ -165,7 +233,7 @@ void AssemblyThresholder::update_image_binary_adaptiveThreshold(const int blocks
 cv::Mat AssemblyThresholder::get_image_binary_adaptiveThreshold(const cv::Mat& img, const int blocksize) const
 {
   // greyscale image
-  cv::Mat img_gs(img.size(), img.type());
+  cv::Mat img_gs;
 
   if(img.channels() > 1)
   {
@@ -174,7 +242,7 @@ cv::Mat AssemblyThresholder::get_image_binary_adaptiveThreshold(const cv::Mat& i
   }
   else
   {
-    img_gs = img.clone();
+    img_gs = img;
   }
 
   // binary image
@@ -209,6 +277,234 @@ cv::Mat AssemblyThresholder::get_image_binary_adaptiveThreshold(const cv::Mat& i
   return img_bin;
 }
 
+//
+// grayscale image (and its downscaled version for the previews) of the current raw image,
+// converted once per raw image; the conversion runs without lock, and is cached only if the raw image was not updated meanwhile
+// (img_raw_id: identifier of the raw image the grayscale images belong to)
+//
+void AssemblyThresholder::grayscale_images(cv::Mat& img_gs, cv::Mat& img_gs_small, unsigned long& img_raw_id)
+{
+  cv::Mat img_raw;
+
+  {
+    std::lock_guard<std::mutex> lock(preview_mutex_);
+
+    img_raw_id = img_raw_id_;
+
+    if(img_raw_gs_.empty() == false)
+    {
+      img_gs       = img_raw_gs_;
+      img_gs_small = img_raw_gs_small_;
+
+      return;
+    }
+
+    img_raw = preview_img_raw_;
+  }
+
+  if(img_raw.empty())
+  {
+    img_gs       = cv::Mat();
+    img_gs_small = cv::Mat();
+
+    return;
+  }
+
+  if(img_raw.channels() > 1)
+  {
+    cv::cvtColor(img_raw, img_gs, CV_BGR2GRAY);
+  }
+  else
+  {
+    img_gs = img_raw;
+  }
+
+  if(preview_downscale_ > 1)
+  {
+    cv::resize(img_gs, img_gs_small, cv::Size(), 1./preview_downscale_, 1./preview_downscale_, cv::INTER_AREA);
+  }
+  else
+  {
+    img_gs_small = img_gs;
+  }
+
+  std::lock_guard<std::mutex> lock(preview_mutex_);
+
+  if(img_raw_id == img_raw_id_)
+  {
+    img_raw_gs_       = img_gs;
+    img_raw_gs_small_ = img_gs_small;
+  }
+
+  return;
+}
+
+cv::Mat AssemblyThresholder::get_image_binary(const cv::Mat& img, const PreviewMethod method, const int value) const
+{
+  return (method == AdaptiveThreshold) ? this->get_image_binary_adaptiveThreshold(img, value) : this->get_image_binary_threshold(img, value);
+}
+
+void AssemblyThresholder::preview_image_binary_threshold(const int threshold_value)
+{
+  if((threshold_value < 0) || (threshold_value > 255))
+  {
+    NQLog("AssemblyThresholder", NQLog::Spam) << "preview_image_binary_threshold(" << threshold_value << ")"
+       << ": invalid threshold value, no preview";
+
+    return;
+  }
+
+  this->request_preview(Threshold, threshold_value);
+}
+
+void AssemblyThresholder::preview_image_binary_adaptiveThreshold(const int blocksize_value)
+{
+  if((blocksize_value < 3) || (blocksize_value > 1499) || ((blocksize_value % 2) == 0))
+  {
+    NQLog("AssemblyThresholder", NQLog::Spam) << "preview_image_binary_adaptiveThreshold(" << blocksize_value << ")"
+       << ": invalid block-size value, no preview";
+
+    return;
+  }
+
+  this->request_preview(AdaptiveThreshold, blocksize_value);
+}
+
+//
+// the request replaces any pending request (coalescing),
+// and makes the worker abandon the computation in progress (cancellation)
+//
+void AssemblyThresholder::request_preview(const PreviewMethod method, const int value)
+{
+  {
+    std::lock_guard<std::mutex> lock(preview_mutex_);
+
+    preview_request_.method_ = method;
+    preview_request_.value_  = value;
+    preview_request_.seq_    = ++preview_seq_;
+
+    preview_pending_ = true;
+  }
+
+  preview_cond_.notify_one();
+}
+
+bool AssemblyThresholder::preview_superseded(const unsigned long img_raw_id, const unsigned long seq) const
+{
+  std::lock_guard<std::mutex> lock(preview_mutex_);
+
+  return (preview_pending_ || preview_stop_ || (img_raw_id != img_raw_id_) || (seq != preview_seq_));
+}
+
+void AssemblyThresholder::supersede_previews()
+{
+  std::lock_guard<std::mutex> lock(preview_mutex_);
+
+  ++preview_seq_;
+
+  preview_pending_ = false;
+}
+
+void AssemblyThresholder::run_previews()
+{
+  while(true)
+  {
+    PreviewRequest request;
+
+    {
+      std::unique_lock<std::mutex> lock(preview_mutex_);
+
+      preview_cond_.wait(lock, [this](){ return (preview_stop_ || preview_pending_); });
+
+      if(preview_stop_){ return; }
+
+      request = preview_request_;
+
+      preview_pending_ = false;
+    }
+
+    cv::Mat img_gs, img_gs_small;
+    unsigned long img_raw_id(0);
+    this->grayscale_images(img_gs, img_gs_small, img_raw_id);
+
+    if(img_gs.empty() || this->preview_superseded(img_raw_id, request.seq_)){ continue; }
+
+    // quick preview on the downscaled image (block size scaled accordingly), shown at the size of the raw image
+    if(img_gs_small.size() != img_gs.size())
+    {
+      int value_small = request.value_;
+
+      if(request.method_ == AdaptiveThreshold)
+      {
+        value_small = std::max(3, request.value_ / preview_downscale_);
+
+        if((value_small % 2) == 0){ ++value_small; }
+      }
+
+      const cv::Mat img_bin_small = this->get_image_binary(img_gs_small, request.method_, value_small);
+
+      if(this->preview_superseded(img_raw_id, request.seq_)){ continue; }
+
+      cv::Mat img_bin_preview;
+      cv::resize(img_bin_small, img_bin_preview, img_gs.size(), 0., 0., cv::INTER_NEAREST);
+
+      emit preview_computed(img_bin_preview, false, img_raw_id, request.seq_);
+    }
+
+    const cv::Mat img_bin = this->get_image_binary(img_gs, request.method_, request.value_);
+
+    if(this->preview_superseded(img_raw_id, request.seq_)){ continue; }
+
+    emit preview_computed(img_bin, true, img_raw_id, request.seq_);
+  }
+}
+
+//
+// the worker's checks are not atomic with the emission (queued):
+// a result is dropped here if the raw image was updated, or a newer request/synchronous result was issued, since its request
+//
+void AssemblyThresholder::apply_preview(const cv::Mat& img, const bool full_resolution, const unsigned long img_raw_id, const unsigned long seq)
+{
+  {
+    std::lock_guard<std::mutex> lock(preview_mutex_);
+
+    if((img_raw_id != img_raw_id_) || (seq != preview_seq_))
+    {
+      NQLog("AssemblyThresholder", NQLog::Spam) << "apply_preview"
+         << ": outdated preview (image " << img_raw_id << ", request " << seq << "), dropped";
+
+      return;
+    }
+  }
+
+  if(full_resolution)
+  {
+    this->update_image_binary(img);
+  }
+  else
+  {
+    NQLog("AssemblyThresholder", NQLog::Spam) << "apply_preview"
+       << ": emitting signal \"updated_image_binary_preview\"";
+
+    emit updated_image_binary_preview(img);
+  }
+}
+
+void AssemblyThresholder::update_image_binary(const cv::Mat& img)
+{
+  this->supersede_previews();
+
+  img_bin_ = img;
+
+  if(updated_img_bin_ == false){ updated_img_bin_ = true; }
+
+  NQLog("AssemblyThresholder", NQLog::Spam) << "update_image_binary"
+     << ": emitting signal \"updated_image_binary\"";
+
+  emit updated_image_binary(img_bin_);
+  emit updated_image_binary();
+}
+
 void AssemblyThresholder::delete_image_binary()
 {
 //  mutex_.lock();
@@ -15,12 +15,22 @@
 
 /*  Description:
  *   Controller to convert image to binary (BW) image
+ *    - the grayscale version of the raw image is cached, and reused for every thresholding of the same raw image
+ *    - previews (e.g. while the threshold is edited) are computed by a worker thread:
+ *      first on the downscaled image, then at full resolution;
+ *      only the latest request is kept, and a computation is abandoned as soon as a newer request arrives
+ *    - preview results are tagged with the raw image and the sequence number of their request, and dropped
+ *      if the raw image or the binary image (e.g. synchronous thresholding) changed in the meantime
  */
 
 #include <QObject>
 #include <QString>
 #include <QMutex>
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
 #include <opencv2/opencv.hpp>
 
 class AssemblyThresholder : public QObject
@@ -46,6 +56,52 @@ class AssemblyThresholder : public QObject
   bool updated_img_raw_;
   bool updated_img_bin_;
 
+  enum PreviewMethod {
+    Threshold         = 0,
+    AdaptiveThreshold = 1
+  };
+
+  class PreviewRequest {
+
+   public:
+    PreviewMethod method_;
+    int           value_;
+    unsigned long seq_;
+  };
+
+  void grayscale_images(cv::Mat&, cv::Mat&, unsigned long&);
+
+  cv::Mat get_image_binary(const cv::Mat&, const PreviewMethod, const int) const;
+
+  void request_preview(const PreviewMethod, const int);
+
+  bool preview_superseded(const unsigned long, const unsigned long) const;
+
+  void supersede_previews();
+
+  void run_previews();
+
+  // grayscale (and downscaled grayscale) image of the current raw image
+  cv::Mat img_raw_gs_;
+  cv::Mat img_raw_gs_small_;
+
+  unsigned long img_raw_id_;
+
+  // sequence number of the latest change of the binary image (preview request, or synchronous thresholding)
+  unsigned long preview_seq_;
+
+  int preview_downscale_;
+
+  std::thread preview_worker_;
+
+  mutable std::mutex preview_mutex_;
+  std::condition_variable preview_cond_;
+
+  cv::Mat        preview_img_raw_;
+  PreviewRequest preview_request_;
+  bool           preview_pending_;
+  bool           preview_stop_;
+
  private:
   Q_DISABLE_COPY(AssemblyThresholder)
 
@@ -61,6 +117,13 @@ class AssemblyThresholder : public QObject
   void update_image_binary_adaptiveThreshold(const int);
   cv::Mat get_image_binary_adaptiveThreshold(const cv::Mat&, const int) const;
 
+  void preview_image_binary_threshold(const int);
+  void preview_image_binary_adaptiveThreshold(const int);
+
+  void update_image_binary(const cv::Mat&);
+
+  void apply_preview(const cv::Mat&, const bool, const unsigned long, const unsigned long);
+
   void send_image_raw();
   void send_image_binary();
 
@@ -72,6 +135,10 @@ class AssemblyThresholder : public QObject
   void updated_image_raw   (const cv::Mat&);
   void updated_image_binary(const cv::Mat&);
 
+  void updated_image_binary_preview(const cv::Mat&);
+
+  void preview_computed(const cv::Mat&, const bool, const unsigned long, const unsigned long);
+
   void image_sent(const cv::Mat&);
 };
 
@@ -43,7 +43,10 @@ AssemblyThresholderView::AssemblyThresholderView(QWidget* parent) :
 
   imgbin_adathr_button_(nullptr),
   imgbin_adathr_label_ (nullptr),
-  imgbin_adathr_linee_ (nullptr)
+  imgbin_adathr_linee_ (nullptr),
+
+  preview_timer_(nullptr),
+  preview_adaptiveThreshold_(false)
 {
   ApplicationConfig* config = ApplicationConfig::instance();
 
@@ -170,6 +173,17 @@ AssemblyThresholderView::AssemblyThresholderView(QWidget* parent) :
   imgbin_adathr_inputcfg->addWidget(imgbin_adathr_linee_, 60);
   // -----
 
+  // previews: one request per pause in the editing of the parameters
+  preview_timer_ = new QTimer(this);
+  preview_timer_->setSingleShot(true);
+  preview_timer_->setInterval(config->getValue<int>("AssemblyThresholderView_previewDelay", 150));
+
+  connect(preview_timer_, SIGNAL(timeout()), this, SLOT(send_preview_request()));
+
+  connect(imgbin_thresh_linee_, SIGNAL(textEdited(QString)), this, SLOT(request_threshold_preview()));
+  connect(imgbin_adathr_linee_, SIGNAL(textEdited(QString)), this, SLOT(request_adaptiveThreshold_preview()));
+  // -----
+
   lBin->addStretch();
   //// ---------------
 }
@@ -216,6 +230,17 @@ void AssemblyThresholderView::update_image_binary(const cv::Mat& img)
   emit image_binary_updated();
 }
 
+//
+// preview of the binary image: only displayed (the binary image to be saved is the full-resolution result)
+//
+void AssemblyThresholderView::update_image_binary_preview(const cv::Mat& img)
+{
+  NQLog("AssemblyThresholderView", NQLog::Spam) << "update_image_binary_preview"
+     << ": emitting signal \"image_binary_updated\"";
+
+  emit image_binary_updated(img);
+}
+
 void AssemblyThresholderView::load_image_raw()
 {
   const QString filename = QFileDialog::getOpenFileName(this, tr("Load Image"), QString::fromStdString(Config::CMSTkModLabBasePath+"/share/assembly"), tr("PNG Files (*.png);;All Files (*)"));
@@ -313,6 +338,47 @@ void AssemblyThresholderView::apply_adaptiveThreshold()
   emit adaptiveThreshold_request(bks);
 }
 
+void AssemblyThresholderView::request_threshold_preview()
+{
+  preview_adaptiveThreshold_ = false;
+
+  preview_timer_->start();
+}
+
+void AssemblyThresholderView::request_adaptiveThreshold_preview()
+{
+  preview_adaptiveThreshold_ = true;
+
+  preview_timer_->start();
+}
+
+void AssemblyThresholderView::send_preview_request()
+{
+  QLineEdit* const linee = preview_adaptiveThreshold_ ? imgbin_adathr_linee_ : imgbin_thresh_linee_;
+
+  bool valid_value(false);
+
+  const int value = linee->text().toInt(&valid_value);
+
+  // incomplete values are expected while typing
+  if(valid_value == false){ return; }
+
+  if(preview_adaptiveThreshold_)
+  {
+    NQLog("AssemblyThresholderView", NQLog::Spam) << "send_preview_request"
+       << ": emitting signal \"adaptiveThreshold_preview_request(" << value << ")\"";
+
+    emit adaptiveThreshold_preview_request(value);
+  }
+  else
+  {
+    NQLog("AssemblyThresholderView", NQLog::Spam) << "send_preview_request"
+       << ": emitting signal \"threshold_preview_request(" << value << ")\"";
+
+    emit threshold_preview_request(value);
+  }
+}
+
 void AssemblyThresholderView::connectImageProducer_raw(const QObject* sender, const char* signal)
 {
   NQLog("AssemblyThresholderView", NQLog::Debug) << "connectImageProducer_raw";
@@ -21,6 +21,7 @@
 #include <QPushButton>
 #include <QLineEdit>
 #include <QLabel>
+#include <QTimer>
 
 #include <opencv2/opencv.hpp>
 
@@ -68,6 +69,10 @@ class AssemblyThresholderView : public QWidget
   QPushButton* imgbin_adathr_button_;
   QLabel*      imgbin_adathr_label_;
   QLineEdit*   imgbin_adathr_linee_;
+
+  // previews while the parameters are edited (sent once the editing pauses)
+  QTimer* preview_timer_;
+  bool    preview_adaptiveThreshold_;
   // ---------
 
  public slots:
@@ -82,6 +87,12 @@ class AssemblyThresholderView : public QWidget
   void apply_threshold();
   void apply_adaptiveThreshold();
 
+  void request_threshold_preview();
+  void request_adaptiveThreshold_preview();
+  void send_preview_request();
+
+  void update_image_binary_preview(const cv::Mat&);
+
  signals:
 
   void image_raw_request();
@@ -96,6 +107,9 @@ class AssemblyThresholderView : public QWidget
 
   void threshold_request(const int);
   void adaptiveThreshold_request(const int);
+
+  void threshold_preview_request(const int);
+  void adaptiveThreshold_preview_request(const int);
 };
 
 #endif // ASSEMBLYTHRESHOLDERVIEW_H
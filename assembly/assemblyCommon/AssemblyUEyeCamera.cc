@@ -11,8 +11,13 @@
 /////////////////////////////////////////////////////////////////////////////////
 
 #include <AssemblyUEyeCamera.h>
+#include <ApplicationConfig.h>
 #include <nqlogger.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
 AssemblyUEyeCameraEventThread::AssemblyUEyeCameraEventThread() :
   cameraHandle_(0),
   runEventThread_(false)
@@ -62,6 +67,70 @@ void AssemblyUEyeCameraEventThread::run ()
     is_DisableEvent (cameraHandle_, IS_SET_EVENT_FRAME);
 }
 
+AssemblyUEyeCameraBufferLocks::AssemblyUEyeCameraBufferLocks(HIDS cameraHandle) :
+  cameraHandle_(cameraHandle),
+  open_(true),
+  locked_(0)
+{
+}
+
+bool AssemblyUEyeCameraBufferLocks::lock(int nNum, char* pBuf)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if(open_ == false){ return false; }
+
+    if(is_LockSeqBuf(cameraHandle_, nNum, pBuf) != IS_SUCCESS){ return false; }
+
+    ++locked_;
+
+    return true;
+}
+
+void AssemblyUEyeCameraBufferLocks::unlock(int nNum, char* pBuf)
+{
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+
+      if(open_){ is_UnlockSeqBuf(cameraHandle_, nNum, pBuf); }
+
+      --locked_;
+    }
+
+    released_.notify_all();
+}
+
+//
+// waits (up to the timeout) for the release of all the locked buffers,
+// then stops handing buffers back to the camera; returns false if buffers are still in use
+// (their memory stays valid until the last of these frames is released)
+//
+bool AssemblyUEyeCameraBufferLocks::close(int timeout_ms)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    const bool released = released_.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this](){ return (locked_ == 0); });
+
+    open_ = false;
+
+    return released;
+}
+
+//
+// memory of one sequence buffer, aligned, with lines padded to the alignment
+// (the line increment of the camera is a divisor of the alignment)
+//
+char* AssemblyUEyeCameraBufferLocks::allocate(size_t size)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    memory_.emplace_back(new char[size + alignment]);
+
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(memory_.back().get());
+
+    return reinterpret_cast<char*>((address + alignment - 1) / alignment * alignment);
+}
+
 AssemblyUEyeCamera::AssemblyUEyeCamera(QObject *parent) : AssemblyVUEyeCamera(parent)
 {
     bufferProps_.width = 0;
@@ -75,7 +144,19 @@ AssemblyUEyeCamera::AssemblyUEyeCamera(QObject *parent) : AssemblyVUEyeCamera(pa
     //for (int i = 0; i < 256; i++)
     //    table_[i] = qRgb (i, i, i);
 
-    ZeroMemory(images_, sizeof(images_));
+    // ring of sequence buffers: frames locked by slow consumers do not stall the capture
+    int nSequenceBuffers = 8;
+
+    ApplicationConfig* config = ApplicationConfig::instance();
+    if(config != nullptr)
+    {
+      nSequenceBuffers = std::max(2, config->getValue<int>("AssemblyUEyeCamera_sequenceBuffers", 8));
+    }
+
+    UEYE_IMAGE image;
+    ZeroMemory(&image, sizeof(image));
+
+    images_.assign(nSequenceBuffers, image);
 
     pixelClocks_.clear();
     currentPixelClock_ = 0;
@@ -198,6 +279,9 @@ void AssemblyUEyeCamera::open()
     updatePixelClock();
     updateExposureTime();
 
+    // owner of the memory of the sequence buffers (allocated in setupCapture)
+    bufferLocks_ = std::make_shared<AssemblyUEyeCameraBufferLocks>(cameraHandle_);
+
     setupCapture();
 
     eventThread_ = new AssemblyUEyeCameraEventThread();
@@ -217,12 +301,25 @@ void AssemblyUEyeCamera::close()
 {
     if(cameraState_ != State::READY){ return; }
 
+    stopStreaming();
+
     cameraState_ = State::CLOSING;
 
     eventThread_->stop();
 
+    resetFrameStatistics();
+
+    if(bufferLocks_->close(1000) == false)
+    {
+        NQLog("AssemblyUEyeCamera", NQLog::Message) << "close"
+           << ": frames still in use after closing the camera, their buffers are freed with the last of them";
+    }
+
+    // the buffers are removed from the driver, their memory is freed with the last reference to bufferLocks_
     freeImages();
 
+    bufferLocks_.reset();
+
     if (eventThread_->wait(2000) == FALSE){
         eventThread_->terminate();
     }
@@ -479,31 +576,56 @@ void AssemblyUEyeCamera::eventHappend()
 {
     NQLog("AssemblyUEyeCamera", NQLog::Debug) << "eventHappend: new frame available";
 
+    if (!cameraHandle_) return;
+
+    if (bufferProps_.width < 1 || bufferProps_.height < 1)
+        return;
+
     INT dummy = 0;
     char *pLast = nullptr, *pMem = nullptr;
 
     is_GetActSeqBuf(cameraHandle_, &dummy, &pMem, &pLast);
     lastBuffer_ = pLast;
 
-    int nNum;
-    INT ret = IS_SUCCESS;
+    const int nNum = getImageNumber(lastBuffer_);
 
-    if (!cameraHandle_) return;
+    if((bufferLocks_ == nullptr) || (bufferLocks_->lock(nNum, lastBuffer_) == false))
+    {
+        NQLog("AssemblyUEyeCamera", NQLog::Warning) << "eventHappend"
+           << ": failed to lock sequence buffer #" << nNum << ", frame dropped";
+
+        countDroppedFrame();
 
-    if (bufferProps_.width < 1 || bufferProps_.height < 1)
         return;
+    }
+
+    // header on the locked sequence buffer (no copy),
+    // the buffer is unlocked when the last reference to the frame is released
+    const cv::Mat image_buffer(bufferProps_.height, bufferProps_.width, bufferProps_.cvimgformat, lastBuffer_, bufferProps_.pitch);
 
-    nNum = getImageNumber(lastBuffer_);
-    ret = is_LockSeqBuf(cameraHandle_, nNum, lastBuffer_);
+    const std::shared_ptr<AssemblyUEyeCameraBufferLocks> locks(bufferLocks_);
+    char* const pBuf = lastBuffer_;
 
-    memcpy(image_.ptr(), (uchar*)lastBuffer_, bufferProps_.width * bufferProps_.height * 1);
+    const FramePtr frame(new Frame(image_buffer, frameTime()), [locks, nNum, pBuf](const Frame* f){ delete f; locks->unlock(nNum, pBuf); });
 
-    is_UnlockSeqBuf(cameraHandle_, nNum, lastBuffer_);
+    if(streaming_)
+    {
+        publishFrame(frame);
+
+        if(streamingImageRequested_ == false){ return; }
+
+        streamingImageRequested_ = false;
+    }
+
+    // the consumers of "imageAcquired" keep the image: they receive a copy, and the buffer goes back to the camera
+    const cv::Mat image = frame->image().clone();
+
+    if(streaming_ == false){ publishFrame(FramePtr(new Frame(image, frame->time()))); }
 
     NQLog("AssemblyUEyeCamera", NQLog::Debug) << "eventHappend"
        << ": emitting signal \"imageAcquired\"";
 
-    emit imageAcquired(image_);
+    emit imageAcquired(image);
 }
 
 void AssemblyUEyeCamera::acquireImage()
@@ -517,6 +639,15 @@ void AssemblyUEyeCamera::acquireImage()
 
   NQLog("AssemblyUEyeCamera", NQLog::Spam) << "acquireImage: camera is ready";
 
+  if(streaming_)
+  {
+      streamingImageRequested_ = true;
+
+      NQLog("AssemblyUEyeCamera", NQLog::Spam) << "acquireImage: camera is streaming, image taken from next frame";
+
+      return;
+  }
+
   unsigned int ret = is_FreezeVideo(cameraHandle_, IS_DONT_WAIT);
 
   if(ret == IS_SUCCESS)
@@ -527,6 +658,62 @@ void AssemblyUEyeCamera::acquireImage()
   return;
 }
 
+void AssemblyUEyeCamera::startStreaming()
+{
+  if(cameraState_ != READY)
+  {
+      NQLog("AssemblyUEyeCamera", NQLog::Critical) << "startStreaming: camera is not ready, no action taken";
+
+      return;
+  }
+
+  if(streaming_){ return; }
+
+  resetFrameStatistics();
+
+  const INT ret = is_CaptureVideo(cameraHandle_, IS_DONT_WAIT);
+
+  if(ret != IS_SUCCESS)
+  {
+      NQLog("AssemblyUEyeCamera", NQLog::Critical) << "startStreaming: is_CaptureVideo=" << ret << ", no action taken";
+
+      return;
+  }
+
+  streaming_ = true;
+  streamingImageRequested_ = false;
+
+  NQLog("AssemblyUEyeCamera", NQLog::Debug) << "startStreaming"
+     << ": emitting signal \"streamingStarted\"";
+
+  emit streamingStarted();
+}
+
+void AssemblyUEyeCamera::stopStreaming()
+{
+  if(streaming_ == false){ return; }
+
+  is_StopLiveVideo(cameraHandle_, IS_FORCE_VIDEO_STOP);
+
+  streaming_ = false;
+
+  NQLog("AssemblyUEyeCamera", NQLog::Message) << "stopStreaming"
+     << ": " << frameCount() << " frames (" << droppedFrames() << " dropped), " << frameRate() << " frames/s";
+
+  // a pending image request is served with a single-frame capture
+  if(streamingImageRequested_)
+  {
+      streamingImageRequested_ = false;
+
+      acquireImage();
+  }
+
+  NQLog("AssemblyUEyeCamera", NQLog::Debug) << "stopStreaming"
+     << ": emitting signal \"streamingStopped\"";
+
+  emit streamingStopped();
+}
+
 int AssemblyUEyeCamera::searchDefaultImageFormats(int supportMask)
 {
     int ret = IS_SUCCESS;
@@ -613,9 +800,19 @@ void AssemblyUEyeCamera::setupCapture()
             break;
         }
 
-        image_.create(bufferProps_.height, bufferProps_.width, bufferProps_.cvimgformat);
-
         allocImages();
+
+        // line pitch of the sequence buffers (lines can be padded)
+        INT nX = 0, nY = 0, nBits = 0, nPitch = 0;
+
+        if((images_.at(0).pBuf == nullptr)
+           || (is_InquireImageMem(cameraHandle_, images_.at(0).pBuf, images_.at(0).nImageID, &nX, &nY, &nBits, &nPitch) != IS_SUCCESS)
+           || (nPitch < bufferProps_.width))
+        {
+            nPitch = bufferProps_.width;
+        }
+
+        bufferProps_.pitch = nPitch;
     }
 }
 
@@ -721,7 +918,7 @@ bool AssemblyUEyeCamera::allocImages()
 
     is_ClearSequence(cameraHandle_);
 
-    for (unsigned int i = 0; i < sizeof(images_) / sizeof(images_[0]); i++) {
+    for (unsigned int i = 0; i < images_.size(); i++) {
 
         if (images_[i].pBuf) {
             is_FreeImageMem (cameraHandle_, images_[i].pBuf, images_[i].nImageID);
@@ -740,9 +937,21 @@ bool AssemblyUEyeCamera::allocImages()
             bufferProps_.height = nHeight = getMaxHeight();
         }
 
-        if (is_AllocImageMem (cameraHandle_, nWidth, nHeight, bufferProps_.bitspp, &images_[i].pBuf,
-                              &images_[i].nImageID) != IS_SUCCESS)
+        // user memory: not freed by is_FreeImageMem/is_ExitCamera, but with the last frame using it
+        const size_t alignment = AssemblyUEyeCameraBufferLocks::alignment;
+        const size_t lineSize = (size_t(nWidth) * ((bufferProps_.bitspp + 7) / 8) + alignment - 1) / alignment * alignment;
+
+        if (bufferLocks_ == nullptr)
+            return FALSE;
+
+        char* const pBuf = bufferLocks_->allocate(lineSize * nHeight);
+
+        if (is_SetAllocatedImageMem (cameraHandle_, nWidth, nHeight, bufferProps_.bitspp, pBuf,
+                                     &images_[i].nImageID) != IS_SUCCESS)
             return FALSE;
+
+        images_[i].pBuf = pBuf;
+
         if (is_AddToSequence (cameraHandle_, images_[i].pBuf, images_[i].nImageID) != IS_SUCCESS)
             return FALSE;
 
@@ -756,7 +965,7 @@ bool AssemblyUEyeCamera::allocImages()
 bool AssemblyUEyeCamera::freeImages()
 {
     lastBuffer_ = nullptr;
-    for (unsigned int i = 0; i < sizeof(images_) / sizeof(images_[0]); i++)
+    for (unsigned int i = 0; i < images_.size(); i++)
     {
         if (images_[i].pBuf)
         {
@@ -771,7 +980,7 @@ bool AssemblyUEyeCamera::freeImages()
 
 int AssemblyUEyeCamera::getImageNumber(char * pBuffer)
 {
-    for (unsigned int i = 0; i < sizeof(images_) / sizeof(images_[0]); i++)
+    for (unsigned int i = 0; i < images_.size(); i++)
         if (images_[i].pBuf == pBuffer)
             return images_[i].nImageSeqNum;
 
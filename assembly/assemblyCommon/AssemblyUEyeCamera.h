@@ -18,6 +18,11 @@
 
 #include <QThread>
 
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+
 #include <opencv2/opencv.hpp>
 
 typedef struct _UEYE_IMAGE
@@ -54,6 +59,42 @@ class AssemblyUEyeCameraEventThread : public QThread
     volatile bool runEventThread_;
 };
 
+//
+// sequence buffers locked by the frames handed out to the consumers:
+// shared by the camera and by the frames, so that a frame released
+// after the camera was closed does not access the camera;
+// the memory of the buffers (user memory, registered with is_SetAllocatedImageMem) belongs to this object,
+// so it is freed with the last reference to it (camera or frame), and never under a frame still in use
+//
+class AssemblyUEyeCameraBufferLocks
+{
+  public:
+
+    explicit AssemblyUEyeCameraBufferLocks(HIDS cameraHandle);
+    virtual ~AssemblyUEyeCameraBufferLocks() {}
+
+    bool lock(int nNum, char* pBuf);
+    void unlock(int nNum, char* pBuf);
+
+    bool close(int timeout_ms);
+
+    char* allocate(size_t size);
+
+    static const size_t alignment = 64;
+
+  protected:
+
+    HIDS cameraHandle_;
+
+    std::vector<std::unique_ptr<char[]> > memory_;
+
+    std::mutex mutex_;
+    std::condition_variable released_;
+
+    bool open_;
+    unsigned int locked_;
+};
+
 class AssemblyUEyeCamera : public AssemblyVUEyeCamera
 {
  Q_OBJECT
@@ -76,6 +117,9 @@ class AssemblyUEyeCamera : public AssemblyVUEyeCamera
 
     void acquireImage();
 
+    void startStreaming();
+    void stopStreaming();
+
     void setPixelClock(unsigned int);
     void setExposureTime(double);
 
@@ -114,6 +158,7 @@ class AssemblyUEyeCamera : public AssemblyVUEyeCamera
         int colorformat;
         int bitspp;
         int cvimgformat;
+        int pitch;
         //QRgb *pRgbTable;
         //int tableentries;
         int imageformat;
@@ -121,9 +166,9 @@ class AssemblyUEyeCamera : public AssemblyVUEyeCamera
     //QRgb table_[256];
 
     char *lastBuffer_;
-    UEYE_IMAGE images_[5];
+    std::vector<UEYE_IMAGE> images_;
 
-    cv::Mat image_;
+    std::shared_ptr<AssemblyUEyeCameraBufferLocks> bufferLocks_;
 };
 
 #endif // ASSEMBLYUEYECAMERA_H
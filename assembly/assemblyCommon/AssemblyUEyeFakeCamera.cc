@@ -12,16 +12,65 @@
 
 #include <AssemblyUEyeFakeCamera.h>
 #include <ApplicationConfig.h>
+#include <AssemblyParameters.h>
 #include <nqlogger.h>
 
 #include <unistd.h>
 
+#include <algorithm>
+
 AssemblyUEyeFakeCamera::AssemblyUEyeFakeCamera(QObject* parent) :
   AssemblyVUEyeCamera(parent),
-  imageIndex_(0)
+  imageIndex_(0),
+  streamingTimer_(nullptr),
+  simulation_(nullptr),
+  motion_model_(nullptr)
 {
     cameraState_ = State::OFF;
 
+    // frame rate of the simulated streaming
+    double frameRate = 10.;
+
+    ApplicationConfig* config = ApplicationConfig::instance();
+    if(config != nullptr)
+    {
+      frameRate = config->getValue<double>("AssemblyUEyeFakeCamera_frameRate", 10.);
+
+      // simulated camera: field of view rendered from a mosaic of the object plane
+      const std::string mosaic = config->getValue<std::string>("AssemblyCameraSimulation_mosaic", "");
+
+      if(mosaic.empty() == false)
+      {
+        AssemblyCameraSimulation::Configuration conf;
+
+        conf.mosaic_path         = (mosaic.at(0) == '/') ? mosaic : (Config::CMSTkModLabBasePath+"/"+mosaic);
+        conf.mosaic_mm_per_pixel = config->getValue<double>("AssemblyCameraSimulation_mosaicMMPerPixel", 0.0012);
+        conf.mosaic_centerX      = config->getValue<double>("AssemblyCameraSimulation_mosaicCenterX"   , 0.);
+        conf.mosaic_centerY      = config->getValue<double>("AssemblyCameraSimulation_mosaicCenterY"   , 0.);
+        conf.width               = config->getValue<int>   ("AssemblyCameraSimulation_width"           , 2560);
+        conf.height              = config->getValue<int>   ("AssemblyCameraSimulation_height"          , 1920);
+        conf.mm_per_pixel_row    = config->getValue<double>("mm_per_pixel_row", 0.0012);
+        conf.mm_per_pixel_col    = config->getValue<double>("mm_per_pixel_col", 0.0012);
+        conf.rotation_centerX    = config->getValue<double>("AssemblyCameraSimulation_rotationCenterX" , 0.);
+        conf.rotation_centerY    = config->getValue<double>("AssemblyCameraSimulation_rotationCenterY" , 0.);
+        conf.focal_Z             = config->getValue<double>("AssemblyCameraSimulation_focalZ"          , 0.);
+        conf.blur_per_mm         = config->getValue<double>("AssemblyCameraSimulation_blurPerMM"       , 200.);
+        conf.blur_max            = config->getValue<double>("AssemblyCameraSimulation_blurMax"         , 20.);
+        conf.noise               = config->getValue<double>("AssemblyCameraSimulation_noise"           , 2.);
+
+        const AssemblyParameters* const params = AssemblyParameters::instance();
+
+        conf.camera_angle = (params != nullptr) ? params->get("AngleOfCameraFrameInRefFrame_dA") : 0.;
+
+        simulation_.reset(new AssemblyCameraSimulation(conf));
+      }
+    }
+
+    streamingTimer_ = new QTimer(this);
+    streamingTimer_->setInterval(std::max(1, int(1000. / std::max(0.1, frameRate))));
+
+    connect(streamingTimer_, SIGNAL(timeout()), this, SLOT(streamFrame()));
+
     QString filename(Config::CMSTkModLabBasePath.c_str());
 
     std::vector<std::string> filenames;
@@ -103,8 +152,12 @@ void AssemblyUEyeFakeCamera::close()
 
     if(cameraState_ != State::READY){ return; }
 
+    stopStreaming();
+
     cameraState_ = State::CLOSING;
 
+    resetFrameStatistics();
+
     usleep(500000);
 
     cameraState_ = State::OFF;
@@ -217,11 +270,52 @@ void AssemblyUEyeFakeCamera::setExposureTime(double et)
     }
 }
 
+const cv::Mat& AssemblyUEyeFakeCamera::image(const std::string& filename)
+{
+    std::map<std::string, cv::Mat>::const_iterator it = imageCache_.find(filename);
+
+    if(it == imageCache_.end())
+    {
+      it = imageCache_.insert(std::make_pair(filename, cv::imread(filename, CV_LOAD_IMAGE_GRAYSCALE))).first;
+    }
+
+    return it->second;
+}
+
+//
+// image of the simulated camera at the current position of the motion stage
+// (empty if the simulation is not enabled)
+//
+cv::Mat AssemblyUEyeFakeCamera::simulated_image()
+{
+    if((simulation_ == nullptr) || (simulation_->ready() == false) || (motion_model_ == nullptr)){ return cv::Mat(); }
+
+    // copy of the positions under the lock of the model (polled in its own thread)
+    std::vector<double> positions;
+    double positions_time(0.);
+
+    motion_model_->getTimedPositions(positions, positions_time);
+
+    return simulation_->render(positions);
+}
+
 void AssemblyUEyeFakeCamera::acquireImage()
 {
     if(cameraState_ != State::READY){ return; }
 
-    image_ = cv::imread(imageFilenames_[imageIndex_++], CV_LOAD_IMAGE_GRAYSCALE);
+    if(streaming_)
+    {
+      streamingImageRequested_ = true;
+
+      return;
+    }
+
+    image_ = this->simulated_image();
+
+    // the consumers of "imageAcquired" keep the image: they receive a copy of the cached image
+    if(image_.empty()){ image_ = this->image(imageFilenames_[imageIndex_++]).clone(); }
+
+    publishFrame(FramePtr(new Frame(image_, frameTime())));
 
     NQLog("AssemblyUEyeFakeCamera", NQLog::Debug) << "acquireImage"
        << ": emitting signal \"imageAcquired\"";
@@ -230,3 +324,76 @@ void AssemblyUEyeFakeCamera::acquireImage()
 
     if(imageIndex_ == imageFilenames_.size()){ imageIndex_ = 0; }
 }
+
+void AssemblyUEyeFakeCamera::startStreaming()
+{
+    if(cameraState_ != State::READY){ return; }
+
+    if(streaming_){ return; }
+
+    resetFrameStatistics();
+
+    streaming_ = true;
+    streamingImageRequested_ = false;
+
+    streamingTimer_->start();
+
+    NQLog("AssemblyUEyeFakeCamera", NQLog::Debug) << "startStreaming"
+       << ": emitting signal \"streamingStarted\"";
+
+    emit streamingStarted();
+}
+
+void AssemblyUEyeFakeCamera::stopStreaming()
+{
+    if(streaming_ == false){ return; }
+
+    streamingTimer_->stop();
+
+    streaming_ = false;
+
+    NQLog("AssemblyUEyeFakeCamera", NQLog::Message) << "stopStreaming"
+       << ": " << frameCount() << " frames (" << droppedFrames() << " dropped), " << frameRate() << " frames/s";
+
+    if(streamingImageRequested_)
+    {
+      streamingImageRequested_ = false;
+
+      acquireImage();
+    }
+
+    NQLog("AssemblyUEyeFakeCamera", NQLog::Debug) << "stopStreaming"
+       << ": emitting signal \"streamingStopped\"";
+
+    emit streamingStopped();
+}
+
+//
+// frame of the simulated streaming: the current image of the sequence, shared with the cache (no copy)
+//
+void AssemblyUEyeFakeCamera::streamFrame()
+{
+    if((cameraState_ != State::READY) || (streaming_ == false)){ return; }
+
+    cv::Mat image = this->simulated_image();
+
+    if(image.empty()){ image = this->image(imageFilenames_[imageIndex_]); }
+
+    const FramePtr frame(new Frame(image, frameTime()));
+
+    publishFrame(frame);
+
+    if(streamingImageRequested_)
+    {
+      streamingImageRequested_ = false;
+
+      image_ = frame->image().clone();
+
+      NQLog("AssemblyUEyeFakeCamera", NQLog::Debug) << "streamFrame"
+         << ": emitting signal \"imageAcquired\"";
+
+      emit imageAcquired(image_);
+
+      if(++imageIndex_ == imageFilenames_.size()){ imageIndex_ = 0; }
+    }
+}
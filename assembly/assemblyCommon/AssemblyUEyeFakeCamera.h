@@ -14,9 +14,14 @@
 #define ASSEMBLYUEYEFAKECAMERA_H
 
 #include <AssemblyVUEyeCamera.h>
+#include <AssemblyCameraSimulation.h>
+#include <LStepExpressModel.h>
+
+#include <QTimer>
 
 #include <vector>
 #include <map>
+#include <memory>
 
 #include <opencv2/opencv.hpp>
 
@@ -35,6 +40,11 @@ class AssemblyUEyeFakeCamera : public AssemblyVUEyeCamera
 
   bool isAvailable() const { return true; }
 
+  // the simulated field of view follows the position of this motion stage
+  void setMotionModel(const LStepExpressModel* model) { motion_model_ = model; }
+
+  const AssemblyCameraSimulation* simulation() const { return simulation_.get(); }
+
  public slots:
 
   void open();
@@ -42,16 +52,36 @@ class AssemblyUEyeFakeCamera : public AssemblyVUEyeCamera
 
   void acquireImage();
 
+  void startStreaming();
+  void stopStreaming();
+
   void setPixelClock(unsigned int pc);
   void setExposureTime(double et);
 
+ protected slots:
+
+  void streamFrame();
+
  protected:
 
+  const cv::Mat& image(const std::string&);
+
+  cv::Mat simulated_image();
+
   cv::Mat image_;
   std::vector<std::string> imageFilenames_;
   size_t imageIndex_;
 
   std::map<unsigned int, std::vector<std::string> > imageFilenamesForPixelClock_;
+
+  // decoded images, shared (read-only) by the frames of the streaming
+  std::map<std::string, cv::Mat> imageCache_;
+
+  QTimer* streamingTimer_;
+
+  // simulated camera (enabled by a mosaic image in the configuration)
+  std::unique_ptr<AssemblyCameraSimulation> simulation_;
+  const LStepExpressModel* motion_model_;
 };
 
 #endif // ASSEMBLYUEYEFAKECAMERA_H
@@ -10,14 +10,22 @@
 //                                                                             //
 /////////////////////////////////////////////////////////////////////////////////
 
+
 #include <AssemblyUEyeView.h>
 
 #include <QPainter>
+#include <QVector>
+
+#include <cmath>
+#include <algorithm>
 
 AssemblyUEyeView::AssemblyUEyeView(QWidget* parent) :
   QLabel(parent),
-  image_(QImage()),
-  zoomFactor_(0.25)
+  image_(cv::Mat()),
+  pixmapValid_(true),
+  centerLines_(false),
+  zoomFactor_(0.25),
+  skippedImages_(0)
 {
 }
 
@@ -35,42 +43,104 @@ void AssemblyUEyeView::setImage(const cv::Mat& newImage)
 {
     QMutexLocker lock(&mutex_);
 
-    if(newImage.channels() == 1)
+    if((pixmapValid_ == false) && (image_.empty() == false)){ ++skippedImages_; }
+
+    image_ = newImage;
+    pixmapValid_ = false;
+
+    lock.unlock();
+
+    update();
+}
+
+//
+// downscaling before the conversion: only the displayed pixels are converted
+//
+void AssemblyUEyeView::render()
+{
+    if(image_.empty())
+    {
+        pixmap_ = QPixmap();
+
+        return;
+    }
+
+    const int width  = std::max(1, int(std::lround(image_.cols * zoomFactor_)));
+    const int height = std::max(1, int(std::lround(image_.rows * zoomFactor_)));
+
+    cv::Mat image = image_;
+
+    if((width != image.cols) || (height != image.rows))
+    {
+        cv::resize(image_, image, cv::Size(width, height), 0., 0., (zoomFactor_ < 1.) ? cv::INTER_AREA : cv::INTER_LINEAR);
+    }
+
+    if(image.depth() != CV_8U)
     {
         cv::Mat temp;
-        cvtColor(newImage, temp, CV_GRAY2RGB);
+        image.convertTo(temp, CV_8U);
 
-        image_ = QImage((const uchar *) temp.data, temp.cols, temp.rows, temp.step, QImage::Format_RGB888);
-        image_.bits();
+        image = temp;
     }
-    else
+
+    if(image.channels() == 4)
     {
-        image_ = QImage((const uchar *) newImage.data, newImage.cols, newImage.rows, newImage.step, QImage::Format_RGB888);
-        image_.bits();
+        cv::Mat temp;
+        cvtColor(image, temp, CV_BGRA2BGR);
+
+        image = temp;
     }
 
-    lock.unlock();
+    QImage qimage;
 
-    update();
+    if(image.channels() == 1)
+    {
+        static QVector<QRgb> grayTable;
+
+        if(grayTable.isEmpty())
+        {
+            for(int i=0; i<256; ++i){ grayTable.push_back(qRgb(i, i, i)); }
+        }
+
+        qimage = QImage((const uchar *) image.data, image.cols, image.rows, image.step, QImage::Format_Indexed8);
+        qimage.setColorTable(grayTable);
+    }
+    else
+    {
+        qimage = QImage((const uchar *) image.data, image.cols, image.rows, image.step, QImage::Format_RGB888);
+    }
+
+    // deep copy: the pixmap does not depend on the input image
+    pixmap_ = QPixmap::fromImage(qimage);
 }
 
 void AssemblyUEyeView::paintEvent(QPaintEvent*)
 {
-    if(image_.isNull() == false)
+    QMutexLocker lock(&mutex_);
+
+    if(pixmapValid_ == false)
     {
-        const QImage image = image_.scaled(image_.width()  * zoomFactor_, image_.height() * zoomFactor_, Qt::KeepAspectRatio);
+        this->render();
+
+        pixmapValid_ = true;
+    }
+
+    if(pixmap_.isNull()){ return; }
 
-        resize(image.width(), image.height());
+    if(size() != pixmap_.size()){ resize(pixmap_.size()); }
 
-        //qreal posX = this->width()  / 2 - image.width()  / 2;
-        //qreal posY = this->height() / 2 - image.height() / 2;
-        QRectF target(0, 0, image.width(), image.height());
+    QPainter painter(this);
+    painter.drawPixmap(0, 0, pixmap_);
 
-        QPainter painter(this);
-        painter.drawImage(target, image);
-        painter.end();
+    if(centerLines_)
+    {
+        painter.setPen(QPen(Qt::red, 2));
+        painter.drawLine(pixmap_.width()/2, 0, pixmap_.width()/2, pixmap_.height());
+        painter.drawLine(0, pixmap_.height()/2, pixmap_.width(), pixmap_.height()/2);
     }
 
+    painter.end();
+
     return;
 }
 
@@ -78,7 +148,13 @@ void AssemblyUEyeView::setZoomFactor(float zoomFactor)
 {
     if(zoomFactor_ == zoomFactor){ return; }
 
+    QMutexLocker lock(&mutex_);
+
     zoomFactor_ = zoomFactor;
+    pixmapValid_ = false;
+
+    lock.unlock();
+
     update();
 }
 
@@ -86,14 +162,20 @@ void AssemblyUEyeView::increaseZoomFactor()
 {
     if(zoomFactor_ >= 4.0){ return; }
 
-    zoomFactor_ += 0.05;
-    update();
+    this->setZoomFactor(zoomFactor_ + 0.05);
 }
 
 void AssemblyUEyeView::decreaseZoomFactor()
 {
     if (zoomFactor_<=0.25) return;
 
-    zoomFactor_ -= 0.05;
+    this->setZoomFactor(zoomFactor_ - 0.05);
+}
+
+void AssemblyUEyeView::setCenterLines(const bool centerLines)
+{
+    if(centerLines_ == centerLines){ return; }
+
+    centerLines_ = centerLines;
     update();
 }
@@ -10,15 +10,22 @@
 //                                                                             //
 /////////////////////////////////////////////////////////////////////////////////
 
+
 #ifndef ASSEMBLYUEYEVIEW_H
 #define ASSEMBLYUEYEVIEW_H
 
 #include <QLabel>
 #include <QImage>
+#include <QPixmap>
 #include <QMutex>
 
 #include <opencv2/opencv.hpp>
 
+//
+// the input image is kept as is (no copy), and converted and scaled
+// for display once, at the first repaint after it was set:
+// images replaced before the next repaint are skipped
+//
 class AssemblyUEyeView : public QLabel
 {
  Q_OBJECT
@@ -35,13 +42,30 @@ class AssemblyUEyeView : public QLabel
   void increaseZoomFactor();
   void decreaseZoomFactor();
 
+  void setCenterLines(const bool);
+  bool centerLines() const { return centerLines_; }
+
+  unsigned long skippedImages() const { return skippedImages_; }
+
  protected:
 
   void paintEvent(QPaintEvent*);
 
-  QImage image_;
+  void render();
+
+  cv::Mat image_;
+
+  // image converted and scaled for display
+  QPixmap pixmap_;
+  bool    pixmapValid_;
+
+  // overlay drawn on top of the image
+  bool centerLines_;
+
   float zoomFactor_;
 
+  unsigned long skippedImages_;
+
   QMutex mutex_;
 
  public slots:
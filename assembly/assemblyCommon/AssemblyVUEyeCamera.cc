@@ -15,9 +15,17 @@
 
 #include <unistd.h> 
 
+#include <chrono>
+
 AssemblyVUEyeCamera::AssemblyVUEyeCamera(QObject* parent) :
   QObject(parent),
-  cameraState_(State::OFF)
+  cameraState_(State::OFF),
+  streaming_(false),
+  streamingImageRequested_(false),
+  latestFrameTaken_(true),
+  frameCount_(0),
+  droppedFrames_(0),
+  frameTimes_(32)
 {
 }
 
@@ -36,3 +44,177 @@ size_t AssemblyVUEyeCamera::getCurrentPixelClockIndex() const
 
     return idx;
 }
+
+//
+// steady-clock time in seconds (time stamp of the frames)
+//
+double AssemblyVUEyeCamera::frameTime()
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#if CV_MAJOR_VERSION >= 3
+namespace {
+
+  //
+  // allocator of the images returned by AssemblyVUEyeCamera::sharedImage:
+  // the data of the image belongs to a frame, which is kept alive by the reference count of the cv::Mat;
+  // new data (e.g. cv::Mat::create on a copy of the image) is allocated by the standard allocator
+  //
+  class FrameMatAllocator : public cv::MatAllocator
+  {
+   public:
+
+    cv::UMatData* allocate(int dims, const int* sizes, int type, void* data, size_t* step, int flags, cv::UMatUsageFlags usageFlags) const
+    {
+      return cv::Mat::getStdAllocator()->allocate(dims, sizes, type, data, step, flags, usageFlags);
+    }
+
+    bool allocate(cv::UMatData* u, int accessFlags, cv::UMatUsageFlags usageFlags) const
+    {
+      return cv::Mat::getStdAllocator()->allocate(u, accessFlags, usageFlags);
+    }
+
+    void deallocate(cv::UMatData* u) const
+    {
+      if(u == nullptr){ return; }
+
+      delete static_cast<AssemblyVUEyeCamera::FramePtr*>(u->userdata);
+
+      u->userdata = nullptr;
+
+      delete u;
+    }
+
+    void unmap(cv::UMatData* u) const
+    {
+      if((u->urefcount == 0) && (u->refcount == 0)){ this->deallocate(u); }
+    }
+
+    static const FrameMatAllocator* instance()
+    {
+      static const FrameMatAllocator allocator;
+
+      return &allocator;
+    }
+  };
+}
+#endif
+
+//
+// header on the image of the frame (no copy), which holds a reference to the frame:
+// the buffer of the frame stays valid as long as any copy of the returned image exists,
+// so the image can be kept by its consumers;
+// OpenCV 2.x has no user-defined reference counting of external data, there the image is copied
+//
+cv::Mat AssemblyVUEyeCamera::sharedImage(const FramePtr& frame)
+{
+  if(frame == nullptr){ return cv::Mat(); }
+
+  const cv::Mat& frame_image = frame->image();
+
+#if CV_MAJOR_VERSION >= 3
+  if(frame_image.empty() || (frame_image.u != nullptr))
+  {
+    // the frame owns a reference-counted image already
+    return frame_image;
+  }
+
+  cv::Mat image(frame_image.rows, frame_image.cols, frame_image.type(), frame_image.data, frame_image.step[0]);
+
+  const FrameMatAllocator* const allocator = FrameMatAllocator::instance();
+
+  cv::UMatData* const u = new cv::UMatData(allocator);
+  u->data     = u->origdata = image.data;
+  u->size     = image.step[0] * image.rows;
+  u->flags   |= cv::UMatData::USER_ALLOCATED;
+  u->userdata = new FramePtr(frame);
+  u->refcount = 1;
+
+  image.u         = u;
+  image.allocator = const_cast<FrameMatAllocator*>(allocator);
+
+  return image;
+#else
+  return frame_image.clone();
+#endif
+}
+
+AssemblyVUEyeCamera::FramePtr AssemblyVUEyeCamera::latestFrame() const
+{
+  std::lock_guard<std::mutex> lock(frameMutex_);
+
+  latestFrameTaken_ = true;
+
+  return latestFrame_;
+}
+
+//
+// frame rate over the most recent frames (up to the capacity of the ring of time stamps)
+//
+double AssemblyVUEyeCamera::frameRate() const
+{
+  std::lock_guard<std::mutex> lock(frameMutex_);
+
+  if(frameTimes_.size() < 2){ return 0.; }
+
+  const double dt = frameTimes_.first() - frameTimes_.last();
+
+  return (dt > 0.) ? ((frameTimes_.size() - 1) / dt) : 0.;
+}
+
+unsigned long AssemblyVUEyeCamera::frameCount() const
+{
+  std::lock_guard<std::mutex> lock(frameMutex_);
+
+  return frameCount_;
+}
+
+unsigned long AssemblyVUEyeCamera::droppedFrames() const
+{
+  std::lock_guard<std::mutex> lock(frameMutex_);
+
+  return droppedFrames_;
+}
+
+//
+// replaces the latest frame: a frame that is replaced before any subscriber took it
+// (i.e. the consumers are slower than the camera) is counted as dropped
+//
+void AssemblyVUEyeCamera::publishFrame(const FramePtr& frame)
+{
+  {
+    std::lock_guard<std::mutex> lock(frameMutex_);
+
+    if((latestFrameTaken_ == false) && (this->receivers(SIGNAL(frameAvailable())) > 0)){ ++droppedFrames_; }
+
+    latestFrame_      = frame;
+    latestFrameTaken_ = false;
+
+    ++frameCount_;
+
+    frameTimes_.push(frame->time());
+  }
+
+  emit frameAvailable();
+}
+
+void AssemblyVUEyeCamera::countDroppedFrame()
+{
+  std::lock_guard<std::mutex> lock(frameMutex_);
+
+  ++droppedFrames_;
+}
+
+void AssemblyVUEyeCamera::resetFrameStatistics()
+{
+  std::lock_guard<std::mutex> lock(frameMutex_);
+
+  latestFrame_.reset();
+  latestFrameTaken_ = true;
+
+  frameCount_    = 0;
+  droppedFrames_ = 0;
+
+  frameTimes_.clear();
+}
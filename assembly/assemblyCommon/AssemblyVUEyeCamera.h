@@ -14,10 +14,14 @@
 #define ASSEMBLYVUEYECAMERA_H
 
 #include <DeviceState.h>
+#include <Ringbuffer.h>
 
 #include <QObject>
 #include <QString>
 
+#include <memory>
+#include <mutex>
+
 #include <opencv2/opencv.hpp>
 
 class AssemblyVUEyeCamera : public QObject
@@ -29,6 +33,28 @@ class AssemblyVUEyeCamera : public QObject
     explicit AssemblyVUEyeCamera(QObject* parent);
     ~AssemblyVUEyeCamera();
 
+    //
+    // frame of the continuous capture (streaming):
+    // the image is a header on the buffer of the camera (no copy),
+    // and the buffer is handed back to the camera when the last reference to the frame is released;
+    // the image is read-only, and has to be copied if it is needed beyond the lifetime of the frame
+    //
+    class Frame {
+
+     public:
+      explicit Frame(const cv::Mat& image, const double time) : image_(image), time_(time) {}
+      virtual ~Frame() {}
+
+      const cv::Mat& image() const { return image_; }
+      double time() const { return time_; }
+
+     protected:
+      cv::Mat image_;
+      double time_;
+    };
+
+    typedef std::shared_ptr<const Frame> FramePtr;
+
     void setCameraID(unsigned int id) { cameraID_ = id; }
     void setDeviceID(unsigned int id) { deviceID_ = id; }
     void setSensorID(unsigned int id) { sensorID_ = id; }
@@ -92,6 +118,16 @@ class AssemblyVUEyeCamera : public QObject
     virtual bool isOpen() const { return (cameraState_==State::READY); }
     State getDeviceState() const { return cameraState_; }
 
+    bool isStreaming() const { return streaming_; }
+
+    FramePtr latestFrame() const;
+
+    static cv::Mat sharedImage(const FramePtr&);
+
+    double frameRate() const;
+    unsigned long frameCount() const;
+    unsigned long droppedFrames() const;
+
   public slots:
 
     virtual void open() = 0;
@@ -99,6 +135,9 @@ class AssemblyVUEyeCamera : public QObject
 
     virtual void acquireImage() = 0;
 
+    virtual void startStreaming() = 0;
+    virtual void stopStreaming() = 0;
+
     virtual void setPixelClock(unsigned int) = 0;
     virtual void setExposureTime(double) = 0;
 
@@ -139,6 +178,24 @@ class AssemblyVUEyeCamera : public QObject
 
     State cameraState_;
 
+    static double frameTime();
+
+    void publishFrame(const FramePtr&);
+    void countDroppedFrame();
+    void resetFrameStatistics();
+
+    bool streaming_;
+
+    // an image request during streaming is served with the next frame
+    bool streamingImageRequested_;
+
+    mutable std::mutex frameMutex_;
+    FramePtr latestFrame_;
+    mutable bool latestFrameTaken_;
+    unsigned long frameCount_;
+    unsigned long droppedFrames_;
+    Ringbuffer<double> frameTimes_;
+
   signals:
     void resultObtained(double,double,double);
     void moveAbsolute(double,double,double,double);
@@ -156,6 +213,11 @@ class AssemblyVUEyeCamera : public QObject
     void exposureTimeRangeChanged(double);
 
     void imageAcquired(const cv::Mat&);
+
+    void streamingStarted();
+    void streamingStopped();
+    void frameAvailable();
+
     void updateStatus(QString, double);
 };
 
@@ -15,6 +15,7 @@
 
 #include <AssemblyZFocusFinder.h>
 #include <AssemblyUtilities.h>
+#include <AssemblyArtifactWriter.h>
 
 #include <iostream>
 #include <iomanip>
@@ -23,6 +24,8 @@
 #include <vector>
 #include <cstdio>
 #include <memory>
+#include <algorithm>
+#include <cmath>
 
 #include <TCanvas.h>
 #include <TGraph.h>
@@ -42,11 +45,22 @@ AssemblyZFocusFinder::AssemblyZFocusFinder(const QString& output_dir_prepath, co
 
  , focus_completed_(false)
 
+ , focus_search_(false)
+ , focus_search_coarse_pointN_(7)
+ , focus_search_tolerance_(0.005)
+
+ , search_zposi_lo_(0.)
+ , search_zposi_hi_(0.)
+ , search_zposi_best_(0.)
+ , search_focus_best_(0.)
+
  , zposi_init_(-9999.)
 
  , zrelm_index_(0)
 
  , output_dir_("")
+
+ , focus_benchmark_(false)
 {
   // initialization
   ApplicationConfig* config = ApplicationConfig::instance();
@@ -66,8 +80,26 @@ AssemblyZFocusFinder::AssemblyZFocusFinder(const QString& output_dir_prepath, co
 
   focus_stepsize_min_ = config->getValue<double>("AssemblyZFocusFinder_stepsize_min", 0.005);
 
+  focus_metric_ = AssemblyFocusMetric(AssemblyFocusMetric::Method(config->getValue<int>("AssemblyZFocusFinder_focusMetric", 0)),
+                                      config->getValue<double>("AssemblyZFocusFinder_focusROI"      , 1.0),
+                                      config->getValue<int>   ("AssemblyZFocusFinder_focusDownscale", 1));
+
+  focus_benchmark_ = bool(config->getValue<int>("AssemblyZFocusFinder_benchmarkFocusMetrics", 0));
+
+  NQLog("AssemblyZFocusFinder", NQLog::Spam) << "initialization"
+     << ": focus discriminant " << AssemblyFocusMetric::method_name(focus_metric_.method())
+     << " (ROI fraction=" << focus_metric_.roi_fraction() << ", downscale=" << focus_metric_.downscale() << ")";
+
+  focus_search_               = bool(config->getValue<int>("AssemblyZFocusFinder_search"            , 0));
+  focus_search_coarse_pointN_ = config->getValue<int>     ("AssemblyZFocusFinder_search_coarsePointN",  7);
+  focus_search_tolerance_     = config->getValue<double>  ("AssemblyZFocusFinder_search_tolerance"   , focus_stepsize_min_);
+
   v_zrelm_vals_.clear();
   v_focus_vals_.clear();
+
+  v_focus_pending_.clear();
+
+  v_focus_images_.clear();
   // --------------
 
   // validation
@@ -207,7 +239,10 @@ void AssemblyZFocusFinder::acquire_image()
       return;
     }
 
-    const double step_size = (2. * focus_zrange_ / double(focus_pointN_ - 1));
+    // search mode: the coarse scan sets the step size
+    const int scan_pointN = focus_search_ ? std::max(3, focus_search_coarse_pointN_) : focus_pointN_;
+
+    const double step_size = (2. * focus_zrange_ / double(scan_pointN - 1));
 
     if(step_size < focus_stepsize_min_)
     {
@@ -254,22 +289,35 @@ void AssemblyZFocusFinder::acquire_image()
 
     v_focus_vals_.clear();
 
+    v_focus_pending_.clear();
+
+    v_focus_images_.clear();
+
     // scan N points around initial position
     const double zmin = (zposi_init_ - focus_zrange_);
     const double zmax = (zposi_init_ + focus_zrange_);
 
     v_zrelm_vals_.emplace_back(zmax - zposi_init_);
 
-    for(int i=1; i<focus_pointN_; ++i)
+    for(int i=1; i<scan_pointN; ++i)
     {
       v_zrelm_vals_.emplace_back(-1.0 * step_size);
     }
 
     zrelm_index_ = -1;
 
-    NQLog("AssemblyZFocusFinder", NQLog::Message) << "acquire_image"
-       << ": initialized auto-focusing"
-       << " (z-min=" << zmin << ", z-max=" << zmax << ", steps=" << focus_pointN_ << ")";
+    if(focus_search_)
+    {
+      NQLog("AssemblyZFocusFinder", NQLog::Message) << "acquire_image"
+         << ": initialized auto-focusing in search mode"
+         << " (z-min=" << zmin << ", z-max=" << zmax << ", coarse steps=" << scan_pointN << ", tolerance=" << focus_search_tolerance_ << ")";
+    }
+    else
+    {
+      NQLog("AssemblyZFocusFinder", NQLog::Message) << "acquire_image"
+         << ": initialized auto-focusing"
+         << " (z-min=" << zmin << ", z-max=" << zmax << ", steps=" << focus_pointN_ << ")";
+    }
 
     NQLog("AssemblyZFocusFinder", NQLog::Spam) << "acquire_image"
        << ": emitting signal \"next_zpoint\"";
@@ -281,6 +329,8 @@ void AssemblyZFocusFinder::test_focus()
 {
   ++zrelm_index_;
 
+  double zposi_next(0.);
+
   if(zrelm_index_ < 0)
   {
     NQLog("AssemblyZFocusFinder", NQLog::Fatal) << "test_focus"
@@ -299,52 +349,86 @@ void AssemblyZFocusFinder::test_focus()
 
     emit focus(0., 0., dz, 0.);
   }
+  else if(focus_search_ && this->search_next_zposition(zposi_next))
+  {
+    const double dz = (zposi_next - motion_manager_->get_position_Z());
+
+    NQLog("AssemblyZFocusFinder", NQLog::Spam) << "test_focus"
+       << ": search step " << (zrelm_index_ - int(v_zrelm_vals_.size())) << " (z=" << zposi_next << ")"
+       << ", emitting signal \"focus(0, 0, " << dz << ", 0)\"";
+
+    emit focus(0., 0., dz, 0.);
+  }
   else
   {
+    this->collect_focus_values();
+
+    if(focus_benchmark_)
+    {
+      this->benchmark_focus_metrics();
+    }
+
     // Find best position
     NQLog("AssemblyZFocusFinder", NQLog::Spam) << "test_focus"
        << ": finding best-focus position";
 
     double zposi_best(zposi_init_);
     {
-      std::unique_ptr<TGraph> zscan_gra(new TGraph(v_focus_vals_.size()));
-      zscan_gra->SetName("zfocus_graph");
-      zscan_gra->SetTitle(";z-axis position [mm];focus discriminant");
-      zscan_gra->SetMarkerColor(2);
-      zscan_gra->SetMarkerStyle(20);
-      zscan_gra->SetMarkerSize(1.25);
-
       double focus_best(-1.);
       for(unsigned int i=0; i<v_focus_vals_.size(); ++i)
       {
         const double i_zposi = v_focus_vals_.at(i).z_position;
         const double i_focus = v_focus_vals_.at(i).focus_disc;
 
-        zscan_gra->SetPoint(i, i_zposi, i_focus);
-
         if((i == 0) || (i_focus > focus_best)){ focus_best = i_focus; zposi_best = i_zposi; }
       }
 
-      std::unique_ptr<TCanvas> zscan_can(new TCanvas());
-      zscan_can->SetName("zfocus_plot");
-      zscan_can->cd();
-      zscan_gra->Draw("alp");
+      // points of the plot ordered in z (the search mode does not acquire them in order)
+      std::vector<focus_info> v_focus_sorted(v_focus_vals_);
 
-      const std::string zscan_plot_path_png  = output_dir_+"/AssemblyZFocusFinder_zscan.png";
-      const std::string zscan_plot_path_root = output_dir_+"/AssemblyZFocusFinder_zscan.root";
+      std::stable_sort(v_focus_sorted.begin(), v_focus_sorted.end(), [](const focus_info& a, const focus_info& b){ return (a.z_position < b.z_position); });
 
-      zscan_can->SaveAs(zscan_plot_path_png.c_str());
+      std::vector<double> v_zposi, v_focus;
+      v_zposi.reserve(v_focus_sorted.size());
+      v_focus.reserve(v_focus_sorted.size());
 
-      std::unique_ptr<TFile> zscan_fil(new TFile(zscan_plot_path_root.c_str(), "recreate"));
-      zscan_fil->cd();
-      zscan_can->Write();
-      zscan_gra->Write();
-      zscan_fil->Close();
+      for(const auto& i_focus_info : v_focus_sorted)
+      {
+        v_zposi.emplace_back(i_focus_info.z_position);
+        v_focus.emplace_back(i_focus_info.focus_disc);
+      }
 
-      NQLog("AssemblyZFocusFinder", NQLog::Spam) << "test_focus"
-         << ": emitting signal \"show_zscan(" << zscan_plot_path_png << ")\"";
+      const std::string zscan_plot_path_png  = output_dir_+"/AssemblyZFocusFinder_zscan.png";
+      const std::string zscan_plot_path_root = output_dir_+"/AssemblyZFocusFinder_zscan.root";
 
-      emit show_zscan(QString(zscan_plot_path_png.c_str()));
+      // z-scan plot: drawn and saved by the artifact writer, shown in the GUI once the PNG file exists (show_zscan_plot)
+      AssemblyArtifactWriter::instance()->write_plot(AssemblyArtifactWriter::Summary, zscan_plot_path_png, [v_zposi, v_focus, zscan_plot_path_png, zscan_plot_path_root]()
+      {
+        std::unique_ptr<TGraph> zscan_gra(new TGraph(v_zposi.size()));
+        zscan_gra->SetName("zfocus_graph");
+        zscan_gra->SetTitle(";z-axis position [mm];focus discriminant");
+        zscan_gra->SetMarkerColor(2);
+        zscan_gra->SetMarkerStyle(20);
+        zscan_gra->SetMarkerSize(1.25);
+
+        for(unsigned int i=0; i<v_zposi.size(); ++i)
+        {
+          zscan_gra->SetPoint(i, v_zposi.at(i), v_focus.at(i));
+        }
+
+        std::unique_ptr<TCanvas> zscan_can(new TCanvas());
+        zscan_can->SetName("zfocus_plot");
+        zscan_can->cd();
+        zscan_gra->Draw("alp");
+
+        zscan_can->SaveAs(zscan_plot_path_png.c_str());
+
+        std::unique_ptr<TFile> zscan_fil(new TFile(zscan_plot_path_root.c_str(), "recreate"));
+        zscan_fil->cd();
+        zscan_can->Write();
+        zscan_gra->Write();
+        zscan_fil->Close();
+      }, this, "show_zscan_plot");
 
       NQLog("AssemblyZFocusFinder", NQLog::Spam) << "test_focus"
          << ": emitting signal \"text_update_request(" << zposi_best << ")\"";
@@ -388,6 +472,14 @@ void AssemblyZFocusFinder::test_focus()
   return;
 }
 
+void AssemblyZFocusFinder::show_zscan_plot(const QString& filepath)
+{
+  NQLog("AssemblyZFocusFinder", NQLog::Spam) << "show_zscan_plot"
+     << ": emitting signal \"show_zscan(" << filepath.toStdString() << ")\"";
+
+  emit show_zscan(filepath);
+}
+
 void AssemblyZFocusFinder::emergencyStop()
 {
   NQLog("AssemblyZFocusFinder", NQLog::Message) << "emergencyStop"
@@ -399,6 +491,10 @@ void AssemblyZFocusFinder::emergencyStop()
 
   v_focus_vals_.clear();
 
+  v_focus_pending_.clear();
+
+  v_focus_images_.clear();
+
   focus_completed_ = false;
 
   zrelm_index_ = -1;
@@ -425,6 +521,10 @@ void AssemblyZFocusFinder::process_image(const cv::Mat& img)
 
     v_focus_vals_.clear();
 
+    v_focus_pending_.clear();
+
+    v_focus_images_.clear();
+
     focus_completed_ = false;
 
     zrelm_index_ = -1;
@@ -432,7 +532,7 @@ void AssemblyZFocusFinder::process_image(const cv::Mat& img)
     // save best-focus image
     const std::string img_outpath = output_dir_+"/AssemblyZFocusFinder_best.png";
 
-    cv::imwrite(img_outpath, img);
+    AssemblyArtifactWriter::instance()->write_image(AssemblyArtifactWriter::Summary, img_outpath, img);
 
     NQLog("AssemblyZFocusFinder", NQLog::Spam) << "process_image"
        << ": emitting signal \"image_acquired\"";
@@ -443,13 +543,13 @@ void AssemblyZFocusFinder::process_image(const cv::Mat& img)
   {
     // --- generic z-focus step ---
 
-    // save image
+    // save image (only in "full" artifact mode)
     const std::string img_outpath = output_dir_+"/AssemblyZFocusFinder_"+std::to_string(v_focus_vals_.size())+".png";
-    cv::imwrite(img_outpath, img);
+    AssemblyArtifactWriter::instance()->write_image(AssemblyArtifactWriter::Full, img_outpath, img);
 
-    // save z-focus info
+    // save z-focus info (the focus discriminant is computed on a worker thread, and collected before it is needed)
     AssemblyZFocusFinder::focus_info this_focus;
-    this_focus.focus_disc = this->image_focus_value(img);
+    this_focus.focus_disc = 0.;
     this_focus.z_position = motion_manager_->get_position_Z();
 
     if((fabs(this_focus.z_position - zposi_init_) - focus_zrange_) > focus_stepsize_min_)
@@ -468,6 +568,10 @@ void AssemblyZFocusFinder::process_image(const cv::Mat& img)
 
       v_focus_vals_.clear();
 
+      v_focus_pending_.clear();
+
+      v_focus_images_.clear();
+
       focus_completed_ = false;
 
       zrelm_index_ = -1;
@@ -481,10 +585,18 @@ void AssemblyZFocusFinder::process_image(const cv::Mat& img)
     {
       NQLog("AssemblyZFocusFinder", NQLog::Spam) << "process_image"
          << ": image(" << exe_counter_ << "," << v_focus_vals_.size() << ")"
-         << " [z = " << this_focus.z_position
-         << ", focus-value = " << this_focus.focus_disc << "]";
+         << " [z = " << this_focus.z_position << "]";
 
       v_focus_vals_.emplace_back(this_focus);
+
+      // the image is copied, as the camera may overwrite its buffer with the next z-focus step
+      const cv::Mat img_copy = img.clone();
+
+      const AssemblyFocusMetric focus_metric(focus_metric_);
+
+      v_focus_pending_.emplace_back(std::async(std::launch::async, [focus_metric, img_copy](){ return focus_metric.value(img_copy); }));
+
+      if(focus_benchmark_){ v_focus_images_.emplace_back(img_copy); }
       // ------------------------------
 
       // go to next z-focus step
@@ -499,31 +611,144 @@ void AssemblyZFocusFinder::process_image(const cv::Mat& img)
   return;
 }
 
-// \Brief Image-focus discriminant based on Laplacian method in OpenCV
-//        REF: https://docs.opencv.org/2.4/doc/tutorials/imgproc/imgtrans/laplace_operator/laplace_operator.html
-double AssemblyZFocusFinder::image_focus_value(const cv::Mat& img)
+//
+// next z-position of the search mode, after the coarse scan (false when the search is completed):
+//   - the best point of the coarse scan and its two neighbours bracket the peak of the focus discriminant
+//   - golden-section search: every new point splits the larger side of the bracket around the best point,
+//     and the bracket shrinks to the side of the best point
+//   - the search stops when the bracket is narrower than the tolerance (i.e. the repeatability of the z-axis),
+//     or when the number of points reaches the allowed max
+//
+bool AssemblyZFocusFinder::search_next_zposition(double& zposi_next)
 {
-//  // Remove noise by blurring with a Gaussian filter
-//  cv::Mat img_gaus;
-//  cv::GaussianBlur(img, img_gaus, cv::Size(img.cols, img.rows), 0, 0, cv::BORDER_DEFAULT);
+  const int N_coarse = v_zrelm_vals_.size();
+  const int N_points = v_focus_vals_.size();
+
+  if(N_points < N_coarse){ return false; }
+
+  this->collect_focus_values();
+
+  if(N_points == N_coarse)
+  {
+    // bracket from the coarse scan (acquired from z-max to z-min)
+    int idx_best(0);
+    for(int i=1; i<N_coarse; ++i)
+    {
+      if(v_focus_vals_.at(i).focus_disc > v_focus_vals_.at(idx_best).focus_disc){ idx_best = i; }
+    }
+
+    search_zposi_best_ = v_focus_vals_.at(idx_best).z_position;
+    search_focus_best_ = v_focus_vals_.at(idx_best).focus_disc;
+
+    search_zposi_hi_ = v_focus_vals_.at(std::max(0         , idx_best-1)).z_position;
+    search_zposi_lo_ = v_focus_vals_.at(std::min(N_coarse-1, idx_best+1)).z_position;
+
+    NQLog("AssemblyZFocusFinder", NQLog::Spam) << "search_next_zposition"
+       << ": coarse scan completed, bracket [" << search_zposi_lo_ << ", " << search_zposi_hi_ << "], best z=" << search_zposi_best_;
+  }
+  else
+  {
+    // update of the bracket with the last point
+    const double zposi = v_focus_vals_.back().z_position;
+    const double focus = v_focus_vals_.back().focus_disc;
+
+    if(focus > search_focus_best_)
+    {
+      if(zposi > search_zposi_best_){ search_zposi_lo_ = search_zposi_best_; }
+      else                          { search_zposi_hi_ = search_zposi_best_; }
+
+      search_zposi_best_ = zposi;
+      search_focus_best_ = focus;
+    }
+    else
+    {
+      if(zposi > search_zposi_best_){ search_zposi_hi_ = zposi; }
+      else                          { search_zposi_lo_ = zposi; }
+    }
+  }
+
+  if((search_zposi_hi_ - search_zposi_lo_) <= focus_search_tolerance_)
+  {
+    NQLog("AssemblyZFocusFinder", NQLog::Message) << "search_next_zposition"
+       << ": search completed after " << N_points << " points, bracket [" << search_zposi_lo_ << ", " << search_zposi_hi_ << "]";
+
+    return false;
+  }
+
+  if(N_points >= focus_pointN_max_)
+  {
+    NQLog("AssemblyZFocusFinder", NQLog::Warning) << "search_next_zposition"
+       << ": search stopped at the max number of points (" << focus_pointN_max_ << "), bracket [" << search_zposi_lo_ << ", " << search_zposi_hi_ << "]";
+
+    return false;
+  }
+
+  const double golden_fraction = 0.5 * (3. - std::sqrt(5.));
+
+  if((search_zposi_hi_ - search_zposi_best_) > (search_zposi_best_ - search_zposi_lo_))
+  {
+    zposi_next = search_zposi_best_ + golden_fraction * (search_zposi_hi_ - search_zposi_best_);
+  }
+  else
+  {
+    zposi_next = search_zposi_best_ - golden_fraction * (search_zposi_best_ - search_zposi_lo_);
+  }
+
+  return true;
+}
+
+//
+// waits for the focus discriminants still computed on the worker threads
+//
+void AssemblyZFocusFinder::collect_focus_values()
+{
+  for(unsigned int i=0; i<v_focus_pending_.size(); ++i)
+  {
+    if((i < v_focus_vals_.size()) && v_focus_pending_.at(i).valid())
+    {
+      v_focus_vals_.at(i).focus_disc = v_focus_pending_.at(i).get();
+
+      NQLog("AssemblyZFocusFinder", NQLog::Spam) << "collect_focus_values"
+         << ": image(" << exe_counter_ << "," << i << ")"
+         << " [z = " << v_focus_vals_.at(i).z_position
+         << ", focus-value = " << v_focus_vals_.at(i).focus_disc << "]";
+    }
+  }
+
+  return;
+}
+
+//
+// comparison of the focus discriminants on the z-stack of this auto-focusing,
+// on a worker thread (output: focus_benchmark.txt)
 //
-//  // Convert the image to grayscale
-//  cv::Mat img_gray;
-//  cv::cvtColor(img_gaus, img_gray, CV_BGR2GRAY);
+void AssemblyZFocusFinder::benchmark_focus_metrics()
+{
+  if(benchmark_future_.valid()){ benchmark_future_.wait(); }
+
+  std::vector<double> zposis;
+  for(const auto& i_focus_info : v_focus_vals_){ zposis.emplace_back(i_focus_info.z_position); }
+
+  const std::vector<cv::Mat> imgs(v_focus_images_);
 
-  // Apply laplacian function to GS image
-  cv::Mat img_lap;
-  cv::Laplacian(img, img_lap, CV_64F);
+  const double roi_fraction = focus_metric_.roi_fraction();
 
-  cv::Mat img_lap_abs;
-//  cv::convertScaleAbs(img_lap, img_lap_abs);
-  img_lap_abs = img_lap.clone();
+  const std::string txt_path = output_dir_+"/focus_benchmark.txt";
 
-  // Calculate standard deviation of laplace image
-  cv::Scalar mean, std_dev;
-  cv::meanStdDev(img_lap_abs, mean, std_dev);
+  benchmark_future_ = std::async(std::launch::async, [zposis, imgs, roi_fraction, txt_path]()
+  {
+    std::ofstream txtfile(txt_path);
 
-  const float value = (std_dev.val[0] * std_dev.val[0]);
+    if(txtfile.is_open())
+    {
+      AssemblyFocusMetric::benchmark(txtfile, zposis, imgs, roi_fraction);
+    }
 
-  return value;
+    NQLog("AssemblyZFocusFinder", NQLog::Message) << "benchmark_focus_metrics"
+       << ": created output file: " << txt_path;
+  });
+
+  v_focus_images_.clear();
+
+  return;
 }
@@ -15,12 +15,14 @@
 
 #include <AssemblyVUEyeCamera.h>
 #include <LStepExpressMotionManager.h>
+#include <AssemblyFocusMetric.h>
 
 #include <QObject>
 #include <QString>
 
 #include <vector>
 #include <string>
+#include <future>
 
 #include <opencv2/opencv.hpp>
 
@@ -62,6 +64,16 @@ class AssemblyZFocusFinder : public QObject
     double focus_zrange_;
     double focus_stepsize_min_;
 
+    // search mode: coarse scan, then golden-section search inside the bracket of the best coarse point
+    bool   focus_search_;
+    int    focus_search_coarse_pointN_;
+    double focus_search_tolerance_;
+
+    double search_zposi_lo_;
+    double search_zposi_hi_;
+    double search_zposi_best_;
+    double search_focus_best_;
+
     double zposi_init_;
 
     int zrelm_index_;
@@ -71,7 +83,19 @@ class AssemblyZFocusFinder : public QObject
     std::vector<double>     v_zrelm_vals_;
     std::vector<focus_info> v_focus_vals_;
 
-    double image_focus_value(const cv::Mat&);
+    // focus discriminant, computed on worker threads while the next z-focus step is executed
+    AssemblyFocusMetric               focus_metric_;
+    std::vector<std::future<double> > v_focus_pending_;
+
+    bool                              focus_benchmark_;
+    std::vector<cv::Mat>              v_focus_images_;
+    std::future<void>                 benchmark_future_;
+
+    void collect_focus_values();
+
+    void benchmark_focus_metrics();
+
+    bool search_next_zposition(double&);
 
   public slots:
 
@@ -88,6 +112,10 @@ class AssemblyZFocusFinder : public QObject
 
     void emergencyStop();
 
+  protected slots:
+
+    void show_zscan_plot(const QString&);
+
   signals:
 
     void next_zpoint();
@@ -11,9 +11,13 @@
 /////////////////////////////////////////////////////////////////////////////////
 
 #include <nqlogger.h>
+#include <ApplicationConfig.h>
 #include <QString>
 #include <QDateTime>
 #include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include "LStepExpressMeasurement.h"
 
 LStepExpressMeasurement::LStepExpressMeasurement(LStepExpressModel* model, LStepExpressMotionManager* manager, LaserModel* laserModel, LStepExpressMeasurementTable* table, QObject*) :
@@ -39,10 +43,29 @@ LStepExpressMeasurement::LStepExpressMeasurement(LStepExpressModel* model, LStep
     currentIndex_ = -1;
     tableSize_ = 0;
 
+    isContinuous_ = false;
+    isSweeping_ = false;
+    scanVelocity_ = 5.0;
+    scanSamplingMode_ = 5;
+    storageCycle_ = 1;
+    velocity_ = 0.0;
+    samplingMode_ = 0;
+    storageStartTime_ = 0.0;
+
+    ApplicationConfig* config = ApplicationConfig::instance();
+    if(config != nullptr)
+    {
+      scanVelocity_     = config->getValue<double>("LStepExpressMeasurement_scanVelocity", 5.0);
+      scanSamplingMode_ = config->getValue<int>("LStepExpressMeasurement_scanSamplingMode", 5);
+      storageCycle_     = std::max(1, config->getValue<int>("LStepExpressMeasurement_storageCycle", 1));
+    }
+
     connect(model_, SIGNAL(emergencyStop_request()), this, SLOT(stopMeasurement()));
 
     connect(model_, SIGNAL(motionFinished()), this, SLOT(takeMeasurement()));
 
+    connect(model_, SIGNAL(motionInformationChanged()), this, SLOT(recordSweepPosition()));
+
     connect(this, SIGNAL(nextScanStep()), this, SLOT(doNextScanStep()));
 
     connect(laserModel_, SIGNAL(deviceStateChanged(State)), this, SLOT(setLaserEnabled(State)));
@@ -60,6 +83,13 @@ void LStepExpressMeasurement::setZigZag(bool zigzag)
     isZigZag_ = zigzag;
 }
 
+void LStepExpressMeasurement::setContinuous(bool continuous)
+{
+    if(measurementInProgress_){return;}
+
+    isContinuous_ = continuous;
+}
+
 void LStepExpressMeasurement::setAverageMeasEnabled(bool enabled)
 {
   //    NQLog("LStepExpressMeasurement ", NQLog::Debug) << "setAverageMeasEnabled";
@@ -176,6 +206,11 @@ void LStepExpressMeasurement::stopMeasurement()
   QMutexLocker locker(&mutex_);
   clearedForMotion_ = false;
   currentIndex_ = tableSize_;
+
+  if(isContinuous_ && measurementInProgress_){
+      finishContinuousScan();
+      measurementInProgress_ = false;
+  }
 }
 
 void LStepExpressMeasurement::setLaserEnabled(State newState)
@@ -193,7 +228,19 @@ void LStepExpressMeasurement::takeMeasurement()
   //    NQLog("LStepExpressMeasurement ", NQLog::Debug) << "takeMeasurement"    ;  
     if(!isLaserEnabled_){return;}
     if(!measurementInProgress_){return;}
-    
+
+    if(isContinuous_){
+        if(isSweeping_){
+            finishSweep();
+
+            emit informationChanged();
+            emit nextScanStep();
+        }else if(currentIndex_ < tableSize_ && clearedForMotion_){
+            startSweep();
+        }
+        return;
+    }
+
     double value = 0;
     laserModel_->getMeasurement(value);
     table_->insertData(4, currentIndex_, value);
@@ -217,6 +264,7 @@ void LStepExpressMeasurement::doNextScanStep()
 	z_pos = table_->data(table_->index(currentIndex_,3), Qt::DisplayRole).toDouble();                                                                               
 	model_->moveAbsolute(x_pos, y_pos, z_pos, 0.0);
     }else{
+        if(isContinuous_ && measurementInProgress_){finishContinuousScan();}
 	measurementInProgress_ = false;
     }
 }
@@ -232,6 +280,153 @@ void LStepExpressMeasurement::performScan()
     clearedForMotion_ = true;
     currentIndex_ = 0;
 
+    if(isContinuous_){
+        samplingMode_ = laserModel_->samplingMode();
+        laserModel_->setSamplingRate(scanSamplingMode_);
+
+        NQLog("LStepExpressMeasurement", NQLog::Debug) << "performScan"
+           << ": continuous scan, y-velocity = " << scanVelocity_
+           << ", sampling period = " << laserModel_->samplingPeriod() << " us";
+    }
+
     emit nextScanStep();
 }
 
+//last grid position of the row (constant x) of the given table index
+int LStepExpressMeasurement::rowEndIndex(int index) const
+{
+    const int rowSize = nstepsy + 1;
+
+    return std::min(tableSize_ - 1, (index / rowSize + 1) * rowSize - 1);
+}
+
+//the stage stands at the start of the row: sweep to its end while the laser stores values
+void LStepExpressMeasurement::startSweep()
+{
+    const int endIndex = rowEndIndex(currentIndex_);
+
+    const double x_pos = table_->data(table_->index(endIndex,1), Qt::DisplayRole).toDouble();
+    const double y_pos = table_->data(table_->index(endIndex,2), Qt::DisplayRole).toDouble();
+    const double z_pos = table_->data(table_->index(endIndex,3), Qt::DisplayRole).toDouble();
+
+    velocity_ = model_->getVelocity(1);
+    model_->setVelocity(1, scanVelocity_);
+
+    laserModel_->initDataStorage();
+
+    const double t0 = LStepExpressModel::pollTime();
+    laserModel_->startDataStorage();
+    const double t1 = LStepExpressModel::pollTime();
+
+    storageStartTime_ = 0.5 * (t0 + t1);
+
+    sweepTimes_.clear();
+    sweepPositions_.clear();
+
+    sweepTimes_.push_back(t1);
+    sweepPositions_.push_back(model_->getPositions());
+
+    isSweeping_ = true;
+
+    model_->moveAbsolute(x_pos, y_pos, z_pos, 0.0);
+}
+
+//timestamped stage positions during a sweep, from the position polls of the model
+void LStepExpressMeasurement::recordSweepPosition()
+{
+    if(!isSweeping_){return;}
+
+    std::vector<double> positions;
+    double time;
+    model_->getTimedPositions(positions, time);
+
+    if(time <= sweepTimes_.back() || positions.size() != sweepPositions_.back().size()){return;}
+
+    sweepTimes_.push_back(time);
+    sweepPositions_.push_back(positions);
+}
+
+//assigns the stored values of the sweep to the grid positions of the row
+void LStepExpressMeasurement::finishSweep()
+{
+    laserModel_->stopDataStorage();
+
+    recordSweepPosition();
+    isSweeping_ = false;
+
+    model_->setVelocity(1, velocity_);
+
+    std::vector<double> values;
+    laserModel_->getStoredData(values);
+
+    //time between two stored values (storage cycle, in units of the sampling period, as set on the controller)
+    const double period = 1e-6 * laserModel_->samplingPeriod() * storageCycle_;
+
+    std::vector<double> ypos(values.size());
+    for(unsigned int i = 0; i < values.size(); i++){
+        ypos[i] = sweepPosition(storageStartTime_ + i*period, 1);
+    }
+
+    const int endIndex = rowEndIndex(currentIndex_);
+
+    for(int index = currentIndex_; index <= endIndex; index++){
+        const double y = table_->data(table_->index(index,2), Qt::DisplayRole).toDouble();
+
+        double sum = 0;
+        int count = 0;
+        int nearest = -1;
+        double distance_min = std::numeric_limits<double>::max();
+
+        for(unsigned int i = 0; i < values.size(); i++){
+            const double distance = std::fabs(ypos[i] - y);
+            if(distance < distance_min){
+                distance_min = distance;
+                nearest = i;
+            }
+            if(averageMeasEnabled_ && distance <= 0.5*y_stepsize && values[i] != 9999 && values[i] != -9999){
+                sum += values[i];
+                count++;
+            }
+        }
+
+        double value = 9999;
+        if(count > 0){value = sum/count;}
+        else if(nearest >= 0){value = values[nearest];}
+
+        table_->insertData(4, index, value);
+    }
+    table_->update();
+
+    NQLog("LStepExpressMeasurement", NQLog::Debug) << "finishSweep"
+       << ": row " << currentIndex_ << "-" << endIndex << ", " << values.size() << " stored values, "
+       << sweepTimes_.size() << " stage positions";
+
+    currentIndex_ = endIndex + 1;
+}
+
+void LStepExpressMeasurement::finishContinuousScan()
+{
+    if(isSweeping_){
+        laserModel_->stopDataStorage();
+        model_->setVelocity(1, velocity_);
+        isSweeping_ = false;
+    }
+
+    laserModel_->setSamplingRate(samplingMode_);
+}
+
+//stage position along the given axis at a given time, interpolated linearly between the recorded positions
+double LStepExpressMeasurement::sweepPosition(double time, unsigned int axis) const
+{
+    if(sweepTimes_.empty()){return 0;}
+
+    if(time <= sweepTimes_.front()){return sweepPositions_.front()[axis];}
+    if(time >= sweepTimes_.back()) {return sweepPositions_.back()[axis];}
+
+    const unsigned int i = std::upper_bound(sweepTimes_.begin(), sweepTimes_.end(), time) - sweepTimes_.begin();
+
+    const double fraction = (time - sweepTimes_[i-1]) / (sweepTimes_[i] - sweepTimes_[i-1]);
+
+    return sweepPositions_[i-1][axis] + fraction * (sweepPositions_[i][axis] - sweepPositions_[i-1][axis]);
+}
+
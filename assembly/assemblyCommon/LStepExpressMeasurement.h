@@ -13,6 +13,15 @@
 #ifndef LSTEPEXPRESSMEASUREMENT_H
 #define LSTEPEXPRESSMEASUREMENT_H
 
+/*  Description:
+ *   Height scans of the stage with the Keyence laser, on a grid of x-y positions:
+ *    - step-and-settle (default): the stage stops at every grid position for a single measurement
+ *    - continuous: the stage moves along each row (constant y-velocity) while the laser
+ *      stores one value per sampling period; after each row, every stored value is assigned
+ *      the stage position interpolated at its time, and the grid positions of the row are
+ *      filled from the values around them (mean within half a step, or nearest value)
+ */
+
 #include <vector>
 
 #include <Qt>
@@ -64,6 +73,7 @@ public slots:
     void generatePositions();
     void setAverageMeasEnabled(bool);
     void setZigZag(bool);
+    void setContinuous(bool);
     void takeMeasurement();
     void setLaserEnabled(State newState);
 
@@ -92,10 +102,29 @@ private:
     bool isLaserEnabled_;
     bool measurementInProgress_;
 
+    //continuous scan
+    bool isContinuous_;
+    bool isSweeping_;
+    double scanVelocity_;
+    int scanSamplingMode_;
+    int storageCycle_;
+    double velocity_;
+    int samplingMode_;
+    double storageStartTime_;
+    std::vector<double> sweepTimes_;
+    std::vector<std::vector<double> > sweepPositions_;
+
+    int rowEndIndex(int index) const;
+    void startSweep();
+    void finishSweep();
+    void finishContinuousScan();
+    double sweepPosition(double time, unsigned int axis) const;
+
 private slots:
     void performScan();
     void stopMeasurement();
     void doNextScanStep();
+    void recordSweepPosition();
 
  signals:
     void nextScanStep();
@@ -28,6 +28,7 @@ LStepExpressMeasurementWidget::LStepExpressMeasurementWidget(LStepExpressModel*
     averageMeasCheckBox_ = new QCheckBox("Average measurement", this);
     buttonGeneratePos_ = new QPushButton("Generate positions", this);
     zigzagCheckBox_ = new QCheckBox("Zigzag motion (default is meander)", this);
+    continuousCheckBox_ = new QCheckBox("Continuous scan along y", this);
     buttonStartMeasurement_ = new QPushButton("Start Measurement", this);
     buttonStartMeasurement_->setEnabled(false);
     //checkBoxEnableLaser_ = new QCheckBox("Enable Laser", this);
@@ -76,6 +77,7 @@ LStepExpressMeasurementWidget::LStepExpressMeasurementWidget(LStepExpressModel*
     QHBoxLayout *hlayout_checkbox = new QHBoxLayout(this);
     hlayout_checkbox->addWidget(averageMeasCheckBox_);
     hlayout_checkbox->addWidget(zigzagCheckBox_);
+    hlayout_checkbox->addWidget(continuousCheckBox_);
 
     QVBoxLayout *layout_xy = new QVBoxLayout(this);
     layout_xy->addLayout(hlayout_x_min);
@@ -136,6 +138,8 @@ LStepExpressMeasurementWidget::LStepExpressMeasurementWidget(LStepExpressModel*
 
     connect(zigzagCheckBox_, SIGNAL(toggled(bool)), measurement_model_, SLOT(setZigZag(bool)));
 
+    connect(continuousCheckBox_, SIGNAL(toggled(bool)), measurement_model_, SLOT(setContinuous(bool)));
+
     connect(measurement_model_, SIGNAL(informationChanged()),
 	this, SLOT(updateWidget()));
 
@@ -165,6 +169,7 @@ LStepExpressMeasurementWidget::~LStepExpressMeasurementWidget()
     if(buttonStoreMeasurement_){delete buttonStoreMeasurement_; buttonStoreMeasurement_ = nullptr;}
     //if(checkBoxEnableLaser_){delete checkBoxEnableLaser_; checkBoxEnableLaser_ = nullptr;}
     if(zigzagCheckBox_){delete zigzagCheckBox_; zigzagCheckBox_ = nullptr;}
+    if(continuousCheckBox_){delete continuousCheckBox_; continuousCheckBox_ = nullptr;}
 }
 
 void LStepExpressMeasurementWidget::laserStateChanged(State /* newState */)
@@ -64,6 +64,7 @@ protected:
     QPushButton *buttonStoreMeasurement_;
     //    QCheckBox *checkBoxEnableLaser_;
     QCheckBox *zigzagCheckBox_;
+    QCheckBox *continuousCheckBox_;
     QLineEdit* x_min_;
     QLineEdit* x_max_;
     QLineEdit* y_min_;
@@ -12,11 +12,15 @@
 
 #include <LStepExpressModel.h>
 #include <nqlogger.h>
+#include <ApplicationConfig.h>
 
 #include <QFileInfo>
 #include <QDir>
 #include <QStringList>
 
+#include <algorithm>
+#include <chrono>
+
 LStepExpressModel::LStepExpressModel(
   const std::string& port,
   const std::string& lstep_ver,
@@ -31,7 +35,12 @@ LStepExpressModel::LStepExpressModel(
  , lstep_iver_(lstep_iver.c_str())
  , updateInterval_(updateInterval)
  , motionUpdateInterval_(motionUpdateInterval)
+ , watchdogInterval_(motionUpdateInterval)
+ , autoStatusMotionInterval_(motionUpdateInterval)
  , updateCount_(0)
+ , pollTimes_(32)
+ , pollDurations_(32)
+ , positionTime_(0.)
 {
     const std::vector<int> allZerosI{ 0, 0, 0, 0 };
     const std::vector<double> allZerosD{ 0.0, 0.0, 0.0, 0.0 };
@@ -51,8 +60,10 @@ LStepExpressModel::LStepExpressModel(
     deceleration_ = allZerosD;
     velocity_ = allZerosD;
     position_ = allZerosD;
+    timedPosition_ = allZerosD;
 
     inMotion_ = false;
+    autoStatusReader_ = false;
     isUpdating_ = false;
     isPaused_ = false;
     finishedCalibrating_ = false;
@@ -65,6 +76,8 @@ LStepExpressModel::LStepExpressModel(
 
 LStepExpressModel::~LStepExpressModel()
 {
+  // the reader thread calls back into the model
+  if(controller_ != nullptr){ controller_->StopAutoStatusReader(); }
 }
 
 void LStepExpressModel::renewController(const QString& port)
@@ -72,6 +85,15 @@ void LStepExpressModel::renewController(const QString& port)
   if(controller_ != nullptr){ delete controller_; }
 
   controller_ = new LStepExpress_t(port.toStdString(), lstep_ver_.toStdString(), lstep_iver_.toStdString());
+
+#ifdef USE_FAKEIO
+  ApplicationConfig* config = ApplicationConfig::instance();
+  if(config != nullptr)
+  {
+    controller_->SetCommandLatency(config->getValue<int>("LStepExpressFake_commandLatency", 0));
+    controller_->SetMotionSimulation(config->getValue<int>("LStepExpressFake_simulateMotion", 0) != 0);
+  }
+#endif
 }
 
 void LStepExpressModel::getStatus(bool& status)
@@ -351,6 +373,8 @@ void LStepExpressModel::setAccelerationJerk(const std::vector<double>& values)
      << "(x=" << values[0] << ", y=" << values[1] << ", z=" << values[2] << ", a=" << values[3] << ")";
 
   controller_->SetAccelerationJerk(values);
+
+  this->readBackValues(&VLStepExpress::GetAccelerationJerk, accelerationJerk_);
 }
 
 void LStepExpressModel::setAccelerationJerk(const double x, const double y, const double z, const double a)
@@ -376,7 +400,7 @@ void LStepExpressModel::setAccelerationJerk(const unsigned int axis, const doubl
 
   controller_->SetAccelerationJerk((VLStepExpress::Axis)axis, value);
 
-  decelerationJerk_[axis] = value;
+  this->readBackValues(&VLStepExpress::GetAccelerationJerk, accelerationJerk_);
 }
 
 void LStepExpressModel::setDecelerationJerk(const std::vector<double>& values)
@@ -402,6 +426,8 @@ void LStepExpressModel::setDecelerationJerk(const std::vector<double>& values)
      << "(x=" << values[0] << ", y=" << values[1] << ", z=" << values[2] << ", a=" << values[3] << ")";
 
   controller_->SetDecelerationJerk(values);
+
+  this->readBackValues(&VLStepExpress::GetDecelerationJerk, decelerationJerk_);
 }
 
 void LStepExpressModel::setDecelerationJerk(const double x, const double y, const double z, const double a)
@@ -427,7 +453,7 @@ void LStepExpressModel::setDecelerationJerk(const unsigned int axis, const doubl
 
   controller_->SetDecelerationJerk((VLStepExpress::Axis)axis, value);
 
-  decelerationJerk_[axis] = value;
+  this->readBackValues(&VLStepExpress::GetDecelerationJerk, decelerationJerk_);
 }
 
 void LStepExpressModel::setAcceleration(const std::vector<double>& values)
@@ -453,6 +479,8 @@ void LStepExpressModel::setAcceleration(const std::vector<double>& values)
      << "(x=" << values[0] << ", y=" << values[1] << ", z=" << values[2] << ", a=" << values[3] << ")";
 
   controller_->SetAcceleration(values);
+
+  this->readBackValues(&VLStepExpress::GetAcceleration, acceleration_);
 }
 
 void LStepExpressModel::setAcceleration(const double x, const double y, const double z, const double a)
@@ -478,7 +506,7 @@ void LStepExpressModel::setAcceleration(const unsigned int axis, const double va
 
   controller_->SetAcceleration((VLStepExpress::Axis)axis, value);
 
-  acceleration_[axis] = value;
+  this->readBackValues(&VLStepExpress::GetAcceleration, acceleration_);
 }
 
 void LStepExpressModel::setDeceleration(const std::vector<double>& values)
@@ -504,6 +532,8 @@ void LStepExpressModel::setDeceleration(const std::vector<double>& values)
      << "(x=" << values[0] << ", y=" << values[1] << ", z=" << values[2] << ", a=" << values[3] << ")";
 
   controller_->SetDeceleration(values);
+
+  this->readBackValues(&VLStepExpress::GetDeceleration, deceleration_);
 }
 
 void LStepExpressModel::setDeceleration(const double x, const double y, const double z, const double a)
@@ -529,7 +559,7 @@ void LStepExpressModel::setDeceleration(const unsigned int axis, const double va
 
   controller_->SetDeceleration((VLStepExpress::Axis)axis, value);
 
-  deceleration_[axis] = value;
+  this->readBackValues(&VLStepExpress::GetDeceleration, deceleration_);
 }
 
 void LStepExpressModel::setVelocity(const std::vector<double>& values)
@@ -555,6 +585,8 @@ void LStepExpressModel::setVelocity(const std::vector<double>& values)
       << "(x=" << values[0] << ", y=" << values[1] << ", z=" << values[2] << ", a=" << values[3] << ")";
 
   controller_->SetVelocity(values);
+
+  this->readBackValues(&VLStepExpress::GetVelocity, velocity_);
 }
 
 void LStepExpressModel::setVelocity(const double x, const double y, const double z, const double a)
@@ -580,7 +612,7 @@ void LStepExpressModel::setVelocity(const unsigned int axis, const double value)
 
   controller_->SetVelocity((VLStepExpress::Axis)axis, value);
 
-  velocity_[axis] = value;
+  this->readBackValues(&VLStepExpress::GetVelocity, velocity_);
 }
 
 void LStepExpressModel::moveRelative(const std::vector<double>& values)
@@ -617,6 +649,8 @@ void LStepExpressModel::moveRelative(const std::vector<double>& values)
 
     inMotion_ = true;
 
+    this->updatePollInterval();
+
     NQLog("LStepExpressModel", NQLog::Spam) << "moveRelative"
        << ": emitting signal \"motionStarted\"";
 
@@ -653,6 +687,8 @@ void LStepExpressModel::moveRelative(const unsigned int axis, const double value
 
     inMotion_ = true;
 
+    this->updatePollInterval();
+
     NQLog("LStepExpressModel", NQLog::Spam) << "moveRelative"
        << ": emitting signal \"motionStarted\"";
 
@@ -694,6 +730,8 @@ void LStepExpressModel::moveAbsolute(const std::vector<double>& values)
 
     inMotion_ = true;
 
+    this->updatePollInterval();
+
     NQLog("LStepExpressModel", NQLog::Spam) << "moveAbsolute"
        << ": emitting signal \"motionStarted\"";
 
@@ -730,6 +768,8 @@ void LStepExpressModel::moveAbsolute(const unsigned int axis, const double value
 
     inMotion_ = true;
 
+    this->updatePollInterval();
+
     NQLog("LStepExpressModel", NQLog::Spam) << "moveAbsolute"
        << ": emitting signal \"motionStarted\"";
 
@@ -768,6 +808,8 @@ void LStepExpressModel::calibrate()
 
     inMotion_ = true;
 
+    this->updatePollInterval();
+
     finishedCalibrating_ = true;
 
     NQLog("LStepExpressModel", NQLog::Spam) << "calibrate"
@@ -792,6 +834,8 @@ void LStepExpressModel::emergencyStop()
 
     inMotion_ = false;
 
+    this->updatePollInterval();
+
     finishedCalibrating_ = false;
 
     NQLog("LStepExpressModel", NQLog::Spam) << "emergencyStop"
@@ -842,7 +886,7 @@ void LStepExpressModel::setAxisEnabled(unsigned int axis, bool enabled)
         controller_->SetPowerAmplifierStatus((VLStepExpress::Axis)axis, temp);
         controller_->SetAxisEnabled((VLStepExpress::Axis)axis, temp);
         axis_[axis] = temp;
-        updateInformation();
+        updateStateInformation();
 
         NQLog("LStepExpressModel", NQLog::Debug) << "setAxisEnabled(" << axis << ", " << enabled << ")"
            << ": emitting signal \"informationChanged\"";
@@ -879,7 +923,7 @@ void LStepExpressModel::setJoystickEnabled(bool enabled)
 
       if(temp2 == 1){controller_->SetJoystickAxisEnabled(ivalues); joystickAxisEnabled_ = ivalues;}
 
-      updateInformation();
+      updateStateInformation();
 
       NQLog("LStepExpressModel", NQLog::Debug) << "setJoystickEnabled(" << enabled << ")"
          << ": emitting signal \"informationChanged\"";
@@ -943,6 +987,63 @@ void LStepExpressModel::getValue(const QString & command, QString & value)
     value = temp.c_str();
 }
 
+bool LStepExpressModel::setValues(const QStringList & commands)
+{
+    if(controller_ == nullptr)
+    {
+      NQLog("LStepExpressModel", NQLog::Critical) << "setValues"
+         << ": null pointer to controller, no action taken";
+
+      return false;
+    }
+
+    NQLog("LStepExpressModel", NQLog::Debug) << "setValues(" << commands.size() << " commands)";
+
+    std::vector<std::string> temp;
+    for(const auto& i_command : commands){ temp.emplace_back(i_command.toStdString()); }
+
+    if(controller_->SetValues(temp) == false)
+    {
+      NQLog("LStepExpressModel", NQLog::Warning) << "setValues"
+         << ": transfer to the controller failed";
+
+      return false;
+    }
+
+    return true;
+}
+
+bool LStepExpressModel::getValues(const QStringList & commands, QStringList & values)
+{
+    values.clear();
+
+    if(controller_ == nullptr)
+    {
+      NQLog("LStepExpressModel", NQLog::Critical) << "getValues"
+         << ": null pointer to controller, no action taken";
+
+      return false;
+    }
+
+    NQLog("LStepExpressModel", NQLog::Debug) << "getValues(" << commands.size() << " commands)";
+
+    std::vector<std::string> temp;
+    for(const auto& i_command : commands){ temp.emplace_back(i_command.toStdString()); }
+
+    std::vector<std::string> temp_values;
+    const bool success = controller_->GetValues(temp, temp_values);
+
+    for(const auto& i_value : temp_values){ values << QString::fromStdString(i_value); }
+
+    if(success == false)
+    {
+      NQLog("LStepExpressModel", NQLog::Warning) << "getValues"
+         << ": transfer from the controller failed after " << values.size() << " of " << commands.size() << " answers";
+    }
+
+    return success;
+}
+
 void LStepExpressModel::validConfig()
 {
     if(controller_ == nullptr)
@@ -1047,6 +1148,29 @@ void LStepExpressModel::initialize()
 
       controller_->SetAutoStatus(2);
 
+      // end of moves reported by the controller, read by a separate thread
+      // (the polling timer stays as watchdog, and if the reports are not available)
+      bool useAutoStatusReader(true);
+
+      ApplicationConfig* config = ApplicationConfig::instance();
+      if(config != nullptr)
+      {
+        useAutoStatusReader = (config->getValue<int>("LStepExpressModel_autoStatusReader", 1) != 0);
+
+        watchdogInterval_         = std::max(motionUpdateInterval_, config->getValue<int>("LStepExpressModel_watchdogInterval"        , 1000));
+        autoStatusMotionInterval_ = std::max(motionUpdateInterval_, config->getValue<int>("LStepExpressModel_autoStatusMotionInterval", 250));
+      }
+
+      autoStatusReader_ = useAutoStatusReader && controller_->StartAutoStatusReader([this](const std::vector<int>&){
+        QMetaObject::invokeMethod(this, "processAutoStatus", Qt::QueuedConnection);
+      });
+
+      this->updatePollInterval();
+
+      NQLog("LStepExpressModel", NQLog::Message) << "initialize"
+         << ": end of moves detected " << (autoStatusReader_ ? "from the status reports of the controller" : "by polling only")
+         << ", status polled every " << timer_->interval() << " ms";
+
       std::vector<int> allZerosI{ 0, 0, 0, 0 };
       std::vector<int> OnI{1,1,1,1};
 
@@ -1091,6 +1215,10 @@ void LStepExpressModel::setDeviceState(State state)
     }
 }
 
+//
+// full read-back of the controller configuration and state:
+// done at initialization, and on demand (configuration values are not polled)
+//
 void LStepExpressModel::updateInformation()
 {
     if(controller_ == nullptr)
@@ -1103,26 +1231,12 @@ void LStepExpressModel::updateInformation()
 
     NQLog("LStepExpressModel", NQLog::Debug) << "updateInformation";
 
-    /*
-      if (thread()==QApplication::instance()->thread()) {
-      NQLog("LStepExpressModel"<< " running in main application thread";
-      } else {
-      NQLog("LStepExpressModel"<< " running in dedicated thread";
-      }
-    */
-
     bool changed = false;
     bool positionChanged = false;
 
     std::vector<int> ivalues;
     std::vector<double> dvalues;
 
-    controller_->GetAxisEnabled(ivalues);
-    if (ivalues!=axis_) {
-        axis_ = ivalues;
-        changed = true;
-    }
-
     controller_->GetDimension(ivalues);
     if (ivalues!=dim_) {
         dim_ = ivalues;
@@ -1165,8 +1279,43 @@ void LStepExpressModel::updateInformation()
       positionChanged = true;
     }
 
+    changed |= this->updateStateInformation();
+
+    if(changed)
+    {
+        NQLog("LStepExpressModel", NQLog::Debug) << "updateInformation"
+           << ": emitting signal \"informationChanged\"";
+
+        emit informationChanged();
+    }
+
+    if(positionChanged)
+    {
+        NQLog("LStepExpressModel", NQLog::Debug) << "updateInformation"
+           << ": emitting signal \"motionInformationChanged\"";
+
+        emit motionInformationChanged();
+    }
+}
+
+//
+// slow polling tier: axis and joystick enabling, which can change
+// on the controller side (e.g. axes disabled after an error);
+// returns true if any value changed
+//
+bool LStepExpressModel::updateStateInformation()
+{
+    bool changed = false;
+
+    std::vector<int> ivalues;
+
+    controller_->GetAxisEnabled(ivalues);
+    if (ivalues!=axis_) {
+        axis_ = ivalues;
+        changed = true;
+    }
+
     int joystick = controller_->GetJoystickEnabled();
-    // int joystick_model = this->getJoystickEnabled();
     if (joystick!=joystickEnabled_) {
         joystickEnabled_ = joystick;
         changed = true;
@@ -1180,23 +1329,33 @@ void LStepExpressModel::updateInformation()
       }
     }
 
-    if(changed)
-    {
-        NQLog("LStepExpressModel", NQLog::Debug) << "updateInformation"
-           << ": emitting signal \"informationChanged\"";
+    return changed;
+}
 
-        emit informationChanged();
-    }
+//
+// values are read back after every write, so the cache holds
+// what the controller accepted (e.g. after rounding or clipping)
+//
+void LStepExpressModel::readBackValues(void (VLStepExpress::*getter)(std::vector<double>&), std::vector<double>& values)
+{
+    std::vector<double> dvalues;
+    (controller_->*getter)(dvalues);
 
-    if(positionChanged)
+    if(dvalues != values)
     {
-        NQLog("LStepExpressModel", NQLog::Debug) << "updateInformation"
-           << ": emitting signal \"motionInformationChanged\"";
+      values = dvalues;
 
-        emit motionInformationChanged();
+      NQLog("LStepExpressModel", NQLog::Debug) << "readBackValues"
+         << ": emitting signal \"informationChanged\"";
+
+      emit informationChanged();
     }
 }
 
+//
+// fast polling tier: axis status and position only (a single exchange with the controller);
+// the axis and joystick state is refreshed every updateInterval_/(poll interval) polls
+//
 void LStepExpressModel::updateMotionInformation()
 {
     if(controller_ == nullptr)
@@ -1209,81 +1368,91 @@ void LStepExpressModel::updateMotionInformation()
 
     NQLog("LStepExpressModel", NQLog::Debug) << "updateMotionInformation";
 
-    static const int nUpdates = updateInterval_/motionUpdateInterval_;
-
-    if ( state_ == READY && !isPaused_) {
-
+    if((state_ == READY) && (isPaused_ == false))
+    {
       isUpdating_ = true;
 
-      updateCount_++;
-      if (updateCount_==nUpdates) {
-        updateInformation();
+      const int nUpdates = std::max(1, updateInterval_/timer_->interval());
+
+      ++updateCount_;
+      if(updateCount_ >= nUpdates)
+      {
         updateCount_ = 0;
-      }
 
-      /*
-        if (thread()==QApplication::instance()->thread()) {
-        NQLog("LStepExpressModel"<< " running in main application thread";
-        } else {
-        NQLog("LStepExpressModel"<< " running in dedicated thread";
+        if(this->updateStateInformation())
+        {
+          NQLog("LStepExpressModel", NQLog::Debug) << "updateMotionInformation"
+             << ": emitting signal \"informationChanged\"";
+
+          emit informationChanged();
         }
-      */
+
+        NQLog("LStepExpressModel", NQLog::Debug) << "updateMotionInformation"
+           << ": poll rate = " << this->pollRate() << " Hz, mean poll duration = " << (1e3 * this->pollDuration()) << " ms";
+      }
 
       bool changed = false;
 
       std::vector<int> ivalues;
-      std::vector<int> pavalues;
-      std::vector<int> evalues;
       std::vector<double> dvalues;
 
-      controller_->GetAxisStatus(ivalues);
-      controller_->GetPowerAmplifierStatus(pavalues);
-      controller_->GetAxisEnabled(evalues);
+      const bool anyAxisEnabled = ((axis_)[0] || (axis_)[1] || (axis_)[2] || (axis_)[3]);
+
+      if(anyAxisEnabled)
+      {
+        const double t0 = LStepExpressModel::pollTime();
+
+        controller_->GetAxisStatusAndPosition(ivalues, dvalues);
+
+        const double t1 = LStepExpressModel::pollTime();
+
+        QMutexLocker locker(&pollMutex_);
+
+        timedPosition_ = dvalues;
+        positionTime_  = 0.5 * (t0 + t1);
+      }
+      else
+      {
+        controller_->GetAxisStatus(ivalues);
+      }
 
       if (ivalues!=axisStatus_) {
         axisStatus_ = ivalues;
         changed = true;
       }
 
-      if (inMotion_) {
+      if(inMotion_)
+      {
         bool temp = true;
-        for(int i = 0; i < 4; i++){
+        for(int i = 0; i < 4; i++)
+        {
           bool ifaxisenabled = ( (ivalues)[i] == LStepExpress_t::AXISSTANDSANDREADY || (ivalues)[i] == LStepExpress_t::AXISACKAFTERCALIBRATION) && (axis_)[i] == 1;
           bool ifaxisnotenabled = (axis_)[i] == 0;
-          temp = ifaxisenabled || ifaxisnotenabled;
-          //	    NQLog("LStepExpressModel", NQLog::Spam) <<" axis status =  "<<(ivalues)[i]<<" axis enabled = "<<(axis_)[i]<<" temp = "<<temp;
+          temp *= (ifaxisenabled || ifaxisnotenabled);
         }
         if(temp)
         {
           inMotion_ = false;
 
+          this->updatePollInterval();
+
           NQLog("LStepExpressModel", NQLog::Debug) << "updateMotionInformation"
               << ": emitting signal \"motionFinished\"";
 
           emit motionFinished();
         }
-          
-          /*
-	if (std::all_of(ivalues.begin(), ivalues.end(),
-	[](int i){	  NQLog("LStepExpressModel", NQLog::Spam)<< "updateMotionInformation() axis status =  "<<i; bool temp = (i==LStepExpress_t::AXISSTANDSANDREADY || i==LStepExpress_t::AXISACKAFTERCALIBRATION) && (axis_)[i]==1; return temp;})) {
-	NQLog("LStepExpressModel", NQLog::Spam)<< "updateMotionInformation() finished moving inMotion_ = false";
-	inMotion_ = false;
-	emit motionFinished();
-	}*/
       }
-      
-      if( (axis_)[0] || (axis_)[1] || (axis_)[2] || (axis_)[3]){
-        controller_->GetPosition(dvalues);
+
+      if(anyAxisEnabled)
+      {
         if (dvalues!=position_) {
-          //NQLog("LStepExpressModel", NQLog::Spam)<< "updateMotionInformation() new position values"  ;
           position_ = dvalues;
           changed = true;
         }
       }
-      
-      //      NQLog("LStepExpressModel", NQLog::Spam)<< "updateMotionInformation() finishedCalibrating_ =  "<<finishedCalibrating_<<" in motion =  "<<inMotion_  ;
-      if(!inMotion_ && finishedCalibrating_){
-        //  NQLog("LStepExpressModel", NQLog::Spam)<< "updateMotionInformation() after calibration, setting position values to zero"  ;
+
+      if(!inMotion_ && finishedCalibrating_)
+      {
         std::vector<double> posvalues{0.0, 0.0, 0.0, 0.0};
         controller_->SetPosition(posvalues);
         position_ = posvalues;
@@ -1305,100 +1474,91 @@ void LStepExpressModel::updateMotionInformation()
 
 void LStepExpressModel::updateMotionInformationFromTimer()
 {
-    if(controller_ == nullptr)
-    {
-      NQLog("LStepExpressModel", NQLog::Debug) << "updateMotionInformationFromTimer"
-         << ": null pointer to controller, no action taken";
+    NQLog("LStepExpressModel", NQLog::Debug) << "updateMotionInformationFromTimer";
 
-      return;
-    }
+    if((controller_ == nullptr) || (state_ != READY) || isPaused_){ return; }
 
-    NQLog("LStepExpressModel", NQLog::Debug) << "updateMotionInformationFromTimer";
+    const double t0 = LStepExpressModel::pollTime();
 
-    static const int nUpdates = updateInterval_/motionUpdateInterval_;
+    this->updateMotionInformation();
 
-    if((state_ == READY) && (isPaused_ == false))
-    {
-      isUpdating_ = true;
+    const double t1 = LStepExpressModel::pollTime();
 
-      updateCount_++;
-      if (updateCount_==nUpdates) {
-        updateInformation();
-        updateCount_ = 0;
-      }
+    QMutexLocker locker(&pollMutex_);
 
-      /*
-        if (thread()==QApplication::instance()->thread()) {
-        NQLog("LStepExpressModel"<< " running in main application thread";
-        } else {
-        NQLog("LStepExpressModel"<< " running in dedicated thread";
-        }
-      */
+    pollTimes_    .push(t0);
+    pollDurations_.push(t1 - t0);
+}
 
-      bool changed = false;
+//
+// end of a move reported by the controller (queued from the reader thread):
+// status and positions are read back right away, instead of at the next poll of the timer;
+// stale reports are harmless, as motionFinished is only emitted if the axes are ready
+//
+void LStepExpressModel::processAutoStatus()
+{
+    NQLog("LStepExpressModel", NQLog::Debug) << "processAutoStatus";
 
-      std::vector<int> ivalues;
-      std::vector<int> pavalues;
-      std::vector<int> evalues;
-      std::vector<double> dvalues;
+    if((controller_ == nullptr) || (state_ != READY) || isPaused_ || (inMotion_ == false)){ return; }
 
-      controller_->GetAxisStatus(ivalues);
-      controller_->GetPowerAmplifierStatus(pavalues);
-      controller_->GetAxisEnabled(evalues);
+    this->updateMotionInformation();
+}
 
-      if (ivalues!=axisStatus_) {
-        axisStatus_ = ivalues;
-        changed = true;
-      }
+//
+// with the status reports of the controller, the end of a move does not need to be polled:
+// the timer is only a watchdog (e.g. a lost report) when the stage is idle,
+// and refreshes the positions shown during a move at a lower rate than the polling-only mode
+//
+void LStepExpressModel::updatePollInterval()
+{
+    const int interval = autoStatusReader_ ? (inMotion_ ? autoStatusMotionInterval_ : watchdogInterval_) : motionUpdateInterval_;
 
-      if(inMotion_)
-      {
-        bool temp = true;
-        for(int i = 0; i < 4; i++)
-        {
-          bool ifaxisenabled = ( (ivalues)[i] == LStepExpress_t::AXISSTANDSANDREADY || (ivalues)[i] == LStepExpress_t::AXISACKAFTERCALIBRATION) && (axis_)[i] == 1;
-          bool ifaxisnotenabled = (axis_)[i] == 0;
-          temp *= (ifaxisenabled || ifaxisnotenabled);
-        }
-        if(temp)
-        {
-          inMotion_ = false;
+    if(timer_->interval() == interval){ return; }
 
-          NQLog("LStepExpressModel", NQLog::Debug) << "updateMotionInformationFromTimer"
-              << ": emitting signal \"motionFinished\"";
+    NQLog("LStepExpressModel", NQLog::Debug) << "updatePollInterval"
+       << ": status polled every " << interval << " ms";
 
-          emit motionFinished();
-        }
-      }
+    timer_->setInterval(interval);
+}
 
-      if((axis_)[0] || (axis_)[1] || (axis_)[2] || (axis_)[3])
-      {
-        controller_->GetPosition(dvalues);
-        if (dvalues!=position_) {
-          position_ = dvalues;
-          changed = true;
-        }
-      }
+double LStepExpressModel::pollTime()
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
 
-      if(!inMotion_ && finishedCalibrating_)
-      {
-        std::vector<double> posvalues{0.0, 0.0, 0.0, 0.0};
-        controller_->SetPosition(posvalues);
-        position_ = posvalues;
-        changed = true;
-        finishedCalibrating_ = false;
-      }
+//
+// last positions read from the controller, and the time of the readout
+// (middle of the query, on the pollTime() clock)
+//
+void LStepExpressModel::getTimedPositions(std::vector<double>& positions, double& time) const
+{
+  QMutexLocker locker(&pollMutex_);
 
-      if(changed)
-      {
-        NQLog("LStepExpressModel", NQLog::Debug) << "updateMotionInformationFromTimer"
-            << ": emitting signal \"motionInformationChanged\"";
+  positions = timedPosition_;
+  time      = positionTime_;
+}
 
-        emit motionInformationChanged();
-      }
+double LStepExpressModel::pollRate() const
+{
+  QMutexLocker locker(&pollMutex_);
 
-      isUpdating_ = false;
-    }
+  if(pollTimes_.size() < 2){ return 0.; }
+
+  const double dt = pollTimes_.first() - pollTimes_.last();
+
+  return (dt > 0.) ? ((pollTimes_.size() - 1) / dt) : 0.;
+}
+
+double LStepExpressModel::pollDuration() const
+{
+  QMutexLocker locker(&pollMutex_);
+
+  if(pollDurations_.empty()){ return 0.; }
+
+  double sum(0.);
+  for(size_t i=0; i<pollDurations_.size(); ++i){ sum += pollDurations_.at(i); }
+
+  return (sum / pollDurations_.size());
 }
 
 void LStepExpressModel::setDeviceEnabled(bool enabled)
@@ -17,12 +17,14 @@
 #include <string>
 
 #include <QString>
+#include <QStringList>
 #include <QTimer>
 #include <QMutex>
 #include <QMutexLocker>
 
 #include "DeviceState.h"
 #include "DeviceParameter.h"
+#include "Ringbuffer.h"
 
 #ifdef USE_FAKEIO
 #include "devices/Lang/LStepExpressFake.h"
@@ -72,6 +74,11 @@ class LStepExpressModel : public QObject, public AbstractDeviceModel<LStepExpres
     void setValue(const QString & command, const QString & value);
     void getValue(const QString & command, QString & value);
 
+    /// Bulk transfer of complete commands (several commands per exchange with the controller);
+    /// false if the transfer failed (then values holds only the answers received before the failure).
+    bool setValues(const QStringList & commands);
+    bool getValues(const QStringList & commands, QStringList & values);
+
     void getStatus(bool& status);
     void getError(int& error);
     void getSystemStatus(std::string& value);
@@ -84,8 +91,23 @@ class LStepExpressModel : public QObject, public AbstractDeviceModel<LStepExpres
     int       updateInterval() const { return       updateInterval_; }
     int motionUpdateInterval() const { return motionUpdateInterval_; }
 
+    /// Current interval of the status/position polls (motionUpdateInterval, or the watchdog intervals with the status reports of the controller); in milliseconds.
+    int pollInterval() const { return timer_->interval(); }
+
+    /// Achieved rate of the status/position polls (in Hz), and their mean duration (in seconds).
+    double pollRate() const;
+    double pollDuration() const;
+
+    /// Last positions read from the controller, with the time of the readout (on the pollTime() clock, in seconds).
+    void getTimedPositions(std::vector<double>& positions, double& time) const;
+
+    static double pollTime();
+
   public slots:
 
+    /// Re-reads the complete configuration from the controller.
+    void updateInformation();
+
     void setDeviceEnabled(bool enabled=true);
     void setControlsEnabled(bool enabled);
     void setAxisEnabled(unsigned int axis, bool enabled);
@@ -142,11 +164,26 @@ class LStepExpressModel : public QObject, public AbstractDeviceModel<LStepExpres
     /// Time interval between cache refreshes; in milliseconds.
     const int updateInterval_;
     const int motionUpdateInterval_;
+    /// Poll intervals when the end of moves is reported by the controller (idle stage, and during moves); in milliseconds.
+    int watchdogInterval_;
+    int autoStatusMotionInterval_;
     QTimer* timer_;
     int updateCount_;
 
+    mutable QMutex pollMutex_;
+    Ringbuffer<double> pollTimes_;
+    Ringbuffer<double> pollDurations_;
+
+    std::vector<double> timedPosition_;
+    double positionTime_;
+
     void setDeviceState( State state );
 
+    void updatePollInterval();
+
+    bool updateStateInformation();
+    void readBackValues(void (VLStepExpress::*getter)(std::vector<double>&), std::vector<double>& values);
+
     std::vector<int> axis_;
     std::vector<int> axisDirection_;
     std::vector<int> dim_;
@@ -163,15 +200,16 @@ class LStepExpressModel : public QObject, public AbstractDeviceModel<LStepExpres
     std::vector<double> position_;
 
     bool inMotion_;
+    bool autoStatusReader_;
     bool isPaused_;
     bool isUpdating_;
     bool finishedCalibrating_;
 
   protected slots:
 
-    void updateInformation();
     void updateMotionInformation();
     void updateMotionInformationFromTimer();
+    void processAutoStatus();
 
   signals:
 
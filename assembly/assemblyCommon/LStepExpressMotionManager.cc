@@ -18,16 +18,31 @@
 
 #include <unistd.h>
 
+#include <chrono>
+#include <cmath>
+
 LStepExpressMotionManager::LStepExpressMotionManager(LStepExpressModel* model, QObject* parent)
  : QObject(parent)
 
  , model_(model)
  , model_connected_(false)
  , inMotion_(false)
+
+ , merge_independent_axes_(false)
+
+ , motion_start_time_(0.)
+ , motion_merged_N_(0)
+ , last_motion_duration_(0.)
 {
   qRegisterMetaType<LStepExpressMotion>("LStepExpressMotion");
   qRegisterMetaType<QQueue<LStepExpressMotion> >("QQueue<LStepExpressMotion>");
 
+  ApplicationConfig* config = ApplicationConfig::instance();
+  if(config != nullptr)
+  {
+    merge_independent_axes_ = config->getValue<bool>("LStepExpressMotionManager_mergeIndependentAxes", false);
+  }
+
   if(model_ == nullptr)
   {
     NQLog("LStepExpressMotionManager", NQLog::Fatal) << "initialization error"
@@ -124,8 +139,35 @@ void LStepExpressMotionManager::run()
 
     LStepExpressMotion motion = motions_.dequeue();
 
+    // look-ahead: queued motions that can be executed as a single controller command
+    // are merged, to avoid a stop (and its detection by polling) between them
+    motion_merged_N_ = 1;
+
+    while((motions_.empty() == false) && LStepExpressMotionManager::motions_mergeable(motion, motions_.head(), merge_independent_axes_))
+    {
+      const LStepExpressMotion next = motions_.dequeue();
+
+      motion = LStepExpressMotion(
+        motion.getX() + next.getX(),
+        motion.getY() + next.getY(),
+        motion.getZ() + next.getZ(),
+        motion.getA() + next.getA(),
+        false
+      );
+
+      ++motion_merged_N_;
+    }
+
+    if(motion_merged_N_ > 1)
+    {
+      NQLog("LStepExpressMotionManager", NQLog::Spam) << "run"
+         << ": merged " << motion_merged_N_ << " queued relative motions into a single motion";
+    }
+
     inMotion_ = true;
 
+    motion_start_time_ = LStepExpressMotionManager::motion_time();
+
     if(motion.getMode() == true)
     {
       NQLog("LStepExpressMotionManager", NQLog::Spam) << "run: emitting signal \"signalMoveAbsolute("
@@ -152,6 +194,39 @@ void LStepExpressMotionManager::run()
     return;
 }
 
+//
+// two consecutive relative motions are merged if the merged motion follows the same path,
+// i.e. if their displacements are parallel and in the same direction (e.g. steps along one axis);
+// motions on independent axes are merged only if explicitly enabled, because the merged motion
+// moves the axes simultaneously instead of one after the other (e.g. XY before lowering Z)
+//
+bool LStepExpressMotionManager::motions_mergeable(const LStepExpressMotion& m1, const LStepExpressMotion& m2, const bool merge_independent_axes)
+{
+  if(m1.getMode() || m2.getMode()){ return false; }
+
+  const double v1[4] = {m1.getX(), m1.getY(), m1.getZ(), m1.getA()};
+  const double v2[4] = {m2.getX(), m2.getY(), m2.getZ(), m2.getA()};
+
+  double dot(0.), norm1(0.), norm2(0.);
+  bool independent_axes(true);
+
+  for(int i=0; i<4; ++i)
+  {
+    dot   += v1[i] * v2[i];
+    norm1 += v1[i] * v1[i];
+    norm2 += v2[i] * v2[i];
+
+    if((v1[i] != 0.) && (v2[i] != 0.)){ independent_axes = false; }
+  }
+
+  // null motion: nothing to wait for
+  if((norm1 == 0.) || (norm2 == 0.)){ return true; }
+
+  const bool same_direction = ((dot > 0.) && (std::fabs(dot * dot - norm1 * norm2) <= 1e-9 * norm1 * norm2));
+
+  return (same_direction || (merge_independent_axes && independent_axes));
+}
+
 bool LStepExpressMotionManager::AxisIsReady(const int axis) const
 {
   const bool axis_ready = (model_->getAxisStatusText(axis) == "@");
@@ -219,8 +294,22 @@ void LStepExpressMotionManager::motionStarted()
   inMotion_ = true;
 }
 
+double LStepExpressMotionManager::motion_time()
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 void LStepExpressMotionManager::finish_motion()
 {
+  if(inMotion_)
+  {
+    last_motion_duration_ = LStepExpressMotionManager::motion_time() - motion_start_time_;
+
+    NQLog("LStepExpressMotionManager", NQLog::Debug) << "finish_motion"
+       << ": motion completed in " << (1e3 * last_motion_duration_) << " ms"
+       << " (" << motion_merged_N_ << " queued motion" << ((motion_merged_N_ > 1) ? "s" : "") << ")";
+  }
+
   NQLog("LStepExpressMotionManager", NQLog::Spam) << "finish_motion"
      << ": setting \"inMotion=false\" and calling run() method";
 
@@ -42,6 +42,10 @@ class LStepExpressMotionManager : public QObject
 
     void myMoveToThread(QThread*);
 
+    static bool motions_mergeable(const LStepExpressMotion&, const LStepExpressMotion&, const bool merge_independent_axes);
+
+    double last_motion_duration() const { return last_motion_duration_; }
+
   protected:
 
     void run();
@@ -56,6 +60,15 @@ class LStepExpressMotionManager : public QObject
 
     QQueue<LStepExpressMotion> motions_;
 
+    bool merge_independent_axes_;
+
+    // timing of the motion sent to the controller (possibly merged from several queued motions)
+    double motion_start_time_;
+    int    motion_merged_N_;
+    double last_motion_duration_;
+
+    static double motion_time();
+
   public slots:
 
     void    connect_model();
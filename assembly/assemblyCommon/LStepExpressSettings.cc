@@ -18,6 +18,7 @@
 #include <QTextStream>
 
 #include <nqlogger.h>
+#include <ApplicationConfig.h>
 
 #include "LStepExpressSettings.h"
 
@@ -68,6 +69,11 @@ bool LStepExpressSettingsInstructionB::setValue(const QString& value)
     return ret;
 }
 
+bool LStepExpressSettingsInstructionB::accepts(const QString& value) const
+{
+    return (value=="0" || value=="1");
+}
+
 bool LStepExpressSettingsInstructionB::setValue(QVariant value)
 {
     bool newValue;
@@ -115,6 +121,14 @@ bool LStepExpressSettingsInstructionI::setValue(const QString& value)
     return ret;
 }
 
+bool LStepExpressSettingsInstructionI::accepts(const QString& value) const
+{
+    bool ok = false;
+    value.toInt(&ok);
+
+    return ok;
+}
+
 bool LStepExpressSettingsInstructionI::setValue(QVariant value)
 {
     int newValue;
@@ -176,6 +190,21 @@ bool LStepExpressSettingsInstructionVI::setValue(const QString& value)
     return ret;
 }
 
+bool LStepExpressSettingsInstructionVI::accepts(const QString& value) const
+{
+    QStringList tokens = value.split(" ", QString::SkipEmptyParts);
+    if (tokens.size()!=size_) return false;
+
+    bool ok = true;
+    for (QStringList::iterator it = tokens.begin();
+         it!=tokens.end() && ok;
+         ++it) {
+        (*it).toInt(&ok);
+    }
+
+    return ok;
+}
+
 bool LStepExpressSettingsInstructionVI::setValue(QVariant value)
 {
     int newValue;
@@ -247,6 +276,14 @@ bool LStepExpressSettingsInstructionD::setValue(const QString& value)
     return ret;
 }
 
+bool LStepExpressSettingsInstructionD::accepts(const QString& value) const
+{
+    bool ok = false;
+    value.toDouble(&ok);
+
+    return ok;
+}
+
 bool LStepExpressSettingsInstructionD::setValue(QVariant value)
 {
     double newValue;
@@ -267,8 +304,16 @@ const QString LStepExpressSettingsInstructionD::valueAsString()
 
 LStepExpressSettings::LStepExpressSettings(LStepExpressModel* model, QObject* parent)
     : QObject(parent),
-      model_(model)
+      model_(model),
+      deviceValueLifetime_(60000)
 {
+    ApplicationConfig* config = ApplicationConfig::instance();
+    if (config!=nullptr) {
+        deviceValueLifetime_ = qint64(1000. * config->getValue<double>("LStepExpressSettings_cacheLifetime", 60.));
+    }
+
+    deviceValueTimer_.start();
+
     //General Section
     addI("BaudRate", "!baud", "baud", false, false); //9600, 19200, 38400, 57600, 115200
     addI("AxisCount", "!configmaxaxis", "configmaxaxis", false, false);
@@ -399,9 +444,38 @@ LStepExpressSettings::LStepExpressSettings(LStepExpressModel* model, QObject* pa
 
 void LStepExpressSettings::deviceControlStateChanged(bool enabled)
 {
+    invalidateDeviceValues();
+
     emit controlStateChanged(enabled);
 }
 
+void LStepExpressSettings::invalidateDeviceValues()
+{
+    QMutexLocker locker(&mutex_);
+
+    deviceValues_.clear();
+    deviceValueTimes_.clear();
+}
+
+bool LStepExpressSettings::hasDeviceValue(const QString& key) const
+{
+    if (deviceValueLifetime_<=0 || !deviceValues_.contains(key)) return false;
+
+    return (deviceValueTimer_.elapsed() - deviceValueTimes_.value(key)) < deviceValueLifetime_;
+}
+
+void LStepExpressSettings::setDeviceValue(const QString& key, const QString& value)
+{
+    deviceValues_[key] = value;
+    deviceValueTimes_[key] = deviceValueTimer_.elapsed();
+}
+
+void LStepExpressSettings::invalidateDeviceValue(const QString& key)
+{
+    deviceValues_.remove(key);
+    deviceValueTimes_.remove(key);
+}
+
 void LStepExpressSettings::valueChanged(QString key, bool value)
 {
     NQLog("LStepExpressSettings ", NQLog::Spam) << "valueChanged " << key.toStdString() << " " << value;    
@@ -455,24 +529,72 @@ void LStepExpressSettings::readSettingsFromDevice()
     //this randomly staryted to cause compilation errors on mac...???
     //while (model_->isUpdating()) usleep(100);
 
-    model_->pauseUpdate();
+    const qint64 startTime = deviceValueTimer_.elapsed();
+
+    // settings with a known value on the controller are restored from it (e.g. after edits), the others are read in bulk
+    QStringList getters;
+    QList<LStepExpressSettingsInstruction*> staleSettings;
 
     for (QList<LStepExpressSettingsInstruction*>::iterator it = parameters_.begin();
          it!=parameters_.end();
          ++it) {
         LStepExpressSettingsInstruction* setting = *it;
 
-        QString value;
-        model_->getValue(setting->getter(), value);
+        if (hasDeviceValue(setting->key())) {
+            if (setting->setValue(deviceValues_.value(setting->key()))) {
+                emit settingChanged(setting->key(),setting->getValue());
+            }
+            continue;
+        }
+
+        getters << setting->getter();
+        staleSettings << setting;
+    }
+
+    if (!getters.isEmpty()) {
+        QStringList values;
+
+        model_->pauseUpdate();
+        const bool success = model_->getValues(getters, values) && (values.size()==getters.size());
+        model_->continueUpdate();
+
+        // after a failed transfer, the answers received may not match their queries: none is used
+        if (!success) {
+            NQLog("LStepExpressSettings ", NQLog::Warning) << "readSettingsFromDevice: "
+                << "transfer from the controller failed, " << getters.size() << " settings not updated";
+        }
+
+        for (int i=0; i<staleSettings.size(); ++i) {
+            LStepExpressSettingsInstruction* setting = staleSettings.at(i);
+
+            if (!success) {
+                invalidateDeviceValue(setting->key());
+                continue;
+            }
+
+            const QString value = values.at(i);
+
+            NQLog("LStepExpressSettings ", NQLog::Spam) << setting->getter().toStdString() << " -> " << value.toStdString()    ;
+
+            if (!setting->accepts(value)) {
+                NQLog("LStepExpressSettings ", NQLog::Warning) << "readSettingsFromDevice: "
+                    << "invalid answer to " << setting->getter().toStdString() << " (\"" << value.toStdString() << "\"), setting not updated";
 
-        NQLog("LStepExpressSettings ", NQLog::Spam) << setting->getter().toStdString() << " -> " << value.toStdString()    ;
+                invalidateDeviceValue(setting->key());
+                continue;
+            }
+
+            if (setting->setValue(value)) {
+                emit settingChanged(setting->key(),setting->getValue());
+            }
 
-        if (setting->setValue(value)) {
-            emit settingChanged(setting->key(),setting->getValue());
+            setDeviceValue(setting->key(), setting->value());
         }
     }
 
-    model_->continueUpdate();
+    NQLog("LStepExpressSettings ", NQLog::Message) << "readSettingsFromDevice: "
+        << getters.size() << " of " << parameters_.size() << " settings read from the controller ("
+        << (deviceValueTimer_.elapsed() - startTime) << " ms)";
 }
 
 void LStepExpressSettings::readSettingsFromFile(const QString& filename)
@@ -504,17 +626,53 @@ void LStepExpressSettings::writeSettingsToDevice()
 {
     QMutexLocker locker(&mutex_);
 
+    const qint64 startTime = deviceValueTimer_.elapsed();
+
+    // only the settings that differ from their known value on the controller are written, in bulk
+    QStringList commands;
+    QList<LStepExpressSettingsInstruction*> writtenSettings;
+
     for (QList<LStepExpressSettingsInstruction*>::iterator it = parameters_.begin();
          it!=parameters_.end();
          ++it) {
         LStepExpressSettingsInstruction* setting = *it;
 
-        model_->setValue(setting->setter(), setting->value());
-        NQLog("LStepExpressSettings ", NQLog::Spam) << setting->setter().toStdString() << " <- " << setting->value().toStdString()    ;
+        const QString value = setting->value();
+
+        if (hasDeviceValue(setting->key()) && deviceValues_.value(setting->key())==value) continue;
+
+        commands << (setting->setter() + " " + value);
+        NQLog("LStepExpressSettings ", NQLog::Spam) << setting->setter().toStdString() << " <- " << value.toStdString()    ;
+
+        writtenSettings << setting;
+    }
+
+    if (!commands.isEmpty()) {
+        const bool success = model_->setValues(commands);
+
+        model_->validConfig();
+        model_->validParameter();
+
+        // the values are known to be on the controller only once the transfer succeeded
+        for (QList<LStepExpressSettingsInstruction*>::iterator it = writtenSettings.begin();
+             it!=writtenSettings.end();
+             ++it) {
+            if (success) {
+                setDeviceValue((*it)->key(), (*it)->value());
+            } else {
+                invalidateDeviceValue((*it)->key());
+            }
+        }
+
+        if (!success) {
+            NQLog("LStepExpressSettings ", NQLog::Warning) << "writeSettingsToDevice: "
+                << "transfer to the controller failed, " << commands.size() << " settings in unknown state";
+        }
     }
 
-    model_->validConfig();
-    model_->validParameter();
+    NQLog("LStepExpressSettings ", NQLog::Message) << "writeSettingsToDevice: "
+        << commands.size() << " of " << parameters_.size() << " settings written to the controller ("
+        << (deviceValueTimer_.elapsed() - startTime) << " ms)";
 }
 
 void LStepExpressSettings::saveSettingsOnDevice()
@@ -530,6 +688,9 @@ void LStepExpressSettings::resetSettings()
     QMutexLocker locker(&mutex_);
     model_->reset();
 
+    deviceValues_.clear();
+    deviceValueTimes_.clear();
+
     NQLog("LStepExpressSettings ", NQLog::Spam) << "reset settings to startup conditions"    ;
 }
 
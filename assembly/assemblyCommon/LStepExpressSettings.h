@@ -22,6 +22,7 @@
 #include <QList>
 #include <QMutex>
 #include <QMutexLocker>
+#include <QElapsedTimer>
 
 #include <LStepExpressModel.h>
 
@@ -46,6 +47,8 @@ public:
     const QString setter() { return setter_; }
     const QString& getter() const { return getter_; }
     virtual bool setValue(const QString& value) = 0;
+    // true if the text (e.g. an answer of the controller) is a valid value of the setting
+    virtual bool accepts(const QString& value) const = 0;
     virtual const QString valueAsString() = 0;
 
     virtual const QString value() = 0;
@@ -77,6 +80,7 @@ public:
                                               bool needsValidPar);
 
     bool setValue(const QString& value);
+    bool accepts(const QString& value) const;
     const QString valueAsString();
 
     const QString value();
@@ -101,6 +105,7 @@ public:
                                               bool needsValidPar);
 
     bool setValue(const QString& value);
+    bool accepts(const QString& value) const;
     const QString valueAsString();
 
     const QString value();
@@ -126,6 +131,7 @@ public:
                                                bool needsValidPar);
 
     bool setValue(const QString& value);
+    bool accepts(const QString& value) const;
     const QString valueAsString();
 
     const QString value();
@@ -151,6 +157,7 @@ public:
                                               bool needsValidPar);
 
     bool setValue(const QString& value);
+    bool accepts(const QString& value) const;
     const QString valueAsString();
 
     const QString value();
@@ -193,10 +200,24 @@ public slots:
     void saveSettingsOnDevice();
     void resetSettings();
 
+    void invalidateDeviceValues();
+
 protected:
 
     LStepExpressModel* model_;
 
+    // last values known to be on the controller (read from or written to it), with the time of the transfer;
+    // settings are only read from the controller if their known value is older than the cache lifetime,
+    // and only written to the controller if they differ from their known value
+    QMap<QString,QString> deviceValues_;
+    QMap<QString,qint64> deviceValueTimes_;
+    QElapsedTimer deviceValueTimer_;
+    qint64 deviceValueLifetime_;
+
+    bool hasDeviceValue(const QString& key) const;
+    void setDeviceValue(const QString& key, const QString& value);
+    void invalidateDeviceValue(const QString& key);
+
     void addBA(const QString& key, const QString& setter, const QString& getter,
                bool needsValidConfig,
                bool needsValidPar);
@@ -249,7 +249,7 @@ void LStepExpressWidget::restart()
 
     // start restart timer
     restart_timer_ = new QTimer(this);
-    restart_timer_->setInterval(2 * std::max(model_->updateInterval(), model_->motionUpdateInterval()));
+    restart_timer_->setInterval(2 * std::max(model_->updateInterval(), model_->pollInterval()));
 
     connect(restart_timer_, SIGNAL(timeout()), this, SLOT(restart()));
 
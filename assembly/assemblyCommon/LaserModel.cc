@@ -16,12 +16,17 @@
 
 #include "LaserModel.h"
 
+#ifdef USE_FAKEIO
+#include "devices/Lang/LStepExpressFake.h"
+#endif
+
 LaserModel::LaserModel(const char* port, QObject*)
     : QObject(),
       AbstractDeviceModel<Keyence_t>(),
       Laser_PORT(port)
 {
     laserHead_ = 2; //note: head A = 2
+    samplingMode_ = 0;
 
     timer_ = new QTimer(this);
     timer_->setInterval(100);
@@ -46,7 +51,52 @@ void LaserModel::setSamplingRate(int mode)
     if(state_ == OFF) return;
 
     //    NQLog("LaserModel ", NQLog::Debug) << "[LaserModel::setSamplingRate]"    ;
+    QMutexLocker locker(&mutex_);
     controller_->SetSamplingRate(mode);
+    samplingMode_ = mode;
+}
+
+int LaserModel::samplingPeriod()
+{
+    if(state_ == OFF) return 0;
+
+    QMutexLocker locker(&mutex_);
+    return controller_->SamplingPeriod();
+}
+
+//clears the stored values
+void LaserModel::initDataStorage()
+{
+    if(state_ == OFF) return;
+
+    QMutexLocker locker(&mutex_);
+    controller_->InitDataStorage();
+}
+
+void LaserModel::startDataStorage()
+{
+    if(state_ == OFF) return;
+
+    QMutexLocker locker(&mutex_);
+    controller_->StartDataStorage();
+}
+
+void LaserModel::stopDataStorage()
+{
+    if(state_ == OFF) return;
+
+    QMutexLocker locker(&mutex_);
+    controller_->StopDataStorage();
+}
+
+void LaserModel::getStoredData(std::vector<double>& values)
+{
+    values.clear();
+
+    if(state_ == OFF) return;
+
+    QMutexLocker locker(&mutex_);
+    controller_->OutputDataStorage(laserHead_, values);
 }
 
 void LaserModel::setAveraging(int mode)
@@ -116,6 +166,16 @@ void LaserModel::initialize()
     bool enabled = (controller_ != nullptr) && (controller_->DeviceAvailable());
 
     if ( enabled ) {
+#ifdef USE_FAKEIO
+        // simulated laser: measures the surface under the position of the simulated motion stage
+        controller_->SetPositionSource([](double time, double& x, double& y){
+            std::vector<double> position;
+            if ( !LStepExpressFake::SimulatedPosition(time, position) ) return false;
+            x = position[0];
+            y = position[1];
+            return true;
+        });
+#endif
         setLaserHead(2);
         setAveraging(0);
         setSamplingRate(0);
@@ -45,6 +45,14 @@ public:
     void setLaserHead(int out);
     void setMeasurement(double value); //dummy method for testing
 
+    //data storage of the controller (one value per sampling period), for continuous scans
+    void initDataStorage();
+    void startDataStorage();
+    void stopDataStorage();
+    void getStoredData(std::vector<double>& values);
+    int samplingMode() const { return samplingMode_; }
+    int samplingPeriod();
+
 public slots:
 
     void setDeviceEnabled(bool enabled = true);
@@ -66,6 +74,7 @@ protected:
     void setDeviceState( State state );
     
     int laserHead_;
+    int samplingMode_;
 
     double value_;
     bool isInRange_;
@@ -0,0 +1,773 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <nqlogger.h>
+#include <ApplicationConfig.h>
+
+#include <AssemblySimulationDriver.h>
+#include <AssemblyUtilities.h>
+
+#include <QMetaObject>
+
+#include <cmath>
+#include <algorithm>
+
+AssemblySimulationDriver::AssemblySimulationDriver(const QString& outputdir_path, const unsigned int camera_ID, QObject* parent) :
+  QObject(parent),
+  step_(Step_Init),
+
+  motion_model_(nullptr),
+  motion_manager_(nullptr),
+  motion_thread_(nullptr),
+
+  camera_model_(nullptr),
+  camera_thread_(nullptr),
+  camera_(nullptr),
+
+  params_(nullptr),
+  zfocus_finder_(nullptr),
+  image_ctr_(nullptr),
+  thresholder_(nullptr),
+  finder_(nullptr),
+  finder_thread_(nullptr),
+  aligner_(nullptr),
+
+  init_timer_(nullptr),
+  timeout_timer_(nullptr),
+
+  camera_enabled_(false),
+  waiting_motion_(false),
+  completed_(false),
+  failures_(0),
+
+  pyramid_tolerance_XY_(0.),
+  pyramid_tolerance_angle_(0.),
+
+  pyramid_index_(0),
+  pyramid_exhaustive_done_(false),
+
+  pyramid_dX_(0.),
+  pyramid_dY_(0.),
+  pyramid_angle_(0.),
+
+  marker_X_(0.),
+  marker_Y_(0.),
+  marker_angle_(0.),
+
+  aligner_measured_angle_(0.)
+{
+  ApplicationConfig* config = ApplicationConfig::instance();
+  if(config == nullptr)
+  {
+    NQLog("AssemblySimulationDriver", NQLog::Fatal) << "initialization error"
+       << ": ApplicationConfig::instance() not initialized (null pointer), exiting constructor";
+
+    return;
+  }
+
+  /// Configuration
+  focal_Z_         = config->getValue<double>("AssemblyCameraSimulation_focalZ", 0.);
+
+  focus_offset_    = config->getValue<double>("AssemblySimulationDriver_focusOffset"   , 0.20);
+  focus_zrange_    = config->getValue<double>("AssemblySimulationDriver_focusZRange"   , 0.30);
+  focus_pointN_    = config->getValue<int>   ("AssemblySimulationDriver_focusPointN"   , 20);
+  focus_tolerance_ = config->getValue<double>("AssemblySimulationDriver_focusTolerance", 0.04);
+
+  shift_X_         = config->getValue<double>("AssemblySimulationDriver_shiftX"     , 0.20);
+  shift_Y_         = config->getValue<double>("AssemblySimulationDriver_shiftY"     , 0.10);
+  tolerance_XY_    = config->getValue<double>("AssemblySimulationDriver_toleranceXY", 0.01);
+
+  rotation_A_      = config->getValue<double>("AssemblySimulationDriver_rotationA"     , 1.00);
+  tolerance_angle_ = config->getValue<double>("AssemblySimulationDriver_toleranceAngle", 0.15);
+
+  // pyramid check: one key per pair, with three values (master image, template image, threshold)
+  const std::vector<std::string> pyramid_check_values = config->getValueVector("AssemblySimulationDriver_pyramidCheck");
+
+  for(unsigned int i=0; (i+2)<pyramid_check_values.size(); i += 3)
+  {
+    PyramidCheck check;
+    check.master_path   = QString::fromStdString(Config::CMSTkModLabBasePath+"/"+pyramid_check_values.at(i));
+    check.template_path = QString::fromStdString(Config::CMSTkModLabBasePath+"/"+pyramid_check_values.at(i+1));
+    check.threshold     = std::stoi(pyramid_check_values.at(i+2));
+
+    pyramid_checks_.emplace_back(check);
+  }
+
+  if((pyramid_check_values.size() % 3) != 0)
+  {
+    NQLog("AssemblySimulationDriver", NQLog::Warning) << "initialization"
+       << ": incomplete entry of \"AssemblySimulationDriver_pyramidCheck\" (master image, template image, threshold), ignored";
+  }
+
+  pyramid_tolerance_XY_    = config->getValue<double>("AssemblySimulationDriver_pyramidToleranceXY"   , 0.005);
+  pyramid_tolerance_angle_ = config->getValue<double>("AssemblySimulationDriver_pyramidToleranceAngle", 0.05);
+
+  aligner_enabled_      = bool(config->getValue<int>("AssemblySimulationDriver_aligner", 0));
+  aligner_target_angle_ = config->getValue<double>("AssemblySimulationDriver_alignerTargetAngle", 0.);
+  aligner_tolerance_    = config->getValue<double>("AssemblySimulationDriver_alignerTolerance"  , 0.05);
+
+  PatRecOne_configuration_ = this->PatRec_configuration_from_config(1);
+  PatRecTwo_configuration_ = this->PatRec_configuration_from_config(2);
+  /// -------------------
+
+  /// Parameters
+  params_ = AssemblyParameters::instance(config->getValue<std::string>("AssemblyParameters_file_path"));
+  /// -------------------
+
+  /// Motion
+  motion_model_ = new LStepExpressModel(
+    config->getValue<std::string>("LStepExpressDevice"),
+    config->getValue<std::string>("LStepExpressDevice_ver"),
+    config->getValue<std::string>("LStepExpressDevice_iver"),
+    config->getValue<int>("LStepExpressModel_updateInterval"      , 1000),
+    config->getValue<int>("LStepExpressModel_motionUpdateInterval", 1000)
+  );
+
+  motion_manager_ = new LStepExpressMotionManager(motion_model_);
+
+  motion_thread_  = new LStepExpressMotionThread(motion_manager_, this);
+  motion_thread_->start();
+  /// -------------------
+
+  /// Camera
+  camera_model_ = new AssemblyUEyeFakeModel(10);
+  camera_model_->updateInformation();
+
+  camera_thread_ = new AssemblyUEyeCameraThread(camera_model_, this);
+  camera_thread_->start();
+
+  camera_ = camera_model_->getCameraByID(camera_ID);
+
+  AssemblyUEyeFakeCamera* const fake_camera = qobject_cast<AssemblyUEyeFakeCamera*>(camera_);
+  if(fake_camera == nullptr)
+  {
+    NQLog("AssemblySimulationDriver", NQLog::Fatal) << "initialization error"
+       << ": null pointer to AssemblyUEyeFakeCamera object (camera_ID=" << camera_ID << "), exiting constructor";
+
+    return;
+  }
+
+  fake_camera->setMotionModel(motion_model_);
+
+  if(fake_camera->simulation() == nullptr)
+  {
+    NQLog("AssemblySimulationDriver", NQLog::Fatal) << "initialization error"
+       << ": camera simulation not enabled (hint: set \"AssemblyCameraSimulation_mosaic\" in the configuration), exiting constructor";
+
+    return;
+  }
+  /// -------------------
+
+  /// Vision
+  zfocus_finder_ = new AssemblyZFocusFinder(outputdir_path+"/AssemblyZFocusFinder", camera_, motion_manager_);
+
+  image_ctr_ = new AssemblyImageController(camera_, zfocus_finder_);
+
+  thresholder_ = new AssemblyThresholder();
+
+  finder_ = new AssemblyObjectFinderPatRec(thresholder_, outputdir_path+"/AssemblyObjectFinderPatRec", "rotations");
+
+  finder_thread_ = new AssemblyObjectFinderPatRecThread(finder_, this);
+  finder_thread_->start();
+
+  aligner_ = new AssemblyObjectAligner(motion_manager_);
+  /// -------------------
+
+  // camera
+  connect(this      , SIGNAL(images_ON())     , image_ctr_, SLOT(enable()));
+  connect(this      , SIGNAL(images_OFF())    , image_ctr_, SLOT(disable()));
+  connect(image_ctr_, SIGNAL(camera_enabled()), this      , SLOT(enable_camera()));
+
+  // auto-focusing: the driver provides the z-scan configuration (in place of the image view)
+  connect(zfocus_finder_, SIGNAL(focus_config_request()), this, SLOT(answer_focus_config_request()));
+  connect(this, SIGNAL(focus_config(double, int)), zfocus_finder_, SLOT(update_focus_config(double, int)));
+
+  connect(this      , SIGNAL(autofocused_image_request()) , image_ctr_, SLOT(acquire_autofocused_image()));
+  connect(image_ctr_, SIGNAL(autofocused_image_acquired()), this      , SLOT(check_focus()));
+
+  // images and PatRec
+  connect(this      , SIGNAL(image_request())        , image_ctr_, SLOT(acquire_image()));
+  connect(image_ctr_, SIGNAL(image_acquired(cv::Mat)), this      , SLOT(process_image(cv::Mat)));
+
+  connect(this   , SIGNAL(image_master(cv::Mat)), finder_, SLOT(update_image_master(cv::Mat)));
+  connect(finder_, SIGNAL(updated_image_master()), this  , SLOT(launch_PatRec()));
+
+  connect(this   , SIGNAL(PatRec_request(AssemblyObjectFinderPatRec::Configuration)), finder_, SLOT(launch_PatRec(AssemblyObjectFinderPatRec::Configuration)));
+  connect(finder_, SIGNAL(PatRec_results(double, double, double)), this, SLOT(process_PatRec_results(double, double, double)));
+  connect(finder_, SIGNAL(PatRec_exitcode(int)), this, SLOT(process_PatRec_exitcode(int)));
+
+  // motion
+  connect(motion_manager_, SIGNAL(motion_finished()), this, SLOT(process_motion_finished()));
+
+  // overall timeout of the sequence
+  timeout_timer_ = new QTimer(this);
+  timeout_timer_->setSingleShot(true);
+  timeout_timer_->setInterval(1000 * config->getValue<int>("AssemblySimulationDriver_timeout", 600));
+
+  connect(timeout_timer_, SIGNAL(timeout()), this, SLOT(timeout()));
+
+  init_timer_ = new QTimer(this);
+  init_timer_->setInterval(500);
+
+  connect(init_timer_, SIGNAL(timeout()), this, SLOT(check_devices()));
+
+  NQLog("AssemblySimulationDriver", NQLog::Debug) << "constructed";
+}
+
+AssemblySimulationDriver::~AssemblySimulationDriver()
+{
+  this->quit_thread(motion_thread_, "terminated LStepExpressMotionThread");
+  this->quit_thread(camera_thread_, "terminated AssemblyUEyeCameraThread");
+  this->quit_thread(finder_thread_, "terminated AssemblyObjectFinderPatRecThread");
+}
+
+int AssemblySimulationDriver::exit_code() const
+{
+  if(completed_ == false){ return std::max(1, failures_); }
+
+  return failures_;
+}
+
+AssemblyObjectFinderPatRec::Configuration AssemblySimulationDriver::PatRec_configuration_from_config(const int marker) const
+{
+  // same configuration keys as the alignment view
+  const std::string prefix = "AssemblyObjectAlignerView_PatRec"+std::to_string(marker)+"_";
+
+  ApplicationConfig* config = ApplicationConfig::instance();
+
+  AssemblyObjectFinderPatRec::Configuration conf;
+
+  const std::string fpath = config->getValue<std::string>(prefix+"template_fpath", "");
+  if(fpath != ""){ conf.template_filepath_ = QString::fromStdString(Config::CMSTkModLabBasePath+"/"+fpath); }
+
+  conf.thresholding_useThreshold_ = true;
+  conf.thresholding_threshold_    = config->getValue<int>(prefix+"threshold", 100);
+
+  conf.thresholding_useAdaptiveThreshold_ = false;
+  conf.thresholding_blocksize_            = -1;
+
+  conf.angles_prescan_vec_.clear();
+  conf.angles_prescan_vec_.emplace_back(config->getValue<double>(prefix+"angles_prescan", 0.));
+
+  conf.angles_finemax_  = config->getValue<double>(prefix+"angles_finemax" , 2.);
+  conf.angles_finestep_ = config->getValue<double>(prefix+"angles_finestep", 0.2);
+
+  return conf;
+}
+
+AssemblyObjectFinderPatRec::Configuration AssemblySimulationDriver::PatRec_configuration_pyramid_check(const bool exhaustive) const
+{
+  // same angular scan as the first marker of the alignment
+  AssemblyObjectFinderPatRec::Configuration conf = PatRecOne_configuration_;
+
+  const PyramidCheck& check = pyramid_checks_.at(pyramid_index_);
+
+  conf.template_filepath_      = check.template_path;
+  conf.thresholding_threshold_ = check.threshold;
+
+  // exhaustive search, or coarse-to-fine search as in the parameters
+  conf.pyramid_levels_ = exhaustive ? 0 : -1;
+
+  return conf;
+}
+
+void AssemblySimulationDriver::check(const bool passed, const QString& text)
+{
+  if(passed)
+  {
+    NQLog("AssemblySimulationDriver", NQLog::Message) << "PASSED: " << text;
+  }
+  else
+  {
+    NQLog("AssemblySimulationDriver", NQLog::Critical) << "FAILED: " << text;
+
+    ++failures_;
+  }
+
+  return;
+}
+
+void AssemblySimulationDriver::move_relative(const double dx, const double dy, const double dz, const double da)
+{
+  waiting_motion_ = true;
+
+  QMetaObject::invokeMethod(motion_manager_, "moveRelative", Qt::QueuedConnection,
+    Q_ARG(double, dx), Q_ARG(double, dy), Q_ARG(double, dz), Q_ARG(double, da));
+
+  return;
+}
+
+void AssemblySimulationDriver::move_absolute_Z(const double z)
+{
+  waiting_motion_ = true;
+
+  QMetaObject::invokeMethod(motion_manager_, "moveAbsolute", Qt::QueuedConnection,
+    Q_ARG(unsigned int, 2), Q_ARG(double, z));
+
+  return;
+}
+
+void AssemblySimulationDriver::start()
+{
+  if((finder_ == nullptr) || (aligner_ == nullptr))
+  {
+    NQLog("AssemblySimulationDriver", NQLog::Fatal) << "start"
+       << ": driver not initialized, stopping";
+
+    this->finish();
+
+    return;
+  }
+
+  if((shift_X_ == 0.) && (shift_Y_ == 0.))
+  {
+    NQLog("AssemblySimulationDriver", NQLog::Fatal) << "start"
+       << ": invalid configuration (null X/Y shift of the offset test), stopping";
+
+    this->finish();
+
+    return;
+  }
+
+  if((focus_offset_ == 0.) || (rotation_A_ == 0.))
+  {
+    NQLog("AssemblySimulationDriver", NQLog::Fatal) << "start"
+       << ": invalid configuration (null focus offset or rotation), stopping";
+
+    this->finish();
+
+    return;
+  }
+
+  timeout_timer_->start();
+
+  if(pyramid_checks_.empty())
+  {
+    this->enable_devices();
+  }
+  else
+  {
+    this->start_pyramid_test();
+  }
+
+  return;
+}
+
+void AssemblySimulationDriver::enable_devices()
+{
+  NQLog("AssemblySimulationDriver", NQLog::Message) << "enable_devices"
+     << ": enabling motion stage and camera";
+
+  QMetaObject::invokeMethod(motion_model_, "setDeviceEnabled", Qt::QueuedConnection, Q_ARG(bool, true));
+
+  emit images_ON();
+
+  init_timer_->start();
+
+  return;
+}
+
+void AssemblySimulationDriver::start_pyramid_test()
+{
+  step_ = Step_Pyramid;
+
+  if(pyramid_index_ >= pyramid_checks_.size())
+  {
+    this->enable_devices();
+
+    return;
+  }
+
+  const PyramidCheck& check = pyramid_checks_.at(pyramid_index_);
+
+  NQLog("AssemblySimulationDriver", NQLog::Message) << "start_pyramid_test"
+     << ": master image " << check.master_path.toStdString() << ", template image " << check.template_path.toStdString();
+
+  const cv::Mat img = assembly::cv_imread(check.master_path, CV_LOAD_IMAGE_GRAYSCALE);
+
+  if(img.empty())
+  {
+    this->check(false, "pyramid: failed to read master image "+check.master_path);
+
+    ++pyramid_index_;
+
+    this->start_pyramid_test();
+
+    return;
+  }
+
+  // the exhaustive search runs first, once the finder has the master image (launch_PatRec)
+  pyramid_exhaustive_done_ = false;
+
+  emit image_master(img);
+
+  return;
+}
+
+void AssemblySimulationDriver::process_pyramid_results(const double patrec_dX, const double patrec_dY, const double patrec_angle)
+{
+  if(pyramid_exhaustive_done_ == false)
+  {
+    pyramid_dX_    = patrec_dX;
+    pyramid_dY_    = patrec_dY;
+    pyramid_angle_ = patrec_angle;
+
+    pyramid_exhaustive_done_ = true;
+
+    // same master image, coarse-to-fine search
+    emit PatRec_request(this->PatRec_configuration_pyramid_check(false));
+
+    return;
+  }
+
+  const PyramidCheck& check = pyramid_checks_.at(pyramid_index_);
+
+  const double dX = patrec_dX    - pyramid_dX_;
+  const double dY = patrec_dY    - pyramid_dY_;
+  const double dA = patrec_angle - pyramid_angle_;
+
+  this->check((std::fabs(dX) <= pyramid_tolerance_XY_) && (std::fabs(dY) <= pyramid_tolerance_XY_) && (std::fabs(dA) <= pyramid_tolerance_angle_),
+    "pyramid: "+check.template_path+" in "+check.master_path+": coarse-to-fine search differs from exhaustive search by (dx="
+    +QString::number(dX)+", dy="+QString::number(dY)+", angle="+QString::number(dA)+") (tolerance="
+    +QString::number(pyramid_tolerance_XY_)+", "+QString::number(pyramid_tolerance_angle_)+")");
+
+  ++pyramid_index_;
+
+  this->start_pyramid_test();
+
+  return;
+}
+
+void AssemblySimulationDriver::check_devices()
+{
+  if(motion_model_->getDeviceState() != READY){ return; }
+
+  bool axes_ready(true);
+
+  for(unsigned int axis=0; axis<4; ++axis)
+  {
+    if(motion_model_->getAxisEnabled(axis) == false)
+    {
+      QMetaObject::invokeMethod(motion_model_, "setAxisEnabled", Qt::QueuedConnection, Q_ARG(unsigned int, axis), Q_ARG(bool, true));
+
+      axes_ready = false;
+    }
+    else if(motion_model_->getAxisStatusText(axis) != "@")
+    {
+      axes_ready = false;
+    }
+  }
+
+  if((axes_ready == false) || (camera_enabled_ == false)){ return; }
+
+  init_timer_->stop();
+
+  NQLog("AssemblySimulationDriver", NQLog::Message) << "check_devices"
+     << ": motion stage and camera ready";
+
+  this->start_focus_test();
+
+  return;
+}
+
+void AssemblySimulationDriver::enable_camera()
+{
+  camera_enabled_ = true;
+
+  return;
+}
+
+void AssemblySimulationDriver::start_focus_test()
+{
+  step_ = Step_Focus;
+
+  NQLog("AssemblySimulationDriver", NQLog::Message) << "start_focus_test"
+     << ": moving to Z=" << (focal_Z_ + focus_offset_) << " (focal plane at Z=" << focal_Z_ << ")";
+
+  this->move_absolute_Z(focal_Z_ + focus_offset_);
+
+  return;
+}
+
+void AssemblySimulationDriver::answer_focus_config_request()
+{
+  emit focus_config(focus_zrange_, focus_pointN_);
+
+  return;
+}
+
+void AssemblySimulationDriver::check_focus()
+{
+  if(step_ != Step_Focus){ return; }
+
+  const double z = motion_manager_->get_position_Z();
+
+  this->check(std::fabs(z - focal_Z_) <= focus_tolerance_,
+    "auto-focusing: Z="+QString::number(z)+" (focal plane at Z="+QString::number(focal_Z_)+", tolerance="+QString::number(focus_tolerance_)+")");
+
+  this->start_offset_test();
+
+  return;
+}
+
+void AssemblySimulationDriver::start_offset_test()
+{
+  step_ = Step_Offset1;
+
+  NQLog("AssemblySimulationDriver", NQLog::Message) << "start_offset_test"
+     << ": PatRec at the initial position";
+
+  emit image_request();
+
+  return;
+}
+
+void AssemblySimulationDriver::process_motion_finished()
+{
+  if(waiting_motion_ == false){ return; }
+
+  waiting_motion_ = false;
+
+  if(step_ == Step_Focus)
+  {
+    emit autofocused_image_request();
+  }
+  else if((step_ == Step_Offset2) || (step_ == Step_Angle))
+  {
+    emit image_request();
+  }
+
+  return;
+}
+
+void AssemblySimulationDriver::process_image(const cv::Mat& img)
+{
+  // images of the auto-focusing are not used for PatRec
+  if((step_ == Step_Offset1) || (step_ == Step_Offset2) || (step_ == Step_Angle) || (step_ == Step_Aligner))
+  {
+    emit image_master(img);
+  }
+
+  return;
+}
+
+void AssemblySimulationDriver::launch_PatRec()
+{
+  // during the alignment, PatRec is requested by the aligner
+  if((step_ == Step_Offset1) || (step_ == Step_Offset2) || (step_ == Step_Angle))
+  {
+    emit PatRec_request(PatRecOne_configuration_);
+  }
+  else if(step_ == Step_Pyramid)
+  {
+    emit PatRec_request(this->PatRec_configuration_pyramid_check(true));
+  }
+
+  return;
+}
+
+void AssemblySimulationDriver::process_PatRec_results(const double patrec_dX, const double patrec_dY, const double patrec_angle)
+{
+  if(step_ == Step_Pyramid)
+  {
+    this->process_pyramid_results(patrec_dX, patrec_dY, patrec_angle);
+
+    return;
+  }
+
+  if((step_ != Step_Offset1) && (step_ != Step_Offset2) && (step_ != Step_Angle)){ return; }
+
+  // position of the marker in the stage frame
+  const double marker_X = motion_manager_->get_position_X() + patrec_dX;
+  const double marker_Y = motion_manager_->get_position_Y() + patrec_dY;
+
+  NQLog("AssemblySimulationDriver", NQLog::Message) << "process_PatRec_results"
+     << ": marker at (x=" << marker_X << ", y=" << marker_Y << "), PatRec angle=" << patrec_angle;
+
+  if(step_ == Step_Offset1)
+  {
+    step_ = Step_Offset2;
+
+    this->move_relative(shift_X_, shift_Y_, 0., 0.);
+  }
+  else if(step_ == Step_Offset2)
+  {
+    const double dX = marker_X - marker_X_;
+    const double dY = marker_Y - marker_Y_;
+
+    this->check((std::fabs(dX) <= tolerance_XY_) && (std::fabs(dY) <= tolerance_XY_),
+      "offset: marker moved by (dx="+QString::number(dX)+", dy="+QString::number(dY)+") after a stage shift of ("
+      +QString::number(shift_X_)+", "+QString::number(shift_Y_)+") (tolerance="+QString::number(tolerance_XY_)+")");
+
+    step_ = Step_Angle;
+
+    this->move_relative(0., 0., 0., rotation_A_);
+  }
+  else if(step_ == Step_Angle)
+  {
+    const double dA = patrec_angle - marker_angle_;
+
+    this->check(std::fabs(dA - rotation_A_) <= tolerance_angle_,
+      "angle: PatRec angle changed by "+QString::number(dA)+" after a rotation of "+QString::number(rotation_A_)
+      +" (tolerance="+QString::number(tolerance_angle_)+")");
+
+    if(aligner_enabled_)
+    {
+      this->start_aligner_test();
+    }
+    else
+    {
+      completed_ = true;
+
+      this->finish();
+    }
+  }
+
+  marker_X_     = marker_X;
+  marker_Y_     = marker_Y;
+  marker_angle_ = patrec_angle;
+
+  return;
+}
+
+void AssemblySimulationDriver::process_PatRec_exitcode(const int exitcode)
+{
+  if(exitcode == 0){ return; }
+
+  if((step_ == Step_Pyramid) || (step_ == Step_Offset1) || (step_ == Step_Offset2) || (step_ == Step_Angle) || (step_ == Step_Aligner))
+  {
+    NQLog("AssemblySimulationDriver", NQLog::Critical) << "process_PatRec_exitcode"
+       << ": PatRec failed (exit code " << exitcode << "), stopping";
+
+    ++failures_;
+
+    this->finish();
+  }
+
+  return;
+}
+
+void AssemblySimulationDriver::start_aligner_test()
+{
+  step_ = Step_Aligner;
+
+  ApplicationConfig* config = ApplicationConfig::instance();
+
+  AssemblyObjectAligner::Configuration conf;
+
+  conf.object_deltaX = config->getValue<double>("AssemblyObjectAlignerView_PSS_deltaX", 0.);
+  conf.object_deltaY = config->getValue<double>("AssemblyObjectAlignerView_PSS_deltaY", 0.);
+
+  conf.target_angle = aligner_target_angle_;
+
+  conf.only_measure_angle    = false;
+  conf.complete_at_position1 = false;
+  conf.use_autofocusing      = false;
+
+  conf.angle_max_dontIter = config->getValue<double>("AssemblyObjectAlignerView_angle_max_dontIter", 0.50);
+  conf.angle_max_complete = config->getValue<double>("AssemblyObjectAlignerView_angle_max_complete", 0.01);
+
+  conf.PatRecOne_configuration = PatRecOne_configuration_;
+  conf.PatRecTwo_configuration = PatRecTwo_configuration_;
+
+  // same connections as the alignment of the GUI (images reach the finder through the driver)
+  connect(aligner_, SIGNAL(image_request())            , image_ctr_, SLOT(acquire_image()));
+  connect(aligner_, SIGNAL(autofocused_image_request()), image_ctr_, SLOT(acquire_autofocused_image()));
+
+  connect(finder_, SIGNAL(updated_image_master()), aligner_, SLOT(launch_next_alignment_step()));
+
+  connect(aligner_, SIGNAL(PatRec_request(AssemblyObjectFinderPatRec::Configuration)), finder_, SLOT(launch_PatRec(AssemblyObjectFinderPatRec::Configuration)));
+
+  connect(finder_, SIGNAL(PatRec_res_image_master_edited(cv::Mat)), aligner_, SLOT(redirect_image(cv::Mat)));
+  connect(finder_, SIGNAL(PatRec_results(double, double, double)) , aligner_, SLOT(run_alignment(double, double, double)));
+
+  connect(aligner_, SIGNAL(measured_angle(double)), this, SLOT(update_aligner_measured_angle(double)));
+  connect(aligner_, SIGNAL(execution_completed()) , this, SLOT(check_alignment()));
+
+  connect(aligner_, SIGNAL(configuration_updated()), aligner_, SLOT(execute()));
+
+  NQLog("AssemblySimulationDriver", NQLog::Message) << "start_aligner_test"
+     << ": aligning object to target angle " << aligner_target_angle_;
+
+  if(params_ != nullptr){ params_->update(); }
+
+  aligner_->update_configuration(conf);
+
+  return;
+}
+
+void AssemblySimulationDriver::update_aligner_measured_angle(const double angle)
+{
+  aligner_measured_angle_ = angle;
+
+  return;
+}
+
+void AssemblySimulationDriver::check_alignment()
+{
+  if(step_ != Step_Aligner){ return; }
+
+  this->check(std::fabs(aligner_measured_angle_ - aligner_target_angle_) <= aligner_tolerance_,
+    "alignment: final angle="+QString::number(aligner_measured_angle_)+" (target="+QString::number(aligner_target_angle_)
+    +", tolerance="+QString::number(aligner_tolerance_)+")");
+
+  completed_ = true;
+
+  this->finish();
+
+  return;
+}
+
+void AssemblySimulationDriver::timeout()
+{
+  NQLog("AssemblySimulationDriver", NQLog::Critical) << "timeout"
+     << ": sequence not completed in time (step=" << int(step_) << "), stopping";
+
+  this->finish();
+
+  return;
+}
+
+void AssemblySimulationDriver::finish()
+{
+  if(step_ == Step_Done){ return; }
+
+  step_ = Step_Done;
+
+  if(init_timer_    != nullptr){ init_timer_   ->stop(); }
+  if(timeout_timer_ != nullptr){ timeout_timer_->stop(); }
+
+  NQLog("AssemblySimulationDriver", NQLog::Message) << "finish"
+     << ": " << (completed_ ? "completed" : "NOT completed") << ", failed checks: " << failures_;
+
+  emit images_OFF();
+
+  emit finished();
+
+  return;
+}
+
+void AssemblySimulationDriver::quit_thread(QThread* thread, const QString& msg) const
+{
+  if(thread != nullptr)
+  {
+    thread->quit();
+
+    if(thread->wait(2000) == false)
+    {
+      thread->terminate();
+      thread->wait();
+    }
+
+    NQLog("AssemblySimulationDriver", NQLog::Spam) << "quit_thread: "+msg;
+  }
+}
@@ -0,0 +1,208 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ASSEMBLYSIMULATIONDRIVER_H
+#define ASSEMBLYSIMULATIONDRIVER_H
+
+#include <AssemblyUEyeFakeModel.h>
+#include <AssemblyUEyeFakeCamera.h>
+#include <AssemblyUEyeCameraThread.h>
+#include <AssemblyZFocusFinder.h>
+#include <AssemblyImageController.h>
+#include <AssemblyThresholder.h>
+#include <AssemblyObjectFinderPatRec.h>
+#include <AssemblyObjectFinderPatRecThread.h>
+#include <AssemblyObjectAligner.h>
+#include <AssemblyParameters.h>
+#include <LStepExpressModel.h>
+#include <LStepExpressMotionManager.h>
+#include <LStepExpressMotionThread.h>
+
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <QThread>
+
+#include <opencv2/opencv.hpp>
+
+#include <vector>
+
+//
+// Headless test of the vision routines against the simulated camera and the fake motion stage:
+//  - pyramid: (optional) PatRec with the coarse-to-fine search (parameter PatRecPyramidLevels) compared to the exhaustive search,
+//             on master/template image pairs from the disk (no camera, no motion)
+//  - focus  : auto-focusing (AssemblyZFocusFinder) from a defocused Z position, compared to the focal plane of the simulation
+//  - offset : PatRec positions of the marker before/after a known X/Y shift of the stage (marker position must not change)
+//  - angle  : PatRec angles of the marker before/after a known rotation of the A axis
+//  - aligner: (optional, needs both markers in the mosaic) full AssemblyObjectAligner run, final angle compared to the target
+//
+// The exit code of the application is the number of failed checks (or 1 if the sequence could not be completed).
+//
+class AssemblySimulationDriver : public QObject
+{
+ Q_OBJECT
+
+ public:
+
+  explicit AssemblySimulationDriver(const QString& outputdir_path, const unsigned int camera_ID=10, QObject* parent=nullptr);
+  virtual ~AssemblySimulationDriver();
+
+  int exit_code() const;
+
+ protected:
+
+  enum Step {
+    Step_Init,
+    Step_Pyramid,
+    Step_Focus,
+    Step_Offset1,
+    Step_Offset2,
+    Step_Angle,
+    Step_Aligner,
+    Step_Done
+  };
+
+  Step step_;
+
+  LStepExpressModel*         motion_model_;
+  LStepExpressMotionManager* motion_manager_;
+  LStepExpressMotionThread*  motion_thread_;
+
+  AssemblyUEyeFakeModel*     camera_model_;
+  AssemblyUEyeCameraThread*  camera_thread_;
+  AssemblyVUEyeCamera*       camera_;
+
+  AssemblyParameters*               params_;
+  AssemblyZFocusFinder*             zfocus_finder_;
+  AssemblyImageController*          image_ctr_;
+  AssemblyThresholder*              thresholder_;
+  AssemblyObjectFinderPatRec*       finder_;
+  AssemblyObjectFinderPatRecThread* finder_thread_;
+  AssemblyObjectAligner*            aligner_;
+
+  QTimer* init_timer_;
+  QTimer* timeout_timer_;
+
+  bool camera_enabled_;
+  bool waiting_motion_;
+  bool completed_;
+  int  failures_;
+
+  // configuration
+  double focal_Z_;
+  double focus_offset_;
+  double focus_zrange_;
+  int    focus_pointN_;
+  double focus_tolerance_;
+
+  double shift_X_;
+  double shift_Y_;
+  double tolerance_XY_;
+
+  double rotation_A_;
+  double tolerance_angle_;
+
+  // master/template pairs of the pyramid check: paths of master and template images, threshold of the master image
+  struct PyramidCheck {
+    QString master_path;
+    QString template_path;
+    int     threshold;
+  };
+
+  std::vector<PyramidCheck> pyramid_checks_;
+  double pyramid_tolerance_XY_;
+  double pyramid_tolerance_angle_;
+
+  unsigned int pyramid_index_;
+  bool         pyramid_exhaustive_done_;
+
+  // results of the exhaustive search of the current pyramid check
+  double pyramid_dX_;
+  double pyramid_dY_;
+  double pyramid_angle_;
+
+  bool   aligner_enabled_;
+  double aligner_target_angle_;
+  double aligner_tolerance_;
+
+  AssemblyObjectFinderPatRec::Configuration PatRecOne_configuration_;
+  AssemblyObjectFinderPatRec::Configuration PatRecTwo_configuration_;
+
+  // results of the previous PatRec (stage frame)
+  double marker_X_;
+  double marker_Y_;
+  double marker_angle_;
+
+  double aligner_measured_angle_;
+
+  AssemblyObjectFinderPatRec::Configuration PatRec_configuration_from_config(const int) const;
+  AssemblyObjectFinderPatRec::Configuration PatRec_configuration_pyramid_check(const bool) const;
+
+  void check(const bool, const QString&);
+
+  void move_relative(const double, const double, const double, const double);
+  void move_absolute_Z(const double);
+
+  void enable_devices();
+
+  void start_pyramid_test();
+  void process_pyramid_results(const double, const double, const double);
+
+  void start_focus_test();
+  void start_offset_test();
+  void start_aligner_test();
+
+  void finish();
+
+  void quit_thread(QThread*, const QString&) const;
+
+ public slots:
+
+  void start();
+
+ protected slots:
+
+  void check_devices();
+  void enable_camera();
+
+  void answer_focus_config_request();
+  void check_focus();
+
+  void process_motion_finished();
+  void process_image(const cv::Mat&);
+  void launch_PatRec();
+  void process_PatRec_results(const double, const double, const double);
+  void process_PatRec_exitcode(const int);
+
+  void update_aligner_measured_angle(const double);
+  void check_alignment();
+
+  void timeout();
+
+ signals:
+
+  void images_ON();
+  void images_OFF();
+
+  void image_request();
+  void autofocused_image_request();
+
+  void focus_config(const double, const int);
+
+  void image_master(const cv::Mat&);
+
+  void PatRec_request(const AssemblyObjectFinderPatRec::Configuration&);
+
+  void finished();
+};
+
+#endif // ASSEMBLYSIMULATIONDRIVER_H
@@ -0,0 +1,89 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <nqlogger.h>
+#include <ApplicationConfig.h>
+#include <DeviceState.h>
+
+#include <AssemblySimulationDriver.h>
+#include <AssemblyUtilities.h>
+#include <AssemblyArtifactWriter.h>
+
+#include <string>
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QFile>
+#include <QTimer>
+
+#include <opencv2/opencv.hpp>
+
+int main(int argc, char** argv)
+{
+    // Qt application (no GUI) -------
+    qRegisterMetaType<State>("State");
+    qRegisterMetaType<cv::Mat>("cv::Mat");
+
+    QCoreApplication app(argc, argv);
+
+    // log output -----------
+    ApplicationConfig* config = ApplicationConfig::instance(std::string(Config::CMSTkModLabBasePath)+"/assembly/assembly.cfg");
+
+    const NQLog::LogLevel nqloglevel_stdout  = ((NQLog::LogLevel) config->getValue<int>("LogLevel_stdout" , 2));
+    const NQLog::LogLevel nqloglevel_logfile = ((NQLog::LogLevel) config->getValue<int>("LogLevel_logfile", 2));
+
+    NQLogger::instance()->addActiveModule("*");
+    NQLogger::instance()->addDestiniation(stdout, nqloglevel_stdout);
+
+    const QString timestamp = QDateTime::currentDateTime().toString("yyyyMMdd_hhmmss");
+
+    const QString outputdir_path = assembly::QtCacheDirectory()+"/simulation_"+timestamp;
+
+    if(assembly::DirectoryExists(outputdir_path))
+    {
+      NQLog("assemblySimulation", NQLog::Fatal) << "target output directory already exists: " << outputdir_path;
+
+      return 1;
+    }
+    else
+    {
+      assembly::QDir_mkpath(outputdir_path);
+    }
+
+    const QString logfile_path = outputdir_path+"/assemblySimulation.log";
+
+    NQLog("assemblySimulation", NQLog::Message) << "VERSION  : " << APPLICATIONVERSIONSTR;
+    NQLog("assemblySimulation", NQLog::Message) << "SESSION  : " << timestamp;
+    NQLog("assemblySimulation", NQLog::Message) << "LOG FILE : " << logfile_path;
+
+    QFile* logfile = new QFile(logfile_path);
+    if(logfile->open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+    {
+      NQLogger::instance()->addDestiniation(logfile, nqloglevel_logfile);
+    }
+    // ----------------------
+
+    AssemblySimulationDriver driver(outputdir_path);
+
+    // quit once the sequence is over (queued: the event loop must be running)
+    QObject::connect(&driver, SIGNAL(finished()), &app, SLOT(quit()), Qt::QueuedConnection);
+
+    QTimer::singleShot(0, &driver, SLOT(start()));
+
+    app.exec();
+
+    // write pending debug artifacts while their sources still exist
+    AssemblyArtifactWriter::instance()->flush();
+
+    return driver.exit_code();
+    // ----------------------
+}
@@ -29,9 +29,7 @@ ArduinoPresModel::ArduinoPresModel(const char* port,
     PressureA_(0),
     PressureB_(0)
 {
-  timer_ = new QTimer(this);
-  timer_->setInterval(updateInterval_ * 1000);
-  connect( timer_, SIGNAL(timeout()), this, SLOT(updateInformation()) );
+  pollHandle_ = DevicePollScheduler::instance()->registerDevice(this, "updateInformation", updateInterval_);
 
   setDeviceEnabled(true);
   setControlsEnabled(true);
@@ -78,9 +76,9 @@ void ArduinoPresModel::setDeviceState( State state ) {
 
     // No need to run the timer if the pump is not ready
     if ( state_ == READY )
-      timer_->start();
+      DevicePollScheduler::instance()->start(pollHandle_);
     else
-      timer_->stop();
+      DevicePollScheduler::instance()->stop(pollHandle_);
 
     emit deviceStateChanged(state);
   }
@@ -99,6 +97,8 @@ void ArduinoPresModel::updateInformation() {
     std::cout << " running in dedicated DAQ thread" << std::endl;
   }
 
+  if (isPollReportDue()) emit message(getPollStatisticsText());
+
   if ( state_ == READY ) {
 
     float newGetPressureA = controller_->GetPressureA();
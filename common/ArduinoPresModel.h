@@ -16,7 +16,6 @@
 #include <cmath>
 
 #include <QString>
-#include <QTimer>
 
 #include "DeviceState.h"
 #include "DeviceParameter.h"
@@ -62,7 +61,6 @@ public:
 
   /// Time interval between cache refreshes; in seconds.
   const double updateInterval_;
-  QTimer* timer_;
 
   void setDeviceState( State state );
 
@@ -17,9 +17,7 @@ CoriFlowModel::CoriFlowModel(const char* port,
     Temp_(0),
     Measure_(0)
 {
-  timer_ = new QTimer(this);
-  timer_->setInterval(updateInterval_ * 1000);
-  connect( timer_, SIGNAL(timeout()), this, SLOT(updateInformation()) );
+  pollHandle_ = DevicePollScheduler::instance()->registerDevice(this, "updateInformation", updateInterval_);
 
   setDeviceEnabled(true);
   setControlsEnabled(true);
@@ -67,9 +65,9 @@ void CoriFlowModel::setDeviceState( State state ) {
 
     // No need to run the timer if the flow meter is not ready
     if ( state_ == READY )
-      timer_->start();
+      DevicePollScheduler::instance()->start(pollHandle_);
     else
-      timer_->stop();
+      DevicePollScheduler::instance()->stop(pollHandle_);
 
     emit deviceStateChanged(state);
   }
@@ -88,6 +86,8 @@ void CoriFlowModel::updateInformation() {
     std::cout << " running in dedicated DAQ thread" << std::endl;
   }
 
+  if (isPollReportDue()) emit message(getPollStatisticsText());
+
   if ( state_ == READY ) {
 
     float newGetTemp = controller_->getTemp();
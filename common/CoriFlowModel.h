@@ -4,7 +4,6 @@
 #include <cmath>
 
 #include <QString>
-#include <QTimer>
 
 #include "DeviceState.h"
 #include "DeviceParameter.h"
@@ -53,7 +52,6 @@ public:
 
   /// Time interval between cache refreshes; in seconds.
   const double updateInterval_;
-  QTimer* timer_;
 
   void setDeviceState( State state );
 
@@ -0,0 +1,58 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include <nqlogger.h>
+
+#include "devices/Serial/DeviceCommandStatistics.h"
+
+#include "DeviceCommandReport.h"
+
+/*!
+  Writes one DeviceCommand element per command that was called at least
+  once. Latencies are given in ms.
+ */
+void DeviceCommandReport::writeDAQStatus(QXmlStreamWriter& xml, const QDateTime& time)
+{
+    std::vector<const DeviceCommandCounter*> counters = DeviceCommandStatistics::instance()->Counters();
+
+    for (std::vector<const DeviceCommandCounter*>::const_iterator it = counters.begin();
+         it != counters.end();
+         ++it) {
+        const DeviceCommandCounter* counter = *it;
+        if (counter->Calls()==0) continue;
+
+        xml.writeStartElement("DeviceCommand");
+        xml.writeAttribute("time", time.toString(Qt::ISODate));
+        xml.writeAttribute("name", QString::fromStdString(counter->Name()));
+        xml.writeAttribute("calls", QString::number(counter->Calls()));
+        xml.writeAttribute("mean", QString::number(counter->MeanLatency(), 'f', 3));
+        xml.writeAttribute("p50", QString::number(counter->Percentile(0.50), 'f', 3));
+        xml.writeAttribute("p99", QString::number(counter->Percentile(0.99), 'f', 3));
+        xml.writeAttribute("max", QString::number(counter->MaxLatency(), 'f', 3));
+        xml.writeEndElement();
+    }
+}
+
+bool DeviceCommandReport::dumpOnSignal(int signal, const QString& filename)
+{
+    if (!DeviceCommandStatistics::instance()->DumpOnSignal(signal, filename.toStdString())) {
+        NQLogWarning("DeviceCommandReport") << "could not install latency dump on signal " << signal;
+        return false;
+    }
+
+    NQLog("DeviceCommandReport") << "device command latencies are written to "
+                                 << filename << " on signal " << signal;
+
+    return true;
+}
@@ -0,0 +1,40 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEVICECOMMANDREPORT_H
+#define DEVICECOMMANDREPORT_H
+
+#include <QString>
+#include <QDateTime>
+#include <QXmlStreamWriter>
+
+/** @addtogroup common
+ *  @{
+ */
+
+/**
+  \brief Qt side of the device command statistics.
+  Writes the call counts and round trip latencies collected by
+  DeviceCommandStatistics into DAQ status messages and installs the
+  dump of the statistics on a signal.
+  */
+class DeviceCommandReport
+{
+public:
+
+  static void writeDAQStatus(QXmlStreamWriter& xml, const QDateTime& time);
+  static bool dumpOnSignal(int signal, const QString& filename);
+};
+
+/** @} */
+
+#endif // DEVICECOMMANDREPORT_H
@@ -0,0 +1,261 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+
+#include <QCoreApplication>
+#include <QMutexLocker>
+
+#include <nqlogger.h>
+
+#include "DevicePollScheduler.h"
+
+// weight of the latest poll in the running averages
+static const double DevicePollAverageWeight = 0.1;
+
+DevicePollWorker::DevicePollWorker(QObject* device, const char* member, double interval)
+  : QObject(),
+    device_(device),
+    member_(member),
+    interval_(interval * 1000.),
+    deadline_(0),
+    lastStart_(-1)
+{
+  statistics_.name = QString(device->metaObject()->className()) + "::" + member;
+  statistics_.interval = interval;
+
+  timer_ = new QTimer(this);
+  timer_->setSingleShot(true);
+  timer_->setTimerType(Qt::PreciseTimer);
+  connect(timer_, SIGNAL(timeout()), this, SLOT(poll()));
+
+  clock_.start();
+}
+
+DevicePollStatistics DevicePollWorker::statistics() const
+{
+  QMutexLocker locker(&mutex_);
+  return statistics_;
+}
+
+double DevicePollWorker::elapsed() const
+{
+  return clock_.nsecsElapsed() / 1.e6;
+}
+
+void DevicePollWorker::start()
+{
+  if (timer_->isActive()) return;
+
+  lastStart_ = -1;
+  deadline_ = elapsed() + interval_;
+  timer_->start(qRound(interval_));
+}
+
+void DevicePollWorker::stop()
+{
+  timer_->stop();
+}
+
+void DevicePollWorker::setInterval(double interval)
+{
+  {
+    QMutexLocker locker(&mutex_);
+    statistics_.interval = interval;
+  }
+
+  interval_ = interval * 1000.;
+
+  if (timer_->isActive()) {
+    timer_->stop();
+    start();
+  }
+}
+
+void DevicePollWorker::poll()
+{
+  if (device_.isNull()) return;
+
+  const double start = elapsed();
+  const double lateness = std::max(0., start - deadline_);
+
+  QMetaObject::invokeMethod(device_, member_.constData(), Qt::DirectConnection);
+
+  const double end = elapsed();
+
+  // advance to the next deadline; drop the ones the device already missed
+  quint64 skipped = 0;
+  deadline_ += interval_;
+  if (end > deadline_) {
+    skipped = static_cast<quint64>(std::floor((end - deadline_) / interval_)) + 1;
+    deadline_ += skipped * interval_;
+  }
+
+  {
+    QMutexLocker locker(&mutex_);
+
+    const double w = (statistics_.polls==0) ? 1. : DevicePollAverageWeight;
+
+    if (lastStart_>=0 && start>lastStart_) {
+      const double rate = 1000. / (start - lastStart_);
+      if (statistics_.achievedRate==0) {
+        statistics_.achievedRate = rate;
+      } else {
+        statistics_.achievedRate += DevicePollAverageWeight * (rate - statistics_.achievedRate);
+      }
+    }
+
+    statistics_.jitter = std::sqrt((1.-w) * statistics_.jitter * statistics_.jitter
+                                   + w * lateness * lateness);
+    statistics_.maxJitter = std::max(statistics_.maxJitter, lateness);
+    statistics_.duration += w * ((end - start) - statistics_.duration);
+    statistics_.polls++;
+    statistics_.skipped += skipped;
+  }
+
+  if (skipped>0) {
+    NQLog("DevicePollScheduler", NQLog::Debug) << statistics_.name
+                                               << " lagging, dropped " << skipped << " poll(s)";
+  }
+
+  lastStart_ = start;
+
+  timer_->start(std::max(0, qRound(deadline_ - end)));
+}
+
+DevicePollScheduler* DevicePollScheduler::instance_ = NULL;
+
+DevicePollScheduler::DevicePollScheduler()
+  : QObject()
+{
+  if (QCoreApplication::instance()) {
+    connect(QCoreApplication::instance(), SIGNAL(aboutToQuit()),
+            this, SLOT(shutdown()));
+  }
+}
+
+DevicePollScheduler* DevicePollScheduler::instance()
+{
+  if (instance_==NULL) {
+    instance_ = new DevicePollScheduler();
+  }
+
+  return instance_;
+}
+
+/**
+  Moves \a device into its own I/O thread (created on first registration of
+  the device) and sets up a deadline based poll of the slot \a member. The
+  poll is not active until start() is called.
+  \return handle to be used for subsequent calls.
+  */
+int DevicePollScheduler::registerDevice(QObject* device, const char* member, double interval)
+{
+  QMutexLocker locker(&mutex_);
+
+  QThread* thread;
+  std::map<QObject*,QThread*>::iterator it = threads_.find(device);
+  if (it==threads_.end()) {
+    thread = new QThread(this);
+    thread->setObjectName(device->metaObject()->className());
+    thread->start();
+
+    device->moveToThread(thread);
+
+    threads_[device] = thread;
+  } else {
+    thread = it->second;
+  }
+
+  DevicePollWorker* worker = new DevicePollWorker(device, member, interval);
+  worker->moveToThread(thread);
+  connect(thread, SIGNAL(finished()), worker, SLOT(deleteLater()));
+
+  workers_.push_back(worker);
+
+  NQLog("DevicePollScheduler", NQLog::Message) << "registered "
+                                               << worker->statistics().name
+                                               << " every " << interval << " s";
+
+  return workers_.size() - 1;
+}
+
+DevicePollWorker* DevicePollScheduler::worker(int handle) const
+{
+  QMutexLocker locker(&mutex_);
+
+  if (handle<0 || handle>=(int)workers_.size()) return NULL;
+
+  return workers_[handle];
+}
+
+void DevicePollScheduler::start(int handle)
+{
+  DevicePollWorker* w = worker(handle);
+  if (w) QMetaObject::invokeMethod(w, "start", Qt::QueuedConnection);
+}
+
+void DevicePollScheduler::stop(int handle)
+{
+  DevicePollWorker* w = worker(handle);
+  if (w) QMetaObject::invokeMethod(w, "stop", Qt::QueuedConnection);
+}
+
+void DevicePollScheduler::setInterval(int handle, double interval)
+{
+  DevicePollWorker* w = worker(handle);
+  if (w) QMetaObject::invokeMethod(w, "setInterval", Qt::QueuedConnection,
+                                   Q_ARG(double, interval));
+}
+
+DevicePollStatistics DevicePollScheduler::statistics(int handle) const
+{
+  DevicePollWorker* w = worker(handle);
+  if (w) return w->statistics();
+
+  return DevicePollStatistics();
+}
+
+std::vector<DevicePollStatistics> DevicePollScheduler::statistics() const
+{
+  QMutexLocker locker(&mutex_);
+
+  std::vector<DevicePollStatistics> result;
+  for (std::vector<DevicePollWorker*>::const_iterator it = workers_.begin();
+       it!=workers_.end();
+       ++it) {
+    result.push_back((*it)->statistics());
+  }
+
+  return result;
+}
+
+/// Stops all polls and terminates the I/O threads.
+void DevicePollScheduler::shutdown()
+{
+  QMutexLocker locker(&mutex_);
+
+  for (std::vector<DevicePollWorker*>::iterator it = workers_.begin();
+       it!=workers_.end();
+       ++it) {
+    QMetaObject::invokeMethod(*it, "stop", Qt::QueuedConnection);
+  }
+  workers_.clear();
+
+  for (std::map<QObject*,QThread*>::iterator it = threads_.begin();
+       it!=threads_.end();
+       ++it) {
+    it->second->quit();
+    it->second->wait();
+  }
+  threads_.clear();
+}
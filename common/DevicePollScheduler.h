@@ -0,0 +1,139 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEVICEPOLLSCHEDULER_H
+#define DEVICEPOLLSCHEDULER_H
+
+#include <map>
+#include <vector>
+
+#include <QObject>
+#include <QString>
+#include <QByteArray>
+#include <QPointer>
+#include <QThread>
+#include <QTimer>
+#include <QMutex>
+#include <QElapsedTimer>
+
+/** @addtogroup common
+ *  @{
+ */
+
+/**
+  Poll timing recorded by the DevicePollScheduler for one periodic update.
+  */
+struct DevicePollStatistics
+{
+  DevicePollStatistics()
+    : interval(0), achievedRate(0), jitter(0), maxJitter(0),
+      duration(0), polls(0), skipped(0) { }
+
+  QString name;          ///< class name and slot of the polled device
+  double interval;       ///< requested poll interval; units s
+  double achievedRate;   ///< achieved poll rate (running average); units Hz
+  double jitter;         ///< rms delay of the poll start w.r.t. its deadline; units ms
+  double maxJitter;      ///< maximum delay of the poll start w.r.t. its deadline; units ms
+  double duration;       ///< time spent in the poll (running average); units ms
+  quint64 polls;         ///< number of executed polls
+  quint64 skipped;       ///< number of deadlines dropped because the device lagged
+};
+
+/**
+  \brief Deadline based periodic update of a single device.
+  The worker lives in the I/O thread of its device and calls the poll slot
+  of the device directly. Deadlines are spaced by the poll interval from the
+  time the polling was started. If a poll overruns one or more deadlines
+  they are dropped instead of being queued.
+  */
+class DevicePollWorker : public QObject
+{
+  Q_OBJECT
+
+public:
+
+  DevicePollWorker(QObject* device, const char* member, double interval);
+
+  DevicePollStatistics statistics() const;
+
+public slots:
+
+  void start();
+  void stop();
+  void setInterval(double interval);
+
+protected slots:
+
+  void poll();
+
+protected:
+
+  double elapsed() const;
+
+  QPointer<QObject> device_;
+  QByteArray member_;
+
+  QTimer* timer_;
+  QElapsedTimer clock_;
+
+  double interval_;     ///< units ms
+  double deadline_;     ///< units ms since clock_ start
+  double lastStart_;    ///< units ms since clock_ start
+
+  mutable QMutex mutex_;
+  DevicePollStatistics statistics_;
+};
+
+/**
+  \brief Central scheduler for the periodic read-out of all device models.
+  Every registered device gets its own I/O thread, so that a slow device
+  no longer delays the read-out of the others. The device object is moved
+  into this thread; all its slots, including the ones invoked through
+  queued signals from the GUI, are therefore serialized with the polls.
+  */
+class DevicePollScheduler : public QObject
+{
+  Q_OBJECT
+
+public:
+
+  static DevicePollScheduler* instance();
+
+  /// Registers the slot \a member of \a device to be called every \a interval seconds.
+  int registerDevice(QObject* device, const char* member, double interval);
+
+  void start(int handle);
+  void stop(int handle);
+  void setInterval(int handle, double interval);
+
+  DevicePollStatistics statistics(int handle) const;
+  std::vector<DevicePollStatistics> statistics() const;
+
+public slots:
+
+  void shutdown();
+
+protected:
+
+  DevicePollScheduler();
+  static DevicePollScheduler* instance_;
+
+  DevicePollWorker* worker(int handle) const;
+
+  mutable QMutex mutex_;
+  std::map<QObject*,QThread*> threads_;
+  std::vector<DevicePollWorker*> workers_;
+};
+
+/** @} */
+
+#endif // DEVICEPOLLSCHEDULER_H
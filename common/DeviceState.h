@@ -13,9 +13,15 @@
 #ifndef DEVICESTATE_H
 #define DEVICESTATE_H
 
-#include <QObject>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
+#include <QObject>
+#include <QString>
+
+#include "DevicePollScheduler.h"
+
 /** @addtogroup common
  *  @{
  */
@@ -42,7 +48,7 @@ enum State {
 template <class Controller> class AbstractDeviceModel
 {
  public:
-    explicit AbstractDeviceModel() : controller_(NULL), state_(OFF) { }
+    explicit AbstractDeviceModel() : controller_(NULL), pollHandle_(-1), state_(OFF) { }
   virtual ~AbstractDeviceModel() { 
       destroyController(); }
 
@@ -50,6 +56,32 @@ template <class Controller> class AbstractDeviceModel
   const State& getDeviceState() const { 
       return state_; }
 
+  /// Returns the achieved poll rate and jitter of the periodic device update.
+  DevicePollStatistics getPollStatistics() const {
+      return DevicePollScheduler::instance()->statistics(pollHandle_); }
+
+  /// Poll rate and jitter in the form used in the status output of the models.
+  QString getPollStatisticsText() const {
+      const DevicePollStatistics s = getPollStatistics();
+      return QString("%1: %2 Hz achieved (%3 Hz requested), jitter %4 ms rms / %5 ms max, %6 ms per poll, %7 of %8 polls skipped")
+          .arg(s.name)
+          .arg(s.achievedRate, 0, 'f', 3)
+          .arg(s.interval>0 ? 1./s.interval : 0., 0, 'f', 3)
+          .arg(s.jitter, 0, 'f', 1)
+          .arg(s.maxJitter, 0, 'f', 1)
+          .arg(s.duration, 0, 'f', 1)
+          .arg(s.skipped)
+          .arg(s.polls + s.skipped); }
+
+  /// True on one poll every PollReportInterval seconds, when the models report their poll statistics.
+  bool isPollReportDue() const {
+      const DevicePollStatistics s = getPollStatistics();
+      if (s.polls==0 || s.interval<=0) return false;
+      const quint64 n = std::max<quint64>(1, std::llround(PollReportInterval / s.interval));
+      return (s.polls % n)==0; }
+
+  static constexpr double PollReportInterval = 900.; ///< units s
+
   /// Attempts to enable/disable the (communication with) the device.
   virtual void setDeviceEnabled( bool enabled ) {
      // To be enabled and off
@@ -70,6 +102,8 @@ protected:
 
   Controller* controller_; ///< Current device controller or NULL if not active.
 
+  int pollHandle_; ///< Handle of the periodic update in the DevicePollScheduler or -1.
+
   /// Renews the current Controller* for the given port.
   virtual void renewController( const QString& port ) {
     if ( controller_ ) delete controller_;
@@ -32,9 +32,7 @@ HamegModel::HamegModel(const char* port,
     voltage2Parameter_(0, 30.000, 2),
     current2Parameter_(0, 0.310, 3)
 {
-    timer_ = new QTimer(this);
-    timer_->setInterval(updateInterval_ * 1000);
-    connect( timer_, SIGNAL(timeout()), this, SLOT(updateInformation()) );
+    pollHandle_ = DevicePollScheduler::instance()->registerDevice(this, "updateInformation", updateInterval_);
 
     setDeviceEnabled(true);
 }
@@ -70,9 +68,9 @@ void HamegModel::setDeviceState( State state ) {
 
     // No need to run the timer if the chiller is not ready
     if ( state_ == READY )
-      timer_->start();
+      DevicePollScheduler::instance()->start(pollHandle_);
     else
-      timer_->stop();
+      DevicePollScheduler::instance()->stop(pollHandle_);
 
     emit deviceStateChanged(state);
   }
@@ -92,6 +90,8 @@ void HamegModel::updateInformation() {
       NQLog("HamegModel", NQLog::Debug) << " running in dedicated DAQ thread";
   }
 
+  if (isPollReportDue()) emit message(getPollStatisticsText());
+
   if ( state_ == READY ) {
 
 	  unsigned int newStatus = controller_->GetStatus();
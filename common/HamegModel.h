@@ -16,7 +16,6 @@
 #include <cmath>
 
 #include <QString>
-#include <QTimer>
 
 #include "DeviceState.h"
 #include "DeviceParameter.h"
@@ -79,7 +78,6 @@ protected:
 
   /// Time interval between cache refreshes; in seconds.
   const double updateInterval_;
-  QTimer* timer_;
   bool forceRemoteMode_;
 
   void setDeviceState( State state );
@@ -106,20 +106,23 @@ HamegChannelWidget::HamegChannelWidget(HamegModel* model, int channel,
 void HamegChannelWidget::modeChanged(int button)
 {
   if (button==0) {
-    model_->setVoltage(channel_, voltageSpinner_->value());
+    voltageSpinnerChanged(voltageSpinner_->value());
   } else {
-    model_->setCurrent(channel_, currentSpinner_->value());
+    currentSpinnerChanged(currentSpinner_->value());
   }
 }
 
+// the model lives in its I/O thread: settings are queued to it
 void HamegChannelWidget::voltageSpinnerChanged(double voltage)
 {
-  model_->setVoltage(channel_, voltage);
+  QMetaObject::invokeMethod(model_, "setVoltage", Qt::QueuedConnection,
+                            Q_ARG(int, channel_), Q_ARG(float, voltage));
 }
 
 void HamegChannelWidget::currentSpinnerChanged(double voltage)
 {
-  model_->setCurrent(channel_, voltage);
+  QMetaObject::invokeMethod(model_, "setCurrent", Qt::QueuedConnection,
+                            Q_ARG(int, channel_), Q_ARG(float, voltage));
 }
 
 void HamegChannelWidget::updateDeviceState(State /*state*/)
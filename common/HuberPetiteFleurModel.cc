@@ -32,9 +32,7 @@ HuberPetiteFleurModel::HuberPetiteFleurModel(const char* port,
     workingTemperature_(-40, 40, 2),
     bathTemperature_(0)
 {
-    timer_ = new QTimer(this);
-    timer_->setInterval(updateInterval_ * 1000);
-    connect( timer_, SIGNAL(timeout()), this, SLOT(updateInformation()) );
+    pollHandle_ = DevicePollScheduler::instance()->registerDevice(this, "updateInformation", updateInterval_);
 
     setDeviceEnabled(true);
     setControlsEnabled(true);
@@ -85,9 +83,9 @@ void HuberPetiteFleurModel::setDeviceState( State state ) {
 
     // No need to run the timer if the chiller is not ready
     if ( state_ == READY )
-      timer_->start();
+      DevicePollScheduler::instance()->start(pollHandle_);
     else
-      timer_->stop();
+      DevicePollScheduler::instance()->stop(pollHandle_);
 
     emit deviceStateChanged(state);
   }
@@ -107,6 +105,8 @@ void HuberPetiteFleurModel::updateInformation() {
         NQLog("HuberPetiteFleurModel", NQLog::Debug) << " running in dedicated DAQ thread";
     }
 
+    if (isPollReportDue()) emit message(getPollStatisticsText());
+
     if ( state_ == READY ) {
 
         float newBathTemp = controller_->GetBathTemperature();
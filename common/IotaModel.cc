@@ -20,9 +20,7 @@ IotaModel::IotaModel(const char* port,
     actFlow_(0),
     setFlow_(0, 200, 1)
     {
-  timer_ = new QTimer(this);
-  timer_->setInterval(updateInterval_ * 1000);
-  connect( timer_, SIGNAL(timeout()), this, SLOT(updateInformation()) );
+  pollHandle_ = DevicePollScheduler::instance()->registerDevice(this, "updateInformation", updateInterval_);
 
   setDeviceEnabled(true);
   setControlsEnabled(true);
@@ -82,9 +80,9 @@ void IotaModel::setDeviceState( State state ) {
 
     // No need to run the timer if the pump is not ready
     if ( state_ == READY )
-      timer_->start();
+      DevicePollScheduler::instance()->start(pollHandle_);
     else
-      timer_->stop();
+      DevicePollScheduler::instance()->stop(pollHandle_);
 
     emit deviceStateChanged(state);
   }
@@ -103,6 +101,8 @@ void IotaModel::updateInformation() {
     std::cout << " running in dedicated DAQ thread" << std::endl;
   }
 
+  if (isPollReportDue()) emit message(getPollStatisticsText());
+
   if ( state_ == READY ) {
 
     float newGetSetFlow = controller_->GetSetFlow();
@@ -45,9 +45,7 @@ JulaboModel::JulaboModel(float updateInterval, QObject * /*parent*/)
     power_(0)
 {
 
-  timer_ = new QTimer(this);
-  timer_->setInterval(updateInterval_ * 1000);
-  connect(timer_, SIGNAL(timeout()), this, SLOT(updateInformation()));
+  pollHandle_ = DevicePollScheduler::instance()->registerDevice(this, "updateInformation", updateInterval_);
 
   setDeviceEnabled(true);
 }
@@ -121,9 +119,9 @@ void JulaboModel::setDeviceState( State state ) {
 
     // No need to run the timer if the chiller is not ready
     if ( state_ == READY )
-      timer_->start();
+      DevicePollScheduler::instance()->start(pollHandle_);
     else
-      timer_->stop();
+      DevicePollScheduler::instance()->stop(pollHandle_);
 
     emit deviceStateChanged(state);
   }
@@ -138,6 +136,8 @@ void JulaboModel::updateInformation() {
 
   NQLog("HuberPetiteFleurModel", NQLog::Debug) << "updateInformation()";
 
+  if (isPollReportDue()) emit message(getPollStatisticsText());
+
   // NOTE Julabo status messages in manual §12.4
   if ( state_ == READY ) {
     float newBathTemp = controller_->GetBathTemperature();
@@ -16,7 +16,6 @@
 #include <cmath>
 
 #include <QString>
-#include <QTimer>
 
 #include "DeviceState.h"
 #include "DeviceParameter.h"
@@ -86,7 +85,6 @@ protected:
 
   /// Time interval between cache refreshes; in seconds.
   const float updateInterval_;
-  QTimer* timer_;
 
   // cached config information
 //  State state_;
@@ -29,12 +29,14 @@ KeithleyModel::KeithleyModel(const char* port,
     sensorStates_(SENSOR_COUNT, OFF),
     temperatures_(SENSOR_COUNT, 0.0),
     gradients_(SENSOR_COUNT, 0.0),
-    temperatureBuffer_(temperatures_),
-    absoluteTime_(std::chrono::system_clock::now())
+    timeBuffer_(4),
+    temperatureBuffer_(4),
+    absoluteTime_(std::chrono::system_clock::now()),
+    continuousScan_(false),
+    continuousScanRequested_(false),
+    continuousInterval_(1.0)
 {
-  timer_ = new QTimer(this);
-  timer_->setInterval(updateInterval_ * 1000);
-  connect( timer_, SIGNAL(timeout()), this, SLOT(scanTemperatures()) );
+  pollHandle_ = DevicePollScheduler::instance()->registerDevice(this, "scanTemperatures", updateInterval_);
 
   setDeviceEnabled(false);
   setControlsEnabled(true);
@@ -66,6 +68,10 @@ void KeithleyModel::initialize() {
         controller_->AddActiveChannels( constructString(i) );
     }
 
+    // ... and restart a requested continuous scan.
+    if (continuousScanRequested_)
+      setContinuousScan(true, continuousInterval_);
+
     // scanTemperatures();
 
   }
@@ -84,12 +90,22 @@ void KeithleyModel::setDeviceEnabled(bool enabled) {
 
 void KeithleyModel::setDeviceState(State state) {
   if (state_ != state) {
+
+    // The instrument scan does not survive a reconnect; fall back to polled
+    // single scans until initialize() restarts it.
+    if (continuousScan_ && state != READY) {
+      if (state_ == READY && controller_) controller_->StopContinuousScan();
+      continuousScan_ = false;
+      DevicePollScheduler::instance()->setInterval(pollHandle_, updateInterval_);
+      emit continuousScanChanged(false);
+    }
+
     state_ = state;
 
     if ( state == READY )
-      timer_->start();
+      DevicePollScheduler::instance()->start(pollHandle_);
     else
-      timer_->stop();
+      DevicePollScheduler::instance()->stop(pollHandle_);
 
     emit deviceStateChanged(state);
   }
@@ -133,7 +149,40 @@ void KeithleyModel::setUpdateInterval(int updateInterval) {
 
   if (updateInterval<10) return;
   updateInterval_ = updateInterval;
-  timer_->setInterval(updateInterval_ * 1000);
+  if (!continuousScan_)
+    DevicePollScheduler::instance()->setInterval(pollHandle_, updateInterval_);
+}
+
+/**
+  Switches between polled single scans and continuous scans, in which the
+  instrument scans all active channels every \a interval seconds into its
+  trace buffer. In continuous mode the model only drains the readings that
+  arrived since the last poll. The request is remembered while the
+  multimeter is off and applied when it becomes ready.
+  */
+void KeithleyModel::setContinuousScan(bool enabled, double interval)
+{
+  continuousScanRequested_ = enabled;
+  if (enabled && interval > 0.) continuousInterval_ = interval;
+
+  if (state_ != READY) return;
+
+  if (enabled) {
+    continuousScan_ = controller_->StartContinuousScan(continuousInterval_);
+    continuousStart_ = std::chrono::system_clock::now();
+    continuousGradientTime_ = continuousStart_;
+  } else {
+    controller_->StopContinuousScan();
+    continuousScan_ = false;
+  }
+
+  NQLog("KeithleyModel", NQLog::Message) << "continuous scan "
+                                         << (continuousScan_ ? "enabled" : "disabled");
+
+  DevicePollScheduler::instance()->setInterval(pollHandle_,
+                                               continuousScan_ ? continuousInterval_ : updateInterval_);
+
+  emit continuousScanChanged(continuousScan_);
 }
 
 /// Returns the current cached state of the requested sensor.
@@ -153,6 +202,13 @@ double KeithleyModel::getTemperature(unsigned int sensor) const
   */
 void KeithleyModel::scanTemperatures()
 {
+  if (isPollReportDue()) emit message(getPollStatisticsText());
+
+  if (continuousScan_) {
+    readBufferedTemperatures();
+    return;
+  }
+
   reading_t reading = controller_->Scan();
 
   // Good scan, cache the retrieved temperatures
@@ -164,41 +220,11 @@ void KeithleyModel::scanTemperatures()
          it < reading.end();
          ++it) {
 
-      unsigned int sensor = it->first;
-      double temperature = it->second;
-
-      // Check for changes
-      if ( temperatures_.at(sensor) != temperature ) {
-        temperatures_[sensor] = temperature;
-        emit temperatureChanged(sensor, temperature);
-      }
-
-      // Check for OVERFLOW readings, i.e. disconnected or malfunction
-      // TODO log OVERFLOW readings
-      NQLog("KeithleyModel", NQLog::Debug) << sensor << " : " << temperature;
-      // if ( temperature == std::numeric_limits<float>::infinity() )
-      //   setSensorEnabled(sensor, false);
-
+      updateTemperature(it->first, it->second);
     }
 
-    timeBuffer_.push_back(absoluteTime_);
-    temperatureBuffer_.push_back(temperatures_);
+    updateGradients();
 
-    std::chrono::time_point<std::chrono::system_clock> lastTime = timeBuffer_.get();
-    const std::vector<double> &lastTemperatures = temperatureBuffer_.get();
-    std::chrono::duration<double> dt = absoluteTime_ - lastTime;
-    
-    if (dt.count()>=30) {
-      for (unsigned int i=0;i<SENSOR_COUNT;++i) {
-	if (sensorStates_[i] != READY) continue;
-	
-	double gradient = (temperatures_[i] - lastTemperatures[i]) / (dt.count()/60.);
-	if ( gradients_.at(i) != gradient ) {
-	  gradients_[i] = gradient;
-	  emit temperatureGradientChanged(i, gradient);
-	}
-      }
-    }
   } else {
     
     NQLog("KeithleyModel", NQLog::Message) << " scanTemperatures failed";
@@ -234,6 +260,84 @@ void KeithleyModel::scanTemperatures()
   absoluteTime_ = std::chrono::system_clock::now();
 }
 
+/// Caches a single temperature reading and emits a signal upon changes.
+void KeithleyModel::updateTemperature(unsigned int sensor, double temperature)
+{
+  // Check for changes
+  if ( temperatures_.at(sensor) != temperature ) {
+    temperatures_[sensor] = temperature;
+    emit temperatureChanged(sensor, temperature);
+  }
+
+  // Check for OVERFLOW readings, i.e. disconnected or malfunction
+  // TODO log OVERFLOW readings
+  NQLog("KeithleyModel", NQLog::Debug) << sensor << " : " << temperature;
+  // if ( temperature == std::numeric_limits<float>::infinity() )
+  //   setSensorEnabled(sensor, false);
+}
+
+/// Updates the temperature gradients from the history of complete scans.
+void KeithleyModel::updateGradients()
+{
+  timeBuffer_.push(absoluteTime_);
+  temperatureBuffer_.push(temperatures_);
+
+  // oldest scan in the history
+  std::chrono::time_point<std::chrono::system_clock> lastTime = timeBuffer_.last();
+  const std::vector<double> &lastTemperatures = temperatureBuffer_.last();
+  std::chrono::duration<double> dt = absoluteTime_ - lastTime;
+
+  if (dt.count()>=30) {
+    for (unsigned int i=0;i<SENSOR_COUNT;++i) {
+      if (sensorStates_[i] != READY) continue;
+
+      double gradient = (temperatures_[i] - lastTemperatures[i]) / (dt.count()/60.);
+      if ( gradients_.at(i) != gradient ) {
+        gradients_[i] = gradient;
+        emit temperatureGradientChanged(i, gradient);
+      }
+    }
+  }
+}
+
+/**
+  Drains the readings of the continuous scan that arrived since the last
+  call. The last active channel of a scan completes it; its instrument time
+  stamp is used for the gradient calculation, which is updated at most once
+  per update interval to keep the gradient history comparable to the one of
+  single scans.
+  */
+void KeithleyModel::readBufferedTemperatures()
+{
+  bufferedReadings_.clear();
+  controller_->ReadBufferedScan(bufferedReadings_);
+
+  NQLog("KeithleyModel", NQLog::Debug) << bufferedReadings_.size() << " buffered temperature readings";
+
+  const channels_t activeChannels = controller_->GetActiveChannels();
+  if (activeChannels.empty()) return;
+
+  for (bufferedreadings_t::const_iterator it = bufferedReadings_.begin();
+       it != bufferedReadings_.end();
+       ++it) {
+
+    if (it->channel >= SENSOR_COUNT) continue;
+
+    updateTemperature(it->channel, it->value);
+
+    if (it->channel == activeChannels.back()) {
+      absoluteTime_ = continuousStart_
+          + std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::duration<double>(it->timestamp));
+
+      std::chrono::duration<double> dt = absoluteTime_ - continuousGradientTime_;
+      if (dt.count() >= updateInterval_) {
+        continuousGradientTime_ = absoluteTime_;
+        updateGradients();
+      }
+    }
+  }
+}
+
 /// Creates a string from sensor number.
 std::string KeithleyModel::constructString(unsigned int sensor)
 {
@@ -19,7 +19,6 @@
 
 #include <QObject>
 #include <QString>
-#include <QTimer>
 
 #include "DeviceState.h"
 #include "Ringbuffer.h"
@@ -55,6 +54,8 @@ public:
   const State& getSensorState( unsigned int sensor ) const;
   double getTemperature( unsigned int sensor ) const;
   int getUpdateInterval() const { return updateInterval_; }
+  bool isContinuousScan() const { return continuousScan_; }
+  double getContinuousInterval() const { return continuousInterval_; }
 
   void statusMessage(const QString & text);
 
@@ -64,6 +65,7 @@ public slots:
   void setSensorEnabled( unsigned int sensor, bool enabled );
   void setControlsEnabled(bool enabled);
   void setUpdateInterval(int updateInterval);
+  void setContinuousScan(bool enabled, double interval = 1.0);
 
 protected:
 
@@ -74,18 +76,29 @@ protected:
   /// Time interval between cache refreshes; in seconds.
   QString port_;
   int updateInterval_;
-  QTimer* timer_;
 
   // cached config information
   std::vector<State> sensorStates_;
   std::vector<double> temperatures_;
   std::vector<double> gradients_;
 
-  Ringbuffer<std::chrono::time_point<std::chrono::system_clock>,4> timeBuffer_;
-  Ringbuffer<std::vector<double>,4> temperatureBuffer_;
+  Ringbuffer<std::chrono::time_point<std::chrono::system_clock> > timeBuffer_;
+  Ringbuffer<std::vector<double> > temperatureBuffer_;
   std::chrono::time_point<std::chrono::system_clock> absoluteTime_;
 
+  /// Instrument driven scans drained from the trace buffer instead of polled single scans.
+  bool continuousScan_;
+  /// Continuous scan requested; (re)started whenever the multimeter becomes ready.
+  bool continuousScanRequested_;
+  double continuousInterval_;
+  std::chrono::time_point<std::chrono::system_clock> continuousStart_;
+  std::chrono::time_point<std::chrono::system_clock> continuousGradientTime_;
+  bufferedreadings_t bufferedReadings_;
+
   void setDeviceState( State state );
+  void updateTemperature( unsigned int sensor, double temperature );
+  void updateGradients();
+  void readBufferedTemperatures();
   void setSensorState( unsigned int sensor, State state );
 
   static std::string constructString( unsigned int sensor );
@@ -101,6 +114,7 @@ signals:
   void temperatureGradientChanged(unsigned int sensor, double gradient);
   void message(const QString & text);
   void controlStateChanged(bool);
+  void continuousScanChanged(bool);
 };
 
 /** @} */
@@ -59,6 +59,10 @@ KeithleyWidget::KeithleyWidget(KeithleyModel* model,
   updateIntervalBox_ = new KeithleyUpdateIntervalBox(model_, this);
   layout->addWidget(updateIntervalBox_);
 
+  continuousScanCheckBox_ = new QCheckBox("Continuous Scan", this);
+  continuousScanCheckBox_->setChecked(model_->isContinuousScan());
+  layout->addWidget(continuousScanCheckBox_);
+
   sensorControlWidget_= new QWidget(this);
   layout->addWidget(sensorControlWidget_);
 
@@ -86,6 +90,16 @@ KeithleyWidget::KeithleyWidget(KeithleyModel* model,
           this,
           SLOT(controlStateChanged(bool)));
 
+  connect(continuousScanCheckBox_,
+          SIGNAL(toggled(bool)),
+          this,
+          SLOT(continuousScanToggled(bool)));
+
+  connect(model_,
+          SIGNAL(continuousScanChanged(bool)),
+          this,
+          SLOT(continuousScanChanged(bool)));
+
   keithleyStateChanged(model_->getDeviceState());
 }
 
@@ -94,6 +108,7 @@ void KeithleyWidget::keithleyStateChanged(State newState) {
 
   keithleyCheckBox_->setChecked(newState == READY || newState == INITIALIZING);
   updateIntervalBox_->setEnabled(newState == READY);
+  continuousScanCheckBox_->setEnabled(newState == READY);
   sensorControlWidget_->setEnabled(newState == READY);
 }
 
@@ -106,10 +121,27 @@ void KeithleyWidget::controlStateChanged(bool enabled) {
   } else {
     keithleyCheckBox_->setEnabled(false);
     updateIntervalBox_->setEnabled(false);
+    continuousScanCheckBox_->setEnabled(false);
     sensorControlWidget_->setEnabled(false);
   }
 }
 
+/// Requests the continuous scan; the model lives in its own polling thread.
+void KeithleyWidget::continuousScanToggled(bool enabled) {
+
+  QMetaObject::invokeMethod(model_, "setContinuousScan", Qt::QueuedConnection,
+                            Q_ARG(bool, enabled),
+                            Q_ARG(double, model_->getContinuousInterval()));
+}
+
+/// Updates the GUI when the continuous scan was started or stopped.
+void KeithleyWidget::continuousScanChanged(bool enabled) {
+
+  continuousScanCheckBox_->blockSignals(true);
+  continuousScanCheckBox_->setChecked(enabled);
+  continuousScanCheckBox_->blockSignals(false);
+}
+
 /* TemperatureWidget implementation */
 
 const unsigned int KeithleyTemperatureWidget::LCD_SIZE = 5;
@@ -250,5 +282,7 @@ void KeithleyTemperatureWidget::sensorTemperatureGradientChanged(unsigned int se
 /// Updates the model according to the GUI change.
 void KeithleyTemperatureWidget::enabledCheckBoxToggled(bool enabled)
 {
-  model_->setSensorEnabled(sensor_, enabled);
+  // the model lives in its I/O thread
+  QMetaObject::invokeMethod(model_, "setSensorEnabled", Qt::QueuedConnection,
+                            Q_ARG(unsigned int, sensor_), Q_ARG(bool, enabled));
 }
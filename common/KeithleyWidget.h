@@ -62,11 +62,16 @@ protected:
   KeithleyModel* model_;
   QCheckBox* keithleyCheckBox_;
   KeithleyUpdateIntervalBox* updateIntervalBox_;
+  QCheckBox* continuousScanCheckBox_;
   QWidget* sensorControlWidget_;
 
 public slots:
   void keithleyStateChanged(State newState);
   void controlStateChanged(bool);
+  void continuousScanChanged(bool enabled);
+
+protected slots:
+  void continuousScanToggled(bool enabled);
 };
 
 class KeithleyTemperatureWidget : public QWidget
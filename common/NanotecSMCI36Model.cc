@@ -56,13 +56,8 @@ NanotecSMCI36Model::NanotecSMCI36Model(const char* port,
   ioPolarityMask_ = 0xffffffff;
   io_ = 0xffffffff;
 
-  timer1_ = new QTimer(this);
-  timer1_->setInterval(updateInterval1_ * 1000);
-  connect( timer1_, SIGNAL(timeout()), this, SLOT(updateInformation1()) );
-
-  timer2_ = new QTimer(this);
-  timer2_->setInterval(updateInterval2_ * 1000);
-  connect( timer2_, SIGNAL(timeout()), this, SLOT(updateInformation2()) );
+  pollHandle_ = DevicePollScheduler::instance()->registerDevice(this, "updateInformation1", updateInterval1_);
+  pollHandle2_ = DevicePollScheduler::instance()->registerDevice(this, "updateInformation2", updateInterval2_);
 
   setDeviceEnabled(true);
 
@@ -696,11 +691,11 @@ void NanotecSMCI36Model::setDeviceState( State state )
 
     // No need to run the timer if the chiller is not ready
     if ( state_ == READY ) {
-      timer1_->start();
-      timer2_->start();
+      DevicePollScheduler::instance()->start(pollHandle_);
+      DevicePollScheduler::instance()->start(pollHandle2_);
     } else {
-      timer1_->stop();
-      timer2_->stop();
+      DevicePollScheduler::instance()->stop(pollHandle_);
+      DevicePollScheduler::instance()->stop(pollHandle2_);
     }
 
     emit deviceStateChanged(state);
@@ -717,6 +712,8 @@ void NanotecSMCI36Model::updateInformation1()
     // NQLog("NanotecSMCI36Model", NQLog::Debug) << " running in dedicated DAQ thread";
   }
 
+  if (isPollReportDue()) NQLog("NanotecSMCI36Model", NQLog::Message) << getPollStatisticsText().toStdString();
+
   if ( state_ == READY ) {
 
     unsigned int status = controller_->GetStatus();
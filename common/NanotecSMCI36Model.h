@@ -18,7 +18,6 @@
 #include <array>
 
 #include <QString>
-#include <QTimer>
 
 #include "DeviceState.h"
 #include "DeviceParameter.h"
@@ -119,8 +118,8 @@ public:
   void setStandStillPhaseCurrent(int current);
 
   void setStepMode(int mode);
-  void setRampMode(int mode);
-  void setErrorCorrectionMode(int mode);
+  Q_INVOKABLE void setRampMode(int mode);
+  Q_INVOKABLE void setErrorCorrectionMode(int mode);
   void setMaxEncoderDeviation(int steps);
   void setEncoderDirection(bool direction);
 
@@ -171,9 +170,8 @@ protected:
 
   /// Time interval between cache refreshes; in seconds.
   const double updateInterval1_;
-  QTimer* timer1_;
   const double updateInterval2_;
-  QTimer* timer2_;
+  int pollHandle2_; ///< Handle of the slow periodic update; pollHandle_ is the fast one.
 
   void setDeviceState( State state );
 
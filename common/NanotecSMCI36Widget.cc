@@ -58,7 +58,7 @@ void NanotecSMCI36ErrorCorrectionModeWidget::indexChanged(int index)
   int userValue = itemData(index).toInt();
 
   if (model_->getErrorCorrectionMode()!=userValue) {
-    model_->setErrorCorrectionMode(userValue);
+    QMetaObject::invokeMethod(model_, "setErrorCorrectionMode", Qt::QueuedConnection, Q_ARG(int, userValue));
   }
 }
 
@@ -140,7 +140,7 @@ void NanotecSMCI36RampModeWidget::indexChanged(int index)
   int userValue = itemData(index).toInt();
 
   if (model_->getRampMode()!=userValue) {
-    model_->setRampMode(userValue);
+    QMetaObject::invokeMethod(model_, "setRampMode", Qt::QueuedConnection, Q_ARG(int, userValue));
   }
 }
 
@@ -226,7 +226,7 @@ void NanotecSMCI36PositioningModeWidget::indexChanged(int index)
   int userValue = itemData(index).toInt();
 
   if (model_->getPositioningMode()!=userValue) {
-    model_->setPositioningMode(userValue);
+    QMetaObject::invokeMethod(model_, "setPositioningMode", Qt::QueuedConnection, Q_ARG(int, userValue));
   }
 }
 
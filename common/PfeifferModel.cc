@@ -31,9 +31,7 @@ PfeifferModel::PfeifferModel(const char* port,
     pressure2_(1013),
     updateInterval_(updateInterval)
 {
-    timer_ = new QTimer(this);
-    timer_->setInterval(updateInterval_ * 1000);
-    connect(timer_, SIGNAL(timeout()), this, SLOT(updateInformation()));
+    pollHandle_ = DevicePollScheduler::instance()->registerDevice(this, "updateInformation", updateInterval_);
 
     setDeviceEnabled(true);
 }
@@ -89,9 +87,9 @@ void PfeifferModel::setDeviceState( State state ) {
 
     // No need to run the timer if the chiller is not ready
     if ( state_ == READY )
-      timer_->start();
+      DevicePollScheduler::instance()->start(pollHandle_);
     else
-      timer_->stop();
+      DevicePollScheduler::instance()->stop(pollHandle_);
 
     emit deviceStateChanged(state);
   }
@@ -111,6 +109,8 @@ void PfeifferModel::updateInformation() {
         NQLog("PfeifferModel", NQLog::Debug) << " running in dedicated DAQ thread";
     }
 
+    if (isPollReportDue()) emit message(getPollStatisticsText());
+
     if ( state_ == READY ) {
 
         VPfeifferTPG262::reading_t reading1, reading2;
@@ -13,43 +13,291 @@
 #ifndef RINGBUFFER_H
 #define RINGBUFFER_H
 
-#include <iostream>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <atomic>
+#include <chrono>
+#include <vector>
 
 /** @addtogroup common
  *  @{
  */
 
-template <class T,size_t N=5> class Ringbuffer
+/// Smallest power of two not smaller than n (at least 1).
+inline size_t ringbufferCapacity(size_t n)
+{
+    size_t capacity = 1;
+    while (capacity<n) capacity <<= 1;
+    return capacity;
+}
+
+/**
+  \brief Circular buffer of the most recent values.
+  Holds exactly &lt;capacity&gt; values; only the backing store is rounded
+  up to a power of two, so indexing is a mask instead of a modulo. Once
+  the buffer is full every push overwrites the oldest value. at(0) and first() are the newest value, last() is the
+  oldest one. Not thread safe; see SPSCRingbuffer for handing values
+  between threads.
+  */
+template <class T> class Ringbuffer
 {
 public:
 
     typedef T      value_type;
 
-    explicit Ringbuffer(const T& value = value_type()) {
-        size_ = N;
-        buffer_ = new T[size_];
-        for (size_t i=0;i<size_;++i) buffer_[i] = value;
-        currentWritePointer_ = 0;
-        currentReadPointer_ = size_ - 1;
+    explicit Ringbuffer(size_t capacity)
+        : capacity_(capacity>0 ? capacity : 1),
+          buffer_(ringbufferCapacity(capacity_)),
+          mask_(buffer_.size() - 1),
+          count_(0) {
     }
 
-    virtual void push_back(const T& value) {
-        buffer_[currentWritePointer_] = value;
-        currentWritePointer_++;
-        if (currentWritePointer_>=size_) currentWritePointer_ = 0;
-        currentReadPointer_ = currentWritePointer_;
+    size_t capacity() const { return capacity_; }
+    size_t size() const { return count_<capacity_ ? count_ : capacity_; }
+    bool empty() const { return count_==0; }
+    bool full() const { return count_>=capacity_; }
+
+    /// number of values pushed since construction or the last clear()
+    uint64_t count() const { return count_; }
+
+    void clear() { count_ = 0; }
+
+    void push(const T& value) {
+        buffer_[count_ & mask_] = value;
+        count_++;
     }
 
-    virtual const T& get() {
-        return buffer_[currentReadPointer_];
+    /// i-th most recent value; indices beyond size() return the oldest value
+    const T& at(size_t i) const {
+        if (i>=size()) i = size() - 1;
+        return buffer_[(count_ - 1 - i) & mask_];
     }
 
+    const T& first() const { return at(0); }
+    const T& last() const { return at(size() - 1); }
+
 protected:
 
-    size_t size_;
-    size_t currentWritePointer_;
-    size_t currentReadPointer_;
-    T* buffer_;
+    size_t capacity_;
+    std::vector<T> buffer_;
+    size_t mask_;
+    uint64_t count_;
+};
+
+/**
+  \brief Lock-free single producer / single consumer queue.
+  One thread may push() and one other thread may pop() without any
+  locking. Head and tail live on separate cache lines, so producer and
+  consumer do not invalidate each other's cache line on every access.
+  push() fails when the queue is full instead of overwriting values that
+  the consumer might be reading.
+  */
+template <class T> class SPSCRingbuffer
+{
+public:
+
+    typedef T      value_type;
+
+    explicit SPSCRingbuffer(size_t capacity)
+        : buffer_(ringbufferCapacity(capacity)),
+          mask_(buffer_.size() - 1),
+          head_(0),
+          tail_(0) {
+    }
+
+    size_t capacity() const { return buffer_.size(); }
+
+    /// only exact if neither producer nor consumer are active
+    size_t size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size()==0; }
+
+    /// producer side
+    bool push(const T& value) {
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire)>=buffer_.size()) return false;
+        buffer_[head & mask_] = value;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// consumer side
+    bool pop(T& value) {
+        const uint64_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail==head_.load(std::memory_order_acquire)) return false;
+        value = buffer_[tail & mask_];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+protected:
+
+    std::vector<T> buffer_;
+    size_t mask_;
+
+    alignas(64) std::atomic<uint64_t> head_;
+    alignas(64) std::atomic<uint64_t> tail_;
+};
+
+/**
+  \brief Running sums for mean, variance and the least squares slope.
+  Values are added and removed in O(1). x is expected relative to a
+  reference close to the data to keep the sums well conditioned.
+  */
+class RunningStatistics
+{
+public:
+
+    RunningStatistics() { clear(); }
+
+    void clear() {
+        n_ = 0;
+        sx_ = sy_ = sxx_ = syy_ = sxy_ = 0.;
+    }
+
+    void add(double x, double y) {
+        n_++;
+        sx_ += x; sy_ += y;
+        sxx_ += x*x; syy_ += y*y; sxy_ += x*y;
+    }
+
+    void remove(double x, double y) {
+        n_--;
+        sx_ -= x; sy_ -= y;
+        sxx_ -= x*x; syy_ -= y*y; sxy_ -= x*y;
+    }
+
+    size_t count() const { return n_; }
+
+    double mean() const { return n_>0 ? sy_/n_ : 0.; }
+
+    /// sample variance of y
+    double variance() const {
+        if (n_<2) return 0.;
+        double v = (syy_ - sy_*sy_/n_) / (n_ - 1);
+        return v>0. ? v : 0.;
+    }
+
+    /// slope of the least squares line y = a + b*x
+    double slope() const {
+        if (n_<2) return 0.;
+        double d = n_*sxx_ - sx_*sx_;
+        if (d<=0.) return 0.;
+        return (n_*sxy_ - sx_*sy_) / d;
+    }
+
+protected:
+
+    size_t n_;
+    double sx_, sy_, sxx_, syy_, sxy_;
+};
+
+/**
+  \brief Circular buffer of time stamped values with windowed statistics.
+  Time stamps are stored as integer milliseconds since the epoch. Mean,
+  variance and the linear regression slope (per second) over all values
+  in the buffer are updated in O(1) on every push; the running sums are
+  rebuilt from the buffer once per capacity pushes to keep rounding errors
+  from accumulating.
+  */
+template <class T> class TimedRingbuffer
+{
+public:
+
+    typedef T      value_type;
+
+    explicit TimedRingbuffer(size_t capacity)
+        : times_(capacity),
+          values_(capacity),
+          reference_(0) {
+    }
+
+    static int64_t currentTime() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>
+            (std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    size_t capacity() const { return values_.capacity(); }
+    size_t size() const { return values_.size(); }
+    bool empty() const { return values_.empty(); }
+    bool full() const { return values_.full(); }
+
+    void clear() {
+        times_.clear();
+        values_.clear();
+        statistics_.clear();
+    }
+
+    void push(const T& value) {
+        push(currentTime(), value);
+    }
+
+    /// &lt;time&gt; in ms since the epoch
+    void push(int64_t time, const T& value) {
+        if (values_.empty()) reference_ = time;
+        if (values_.full()) statistics_.remove(seconds(times_.last()), values_.last());
+
+        times_.push(time);
+        values_.push(value);
+
+        if ((values_.count() % values_.capacity())==0) {
+            rebuild();
+        } else {
+            statistics_.add(seconds(time), value);
+        }
+    }
+
+    int64_t timeAt(size_t i) const { return times_.at(i); }
+    const T& at(size_t i) const { return values_.at(i); }
+
+    int64_t firstTime() const { return times_.first(); }
+    int64_t lastTime() const { return times_.last(); }
+    const T& first() const { return values_.first(); }
+    const T& last() const { return values_.last(); }
+
+    /// time between the oldest and the newest value; units s
+    double deltaTime() const { return deltaTime(size() - 1, 0); }
+
+    /// time from the i-th to the j-th most recent value; units s
+    double deltaTime(size_t i, size_t j) const {
+        return 1e-3 * (timeAt(j) - timeAt(i));
+    }
+
+    T delta() const { return delta(size() - 1, 0); }
+    T delta(size_t i, size_t j) const { return at(j) - at(i); }
+
+    /// two point gradient between the oldest and the newest value; units 1/s
+    double gradient() const { return gradient(size() - 1, 0); }
+
+    double gradient(size_t i, size_t j) const {
+        double dt = deltaTime(i, j);
+        if (dt==0.) return 0.;
+        return delta(i, j) / dt;
+    }
+
+    double mean() const { return statistics_.mean(); }
+    double variance() const { return statistics_.variance(); }
+    double rms() const { return std::sqrt(variance()); }
+
+    /// linear regression slope over all values in the buffer; units 1/s
+    double slope() const { return statistics_.slope(); }
+
+protected:
+
+    double seconds(int64_t time) const { return 1e-3 * (time - reference_); }
+
+    void rebuild() {
+        statistics_.clear();
+        reference_ = times_.last();
+        for (size_t i=0;i<size();++i) statistics_.add(seconds(times_.at(i)), values_.at(i));
+    }
+
+    Ringbuffer<int64_t> times_;
+    Ringbuffer<T> values_;
+    int64_t reference_;
+    RunningStatistics statistics_;
 };
 
 /** @} */
@@ -29,19 +29,19 @@ ScriptableHuberPetiteFleur::ScriptableHuberPetiteFleur(HuberPetiteFleurModel* hu
 void ScriptableHuberPetiteFleur::switchCirculatorOn() {
 
   QMutexLocker locker(&mutex_);
-  huberPetiteFleurModel_->setCirculatorEnabled(true);
+  QMetaObject::invokeMethod(huberPetiteFleurModel_, "setCirculatorEnabled", Qt::BlockingQueuedConnection, Q_ARG(bool, true));
 }
 
 void ScriptableHuberPetiteFleur::switchCirculatorOff() {
 
   QMutexLocker locker(&mutex_);
-  huberPetiteFleurModel_->setCirculatorEnabled(false);
+  QMetaObject::invokeMethod(huberPetiteFleurModel_, "setCirculatorEnabled", Qt::BlockingQueuedConnection, Q_ARG(bool, false));
 }
 
 void ScriptableHuberPetiteFleur::setWorkingTemperature(double temperature) {
 
  QMutexLocker locker(&mutex_);
- huberPetiteFleurModel_->setWorkingTemperatureValue(temperature);
+ QMetaObject::invokeMethod(huberPetiteFleurModel_, "setWorkingTemperatureValue", Qt::BlockingQueuedConnection, Q_ARG(double, temperature));
 }
 
 QScriptValue ScriptableHuberPetiteFleur::isCirculatorOn() {
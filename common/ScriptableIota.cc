@@ -17,25 +17,25 @@ ScriptableIota::ScriptableIota(IotaModel* IotaModel,
 void ScriptableIota::switchPumpOn() {
 
   QMutexLocker locker(&mutex_);
-  IotaModel_->setPumpEnabled(true);
+  QMetaObject::invokeMethod(IotaModel_, "setPumpEnabled", Qt::BlockingQueuedConnection, Q_ARG(bool, true));
 }
 
 void ScriptableIota::switchPumpOff() {
 
   QMutexLocker locker(&mutex_);
-  IotaModel_->setPumpEnabled(false);
+  QMetaObject::invokeMethod(IotaModel_, "setPumpEnabled", Qt::BlockingQueuedConnection, Q_ARG(bool, false));
 }
 
 void ScriptableIota::setPressure(float pressure) {
 
   QMutexLocker locker(&mutex_);
-  IotaModel_->setPressureValue(pressure);
+  QMetaObject::invokeMethod(IotaModel_, "setPressureValue", Qt::BlockingQueuedConnection, Q_ARG(double, pressure));
 }
 
 void ScriptableIota::setFlow(float flow) {
 
   QMutexLocker locker(&mutex_);
-  IotaModel_->setFlowValue(flow);
+  QMetaObject::invokeMethod(IotaModel_, "setFlowValue", Qt::BlockingQueuedConnection, Q_ARG(double, flow));
 }
 
 QScriptValue ScriptableIota::isPumpOn() {
@@ -80,12 +80,8 @@ void ScriptableKeithley::waitForStableTemperature(const QString & channels,
   keithleyModel_->statusMessage(QString("wait for stable temperatures on channels %1 ...").arg(channelString));
   NQLog("keithley") << QString("wait for stable temperatures on channels %1 ...").arg(channelString);
 
-  Ringbuffer<float,10> buffer[10];
-  for (int c=0;c<10;++c) {
-    for (int b=0;b<10;++b) {
-      buffer[c].push_back(-999);
-    }
-  }
+  // last ten readings per channel, one per minute
+  std::vector<Ringbuffer<float> > buffer(10, Ringbuffer<float>(10));
 
   float current[10];
 
@@ -97,12 +93,12 @@ void ScriptableKeithley::waitForStableTemperature(const QString & channels,
 	 it!=activeChannels.end();
 	 ++it) {
       current[*it] = keithleyModel_->getTemperature(*it);
-      buffer[*it].push_back(current[*it]);
+      buffer[*it].push(current[*it]);
 
-      float delta = current[*it]-buffer[*it].get();
+      float delta = current[*it]-buffer[*it].at(9);
       NQLog("keithley") << QString("dT(%1) = %2").arg(*it).arg(delta);
 
-      if (std::fabs(delta)>=0.01) stable = false;
+      if (buffer[*it].size()<10 || std::fabs(delta)>=0.01) stable = false;
     }
     if (stable) break;
 
@@ -31,8 +31,7 @@
 
 #include <MattermostBot.h>
 
-#include <Fifo.h>
-#include <HistoryFifo.h>
+#include <Ringbuffer.h>
 
 #include <ApplicationConfig.h>
 
@@ -86,43 +85,39 @@ int main(int /* argc */, char ** /* argv */)
 
   /*
   {
-    HistoryFifo<double> fifo(5);
-
-    fifo.push(QDateTime::fromString("2017-06-13T09:09:11", Qt::ISODate), 10);
-    fifo.push(QDateTime::fromString("2017-06-13T09:09:12", Qt::ISODate), 20);
-    fifo.push(QDateTime::fromString("2017-06-13T09:09:13", Qt::ISODate), 30);
-    fifo.push(QDateTime::fromString("2017-06-13T09:09:14", Qt::ISODate), 40);
-    fifo.push(QDateTime::fromString("2017-06-13T09:09:15", Qt::ISODate), 50);
-    fifo.push(QDateTime::fromString("2017-06-13T09:09:16", Qt::ISODate), 60);
-    fifo.push(QDateTime::fromString("2017-06-13T09:09:17", Qt::ISODate), 70);
-    fifo.push(QDateTime::fromString("2017-06-13T09:09:18", Qt::ISODate), 80);
-    fifo.push(QDateTime::fromString("2017-06-13T09:09:19", Qt::ISODate), 90);
-
-    for (int i=0;i<fifo.size();++i) {
-      std::cout << fifo.timeAt(i).toString(Qt::ISODate).toStdString() << " : " << fifo.at(i) << std::endl;
+    TimedRingbuffer<double> fifo(8);
+
+    qint64 t0 = QDateTime::fromString("2017-06-13T09:09:11", Qt::ISODate).toMSecsSinceEpoch();
+    for (int i=0;i<9;++i) {
+      fifo.push(t0 + 1000*i, 10*(i+1));
+    }
+
+    for (size_t i=0;i<fifo.size();++i) {
+      std::cout << QDateTime::fromMSecsSinceEpoch(fifo.timeAt(i)).toString(Qt::ISODate).toStdString() << " : " << fifo.at(i) << std::endl;
     }
 
-    std::cout << fifo.sizeInSecs() << std::endl;
-    std::cout << fifo.deltaTime(0, 4) << std::endl;
-    std::cout << fifo.delta(0, 4) << std::endl;
-    std::cout << fifo.gradient(0, 4) << std::endl;
+    std::cout << fifo.deltaTime() << std::endl;
+    std::cout << fifo.deltaTime(4, 0) << std::endl;
+    std::cout << fifo.delta(4, 0) << std::endl;
+    std::cout << fifo.gradient(4, 0) << std::endl;
+    std::cout << fifo.mean() << " " << fifo.rms() << " " << fifo.slope() << std::endl;
   }
   */
 
   /*
   {
-    Fifo<int> fifo(5);
+    Ringbuffer<int> fifo(4);
 
     fifo.push(1);
     fifo.push(2); // 1
     fifo.push(3); // 1
     fifo.push(4); // 1
-    fifo.push(5); // 1
-    fifo.push(6); // 2
-    fifo.push(7); // 3
-    fifo.push(8); // 4
+    fifo.push(5); // 2
+    fifo.push(6); // 3
+    fifo.push(7); // 4
+    fifo.push(8); // 5
 
-    for (int i=0;i<fifo.size();++i) {
+    for (size_t i=0;i<fifo.size();++i) {
       std::cout << fifo.at(i) << " ";
     }
     std::cout << std::endl;
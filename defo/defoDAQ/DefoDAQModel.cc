@@ -8,6 +8,8 @@
 
 #include <nqlogger.h>
 
+#include "DeviceCommandReport.h"
+
 #include "DefoDAQModel.h"
 
 DefoDAQModel::DefoDAQModel(DefoConradModel* conradModel,
@@ -46,9 +48,10 @@ DefoDAQModel::DefoDAQModel(DefoConradModel* conradModel,
 
 void DefoDAQModel::myMoveToThread(QThread *thread)
 {
+    // the Keithley model is polled in its own I/O thread,
+    // see DevicePollScheduler
     conradModel_->moveToThread(thread);
     julaboModel_->moveToThread(thread);
-    keithleyModel_->moveToThread(thread);
     this->moveToThread(thread);
 }
 
@@ -124,6 +127,8 @@ void DefoDAQModel::createDAQStatusMessage(QString &buffer)
       xml.writeEndElement();
     }
 
+    DeviceCommandReport::writeDAQStatus(xml, utime);
+
     xml.writeStartElement("DAQStarted");
     xml.writeAttribute("time", utime.toString(Qt::ISODate));
     xml.writeEndElement();
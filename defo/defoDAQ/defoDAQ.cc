@@ -1,4 +1,5 @@
 #include <iostream>
+#include <csignal>
 
 #include <QApplication>
 #include <QProcess>
@@ -16,6 +17,7 @@
 
 #include "SingletonApplication.h"
 #include "ApplicationConfig.h"
+#include "DeviceCommandReport.h"
 
 #include "DefoMainWindow.h"
 #include "TestWindow.h"
@@ -51,6 +53,8 @@ int main( int argc, char** argv )
       NQLogger::instance()->addDestiniation(logfile, NQLog::Message);
   }
 
+  DeviceCommandReport::dumpOnSignal(SIGUSR1, logdir + "/defoDAQ-devices.txt");
+
 #ifdef SINGLETON
     SingletonApplication app(argc, argv, defoDAQGUID);
     if(!app.lock()){
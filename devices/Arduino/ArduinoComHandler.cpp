@@ -24,6 +24,11 @@ ArduinoComHandler::ArduinoComHandler( const ioport_t ioPort ) {
   // save ioport 
   fIoPort = ioPort;
 
+  // answers are terminated by <CR><NL>
+  fPort.SetFeed( "\n" );
+  fPort.SetTerminator( "\n" );
+  fPort.SetTimeoutPolicy( SerialTimeoutPolicy( 1000, 50 ) );
+
   // initialize
   OpenIoPort();
   InitializeIoPort();
@@ -46,58 +51,28 @@ void ArduinoComHandler::SendCommand( const char *commandString ) {
 
   if (!fDeviceAvailable) return;
 
-  char singleCharacter = 0; 
-
-  for ( unsigned int i = 0; i < strlen( commandString ); i++ ) {
-    
-    // scan command string character wise & write
-    singleCharacter = commandString[i];
-    write( fIoPortFileDescriptor, &singleCharacter, 1 );
-  }
-
-//   std::cout << "write: -" << commandString <<"-"<< std::endl;
-
-  // send feed characters
-  SendFeedString();
+  // command and feed string in a single write
+  fPort.SendCommand( commandString );
 }
 
 //! Read a string from device.
 /*!
 \par Input:
-  <br><b>Receive string must be at least 41 characters long.</b>
+  <br><b>Receive string must be at least 13 characters long.</b>
 
-  This function must be placed right in time before
-  the device starts sending.
-
-  See example program in class description.
+  Returns as soon as the answer is complete.
 */
 void ArduinoComHandler::ReceiveString( char *receiveString ) {
 
-  if (!fDeviceAvailable) {
-    receiveString[0] = 0;
-    return;
-  }
-
-  usleep( ComHandlerDelay );
-
-  int timeout = 0, readResult = 0;
+  receiveString[0] = 0;
 
-  while ( timeout < 10 )  {
-
-    usleep( 100000 );
+  if (!fDeviceAvailable) return;
 
-    readResult = read( fIoPortFileDescriptor, receiveString, 12 );
-    // std::cout << "read: -" << readResult << "- -" << receiveString <<"-"<< std::endl;
+  std::string answer;
+  fPort.ReceiveFrame( answer );
 
-    if ( readResult > 0 ) {
-      receiveString[readResult] = 0;
-      // std::cout << "read: -" << readResult << "- -" << receiveString <<"-"<< std::endl;
-      return;
-    }
-    timeout++;
-  }
-
-  //std::cout << "timeout" << std::endl;
+  size_t length = answer.copy( receiveString, 12 );
+  receiveString[length] = 0;
 }
 
 //! Open I/O port.
@@ -107,7 +82,8 @@ void ArduinoComHandler::ReceiveString( char *receiveString ) {
 void ArduinoComHandler::OpenIoPort( void ) noexcept(false) {
 
   // open io port ( read/write | no term control | no DCD line check )
-  fIoPortFileDescriptor = open( fIoPort, O_RDWR | O_NOCTTY  | O_NDELAY );
+  fPort.Open( fIoPort );
+  fIoPortFileDescriptor = fPort.FileDescriptor();
 
   // check if successful
   if ( fIoPortFileDescriptor == -1 ) {
@@ -117,9 +93,6 @@ void ArduinoComHandler::OpenIoPort( void ) noexcept(false) {
               << std::endl;
     fDeviceAvailable = false;
     return;
-  } else {
-    // configure port with no delay
-    fcntl( fIoPortFileDescriptor, F_SETFL, FNDELAY );
   }
 
   fDeviceAvailable = true;
@@ -195,16 +168,7 @@ void ArduinoComHandler::CloseIoPort( void ) {
 
   if (!fDeviceAvailable) return;
 
-  close( fIoPortFileDescriptor );
-}
-
-//! Send command termination string (<NL>).
-/*!
-  \internal
-*/
-void ArduinoComHandler::SendFeedString( void )
-{
-  write( fIoPortFileDescriptor, "\n", 1 );
+  fPort.Close();
 }
 
 bool ArduinoComHandler::DeviceAvailable()
@@ -8,6 +8,8 @@
 #include <unistd.h>
 #include <cmath>
 
+#include "../Serial/SerialPort.h"
+
 typedef const char* ioport_t;
 typedef struct termios termios_t;
 
@@ -29,21 +31,20 @@ class ArduinoComHandler {
 
   bool DeviceAvailable();
 
-  static constexpr int ComHandlerDelay = 1000;
-
  private:
 
   void OpenIoPort( void ) noexcept(false);
   void InitializeIoPort( void );
   void RestoreIoPort( void );
   void CloseIoPort( void );
-  void SendFeedString( void );
 
   bool fDeviceAvailable;
   int fIoPortFileDescriptor;
 
   ioport_t fIoPort;
   termios_t fCurrentTermios, fThisTermios;
+
+  SerialPort fPort;
 };
 
 #endif
@@ -11,6 +11,7 @@
 #include "ArduinoComHandler.h"
 
 #include "ArduinoMotor.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 //#define __ARDUINO_DEBUG
 
@@ -33,6 +34,8 @@ ArduinoMotor::~ArduinoMotor()
 
 bool ArduinoMotor::IsCommunication( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return isCommunication_; 
 }
 
@@ -51,6 +54,8 @@ void ArduinoMotor::SendCommand(const char *commandString){
 
 float ArduinoMotor::GetPressureA( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   #ifdef __ARDUINO_DEBUG
   std::cout << "[ArduinoPres::GetPressureA] -- DEBUG: Called." << std::endl;
   #endif
@@ -81,6 +86,8 @@ float ArduinoMotor::GetPressureA( void ) const
 ///
 float ArduinoMotor::GetPressureB( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   #ifdef __ARDUINO_DEBUG
   std::cout << "[ArduinoMotor::GetPressureB] -- DEBUG: Called." << std::endl;
   #endif
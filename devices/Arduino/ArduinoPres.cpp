@@ -11,6 +11,7 @@
 #include "ArduinoComHandler.h"
 
 #include "ArduinoPres.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 //#define __ARDUINO_DEBUG
 
@@ -33,6 +34,8 @@ ArduinoPres::~ArduinoPres()
 
 bool ArduinoPres::IsCommunication( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return isCommunication_; 
 }
 
@@ -41,6 +44,8 @@ bool ArduinoPres::IsCommunication( void ) const
 ///
 float ArduinoPres::GetPressureA( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   #ifdef __ARDUINO_DEBUG
   std::cout << "[ArduinoPres::GetPressureA] -- DEBUG: Called." << std::endl;
   #endif
@@ -72,6 +77,8 @@ float ArduinoPres::GetPressureA( void ) const
 ///
 float ArduinoPres::GetPressureB( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   #ifdef __ARDUINO_DEBUG
   std::cout << "[ArduinoPres::GetPressureB] -- DEBUG: Called." << std::endl;
   #endif
@@ -10,6 +10,7 @@
 //#####################
 
 #include "ArduinoPresFake.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 ///
 ///
@@ -26,6 +27,8 @@ ArduinoPresFake::ArduinoPresFake( const ioport_t ioPort )
 ///
 float ArduinoPresFake::GetPressureA( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [ArduinoPresFake::GetPressureA] -- FAKE: Returning p(a) = "
 	        << pressureA_ << std::endl;
 
@@ -52,6 +55,8 @@ float ArduinoPresFake::GetPressureA( void ) const
 ///
 float ArduinoPresFake::GetPressureB( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [ArduinoPresFake::GetPressureB] -- FAKE: Returning p(b) = "
             << pressureB_ << std::endl;
 
@@ -26,6 +26,9 @@ ConradCommunication::ConradCommunication(const std::string& comPort)
   : m_comPort(comPort),
     m_ioPort(-1)
 {
+  // binary protocol with fixed 4 byte frames;
+  // the card needs 100 ms after a transmitted command
+  m_port.SetTimeoutPolicy(SerialTimeoutPolicy(1000, 50, 100));
 }
 
 
@@ -43,8 +46,8 @@ bool ConradCommunication::initialize()
   assert(m_ioPort == -1);
 
   // open io port (read/write | no term control | no DCD line check)
-  m_ioPort = open(m_comPort.c_str(), O_RDWR | O_NOCTTY  | O_NDELAY);
-  if (m_ioPort == -1){ return false; }
+  if (!m_port.Open(m_comPort)) { return false; }
+  m_ioPort = m_port.FileDescriptor();
 
   // get and save current ioport settings for later restoring
   tcgetattr(m_ioPort, &m_termiosInitial);
@@ -95,7 +98,7 @@ void ConradCommunication::finish()
   tcsetattr(m_ioPort, TCSANOW, &m_termiosInitial);
 
   // close io port
-  close(m_ioPort);
+  m_port.Close();
   m_ioPort = -1;
 }
 
@@ -109,37 +112,27 @@ bool ConradCommunication::sendCommand(unsigned char command, unsigned char addre
   buffer[1] = address;
   buffer[2] = data;
   buffer[3] = command ^ address ^ data;
-  int wroteBytes = write(m_ioPort, buffer, 4);
 
-  // wait until the output has been transmitted
-  tcdrain(m_ioPort);
-
-  if (wroteBytes != 4) {
-    fprintf(stderr, "[Conrad] ERROR (port: %s): Could send only %d of 4 bytes\n", comPort().c_str(), wroteBytes);
+  if (!m_port.Write(reinterpret_cast<const char*>(buffer), 4)) {
+    fprintf(stderr, "[Conrad] ERROR (port: %s): Could not send command\n", comPort().c_str());
     return false;
   }
 
-  // give the card some time (100 ms)
-  usleep(100000);
-
   return true;
 }
 
 //! Receive answer from Conrad
 bool ConradCommunication::receiveAnswer(unsigned char* answer, unsigned char* address, unsigned char* data) const
 {
-  unsigned char buffer[4] = { 0 };
+  std::string frame;
 
-  int readBytes = read(m_ioPort, buffer, 4);
-  if (readBytes == -1) {
-    fprintf(stderr, "[Conrad] ERROR (port: %s): Reading from card failed\n", comPort().c_str());
+  // returns as soon as the 4 bytes are in
+  if (!m_port.ReceiveBytes(frame, 4)) {
+    fprintf(stderr, "[Conrad] ERROR (port: %s): Could receive only %d of 4 bytes\n", comPort().c_str(), (int)frame.size());
     return false;
   }
 
-  if (readBytes != 4) {
-    fprintf(stderr, "[Conrad] ERROR (port: %s): Could receive only %d of 4 bytes\n", comPort().c_str(), readBytes);
-    return false;
-  }
+  const unsigned char* buffer = reinterpret_cast<const unsigned char*>(frame.data());
 
   int checksum = buffer[0] ^ buffer[1] ^ buffer[2];
   if (checksum != buffer[3]) {
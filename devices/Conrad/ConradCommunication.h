@@ -16,6 +16,8 @@
 #include <string>
 #include <termios.h>
 
+#include "../Serial/SerialPort.h"
+
 /** @addtogroup devices
  *  @{
  */
@@ -46,6 +48,8 @@ private:
 
   struct termios m_termiosInitial;
   struct termios m_termios;
+
+  mutable SerialPort m_port;
 };
 
 /** @} */
@@ -19,6 +19,7 @@
 #include "ConradController.h"
 
 #include <iostream>
+#include "../Serial/DeviceCommandStatistics.h"
 
 //! Default constructor
 ConradController::ConradController(const std::string& ioPort)
@@ -39,6 +40,8 @@ ConradController::~ConradController()
 //! Initialize Conrad IO communication
 bool ConradController::initialize()
 {
+  DEVICE_COMMAND_TIMER();
+
   assert(m_communication);
 
   // Initialize communication
@@ -108,6 +111,8 @@ bool ConradController::queryRawStatus(unsigned char& status) const
 //! Query channel status (returns 8 items reflecting the channel state, on/off, 0 items if it failed)
 std::vector<bool> ConradController::queryStatus() const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::vector<bool> result;
 
   unsigned char status;
@@ -124,6 +129,8 @@ std::vector<bool> ConradController::queryStatus() const
 //! Set a specific channel on or off, not touching any other channel status
 bool ConradController::setChannel(unsigned channel, bool value) const
 {
+  DEVICE_COMMAND_TIMER();
+
   assert(channel <= 8);
   unsigned twoPowChannel = (unsigned) pow(2.0, channel - 1.0);
 
@@ -155,6 +162,8 @@ bool ConradController::setChannel(unsigned channel, bool value) const
 //! Set a specific channel on or off, and switch _all_ other channels to off
 bool ConradController::setSingleChannel(unsigned channel, bool value) const
 {
+  DEVICE_COMMAND_TIMER();
+
   assert(channel <= 8);
   unsigned twoPowChannel = (unsigned) pow(2.0, channel - 1.0);
 
@@ -17,6 +17,7 @@
 #include <iostream>
 
 #include "ConradControllerFake.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 //! Default constructor
 ConradControllerFake::ConradControllerFake(const std::string& ioPort)
@@ -34,12 +35,16 @@ ConradControllerFake::~ConradControllerFake()
 //! Initialize Conrad IO communication
 bool ConradControllerFake::initialize()
 {
+  DEVICE_COMMAND_TIMER();
+
   return true;
 }
 
 //! Query channel status (returns 8 items reflecting the channel state, on/off, 0 items if it failed)
 std::vector<bool> ConradControllerFake::queryStatus() const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::vector<bool> result(status_, status_ + 8);
   return result;
 }
@@ -47,6 +52,8 @@ std::vector<bool> ConradControllerFake::queryStatus() const
 //! Set a specific channel on or off, not touching any other channel status
 bool ConradControllerFake::setChannel(unsigned channel, bool value) const
 {
+  DEVICE_COMMAND_TIMER();
+
   assert(channel <= 8);
 
   status_[channel] = value;
@@ -57,6 +64,8 @@ bool ConradControllerFake::setChannel(unsigned channel, bool value) const
 //! Set a specific channel on or off, and switch _all_ other channels to off
 bool ConradControllerFake::setSingleChannel(unsigned channel, bool value) const
 {
+  DEVICE_COMMAND_TIMER();
+
   assert(channel <= 8);
 
   for (int c=0;c<8;++c) status_[c] = false;
@@ -11,6 +11,7 @@
 #include "CoriFlowComHandler.h"
 
 #include "CoriFlow.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 ///
 ///
@@ -30,6 +31,8 @@ CoriFlow::~CoriFlow()
 
 bool CoriFlow::IsCommunication( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return isCommunication_;
 }
 
@@ -37,6 +40,7 @@ bool CoriFlow::IsCommunication( void ) const
 //////////////////////////////////////////////////////////
 
 float CoriFlow::getTemp( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __CORIFLOW_DEBUG
   std::cout << "[CoriFlow::test] -- DEBUG: Called." << std::endl;
@@ -55,6 +59,7 @@ float CoriFlow::getTemp( void ) const {
 }
 
 float CoriFlow::getPres( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __CORIFLOW_DEBUG
   std::cout << "[CoriFlow::test] -- DEBUG: Called." << std::endl;
@@ -73,6 +78,7 @@ float CoriFlow::getPres( void ) const {
 }
 
 float CoriFlow::getMeasure( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __CORIFLOW_DEBUG
   std::cout << "[CoriFlow::test] -- DEBUG: Called." << std::endl;
@@ -97,6 +103,7 @@ float CoriFlow::getMeasure( void ) const {
 /// ///////////////////////////////////////////////////////////////////
 
 float CoriFlow::getCapacity( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __CORIFLOW_DEBUG
   std::cout << "[CoriFlow::test] -- DEBUG: Called." << std::endl;
@@ -115,6 +122,7 @@ float CoriFlow::getCapacity( void ) const {
 }
 
 std::string CoriFlow::getUnit( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __CORIFLOW_DEBUG
   std::cout << "[CoriFlow::test] -- DEBUG: Called." << std::endl;
@@ -134,6 +142,7 @@ std::string CoriFlow::getUnit( void ) const {
 
 
 std::string CoriFlow::getFluid( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __CORIFLOW_DEBUG
   std::cout << "[CoriFlow::test] -- DEBUG: Called." << std::endl;
@@ -152,6 +161,7 @@ std::string CoriFlow::getFluid( void ) const {
 }
 
 std::string CoriFlow::getTag( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __CORIFLOW_DEBUG
   std::cout << "[CoriFlow::test] -- DEBUG: Called." << std::endl;
@@ -171,6 +181,7 @@ std::string CoriFlow::getTag( void ) const {
 
 
 std::string CoriFlow::setInit( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __CORIFLOW_DEBUG
   std::cout << "[CoriFlow::test] -- DEBUG: Called." << std::endl;
@@ -190,6 +201,7 @@ std::string CoriFlow::setInit( void ) const {
 
 
 float CoriFlow::getDensity( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __CORIFLOW_DEBUG
   std::cout << "[CoriFlow::test] -- DEBUG: Called." << std::endl;
@@ -208,6 +220,7 @@ float CoriFlow::getDensity( void ) const {
 }
 
 std::string CoriFlow::setCapacity( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __CORIFLOW_DEBUG
   std::cout << "[CoriFlow::test] -- DEBUG: Called." << std::endl;
@@ -228,6 +241,7 @@ std::string CoriFlow::setCapacity( void ) const {
 
 
 std::string CoriFlow::setTag( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __CORIFLOW_DEBUG
   std::cout << "[CoriFlow::test] -- DEBUG: Called." << std::endl;
@@ -34,6 +34,11 @@ CoriFlowComHandler::CoriFlowComHandler( const ioport_t ioPort ) {
   // save ioport 
   fIoPort = ioPort;
 
+  // answers are terminated by <CR><NL>
+  fPort.SetFeed( "\r\n" );
+  fPort.SetTerminator( "\n" );
+  fPort.SetTimeoutPolicy( SerialTimeoutPolicy( 1000, 50 ) );
+
   // initialize
   OpenIoPort();
   InitializeIoPort();
@@ -54,25 +59,15 @@ CoriFlowComHandler::~CoriFlowComHandler( void ) {
 //! Send the command string &lt;commandString&gt; to device.
 void CoriFlowComHandler::SendCommand( const char *commandString ) {
 
-  char singleCharacter = 0; 
-
-  for ( unsigned int i = 0; i < strlen( commandString ); i++ ) {
-    
-    // scan command string character wise & write
-    singleCharacter = commandString[i];
-    write( fIoPortFileDescriptor, &singleCharacter, 1 );
-  }
-
-//   std::cout << "write: " << commandString << std::endl;
-
-  // send feed characters
-  SendFeedString();
+  // command and feed string in a single write
+  fPort.SendCommand( commandString );
 }
 
 //! flush the IO memory
 void CoriFlowComHandler::flush(void) {
 
   sleep(2);
+  fPort.Flush();
   if(tcflush(fIoPortFileDescriptor, TCIOFLUSH)==0)
     printf("The input and output queues have been flushed\n\n");
     else{
@@ -84,34 +79,17 @@ void CoriFlowComHandler::flush(void) {
 //! Read a string from device.
 /*!
 \par Input:
-  <br><b>Receive string must be at least 41 characters long.</b>
+  <br><b>Receive string must be at least 1025 characters long.</b>
 
-  This function must be placed right in time before
-  the device starts sending.
-
-  See example program in class description.
+  Returns as soon as the answer is complete.
 */
 void CoriFlowComHandler::ReceiveString( char *receiveString ) {
 
-  usleep( ComHandlerDelay );
-
-  int timeout = 0, readResult = 0;
-
-  while ( timeout < 10 )  {
-
-    usleep( 100000 );
+  std::string answer;
+  fPort.ReceiveFrame( answer );
 
-    readResult = read( fIoPortFileDescriptor, receiveString, 1024 );
-
-    if ( readResult > 0 ) {
-      receiveString[readResult] = 0;
-//       std::cout << "read: " << readResult << " " << receiveString << std::endl;
-      return;
-    }
-    timeout++;
-  }
-
-  //std::cout << "timeout" << std::endl;
+  size_t length = answer.copy( receiveString, 1024 );
+  receiveString[length] = 0;
 }
 
 //! Open I/O port.
@@ -121,7 +99,8 @@ void CoriFlowComHandler::ReceiveString( char *receiveString ) {
 void CoriFlowComHandler::OpenIoPort( void ) noexcept(false) {
 
   // open io port ( read/write | no term control | no DCD line check )
-  fIoPortFileDescriptor = open( fIoPort, O_RDWR | O_NOCTTY  | O_NDELAY );
+  fPort.Open( fIoPort );
+  fIoPortFileDescriptor = fPort.FileDescriptor();
 
   // check if successful
   if ( fIoPortFileDescriptor == -1 ) {
@@ -130,9 +109,6 @@ void CoriFlowComHandler::OpenIoPort( void ) noexcept(false) {
     std::cerr << "(probably it's not user-writable)."
           << std::endl;
     throw int(-1);
-  } else {
-    // configure port with no delay
-    fcntl( fIoPortFileDescriptor, F_SETFL, FNDELAY );
   }
 }
 
@@ -194,14 +170,5 @@ void CoriFlowComHandler::RestoreIoPort( void ) {
 */
 void CoriFlowComHandler::CloseIoPort( void ) {
 
-  close( fIoPortFileDescriptor );
-}
-
-//! Send command termination string (<CR><NL>).
-/*!
-  \internal
-*/
-void CoriFlowComHandler::SendFeedString( void )
-{
-  write( fIoPortFileDescriptor, "\r\n", 4 ); // /r nicht noetig?
+  fPort.Close();
 }
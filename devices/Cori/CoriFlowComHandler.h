@@ -22,6 +22,8 @@
 #include <unistd.h>
 #include <cmath>
 
+#include "../Serial/SerialPort.h"
+
 #define COM1 "/dev/ttyS0"
 #define COM2 "/dev/ttyS1"
 #define COM3 "/dev/ttyS2"
@@ -57,21 +59,20 @@ class CoriFlowComHandler {
 
   void flush( void);
 
-  static constexpr int ComHandlerDelay = 1000;
-
  private:
 
   void OpenIoPort( void ) noexcept(false);
   void InitializeIoPort( void );
   void RestoreIoPort( void );
   void CloseIoPort( void );
-  void SendFeedString( void );
 
 
   int fIoPortFileDescriptor;
 
   ioport_t fIoPort;
   termios_t fCurrentTermios, fThisTermios;
+
+  SerialPort fPort;
 };
 
 #endif
@@ -13,6 +13,7 @@
 //#####################
 
 #include "CoriFlowFake.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 ///
 ///
@@ -25,57 +26,79 @@ CoriFlowFake::CoriFlowFake( const ioport_t ioPort )
 
 float CoriFlowFake::getTemp( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return 0.;
 }
 
 float CoriFlowFake::getPres( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return 0.;
 }
 
 float CoriFlowFake::getMeasure( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return 0.;
 }
 
 /// additional stuff
 float CoriFlowFake::getCapacity( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return 0.;
 }
 
 std::string CoriFlowFake::getUnit( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return std::string();
 }
 
 std::string CoriFlowFake::getFluid( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return std::string();
 }
 
 std::string CoriFlowFake::getTag( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return std::string();
 }
 
 std::string CoriFlowFake::setInit( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return std::string();
 }
 
 std::string CoriFlowFake::setTag( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return std::string();
 }
 
 float CoriFlowFake::getDensity( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return 0.;
 }
 
 std::string CoriFlowFake::setCapacity( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return std::string();
 }
 
@@ -17,6 +17,7 @@
 #include <iostream>
 
 #include "GMH3750.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 GMH3750::GMH3750( ioport_t ioPort )
     :VGMH3750(ioPort)
@@ -34,6 +35,8 @@ GMH3750::~GMH3750( void )
 
 bool GMH3750::Read(double & temperature)
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[10];
   char buffer[1000];
   bzero( buffer, 1000 );
@@ -36,6 +36,10 @@ GMH3750ComHandler::GMH3750ComHandler( ioport_t ioPort )
   // save ioport 
   fIoPort = ioPort;
 
+  // binary protocol; the answer is complete when the device goes silent
+  fPort.SetTerminator( "" );
+  fPort.SetTimeoutPolicy( SerialTimeoutPolicy( 500, 20 ) );
+
   // initialize
   OpenIoPort();
   InitializeIoPort();
@@ -56,52 +60,27 @@ GMH3750ComHandler::~GMH3750ComHandler( void )
 //! Send the command string &lt;commandString&gt; to device.
 void GMH3750ComHandler::SendCommand( const char *commandString, int length )
 {
-  char singleCharacter = 0; 
-  int size = length;
+  size_t size = length;
   if (length==-1) size = strlen( commandString );
 
-  for ( unsigned int i = 0; i < size; i++ ) {
-    
-    // scan command string character wise & write
-    singleCharacter = commandString[i];
-
-    write( fIoPortFileDescriptor, &singleCharacter, 1 );
-  }
-  
-  // send feed characters
-  //SendFeedString();
+  // no feed string, the protocol is binary
+  fPort.Write( commandString, size );
 }
 
 //! Read a string from device.
 /*!
 \par Input:
-  <br><b>Receive string must be at least 41 characters long.</b>
-
-  This function must be placed right in time before
-  the device starts sending.
+  <br><b>Receive string must be at least 1025 characters long.</b>
 
-  See example program in class description.
+  Returns as soon as the answer is complete.
 */
 void GMH3750ComHandler::ReceiveString( char *receiveString )
 {
-  usleep( _COMHANDLER_DELAY );
+  std::string answer;
+  fPort.ReceiveFrame( answer );
 
-  int timeout = 0, readResult = 0;
-
-  while ( timeout < 500000 )  {
-
-    readResult = read( fIoPortFileDescriptor, receiveString, 1024 );
-
-    if ( readResult > 0 )   {
-    
-      receiveString[readResult] = 0;
-      break;
-    }
-    
-    timeout++;
-  }
-  
-  std::cout << "TO: " << timeout << std::endl; /////////////////////////////////
+  size_t length = answer.copy( receiveString, 1024 );
+  receiveString[length] = 0;
 }
 
 //! Open I/O port.
@@ -111,7 +90,8 @@ void GMH3750ComHandler::ReceiveString( char *receiveString )
 void GMH3750ComHandler::OpenIoPort( void )
 {
   // open io port ( read/write | no term control | no DCD line check )
-  fIoPortFileDescriptor = open( fIoPort, O_RDWR | O_NOCTTY | O_NDELAY );
+  fPort.Open( fIoPort );
+  fIoPortFileDescriptor = fPort.FileDescriptor();
 
   // check if successful
   if ( fIoPortFileDescriptor == -1 ) {
@@ -122,11 +102,6 @@ void GMH3750ComHandler::OpenIoPort( void )
               << std::endl;
     throw;
   
-  } else {
-  
-    // configure port with no delay
-    fcntl( fIoPortFileDescriptor, F_SETFL, FNDELAY );
-  
   }
 
   int status;
@@ -199,18 +174,5 @@ void GMH3750ComHandler::RestoreIoPort( void )
 */
 void GMH3750ComHandler::CloseIoPort( void )
 {
-  close( fIoPortFileDescriptor );
-}
-
-//! Send command termination string (<CR><NL>).
-/*!
-  \internal
-*/
-void GMH3750ComHandler::SendFeedString( void )
-{
-  // feed string is <NL>
-  char feedString = 10;
-
-  // write <CR> and get echo
-  write( fIoPortFileDescriptor, &feedString, 1 );
+  fPort.Close();
 }
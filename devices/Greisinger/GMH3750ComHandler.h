@@ -20,6 +20,8 @@
 #include <unistd.h>
 #include <cmath>
 
+#include "../Serial/SerialPort.h"
+
 #define COM1 "/dev/ttyS0"
 #define COM2 "/dev/ttyS1"
 #define COM3 "/dev/ttyS2"
@@ -30,8 +32,6 @@
 #define ttyS2 "/dev/ttyS2"
 #define ttyS3 "/dev/ttyS3"
 
-#define _COMHANDLER_DELAY 1000
-
 /** @addtogroup devices
  *  @{
  */
@@ -66,12 +66,13 @@ class GMH3750ComHandler
   void InitializeIoPort( void );
   void RestoreIoPort( void );
   void CloseIoPort( void );
-  void SendFeedString( void );
 
   int fIoPortFileDescriptor;
 
   ioport_t fIoPort;
   termios_t fCurrentTermios, fThisTermios;
+
+  SerialPort fPort;
 };
 
 /** @} */
@@ -15,6 +15,7 @@
 #include <iostream>
 
 #include "GMH3750Fake.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 GMH3750Fake::GMH3750Fake( ioport_t ioPort )
     :VGMH3750(ioPort)
@@ -32,6 +33,8 @@ GMH3750Fake::~GMH3750Fake( void )
 
 bool GMH3750Fake::Read(double & temperature)
 {
+    DEVICE_COMMAND_TIMER();
+
     temperature = 16.0;
 
     usleep(500);
@@ -26,6 +26,11 @@ HO820ComHandler::HO820ComHandler(ioport_t ioPort)
   // save ioport 
   fIoPort = ioPort;
 
+  // answers are terminated by <NL>
+  fPort.SetFeed( "\n" );
+  fPort.SetTerminator( "\n" );
+  fPort.SetTimeoutPolicy( SerialTimeoutPolicy( 500, 20 ) );
+
   // initialize
   OpenIoPort();
   InitializeIoPort();
@@ -45,51 +50,28 @@ void HO820ComHandler::SendCommand( const char *commandString )
 {
   if (!fDeviceAvailable) return;
 
-  char singleCharacter = 0; 
-
-  for ( unsigned int i = 0; i < strlen( commandString ); i++ ) {
-    
-    // scan command string character wise & write
-    singleCharacter = commandString[i];
-    write( fIoPortFileDescriptor, &singleCharacter, 1 );
-  }
-
-  // send feed characters
-  SendFeedString();
+  // command and feed string in a single write
+  fPort.SendCommand( commandString );
 }
 
 //! Read a string from device.
 /*!
 \par Input:
-  <br><b>Receive string must be at least 41 characters long.</b>
-
-  This function must be placed right in time before
-  the device starts sending.
+  <br><b>Receive string must be at least 1025 characters long.</b>
 
-  See example program in class description.
+  Returns as soon as the answer is complete.
 */
 void HO820ComHandler::ReceiveString( char *receiveString )
 {
-  if (!fDeviceAvailable) {
-    receiveString[0] = 0;
-    return;
-  }
-
-  usleep( 10000 );
+  receiveString[0] = 0;
 
-  int timeout = 0, readResult = 0;
-
-  while ( timeout < 100000 )  {
+  if (!fDeviceAvailable) return;
 
-    readResult = read( fIoPortFileDescriptor, receiveString, 1024 );
+  std::string answer;
+  fPort.ReceiveFrame( answer );
 
-    if ( readResult > 0 ) {
-      receiveString[readResult] = 0;
-      break;
-    }
-    
-    timeout++;
-  }
+  size_t length = answer.copy( receiveString, 1024 );
+  receiveString[length] = 0;
 }
 
 //! Open I/O port.
@@ -99,7 +81,8 @@ void HO820ComHandler::ReceiveString( char *receiveString )
 void HO820ComHandler::OpenIoPort( void )
 {
   // open io port ( read/write | no term control | no DCD line check )
-  fIoPortFileDescriptor = open( fIoPort, O_RDWR | O_NOCTTY  | O_NDELAY );
+  fPort.Open( fIoPort );
+  fIoPortFileDescriptor = fPort.FileDescriptor();
 
   // check if successful
   if ( fIoPortFileDescriptor == -1 ) {
@@ -109,9 +92,6 @@ void HO820ComHandler::OpenIoPort( void )
               << std::endl;
     fDeviceAvailable = false;
     return;
-  } else {
-    // configure port with no delay
-    fcntl( fIoPortFileDescriptor, F_SETFL, FNDELAY );
   }
 
   fDeviceAvailable = true;
@@ -149,22 +129,7 @@ void HO820ComHandler::CloseIoPort( void )
 {
   if (!fDeviceAvailable) return;
 
-  close( fIoPortFileDescriptor );
-}
-
-//! Send command termination string (<CR><NL>).
-/*!
-  \internal
-*/
-void HO820ComHandler::SendFeedString( void )
-{
-  if (!fDeviceAvailable) return;
-
-  // feed string is <NL>
-  char feedString = 10;
-
-  // write <CR> and get echo
-  write( fIoPortFileDescriptor, &feedString, 1 );
+  fPort.Close();
 }
 
 bool HO820ComHandler::DeviceAvailable()
@@ -15,6 +15,7 @@
 #include <sstream>
 
 #include "Hameg8143.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 Hameg8143::Hameg8143( const ioport_t ioPort )
   :VHameg8143(ioPort),
@@ -36,6 +37,8 @@ bool Hameg8143::DeviceAvailable() const
 
 unsigned int Hameg8143::GetStatus() const
 {
+  DEVICE_COMMAND_TIMER();
+
   comHandler_->SendCommand("STA");
   char buffer[1000];
   comHandler_->ReceiveString(buffer);
@@ -60,6 +63,8 @@ unsigned int Hameg8143::GetStatus() const
 
 bool Hameg8143::SetRemoteMode(bool remote) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (remote) {
     comHandler_->SendCommand("RM1");
   } else {
@@ -71,6 +76,8 @@ bool Hameg8143::SetRemoteMode(bool remote) const
 
 bool Hameg8143::SetMixedMode(bool mixed) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (mixed) {
     comHandler_->SendCommand("MX1");
   } else {
@@ -82,6 +89,8 @@ bool Hameg8143::SetMixedMode(bool mixed) const
  
 bool Hameg8143::SetVoltage(int channel, float voltage) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (channel==0 || channel>2) return false;
   if (voltage<0 || voltage>30) return false;
 
@@ -97,6 +106,8 @@ bool Hameg8143::SetVoltage(int channel, float voltage) const
   
 float Hameg8143::GetSetVoltage(int channel) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (channel==0 || channel>2) return -99;
   
   if (channel==1) {
@@ -118,6 +129,8 @@ float Hameg8143::GetSetVoltage(int channel) const
   
 float Hameg8143::GetVoltage(int channel) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (channel==0 || channel>2) return -99;
   
   if (channel==1) {
@@ -139,6 +152,8 @@ float Hameg8143::GetVoltage(int channel) const
 
 bool Hameg8143::SetCurrent(int channel, float current) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (channel==0 || channel>2) return false;
   if (current<0 || current>2) return false;
 
@@ -154,6 +169,8 @@ bool Hameg8143::SetCurrent(int channel, float current) const
   
 float Hameg8143::GetSetCurrent(int channel) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (channel==0 || channel>2) return -99;
   
   if (channel==1) {
@@ -175,6 +192,8 @@ float Hameg8143::GetSetCurrent(int channel) const
 
 float Hameg8143::GetCurrent(int channel) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (channel==0 || channel>2) return -99;
   
   if (channel==1) {
@@ -196,6 +215,8 @@ float Hameg8143::GetCurrent(int channel) const
  
 bool Hameg8143::SetTrackingVoltage(float voltage) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (voltage<0 || voltage>30) return false;
 
   std::stringstream theCommand;
@@ -210,6 +231,8 @@ bool Hameg8143::SetTrackingVoltage(float voltage) const
 
 bool Hameg8143::SetTrackingCurrent(float current) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (current<0 || current>2) return false;
 
   std::stringstream theCommand;
@@ -224,6 +247,8 @@ bool Hameg8143::SetTrackingCurrent(float current) const
 
 bool Hameg8143::SwitchOutputOn() const
 {
+  DEVICE_COMMAND_TIMER();
+
   comHandler_->SendCommand("OP1");
 
   return true;
@@ -231,6 +256,8 @@ bool Hameg8143::SwitchOutputOn() const
 
 bool Hameg8143::SwitchOutputOff() const
 {
+  DEVICE_COMMAND_TIMER();
+
   comHandler_->SendCommand("OP0");
 
   return true;
@@ -13,6 +13,7 @@
 #include <cmath>
 
 #include "Hameg8143Fake.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 Hameg8143Fake::Hameg8143Fake( const ioport_t ioPort )
   :VHameg8143(ioPort)
@@ -31,11 +32,15 @@ Hameg8143Fake::~Hameg8143Fake()
 
 unsigned int Hameg8143Fake::GetStatus() const
 {
+    DEVICE_COMMAND_TIMER();
+
     return statusBits_;
 }
 
 bool Hameg8143Fake::SetRemoteMode(bool remote) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (statusBits_&hmRM0) statusBits_ -= hmRM0;
   if (statusBits_&hmRM1) statusBits_ -= hmRM1;
   if (remote) {
@@ -49,12 +54,16 @@ bool Hameg8143Fake::SetRemoteMode(bool remote) const
 
 bool Hameg8143Fake::SetMixedMode(bool mixed) const
 {
+  DEVICE_COMMAND_TIMER();
+
   SetRemoteMode(true);
   return true;
 }
 
 bool Hameg8143Fake::SetVoltage(int channel, float voltage) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (channel==1) {
     if (statusBits_&hmCC1) statusBits_ -= hmCC1;
     statusBits_ |= hmCV1;
@@ -68,11 +77,15 @@ bool Hameg8143Fake::SetVoltage(int channel, float voltage) const
   
 float Hameg8143Fake::GetSetVoltage(int channel) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return voltage_[channel-1];
 }
   
 float Hameg8143Fake::GetVoltage(int channel) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if ((channel==1 && statusBits_&hmCC1) ||
       (channel==2 && statusBits_&hmCC2)) return resistance_ * current_[channel-1];
   return voltage_[channel-1];
@@ -80,6 +93,8 @@ float Hameg8143Fake::GetVoltage(int channel) const
 
 bool Hameg8143Fake::SetCurrent(int channel, float current) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (channel==1) {
     if (statusBits_&hmCV1) statusBits_ -= hmCV1;
     statusBits_ |= hmCC1;
@@ -93,11 +108,15 @@ bool Hameg8143Fake::SetCurrent(int channel, float current) const
 
 float Hameg8143Fake::GetSetCurrent(int channel) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return current_[channel-1];
 }
 
 float Hameg8143Fake::GetCurrent(int channel) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if ((channel==1 && statusBits_&hmCV1) ||
       (channel==2 && statusBits_&hmCV2)) return voltage_[channel-1] / resistance_;
   return current_[channel-1];
@@ -105,16 +124,22 @@ float Hameg8143Fake::GetCurrent(int channel) const
  
 bool Hameg8143Fake::SetTrackingVoltage(float /*voltage*/) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return true;
 }
 
 bool Hameg8143Fake::SetTrackingCurrent(float /*current*/) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return true;
 }
 
 bool Hameg8143Fake::SwitchOutputOn() const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (statusBits_&hmOP0) statusBits_ -= hmOP0;
   statusBits_ |= hmOP1;
   return true;
@@ -122,6 +147,8 @@ bool Hameg8143Fake::SwitchOutputOn() const
 
 bool Hameg8143Fake::SwitchOutputOff() const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (statusBits_&hmOP1) statusBits_ -= hmOP1;
   statusBits_ |= hmOP0;
   return true;
@@ -25,6 +25,7 @@
 #include "PetiteFleurComHandler.h"
 
 #include "HuberPetiteFleur.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 ///
 ///
@@ -42,6 +43,7 @@ HuberPetiteFleur::HuberPetiteFleur( const ioport_t ioPort )
 /// returns success flag
 ///
 bool HuberPetiteFleur::SetWorkingTemperature( const float workingTemp ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __HUBERPETITEFLEUR_DEBUG
   std::cout << "[HuberPetiteFleur::SetWorkingTemp] -- DEBUG: Called." << std::endl;
@@ -91,6 +93,7 @@ bool HuberPetiteFleur::SetWorkingTemperature( const float workingTemp ) const {
 /// return success flag
 ///
 bool HuberPetiteFleur::SetCirculatorOn( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __HUBERPETITEFLEUR_DEBUG
   std::cout << "[HuberPetiteFleur::SetCirculatorOn] -- DEBUG: Called." << std::endl;
@@ -122,6 +125,7 @@ bool HuberPetiteFleur::SetCirculatorOn( void ) const {
 /// return success flag
 ///
 bool HuberPetiteFleur::SetCirculatorOff( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __HUBERPETITEFLEUR_DEBUG
   std::cout << "[HuberPetiteFleur::SetCirculatorOf] -- DEBUG: Called." << std::endl;
@@ -153,6 +157,7 @@ bool HuberPetiteFleur::SetCirculatorOff( void ) const {
 ///
 ///
 float HuberPetiteFleur::GetBathTemperature( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __HUBERPETITEFLEUR_DEBUG
   std::cout << "[HuberPetiteFleur::GetBathTemperature] -- DEBUG: Called." << std::endl;
@@ -174,6 +179,7 @@ float HuberPetiteFleur::GetBathTemperature( void ) const {
 ///
 ///
 float HuberPetiteFleur::GetWorkingTemperature( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __HUBERPETITEFLEUR_DEBUG
   std::cout << "[HuberPetiteFleur::GetWorkingTemperature] -- DEBUG: Called." << std::endl;
@@ -197,6 +203,7 @@ float HuberPetiteFleur::GetWorkingTemperature( void ) const {
 /// true = on / false = off
 ///
 bool HuberPetiteFleur::GetCirculatorStatus( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __HUBERPETITEFLEUR_DEBUG
   std::cout << "[HuberPetiteFleur::GetCirculatorStatus] -- DEBUG: Called." << std::endl;
@@ -21,6 +21,7 @@
 //#####################
 
 #include "HuberPetiteFleurFake.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 ///
 ///
@@ -36,6 +37,7 @@ HuberPetiteFleurFake::HuberPetiteFleurFake( const ioport_t ioPort )
 /// returns success flag
 ///
 bool HuberPetiteFleurFake::SetWorkingTemperature( const float workingTemp ) const {
+  DEVICE_COMMAND_TIMER();
 
   if( workingTemp > PetiteFleurUpperTempLimit || workingTemp < PetiteFleurLowerTempLimit ) {
     std::cerr << " [HuberPetiteFleurFake::SetWorkingTemp] ** ERROR: working temp T="
@@ -57,6 +59,8 @@ bool HuberPetiteFleurFake::SetWorkingTemperature( const float workingTemp ) cons
 ///
 bool HuberPetiteFleurFake::SetCirculatorOn( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [HuberPetiteFleurFake::SetCirculatorOn] -- FAKE: Setting circulator ON "
             << std::endl;
 
@@ -72,6 +76,8 @@ bool HuberPetiteFleurFake::SetCirculatorOn( void ) const
 ///
 bool HuberPetiteFleurFake::SetCirculatorOff( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [HuberPetiteFleurFake::SetCirculatorOff] -- FAKE: Setting circulator OFF"
             << std::endl;
 
@@ -85,6 +91,8 @@ bool HuberPetiteFleurFake::SetCirculatorOff( void ) const
 ///
 float HuberPetiteFleurFake::GetBathTemperature( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [HuberPetiteFleurFake::GetBathTemperature] -- FAKE: Returning T = "
 	        << workingTemp_ << std::endl;
   usleep( 10000 );
@@ -96,6 +104,8 @@ float HuberPetiteFleurFake::GetBathTemperature( void ) const
 ///
 float HuberPetiteFleurFake::GetWorkingTemperature( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [HuberPetiteFleurFake::GetWorkingTemperature] -- FAKE: Returning T = "
 	        << workingTemp_ << std::endl;
   usleep( 10000 );
@@ -106,6 +116,7 @@ float HuberPetiteFleurFake::GetWorkingTemperature( void ) const
 /// true = on / false = off
 ///
 bool HuberPetiteFleurFake::GetCirculatorStatus( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   std::cout << " [HuberPetiteFleurFake::GetCirculatorStatus] -- FAKE: Returning: " 
 	        << (circulatorStatus_?"TRUE":"FALSE") << std::endl;
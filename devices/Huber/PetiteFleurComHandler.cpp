@@ -36,6 +36,11 @@ PetiteFleurComHandler::PetiteFleurComHandler( const ioport_t ioPort ) {
   // save ioport 
   fIoPort = ioPort;
 
+  // canonical mode; answers are read line by line
+  fPort.SetFeed( "\n\r" );
+  fPort.SetTerminator( "\n" );
+  fPort.SetTimeoutPolicy( SerialTimeoutPolicy( 1000, 50 ) );
+
   // initialize
   OpenIoPort();
   InitializeIoPort();
@@ -56,52 +61,24 @@ PetiteFleurComHandler::~PetiteFleurComHandler( void ) {
 //! Send the command string &lt;commandString&gt; to device.
 void PetiteFleurComHandler::SendCommand( const char *commandString ) {
 
-  char singleCharacter = 0; 
-
-  for ( unsigned int i = 0; i < strlen( commandString ); i++ ) {
-    
-    // scan command string character wise & write
-    singleCharacter = commandString[i];
-    write( fIoPortFileDescriptor, &singleCharacter, 1 );
-  }
-
-  //std::cout << "write: " << commandString << std::endl;
-
-  // send feed characters
-  SendFeedString();
+  // command and feed string in a single write
+  fPort.SendCommand( commandString );
 }
 
 //! Read a string from device.
 /*!
 \par Input:
-  <br><b>Receive string must be at least 41 characters long.</b>
+  <br><b>Receive string must be at least 1025 characters long.</b>
 
-  This function must be placed right in time before
-  the device starts sending.
-
-  See example program in class description.
+  Returns as soon as the answer is complete.
 */
 void PetiteFleurComHandler::ReceiveString( char *receiveString ) {
 
-  usleep( ComHandlerDelay );
-
-  int timeout = 0, readResult = 0;
-
-  while ( timeout < 10 )  {
-
-    usleep( 100000 );
+  std::string answer;
+  fPort.ReceiveFrame( answer );
 
-    readResult = read( fIoPortFileDescriptor, receiveString, 1024 );
-
-    if ( readResult > 0 ) {
-      receiveString[readResult] = 0;
-      //std::cout << "read: " << readResult << " " << receiveString << std::endl;
-      return;
-    }
-    timeout++;
-  }
-
-  //std::cout << "timeout" << std::endl;
+  size_t length = answer.copy( receiveString, 1024 );
+  receiveString[length] = 0;
 }
 
 //! Open I/O port.
@@ -111,7 +88,8 @@ void PetiteFleurComHandler::ReceiveString( char *receiveString ) {
 void PetiteFleurComHandler::OpenIoPort( void ) noexcept(false) {
 
   // open io port ( read/write | no term control | no DCD line check )
-  fIoPortFileDescriptor = open( fIoPort, O_RDWR | O_NOCTTY  | O_NDELAY );
+  fPort.Open( fIoPort );
+  fIoPortFileDescriptor = fPort.FileDescriptor();
 
   // check if successful
   if ( fIoPortFileDescriptor == -1 ) {
@@ -120,9 +98,6 @@ void PetiteFleurComHandler::OpenIoPort( void ) noexcept(false) {
     std::cerr << "                               (probably it's not user-writable)."
               << std::endl;
     throw int(-1);
-  } else {
-    // configure port with no delay
-    fcntl( fIoPortFileDescriptor, F_SETFL, FNDELAY );
   }
 }
 
@@ -224,14 +199,5 @@ void PetiteFleurComHandler::RestoreIoPort( void ) {
 */
 void PetiteFleurComHandler::CloseIoPort( void ) {
 
-  close( fIoPortFileDescriptor );
-}
-
-//! Send command termination string (<CR><NL>).
-/*!
-  \internal
-*/
-void PetiteFleurComHandler::SendFeedString( void )
-{
-  write( fIoPortFileDescriptor, "\n\r", 2 );
+  fPort.Close();
 }
@@ -20,6 +20,8 @@
 #include <unistd.h>
 #include <cmath>
 
+#include "../Serial/SerialPort.h"
+
 typedef const char* ioport_t;
 typedef struct termios termios_t;
 
@@ -39,20 +41,19 @@ class PetiteFleurComHandler {
   void SendCommand( const char* );
   void ReceiveString( char* );
 
-  static constexpr int ComHandlerDelay = 1000;
-
  private:
 
   void OpenIoPort( void ) noexcept(false);
   void InitializeIoPort( void );
   void RestoreIoPort( void );
   void CloseIoPort( void );
-  void SendFeedString( void );
 
   int fIoPortFileDescriptor;
 
   ioport_t fIoPort;
   termios_t fCurrentTermios, fThisTermios;
+
+  SerialPort fPort;
 };
 
 #endif
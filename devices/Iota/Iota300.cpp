@@ -16,6 +16,7 @@
 #include "Iota300ComHandler.h"
 
 #include "Iota300.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 ///
 ///
@@ -33,6 +34,7 @@ Iota300::Iota300( const ioport_t ioPort )
 /// returns success flag
 ///
 bool Iota300::SetFlow( const float flow ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __IOTA300_DEBUG
   std::cout << "[Iota300::SetFlow] -- DEBUG: Called." << std::endl;
@@ -80,6 +82,7 @@ bool Iota300::SetFlow( const float flow ) const {
 /// return success flag
 ///
 bool Iota300::SetPressure( const float pressure ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __IOTA300_DEBUG
   std::cout << "[Iota300::SetPressure] -- DEBUG: Called." << std::endl;
@@ -126,6 +129,7 @@ bool Iota300::SetPressure( const float pressure ) const {
 /// return success flag
 ///
 bool Iota300::SetPumpOn( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __IOTA300_DEBUG
   std::cout << "[Iota300::SetPumpOn] -- DEBUG: Called." << std::endl;
@@ -156,6 +160,7 @@ bool Iota300::SetPumpOn( void ) const {
 /// return success flag
 ///
 bool Iota300::SetPumpOff( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __IOTA300_DEBUG
   std::cout << "[Iota300::SetPumpOff] -- DEBUG: Called." << std::endl;
@@ -187,6 +192,7 @@ bool Iota300::SetPumpOff( void ) const {
 /// return success flag
 ///
 bool Iota300::SetStatus( const float status ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __IOTA300_DEBUG
   std::cout << "[Iota300::SetStatus] -- DEBUG: Called." << std::endl;
@@ -233,6 +239,7 @@ bool Iota300::SetStatus( const float status ) const {
 /// return success flag
 ///
 float Iota300::GetSetFlow( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __IOTA300_DEBUG
   std::cout << "[Iota300::GetFlow] -- DEBUG: Called." << std::endl;
@@ -257,6 +264,7 @@ float Iota300::GetSetFlow( void ) const {
 ///
 ///
 float Iota300::GetActFlow( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __IOTA300_DEBUG
   std::cout << "[Iota300::GetFlow] -- DEBUG: Called." << std::endl;
@@ -279,6 +287,7 @@ float Iota300::GetActFlow( void ) const {
 ///
 ///
 float Iota300::GetSetPressure( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __IOTA300_DEBUG
   std::cout << "[Iota300::GetPressure] -- DEBUG: Called." << std::endl;
@@ -301,6 +310,7 @@ float Iota300::GetSetPressure( void ) const {
 ///
 ///
 float Iota300::GetActPressure( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __IOTA300_DEBUG
   std::cout << "[Iota300::GetPressure] -- DEBUG: Called." << std::endl;
@@ -323,6 +333,7 @@ float Iota300::GetActPressure( void ) const {
 ///
 ///
 float Iota300::GetStatus( void ) const {
+  DEVICE_COMMAND_TIMER();
 
 #ifdef __IOTA300_DEBUG
   std::cout << "[Iota300::GetStatus] -- DEBUG: Called." << std::endl;
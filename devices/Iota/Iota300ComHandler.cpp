@@ -34,6 +34,11 @@ Iota300ComHandler::Iota300ComHandler( const ioport_t ioPort ) {
   // save ioport 
   fIoPort = ioPort;
 
+  // answers are terminated by <NL>
+  fPort.SetFeed( "\n" );
+  fPort.SetTerminator( "\n" );
+  fPort.SetTimeoutPolicy( SerialTimeoutPolicy( 1000, 50 ) );
+
   // initialize
   OpenIoPort();
   InitializeIoPort();
@@ -54,25 +59,15 @@ Iota300ComHandler::~Iota300ComHandler( void ) {
 //! Send the command string &lt;commandString&gt; to device.
 void Iota300ComHandler::SendCommand( const char *commandString ) {
 
-  char singleCharacter = 0; 
-
-  for ( unsigned int i = 0; i < strlen( commandString ); i++ ) {
-    
-    // scan command string character wise & write
-    singleCharacter = commandString[i];
-    write( fIoPortFileDescriptor, &singleCharacter, 1 );
-  }
-
-//   std::cout << "write: " << commandString << std::endl;
-
-  // send feed characters
-  SendFeedString();
+  // command and feed string in a single write
+  fPort.SendCommand( commandString );
 }
 
 //! flush the IO memory
 void Iota300ComHandler::flush(void) {
 
   sleep(2);
+  fPort.Flush();
   if(tcflush(fIoPortFileDescriptor, TCIOFLUSH)==0)
     printf("The input and output queues have been flushed\n\n");
     else{
@@ -84,34 +79,17 @@ void Iota300ComHandler::flush(void) {
 //! Read a string from device.
 /*!
 \par Input:
-  <br><b>Receive string must be at least 41 characters long.</b>
+  <br><b>Receive string must be at least 1025 characters long.</b>
 
-  This function must be placed right in time before
-  the device starts sending.
-
-  See example program in class description.
+  Returns as soon as the answer is complete.
 */
 void Iota300ComHandler::ReceiveString( char *receiveString ) {
 
-  usleep( ComHandlerDelay );
-
-  int timeout = 0, readResult = 0;
-
-  while ( timeout < 10 )  {
-
-    usleep( 100000 );
+  std::string answer;
+  fPort.ReceiveFrame( answer );
 
-    readResult = read( fIoPortFileDescriptor, receiveString, 1024 );
-
-    if ( readResult > 0 ) {
-      receiveString[readResult] = 0;
-//       std::cout << "read: " << readResult << " " << receiveString << std::endl;
-      return;
-    }
-    timeout++;
-  }
-
-  //std::cout << "timeout" << std::endl;
+  size_t length = answer.copy( receiveString, 1024 );
+  receiveString[length] = 0;
 }
 
 //! Open I/O port.
@@ -121,7 +99,8 @@ void Iota300ComHandler::ReceiveString( char *receiveString ) {
 void Iota300ComHandler::OpenIoPort( void ) noexcept(false) {
 
   // open io port ( read/write | no term control | no DCD line check )
-  fIoPortFileDescriptor = open( fIoPort, O_RDWR | O_NOCTTY  | O_NDELAY );
+  fPort.Open( fIoPort );
+  fIoPortFileDescriptor = fPort.FileDescriptor();
 
   // check if successful
   if ( fIoPortFileDescriptor == -1 ) {
@@ -130,9 +109,6 @@ void Iota300ComHandler::OpenIoPort( void ) noexcept(false) {
     std::cerr << "                               (probably it's not user-writable)."
           << std::endl;
     throw int(-1);
-  } else {
-    // configure port with no delay
-    fcntl( fIoPortFileDescriptor, F_SETFL, FNDELAY );
   }
 }
 
@@ -194,14 +170,5 @@ void Iota300ComHandler::RestoreIoPort( void ) {
 */
 void Iota300ComHandler::CloseIoPort( void ) {
 
-  close( fIoPortFileDescriptor );
-}
-
-//! Send command termination string (<CR><NL>).
-/*!
-  \internal
-*/
-void Iota300ComHandler::SendFeedString( void )
-{
-  write( fIoPortFileDescriptor, "\n", 2 ); // /r nicht noetig?
+  fPort.Close();
 }
@@ -13,6 +13,7 @@
 //#####################
 
 #include "Iota300Fake.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 ///
 ///
@@ -30,6 +31,7 @@ Iota300Fake::Iota300Fake( const ioport_t ioPort )
 /// returns success flag
 ///
 bool Iota300Fake::SetFlow( const float flow ) const {
+  DEVICE_COMMAND_TIMER();
 
   if( flow > Iota300UpperFlowLimit || flow < Iota300LowerFlowLimit ) {
     std::cerr << " [Iota300Fake::SetFlow] ** ERROR: Flow Q="
@@ -50,6 +52,7 @@ bool Iota300Fake::SetFlow( const float flow ) const {
 /// returns success flag
 ///
 bool Iota300Fake::SetPressure( const float pressure ) const {
+  DEVICE_COMMAND_TIMER();
 
   if( pressure > Iota300UpperPressureLimit || pressure < Iota300LowerPressureLimit ) {
     std::cerr << " [Iota300Fake::SetPressure] ** ERROR: p="
@@ -71,6 +74,8 @@ bool Iota300Fake::SetPressure( const float pressure ) const {
 ///
 bool Iota300Fake::SetPumpOn( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [IotaFake::SetCirculatorOn] -- FAKE: Setting pump ON "
             << std::endl;
 
@@ -84,6 +89,8 @@ bool Iota300Fake::SetPumpOn( void ) const
 ///
 bool Iota300Fake::SetPumpOff( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [IotaFake::SetCirculatorOn] -- FAKE: Setting pump OFF "
             << std::endl;
 
@@ -96,6 +103,7 @@ bool Iota300Fake::SetPumpOff( void ) const
 /// returns success flag
 ///
 bool Iota300Fake::SetStatus( const float status ) const {
+  DEVICE_COMMAND_TIMER();
 
   /*
   if( status > __IOTA300_UPPER_STATUS_LIMIT || status < __IOTA300_LOWER_STATUS_LIMIT ) {
@@ -120,6 +128,8 @@ bool Iota300Fake::SetStatus( const float status ) const {
 ///
 float Iota300Fake::GetSetFlow( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [Iota300Fake::GetSetFlow] -- FAKE: Returning Q = "
         << flow_ << std::endl;
   usleep( 10000 );
@@ -130,6 +140,8 @@ float Iota300Fake::GetSetFlow( void ) const
 ///
 float Iota300Fake::GetActFlow( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [Iota300Fake::GetActFlow] -- FAKE: Returning Q = "
         << flow_ << std::endl;
   usleep( 10000 );
@@ -141,6 +153,8 @@ float Iota300Fake::GetActFlow( void ) const
 ///
 float Iota300Fake::GetSetPressure( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [Iota300Fake::GetSetPressure] -- FAKE: Returning Q = "
         << pressure_ << std::endl;
   usleep( 10000 );
@@ -151,6 +165,8 @@ float Iota300Fake::GetSetPressure( void ) const
 ///
 float Iota300Fake::GetActPressure( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [Iota300Fake::GetActPressure] -- FAKE: Returning Q = "
         << pressure_ << std::endl;
   usleep( 10000 );
@@ -162,6 +178,8 @@ float Iota300Fake::GetActPressure( void ) const
 ///
 float Iota300Fake::GetStatus( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [Iota300Fake::GetStatus] -- FAKE: Returning Status = "
 	    << status_ << std::endl;
   usleep( 10000 );
@@ -20,6 +20,7 @@
 #include "FP50ComHandler.h"
 
 #include "JulaboFP50.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 //#####################
 // TODO:
@@ -41,6 +42,7 @@ JulaboFP50::JulaboFP50( const ioport_t ioPort )
 /// returns success flag
 ///
 bool JulaboFP50::SetWorkingTemperature( const float workingTemp ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::SetWorkingTemp] -- DEBUG: Called." << std::endl;
@@ -79,6 +81,7 @@ bool JulaboFP50::SetWorkingTemperature( const float workingTemp ) const {
 /// pressureStage = 1..4
 ///
 bool JulaboFP50::SetPumpPressure( const unsigned int pressureStage ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::SetPumpPressure] -- DEBUG: Called." << std::endl;
@@ -115,6 +118,7 @@ bool JulaboFP50::SetPumpPressure( const unsigned int pressureStage ) const {
 /// return success flag
 ///
 bool JulaboFP50::SetCirculatorOn( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::SetCirculatorOn] -- DEBUG: Called." << std::endl;
@@ -142,6 +146,7 @@ bool JulaboFP50::SetCirculatorOn( void ) const {
 /// return success flag
 ///
 bool JulaboFP50::SetCirculatorOff( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::SetCirculatorOf] -- DEBUG: Called." << std::endl;
@@ -171,6 +176,7 @@ bool JulaboFP50::SetCirculatorOff( void ) const {
 /// xp = prop. / tn = int / tv = diff
 ///
 bool JulaboFP50::SetControlParameters( float xp, int tn, int tv ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::SetControlParameters] -- DEBUG: Called." << std::endl;
@@ -260,6 +266,7 @@ bool JulaboFP50::SetControlParameters( float xp, int tn, int tv ) const {
 ///
 ///
 float JulaboFP50::GetBathTemperature( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::GetBathTemperature] -- DEBUG: Called." << std::endl;
@@ -278,6 +285,7 @@ float JulaboFP50::GetBathTemperature( void ) const {
 ///
 ///
 float JulaboFP50::GetSafetySensorTemperature( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::GetSafetySensorTemperature] -- DEBUG: Called." << std::endl;
@@ -297,6 +305,7 @@ float JulaboFP50::GetSafetySensorTemperature( void ) const {
 ///
 ///
 float JulaboFP50::GetWorkingTemperature( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::GetWorkingTemperature] -- DEBUG: Called." << std::endl;
@@ -317,6 +326,8 @@ float JulaboFP50::GetWorkingTemperature( void ) const {
 ///
 int JulaboFP50::GetHeatingPower( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::GetHeatingPower] -- DEBUG: Called." << std::endl;
   #endif
@@ -335,6 +346,7 @@ int JulaboFP50::GetHeatingPower( void ) const
 ///
 ///
 unsigned int JulaboFP50::GetPumpPressure( void ) const {
+  DEVICE_COMMAND_TIMER();
   
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::GetPumpPressure] -- DEBUG: Called." << std::endl;
@@ -354,6 +366,7 @@ unsigned int JulaboFP50::GetPumpPressure( void ) const {
 /// true = on / false = off
 ///
 bool JulaboFP50::GetCirculatorStatus( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::GetCirculatorStatus] -- DEBUG: Called." << std::endl;
@@ -377,6 +390,7 @@ bool JulaboFP50::GetCirculatorStatus( void ) const {
 /// separate extracted status/error number
 ///
 std::pair<int,std::string> JulaboFP50::GetStatus( void ) const {
+  DEVICE_COMMAND_TIMER();
   
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::GetStatus] -- DEBUG: Called." << std::endl;
@@ -417,6 +431,7 @@ std::pair<int,std::string> JulaboFP50::GetStatus( void ) const {
 ///
 ///
 float JulaboFP50::GetProportionalParameter( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::GetProportionalParameter] -- DEBUG: Called."
@@ -436,6 +451,7 @@ float JulaboFP50::GetProportionalParameter( void ) const {
 ///
 ///
 int JulaboFP50::GetIntegralParameter( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::GetIntegralParameter] -- DEBUG: Called." << std::endl;
@@ -455,6 +471,7 @@ int JulaboFP50::GetIntegralParameter( void ) const {
 ///
 ///
 int JulaboFP50::GetDifferentialParameter( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::GetDifferentialParameter] -- DEBUG: Called." << std::endl;
@@ -474,6 +491,7 @@ int JulaboFP50::GetDifferentialParameter( void ) const {
 /// save pid parameters to file
 ///
 bool JulaboFP50::SaveControlParameters( const std::string& filepath ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::SaveControlParameters] -- DEBUG: Called." << std::endl;
@@ -500,6 +518,7 @@ bool JulaboFP50::SaveControlParameters( const std::string& filepath ) const {
 /// return success flag
 ///
 bool JulaboFP50::LoadControlParametersAndApply( const std::string& filepath ) const {
+  DEVICE_COMMAND_TIMER();
 
   #ifdef __JULABOFP50_DEBUG
   std::cout << "[JulaboFP50::LoadControlParametersAndApply] -- DEBUG: Called."
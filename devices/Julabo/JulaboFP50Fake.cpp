@@ -18,6 +18,7 @@
 //#####################
 
 #include "JulaboFP50Fake.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 ///
 ///
@@ -35,6 +36,7 @@ JulaboFP50Fake::JulaboFP50Fake( const ioport_t ioPort )
 /// returns success flag
 ///
 bool JulaboFP50Fake::SetWorkingTemperature( const float workingTemp ) const {
+  DEVICE_COMMAND_TIMER();
 
   if( workingTemp > FP50UpperTempLimit || workingTemp < FP50LowerTempLimit ) {
     std::cerr << " [JulaboFP50Fake::SetWorkingTemp] ** ERROR: working temp T="
@@ -55,6 +57,7 @@ bool JulaboFP50Fake::SetWorkingTemperature( const float workingTemp ) const {
 /// pressureStage = 1..4
 ///
 bool JulaboFP50Fake::SetPumpPressure( const unsigned int pressureStage ) const {
+  DEVICE_COMMAND_TIMER();
 
   if( pressureStage < 1 || pressureStage > 4 ) {
     std::cerr << " [JulaboFP50Fake::SetPumpPressure] ** ERROR: Invalid pressure stage: "
@@ -74,6 +77,8 @@ bool JulaboFP50Fake::SetPumpPressure( const unsigned int pressureStage ) const {
 ///
 bool JulaboFP50Fake::SetCirculatorOn( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [JulaboFP50Fake::SetCirculatorOn] -- FAKE: Setting circulator ON "
             << std::endl;
 
@@ -85,6 +90,8 @@ bool JulaboFP50Fake::SetCirculatorOn( void ) const
 ///
 bool JulaboFP50Fake::SetCirculatorOff( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [JulaboFP50Fake::SetCirculatorOff] -- FAKE: Setting circulator OFF"
             << std::endl;
 
@@ -97,6 +104,8 @@ bool JulaboFP50Fake::SetCirculatorOff( void ) const
 ///
 bool JulaboFP50Fake::SetControlParameters( float xp, int tn, int tv ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [JulaboFP50Fake::SetCirculatorOff] -- FAKE: Setting control pars: ";
   std::cout << "xp=" << xp << " tn=" << tn << " tv=" << tv << "." << std::endl;
   
@@ -108,6 +117,8 @@ bool JulaboFP50Fake::SetControlParameters( float xp, int tn, int tv ) const
 ///
 float JulaboFP50Fake::GetBathTemperature( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [JulaboFP50Fake::GetBathTemperature] -- FAKE: Returning T = -23.5"
             << std::endl;
   usleep( 10000 );
@@ -119,6 +130,8 @@ float JulaboFP50Fake::GetBathTemperature( void ) const
 ///
 float JulaboFP50Fake::GetSafetySensorTemperature( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [JulaboFP50Fake::GetSafetySensorTemperature] -- FAKE: Returning T = -21.0"
             << std::endl;
   usleep( 10000 );
@@ -131,6 +144,8 @@ float JulaboFP50Fake::GetSafetySensorTemperature( void ) const
 ///
 float JulaboFP50Fake::GetWorkingTemperature( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [JulaboFP50Fake::GetWorkingTemperature] -- FAKE: Returning T = -23.5"
             << std::endl;
   usleep( 10000 );
@@ -142,6 +157,8 @@ float JulaboFP50Fake::GetWorkingTemperature( void ) const
 ///
 int JulaboFP50Fake::GetHeatingPower( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [JulaboFP50Fake::GetHeatingPower] -- FAKE: Returning P = 34 %"
             << std::endl;
   usleep( 10000 );
@@ -152,6 +169,7 @@ int JulaboFP50Fake::GetHeatingPower( void ) const
 ///
 ///
 unsigned int JulaboFP50Fake::GetPumpPressure( void ) const {
+  DEVICE_COMMAND_TIMER();
   
   std::cout << " [JulaboFP50Fake::GetPumpPressure] -- FAKE: Returning: 2"
             << std::endl;
@@ -164,6 +182,7 @@ unsigned int JulaboFP50Fake::GetPumpPressure( void ) const {
 /// true = on / false = off
 ///
 bool JulaboFP50Fake::GetCirculatorStatus( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   std::cout << " [JulaboFP50Fake::GetCirculatorStatus] -- FAKE: Returning: "
             << (circulatorStatus?"TRUE":"FALSE") << std::endl;
@@ -176,6 +195,7 @@ bool JulaboFP50Fake::GetCirculatorStatus( void ) const {
 ///
 ///
 std::pair<int,std::string> JulaboFP50Fake::GetStatus( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   const int out1 = -13;
   const std::string out2("WARNING : VALUE EXCEEDS TEMPERATURE LIMITS");
@@ -193,6 +213,7 @@ std::pair<int,std::string> JulaboFP50Fake::GetStatus( void ) const {
 ///
 ///
 float JulaboFP50Fake::GetProportionalParameter( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   std::cout << " [JulaboFP50Fake::GetProportionalParameter] -- FAKE: returning: "
             << parameterProp_ << std::endl;
@@ -204,6 +225,7 @@ float JulaboFP50Fake::GetProportionalParameter( void ) const {
 ///
 ///
 int JulaboFP50Fake::GetIntegralParameter( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   std::cout << " [JulaboFP50Fake::GetIntegralParameter] -- FAKE: returning: "
             <<  parameterIntl_ << std::endl;
@@ -215,6 +237,7 @@ int JulaboFP50Fake::GetIntegralParameter( void ) const {
 ///
 ///
 int JulaboFP50Fake::GetDifferentialParameter( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   std::cout << " [JulaboFP50Fake::GetDifferentialParameter] -- FAKE: returning: "
             << parameterDiff_ << std::endl;
@@ -226,6 +249,7 @@ int JulaboFP50Fake::GetDifferentialParameter( void ) const {
 ///
 ///
 bool JulaboFP50Fake::SaveControlParameters( const std::string& filepath ) const {
+  DEVICE_COMMAND_TIMER();
 
   std::ofstream file( filepath.c_str() );
   if ( file.bad() ) {
@@ -248,6 +272,7 @@ bool JulaboFP50Fake::SaveControlParameters( const std::string& filepath ) const
 ///
 bool JulaboFP50Fake::LoadControlParametersAndApply( const std::string& filepath ) const
 {
+  DEVICE_COMMAND_TIMER();
 
   std::ifstream file( filepath.c_str(), std::ios::in );
   if ( file.bad() ) {
@@ -35,6 +35,11 @@ KMMComHandler::KMMComHandler( ioport_t ioPort ) {
   // save ioport 
   fIoPort = ioPort;
 
+  // answers are terminated by <NL> (TX TERM: LF)
+  fPort.SetFeed( "\n" );
+  fPort.SetTerminator( "\n" );
+  fPort.SetTimeoutPolicy( SerialTimeoutPolicy( 2000, 100 ) );
+
   // initialize
   OpenIoPort();
   InitializeIoPort();
@@ -55,53 +60,52 @@ KMMComHandler::~KMMComHandler( void ) {
 //! Send the command string &lt;commandString&gt; to device.
 void KMMComHandler::SendCommand( const char *commandString )
 {
-  if (fIoPortFileDescriptor != -1 ) {
+  if (fIoPortFileDescriptor == -1 ) return;
 
-    char singleCharacter = 0; 
-    
-    for ( unsigned int i = 0; i < strlen( commandString ); i++ ) {
-      
-      // scan command string character wise & write
-      singleCharacter = commandString[i];
-      write( fIoPortFileDescriptor, &singleCharacter, 1 );
-    }
-    
-    // send feed characters ( <CR> <LF> )
-    SendFeedString();
-  }
+  // command and feed string in a single write
+  fPort.SendCommand( commandString );
 }
 
 //! Read a string from device.
 /*!
 \par Input:
-  <br><b>Receive string must be at least 41 characters long.</b>
-
-  This function must be placed right in time before
-  the device starts sending.
+  <br><b>Receive string must be at least 1025 characters long.</b>
 
-  See example program in class description.
+  Returns as soon as the answer is complete.
 */
 void KMMComHandler::ReceiveString( char *receiveString ) {
 
-  usleep( 1000000 );
+  receiveString[0] = 0;
 
-  if (fIoPortFileDescriptor != -1 ) {
-    int timeout = 0, readResult = 0;
-    
-    while ( timeout < 100000 )  {
-      
-      readResult = read( fIoPortFileDescriptor, receiveString, 1024 );
-      
-      if ( readResult > 0 )   {
-	receiveString[readResult] = 0;
-	break;
-      }
-      
-      timeout++;
-    }
-  } else {
-    receiveString[0] = 0;
-  }
+  if (fIoPortFileDescriptor == -1 ) return;
+
+  std::string answer;
+  fPort.ReceiveFrame( answer );
+
+  size_t length = answer.copy( receiveString, 1024 );
+  receiveString[length] = 0;
+}
+
+//! Read a single <LF> terminated line from device.
+/*!
+  Returns as soon as the terminator arrived, without the fixed delay
+  of ReceiveString. The terminator is stripped.
+  \par Input:
+  <br><b>timeout</b> maximum time to wait for the complete line in ms.
+  \return false if the line was not complete within timeout.
+*/
+bool KMMComHandler::ReceiveLine( std::string& receiveString, int timeout )
+{
+  receiveString.clear();
+
+  if (fIoPortFileDescriptor == -1 ) return false;
+
+  if ( !fPort.ReceiveFrame( receiveString, timeout ) ) return false;
+
+  std::string::size_type pos = receiveString.find( '\n' );
+  if ( pos != std::string::npos ) receiveString.erase( pos );
+
+  return true;
 }
 
 //! Open I/O port.
@@ -112,7 +116,8 @@ void KMMComHandler::OpenIoPort( void ) noexcept(false)
 {
 
   // open io port ( read/write | no term control | no DCD line check )
-  fIoPortFileDescriptor = open( fIoPort, O_RDWR | O_NOCTTY  | O_NDELAY );
+  fPort.Open( fIoPort );
+  fIoPortFileDescriptor = fPort.FileDescriptor();
 
   // check if successful
   if ( fIoPortFileDescriptor == -1 ) {
@@ -122,9 +127,6 @@ void KMMComHandler::OpenIoPort( void ) noexcept(false)
               << std::endl;
     //throw 1;
 
-  } else {
-    // configure port with no delay
-    fcntl( fIoPortFileDescriptor, F_SETFL, FNDELAY );
   }
 }
 
@@ -185,20 +187,5 @@ void KMMComHandler::RestoreIoPort( void )
 */
 void KMMComHandler::CloseIoPort( void )
 {
-  if (fIoPortFileDescriptor != -1 ) {
-    close( fIoPortFileDescriptor );
-  }
-}
-
-//! Send command termination string (<CR><NL>).
-/*!
-  \internal
-*/
-void KMMComHandler::SendFeedString( void )
-{
-  // feed string is <NL>
-  char feedString = 10;
-  
-  // write <CR> and get echo
-  write( fIoPortFileDescriptor, &feedString, 1 );
+  fPort.Close();
 }
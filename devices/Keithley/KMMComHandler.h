@@ -13,12 +13,16 @@
 #ifndef _KMMCOMHANDLER_H_
 #define _KMMCOMHANDLER_H_
 
+#include <string>
+
 #include <termios.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
 
+#include "../Serial/SerialPort.h"
+
 #define COM1 "/dev/ttyS0"
 #define COM2 "/dev/ttyS1"
 #define COM3 "/dev/ttyS2"
@@ -55,6 +59,7 @@ class KMMComHandler
 
   void SendCommand( const char *commandString );
   void ReceiveString( char *receiveString );
+  bool ReceiveLine( std::string& receiveString, int timeout );
 
  private:
 
@@ -62,12 +67,13 @@ class KMMComHandler
   void InitializeIoPort( void );
   void RestoreIoPort( void );
   void CloseIoPort( void );
-  void SendFeedString( void );
 
   int fIoPortFileDescriptor;
 
   ioport_t fIoPort;
   termios_t fCurrentTermios, fThisTermios;
+
+  SerialPort fPort;
 };
 
 /** @} */
@@ -19,12 +19,16 @@
 #include <sstream>
 
 #include "Keithley2700.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 ///
 ///
 ///
 Keithley2700::Keithley2700( ioport_t port )
-    : VKeithley2700(port)
+    : VKeithley2700(port),
+      scanInterval_( 1.0 ),
+      traceIndex_( 0 ),
+      readerRunning_( false )
 {
   comHandler_ = new KMMComHandler( port );
 
@@ -38,27 +42,51 @@ Keithley2700::Keithley2700( ioport_t port )
   Device_Init();
 }
 
+///
+///
+///
+Keithley2700::~Keithley2700()
+{
+  StopContinuousScan();
+}
+
 ///
 /// enables the channels given by string
 /// format: see ::ParseChannelString
 ///
 void Keithley2700::SetActiveChannels( std::string channelString )
 {
+  DEVICE_COMMAND_TIMER();
+
+  // the trace has to be restarted with the new scan list
+  const bool continuous = IsContinuousScan();
+  if( continuous ) StopContinuousScan();
+
   enabledChannels_.resize( 0 );
   enabledChannels_ = ParseChannelString( channelString );
 
   CalculateDelay();
 
   Device_SetChannels();
+
+  if( continuous ) StartContinuousScan( scanInterval_ );
 }
 
 void Keithley2700::SetActiveChannels( channels_t channels )
 {
+  DEVICE_COMMAND_TIMER();
+
+  // the trace has to be restarted with the new scan list
+  const bool continuous = IsContinuousScan();
+  if( continuous ) StopContinuousScan();
+
   enabledChannels_ = channels;
 
   CalculateDelay();
 
   Device_SetChannels();
+
+  if( continuous ) StartContinuousScan( scanInterval_ );
 }
 
 ///
@@ -66,6 +94,11 @@ void Keithley2700::SetActiveChannels( channels_t channels )
 /// format: see ParseChannelString
 ///
 void Keithley2700::AddActiveChannels( std::string channelString ) {
+  DEVICE_COMMAND_TIMER();
+
+  // the trace has to be restarted with the new scan list
+  const bool continuous = IsContinuousScan();
+  if( continuous ) StopContinuousScan();
 
   // append new channels
   const channels_t& newChannels = ParseChannelString( channelString );
@@ -78,6 +111,8 @@ void Keithley2700::AddActiveChannels( std::string channelString ) {
   CalculateDelay();
 
   Device_SetChannels();
+
+  if( continuous ) StartContinuousScan( scanInterval_ );
 }
 
 ///
@@ -85,6 +120,11 @@ void Keithley2700::AddActiveChannels( std::string channelString ) {
 /// format: see ParseChannelString
 ///
 void Keithley2700::DisableActiveChannels( std::string channelString ) {
+  DEVICE_COMMAND_TIMER();
+
+  // the trace has to be restarted with the new scan list
+  const bool continuous = IsContinuousScan();
+  if( continuous ) StopContinuousScan();
 
   const channels_t& newChannels = ParseChannelString( channelString );
 
@@ -104,16 +144,26 @@ void Keithley2700::DisableActiveChannels( std::string channelString ) {
   CalculateDelay();
 
   Device_SetChannels();
+
+  if( continuous ) StartContinuousScan( scanInterval_ );
 }
 
 ///
 ///
 ///
 const reading_t Keithley2700::Scan( void ) {
+  DEVICE_COMMAND_TIMER();
 
   reading_t theReading(0);
   char buffer[1000];
 
+  if( IsContinuousScan() ) {
+    std::cerr << " [Keithley2700::Scan] ** ERROR: continuous scan active,"
+              << " use ReadBufferedScan." << std::endl;
+    isScanOk_ = false;
+    return theReading;
+  }
+
   // presume that it will work..
   isScanOk_ = true;
 
@@ -171,6 +221,7 @@ const reading_t Keithley2700::Scan( void ) {
 ///
 ///
 void Keithley2700::Dump( void ) const {
+  DEVICE_COMMAND_TIMER();
 
   std::cout << " [Keithley2700::Dump] -- Channels enabled in scan: \n ";
 
@@ -230,6 +281,10 @@ void Keithley2700::Device_SetChannels( void ) const {
   
 void Keithley2700::Reset()
 {
+  DEVICE_COMMAND_TIMER();
+
+  StopContinuousScan();
+
   comHandler_->SendCommand( "ROUT:SCAN:LSEL NONE" );
   comHandler_->SendCommand( "TRAC:CLE" );
   comHandler_->SendCommand( "ROUT:OPEN:ALL" );
@@ -284,6 +339,175 @@ void Keithley2700::Device_Init( void ) const {
   //  comHandler_->SendCommand( "ROUT:OPEN:ALL" );
 }
 
+///
+/// configures the trace buffer and the trigger model once, such that the
+/// instrument scans the active channels every interval seconds on its own.
+/// the readings are drained by a reader thread and can be retrieved
+/// through ReadBufferedScan.
+///
+bool Keithley2700::StartContinuousScan( double interval ) {
+  DEVICE_COMMAND_TIMER();
+
+  if( enabledChannels_.empty() ) {
+    std::cerr << " [Keithley2700::StartContinuousScan] ** ERROR: no active channels."
+              << std::endl;
+    return false;
+  }
+
+  StopContinuousScan();
+
+  scanInterval_ = interval;
+
+  Device_StartTrace();
+
+  traceIndex_ = 0;
+  isContinuousScan_ = true;
+  readerRunning_ = true;
+  reader_ = std::thread( &Keithley2700::ReaderLoop, this );
+
+  return true;
+}
+
+///
+/// stops the reader thread and the instrument trigger model
+/// and restores the settings for single scans
+///
+void Keithley2700::StopContinuousScan( void ) {
+  DEVICE_COMMAND_TIMER();
+
+  if( !isContinuousScan_ ) return;
+
+  readerRunning_ = false;
+  if( reader_.joinable() ) reader_.join();
+
+  comHandler_->SendCommand( "ABOR" );
+  comHandler_->SendCommand( "ROUT:SCAN:LSEL NONE" );
+  comHandler_->SendCommand( "TRAC:FEED:CONT NEV" );
+  comHandler_->SendCommand( "TRAC:CLE" );
+  comHandler_->SendCommand( "FORM:ELEM READ,TST,RNUM" );
+
+  isContinuousScan_ = false;
+
+  Device_Init();
+  Device_SetChannels();
+}
+
+///
+/// trace buffer and trigger setup for continuous scans
+///
+void Keithley2700::Device_StartTrace( void ) {
+
+  std::stringstream theCommand;
+
+  comHandler_->SendCommand( "ROUT:SCAN:LSEL NONE" );
+
+  // circular trace buffer, filled with every reading
+  comHandler_->SendCommand( "TRAC:CLE" );
+  theCommand << "TRAC:POIN " << TraceBufferSize;
+  comHandler_->SendCommand( theCommand.str().c_str() );
+  comHandler_->SendCommand( "TRAC:FEED SENS" );
+  comHandler_->SendCommand( "TRAC:FEED:CONT ALW" );
+
+  // reading, time stamp (relative to the first reading) and channel
+  comHandler_->SendCommand( "TRAC:TST:FORM ABS" );
+  comHandler_->SendCommand( "FORM:ELEM READ,TST,CHAN" );
+
+  // one pass through the scan list per timer trigger, forever
+  theCommand.str("");
+  theCommand << "TRIG:TIM " << scanInterval_;
+  comHandler_->SendCommand( "TRIG:SOUR TIM" );
+  comHandler_->SendCommand( theCommand.str().c_str() );
+  comHandler_->SendCommand( "TRIG:COUN INF" );
+
+  theCommand.str("");
+  theCommand << "SAMP:COUN " << enabledChannels_.size();
+  comHandler_->SendCommand( theCommand.str().c_str() );
+
+  comHandler_->SendCommand( "ROUT:SCAN:TSO IMM" );
+  comHandler_->SendCommand( "ROUT:SCAN:LSEL INT" );
+  comHandler_->SendCommand( "INIT" );
+
+  if( isDebug_ ) {
+    std::cout << " [Keithley2700::Device_StartTrace] -- DEBUG: continuous scan every "
+              << scanInterval_ << " s" << std::endl;
+  }
+}
+
+///
+/// fetches count readings starting at buffer location start
+/// and pushes them into the reading ring
+///
+bool Keithley2700::Device_ReadTrace( unsigned int start, unsigned int count ) {
+
+  std::stringstream theCommand;
+  theCommand << "TRAC:DATA:SEL? " << start << "," << count;
+  comHandler_->SendCommand( theCommand.str().c_str() );
+
+  std::string buffer;
+  if( !comHandler_->ReceiveLine( buffer, 2000 ) ) {
+    std::cerr << " [Keithley2700::Device_ReadTrace] ** ERROR: timeout reading trace."
+              << std::endl;
+    return false;
+  }
+
+  std::vector<std::string> tokens(0);
+  Tokenize( buffer, tokens, "," );
+
+  if( tokens.size() != 3 * count ) {
+    std::cerr << " [Keithley2700::Device_ReadTrace] ** ERROR: expect "
+              << count << " reading(s) but received "
+              << tokens.size() / 3 << "." << std::endl;
+    return false;
+  }
+
+  for( std::vector<std::string>::const_iterator it = tokens.begin(); it < tokens.end(); it += 3 ) {
+
+    bufferedreading_t reading;
+    reading.value = atof( it->c_str() );
+    reading.timestamp = atof( (it+1)->c_str() );
+
+    // inverse of the mapping in Device_SetChannels
+    unsigned int theChannel = atoi( (it+2)->c_str() );
+    reading.channel = theChannel < 201 ? theChannel - 101 : theChannel - 201 + 10;
+
+    PushBufferedReading( reading );
+  }
+
+  return true;
+}
+
+///
+/// reader thread of the continuous scan. drains all readings
+/// added to the trace buffer since the last pass.
+///
+void Keithley2700::ReaderLoop( void ) {
+
+  std::string buffer;
+
+  while( readerRunning_ ) {
+
+    comHandler_->SendCommand( "TRAC:NEXT?" );
+
+    if( comHandler_->ReceiveLine( buffer, 1000 ) ) {
+
+      const unsigned int next = atoi( buffer.c_str() ) % TraceBufferSize;
+
+      while( traceIndex_ != next ) {
+
+        unsigned int count = ( next + TraceBufferSize - traceIndex_ ) % TraceBufferSize;
+        count = std::min( count, TraceBufferSize - traceIndex_ );
+        count = std::min( count, TraceFetchMax );
+
+        if( !Device_ReadTrace( traceIndex_, count ) ) break;
+
+        traceIndex_ = ( traceIndex_ + count ) % TraceBufferSize;
+      }
+    }
+
+    usleep( TracePollInterval * 1000 );
+  }
+}
+
 ///
 ///
 ///
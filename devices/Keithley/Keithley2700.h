@@ -13,6 +13,9 @@
 #ifndef __KEITHLEY2700_H
 #define __KEITHLEY2700_H
 
+#include <thread>
+#include <atomic>
+
 #include "VKeithley2700.h"
 
 #include "KMMComHandler.h"
@@ -21,6 +24,7 @@ class Keithley2700 : public VKeithley2700
 {
  public:
   Keithley2700( ioport_t );
+  ~Keithley2700();
 
   void SetActiveChannels( std::string );
   void SetActiveChannels( channels_t );
@@ -31,11 +35,21 @@ class Keithley2700 : public VKeithley2700
   bool IsScanOk( void ) { return isScanOk_; }
   void Reset();
 
+  bool StartContinuousScan( double interval );
+  void StopContinuousScan( void );
+
   // delay time constants (usec)
   // delay for 1 channel scan -- delay for 10 channel scan
   static constexpr int DelayMin = 1700000;
   static constexpr int DelayMax = 7000000;
 
+  // size of the instrument trace buffer used for continuous scans
+  static constexpr unsigned int TraceBufferSize = 1000;
+  // maximum number of readings fetched by a single TRAC:DATA:SEL? query
+  static constexpr unsigned int TraceFetchMax = 100;
+  // interval at which the reader thread drains the trace buffer (msec)
+  static constexpr int TracePollInterval = 100;
+
  private:
 
   KMMComHandler* comHandler_;
@@ -43,8 +57,16 @@ class Keithley2700 : public VKeithley2700
   bool isScanOk_;
   unsigned int uSecDelay_;
   
+  double scanInterval_;
+  unsigned int traceIndex_;
+  std::atomic<bool> readerRunning_;
+  std::thread reader_;
+
   void Device_SetChannels( void ) const;
   void Device_Init( void ) const;
+  void Device_StartTrace( void );
+  bool Device_ReadTrace( unsigned int start, unsigned int count );
+  void ReaderLoop( void );
   void CalculateDelay( void );
 };
 
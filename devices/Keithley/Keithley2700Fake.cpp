@@ -12,7 +12,10 @@
 
 #include <unistd.h>
 
+#include <chrono>
+
 #include "Keithley2700Fake.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 using namespace std;
 
@@ -20,24 +23,48 @@ using namespace std;
 ///
 ///
 Keithley2700Fake::Keithley2700Fake( ioport_t port )
-    : VKeithley2700(port)
+    : VKeithley2700(port),
+      scanInterval_( 1.0 ),
+      readerRunning_( false )
 {
 
 }
 
+///
+///
+///
+Keithley2700Fake::~Keithley2700Fake()
+{
+  StopContinuousScan();
+}
+
 ///
 /// enables the channels given by string
 /// format: see ::ParseChannelString
 ///
 void Keithley2700Fake::SetActiveChannels( string channelString )
 {
+  DEVICE_COMMAND_TIMER();
+
+  const bool continuous = IsContinuousScan();
+  if( continuous ) StopContinuousScan();
+
   enabledChannels_.resize( 0 );
   enabledChannels_ = ParseChannelString( channelString );
+
+  if( continuous ) StartContinuousScan( scanInterval_ );
 }
 
 void Keithley2700Fake::SetActiveChannels( channels_t channels )
 {
+  DEVICE_COMMAND_TIMER();
+
+  const bool continuous = IsContinuousScan();
+  if( continuous ) StopContinuousScan();
+
   enabledChannels_ = channels;
+
+  if( continuous ) StartContinuousScan( scanInterval_ );
 }
 
 ///
@@ -46,6 +73,11 @@ void Keithley2700Fake::SetActiveChannels( channels_t channels )
 ///
 void Keithley2700Fake::AddActiveChannels( string channelString )
 {
+  DEVICE_COMMAND_TIMER();
+
+  const bool continuous = IsContinuousScan();
+  if( continuous ) StopContinuousScan();
+
   // append new channels
   const channels_t& newChannels = ParseChannelString( channelString );
   enabledChannels_.insert( enabledChannels_.end(), newChannels.begin(), newChannels.end() );
@@ -53,6 +85,8 @@ void Keithley2700Fake::AddActiveChannels( string channelString )
   // re-sort and remove duplicates
   std::sort( enabledChannels_.begin(), enabledChannels_.end() );
   enabledChannels_.erase( std::unique( enabledChannels_.begin(), enabledChannels_.end() ), enabledChannels_.end() );
+
+  if( continuous ) StartContinuousScan( scanInterval_ );
 }
 
 ///
@@ -60,6 +94,10 @@ void Keithley2700Fake::AddActiveChannels( string channelString )
 /// format: see ParseChannelString
 ///
 void Keithley2700Fake::DisableActiveChannels( string channelString ) {
+  DEVICE_COMMAND_TIMER();
+
+  const bool continuous = IsContinuousScan();
+  if( continuous ) StopContinuousScan();
 
   const channels_t& newChannels = ParseChannelString( channelString );
 
@@ -75,6 +113,8 @@ void Keithley2700Fake::DisableActiveChannels( string channelString ) {
     }
 
   }
+
+  if( continuous ) StartContinuousScan( scanInterval_ );
 }
 
 ///
@@ -82,6 +122,8 @@ void Keithley2700Fake::DisableActiveChannels( string channelString ) {
 ///
 const reading_t Keithley2700Fake::Scan( void )
 {
+  DEVICE_COMMAND_TIMER();
+
   reading_t theReading;
 
   for (channels_t::const_iterator channelsIt = enabledChannels_.begin();
@@ -94,11 +136,82 @@ const reading_t Keithley2700Fake::Scan( void )
   return theReading;
 }
 
+///
+/// emulates the trace buffer of the instrument: a reader thread produces
+/// one reading per active channel every interval seconds, time stamped
+/// relative to the start of the scan
+///
+bool Keithley2700Fake::StartContinuousScan( double interval )
+{
+  DEVICE_COMMAND_TIMER();
+
+  if( enabledChannels_.empty() ) return false;
+
+  StopContinuousScan();
+
+  scanInterval_ = interval;
+  isContinuousScan_ = true;
+  readerRunning_ = true;
+  reader_ = std::thread( &Keithley2700Fake::ReaderLoop, this );
+
+  return true;
+}
+
+///
+///
+///
+void Keithley2700Fake::StopContinuousScan( void )
+{
+  DEVICE_COMMAND_TIMER();
+
+  if( !isContinuousScan_ ) return;
+
+  readerRunning_ = false;
+  if( reader_.joinable() ) reader_.join();
+
+  isContinuousScan_ = false;
+}
+
+///
+///
+///
+void Keithley2700Fake::ReaderLoop( void )
+{
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  const std::chrono::microseconds interval( (long)( scanInterval_ * 1.e6 ) );
+  std::chrono::steady_clock::time_point nextScan = start;
+
+  while( readerRunning_ ) {
+
+    if( std::chrono::steady_clock::now() >= nextScan ) {
+
+      double timestamp = std::chrono::duration<double>( nextScan - start ).count();
+
+      for( channels_t::const_iterator it = enabledChannels_.begin(); it != enabledChannels_.end(); ++it ) {
+        bufferedreading_t reading;
+        reading.channel = *it;
+        reading.value = 10.0 + *it + (std::rand() % 100)/100.;
+        reading.timestamp = timestamp;
+        PushBufferedReading( reading );
+
+        // channel switching time of the scanner card
+        timestamp += 0.005;
+      }
+
+      nextScan += interval;
+    }
+
+    usleep( 10000 );
+  }
+}
+
 ///
 ///
 ///
 bool Keithley2700Fake::IsScanOk( void )
 {
+  DEVICE_COMMAND_TIMER();
+
   return true;
 }
 
@@ -107,6 +220,8 @@ bool Keithley2700Fake::IsScanOk( void )
 ///
 void Keithley2700Fake::Dump( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::cout << " [Keithley2700Fake::Dump] -- Channels enabled in scan: \n ";
 
   for( channels_t::const_iterator it = enabledChannels_.begin(); it < enabledChannels_.end(); ++it ) {
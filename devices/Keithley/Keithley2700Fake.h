@@ -20,6 +20,8 @@
 #include <cstdlib>
 #include <algorithm>
 #include <sstream>
+#include <thread>
+#include <atomic>
 
 #include "VKeithley2700.h"
 
@@ -27,6 +29,7 @@ class Keithley2700Fake : public VKeithley2700
 {
  public:
   Keithley2700Fake( ioport_t );
+  ~Keithley2700Fake();
 
   void SetActiveChannels( std::string );
   void SetActiveChannels( channels_t );
@@ -35,11 +38,20 @@ class Keithley2700Fake : public VKeithley2700
   const reading_t Scan( void );
   void Dump( void ) const;
   bool IsScanOk( void );
-  void Reset() { }
+  void Reset() { StopContinuousScan(); }
+
+  bool StartContinuousScan( double interval );
+  void StopContinuousScan( void );
 
 protected:
 
   std::vector<int> activeChannels_;
+
+  double scanInterval_;
+  std::atomic<bool> readerRunning_;
+  std::thread reader_;
+
+  void ReaderLoop( void );
 };
 
 #endif
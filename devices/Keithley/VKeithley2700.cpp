@@ -22,6 +22,9 @@
 ///
 ///
 VKeithley2700::VKeithley2700( ioport_t port )
+  : isContinuousScan_( false ),
+    bufferOverflows_( 0 ),
+    readingRing_( 1024 )
 {
 
 }
@@ -34,6 +37,34 @@ VKeithley2700::~VKeithley2700()
 
 }
 
+///
+/// appends all readings of the continuous scan that arrived since the
+/// last call to readings. never blocks; to be called from a single
+/// consumer thread.
+///
+unsigned int VKeithley2700::ReadBufferedScan( bufferedreadings_t& readings )
+{
+  unsigned int count = 0;
+  bufferedreading_t reading;
+
+  while( readingRing_.pop( reading ) ) {
+    readings.push_back( reading );
+    ++count;
+  }
+
+  return count;
+}
+
+///
+/// to be called from the single reader thread of a continuous scan
+///
+void VKeithley2700::PushBufferedReading( const bufferedreading_t& reading )
+{
+  if( !readingRing_.push( reading ) ) {
+    ++bufferOverflows_;
+  }
+}
+
 ///
 /// string:
 /// comma separated list of channels or channel ranges
@@ -15,6 +15,9 @@
 
 #include <string>
 #include <vector>
+#include <atomic>
+
+#include "../../common/Ringbuffer.h"
 
 typedef std::vector<std::pair<unsigned int, double> > reading_t;
 typedef std::vector<unsigned int> channels_t;
@@ -22,6 +25,14 @@ typedef std::pair<unsigned int, unsigned int> range_t;
 
 typedef const char* ioport_t;
 
+/// single reading of a continuous scan, time stamped by the instrument
+struct bufferedreading_t {
+  unsigned int channel;
+  double value;
+  double timestamp; ///< seconds since the start of the continuous scan
+};
+typedef std::vector<bufferedreading_t> bufferedreadings_t;
+
 class VKeithley2700
 {
  public:
@@ -37,6 +48,15 @@ class VKeithley2700
   virtual bool IsScanOk( void ) = 0;
   virtual void Reset() = 0;
 
+  // continuous acquisition: the instrument scans the active channels
+  // every interval seconds into its trace buffer, which is drained by
+  // a reader thread into a lock-free ring
+  virtual bool StartContinuousScan( double interval ) = 0;
+  virtual void StopContinuousScan( void ) = 0;
+  bool IsContinuousScan( void ) const { return isContinuousScan_; }
+  unsigned int ReadBufferedScan( bufferedreadings_t& readings );
+  unsigned long GetBufferOverflows( void ) const { return bufferOverflows_; }
+
   const channels_t GetActiveChannels() { return enabledChannels_; }
 
   // the number of channels available to the device,
@@ -52,7 +72,13 @@ class VKeithley2700
   unsigned int EvaluateChannelToken( const std::string& ) const;
   const range_t EvaluateRangeToken( const std::string& ) const;
 
+  void PushBufferedReading( const bufferedreading_t& reading );
+
   channels_t enabledChannels_;
+
+  bool isContinuousScan_;
+  std::atomic<unsigned long> bufferOverflows_;
+  SPSCRingbuffer<bufferedreading_t> readingRing_;
 };
 
 #endif
@@ -17,6 +17,7 @@
 #include <iostream>
 
 #include "Keyence.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 //#define KEYENCEDEBUG 1
 
@@ -43,6 +44,8 @@ bool Keyence::DeviceAvailable() const
 // low level debugging methods
 void Keyence::SendCommand(const std::string & command)
 {
+  DEVICE_COMMAND_TIMER();
+
 #ifdef KEYENCEDEBUG
   std::cout << "SendCommand: " << command << std::endl;
 #endif
@@ -51,6 +54,8 @@ void Keyence::SendCommand(const std::string & command)
 
 void Keyence::ReceiveString(std::string & buffer)
 {
+  DEVICE_COMMAND_TIMER();
+
   usleep(1000);
 
   char temp[1000];
@@ -67,6 +72,8 @@ void Keyence::ReceiveString(std::string & buffer)
 //only in communication mode
 void Keyence::SetABLE(bool on, int out)
 {
+    DEVICE_COMMAND_TIMER();
+
     if(!comMode_){ChangeToCommunicationMode(true);}
     std::string response = SetValue("SW,HA,M,",out,on);
     if(response != "SW,HA"){
@@ -88,6 +95,8 @@ void Keyence::SetABLE(bool on, int out)
 */
 void Keyence::SetMaterialMode(int out, int mode)
 {
+    DEVICE_COMMAND_TIMER();
+
     if(!comMode_){ChangeToCommunicationMode(true);}
     std::string response = SetValue("SW,HB,",out, mode);
     if(response != "SW,HB"){
@@ -106,6 +115,8 @@ mode = 1 -> mirror reflection mode
 */
 void Keyence::SetDiffuseMode(int out, int mode)
 {
+    DEVICE_COMMAND_TIMER();
+
     if(!comMode_){ChangeToCommunicationMode(true);}
     std::string response = SetValue("SW,HE,",out,mode);
     if(response != "SW,HE"){
@@ -129,6 +140,8 @@ only in communication mode
 */
 void Keyence::SetSamplingRate(int mode)
 {
+    DEVICE_COMMAND_TIMER();
+
     if(!comMode_){ChangeToCommunicationMode(true);}
     std::string response = SetValue("SW,CA,",mode);
     if(response != "SW,CA"){
@@ -167,6 +180,8 @@ only in communication mode
 */
 void Keyence::SetAveraging(int out, int mode)
 {
+    DEVICE_COMMAND_TIMER();
+
     if(!comMode_){ChangeToCommunicationMode(true);}
     std::string response = SetValue("SW,OC,",out,"0",mode);
     if(response != "SW,OC"){
@@ -198,6 +213,8 @@ void Keyence::SetAveraging(int out, int mode)
 //communication mode (commOn = 1) -> no measurement possible, writing and reading system settings is possible 
 void Keyence::ChangeToCommunicationMode(bool commOn)
 {
+    DEVICE_COMMAND_TIMER();
+
     std::string response;
     if(commOn){
         response = SetValue("Q0");
@@ -222,6 +239,8 @@ void Keyence::ChangeToCommunicationMode(bool commOn)
 
 void Keyence::MeasurementValueOutput(int out, double & value)
 {
+    DEVICE_COMMAND_TIMER();
+
     std::string response = SetValue("M",out);
     if(response.find("ER") != std::string::npos || response.find("M") == std::string::npos ){
 	std::cout << "[Keyence::MeasurementValueOutput] ** ERROR: could not be executed, response : "
@@ -248,6 +267,8 @@ void Keyence::MeasurementValueOutput(int out, double & value)
 //lock the panel on the controller to avoid accidental pushing of buttons
 void Keyence::PanelLock(int status)
 {
+    DEVICE_COMMAND_TIMER();
+
     std::string response = SetValue("KL,", status);
     if(response != "KL"){
         std::cout << "[Keyence::PanelLock] ** ERROR: could not be executed, response : "
@@ -278,6 +299,8 @@ void Keyence::DeviceInit()
 
 void Keyence::Reset(int out)
 {
+    DEVICE_COMMAND_TIMER();
+
     std::string response = SetValue("VR,", out);
     if(response != "VR"){
         std::cout << "[Keyence::Reset] ** ERROR: could not be executed, response : "
@@ -290,6 +313,8 @@ void Keyence::Reset(int out)
 
 void Keyence::ProgramChange(int prog_number)
 {
+    DEVICE_COMMAND_TIMER();
+
     std::string response = SetValue("PW,",prog_number);
     if(response != "PW"){
         std::cout << "[Keyence::ProgramChange] ** ERROR: could not be executed, response : "
@@ -303,6 +328,8 @@ void Keyence::ProgramChange(int prog_number)
 
 void Keyence::ProgramCheck(int & value)
 {
+    DEVICE_COMMAND_TIMER();
+
     std::string response = SetValue("PR");
     if(response.find("ER") != std::string::npos || response.find("PR") == std::string::npos ){
         std::cout << "[Keyence::ProgramCheck] ** ERROR: could not be executed, response : "
@@ -320,6 +347,8 @@ void Keyence::ProgramCheck(int & value)
 /*
 void Keyence::Timing(int out, int status)
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string response = SetValue("T", status, out);
   std::ostringstream os;
   os << "T" << status;
@@ -335,6 +364,8 @@ void Keyence::Timing(int out, int status)
 /*
 void Keyence::AutoZero(int out, bool status)
 {
+  DEVICE_COMMAND_TIMER();
+
 std::string response;
   if(status){
     response = SetValue("V", out);
@@ -364,6 +395,8 @@ std::string response;
 //FIX ME!!!
 void Keyence::StatResultOutput(int out, std::string value)
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string response = SetValue("DO,", out, value);
     if(response != "PW"){
     std::cout << "[Keyence::StatResultOutput] ** ERROR: could not be executed, response : "
@@ -377,6 +410,8 @@ void Keyence::StatResultOutput(int out, std::string value)
 /*
 void Keyence::ClearStat(int out)
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string response = SetValue("DQ,", out);
   std::stringstream os;
   os << "DQ," << out;
@@ -389,71 +424,94 @@ void Keyence::ClearStat(int out)
 }
 */
 
-/*
 void Keyence::StartDataStorage()
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string response = SetValue("AS");
   if(response != "AS"){
-  std::cout << "[Keyence::StartDataStorage] ** ERROR: could not be executed, response : "
-  << response
-  << std::endl;
-  return;
+    std::cout << "[Keyence::StartDataStorage] ** ERROR: could not be executed, response : "
+              << response
+              << std::endl;
+    return;
   }
-  }
-*/
+}
 
-/*
 void Keyence::StopDataStorage()
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string response = SetValue("AP");
   if(response != "AP"){
-  std::cout << "[Keyence::StopDataStorage] ** ERROR: could not be executed, response : "
-  << response
-  << std::endl;
-  return;
+    std::cout << "[Keyence::StopDataStorage] ** ERROR: could not be executed, response : "
+              << response
+              << std::endl;
+    return;
   }
-  }
-*/
+}
 
-/*
 void Keyence::InitDataStorage()
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string response = SetValue("AQ");
   if(response != "AQ"){
-  std::cout << "[Keyence::InitDataStorage] ** ERROR: could not be executed, response : "
-  << response
-  << std::endl;
-  return;
+    std::cout << "[Keyence::InitDataStorage] ** ERROR: could not be executed, response : "
+              << response
+              << std::endl;
+    return;
   }
-  }
-*/
+}
 
-/*
-//FIX ME
-void Keyence::OutputDataStorage(int out, std::vector<double> values)
+/*!
+  Reads back the stored values of output <out>, in storage order;
+  out-of-range values ("FFFFFFF") are returned as +/-9999, as in MeasurementValueOutput.
+*/
+void Keyence::OutputDataStorage(int out, std::vector<double> & values)
 {
-  std::string response = SetValue("AO,",out,values);
-    if(response != "PW"){
+  DEVICE_COMMAND_TIMER();
+
+  values.clear();
+
+  std::string response = SetValue("AO,", out);
+  if(response.find("ER") != std::string::npos || response.compare(0, 2, "AO") != 0){
     std::cout << "[Keyence::OutputDataStorage] ** ERROR: could not be executed, response : "
-    << response
-    << std::endl;
-        return;
+              << response
+              << std::endl;
+    return;
+  }
+
+  std::istringstream is(response.substr(2));
+  std::string token;
+  while(std::getline(is, token, ',')){
+    if(token.empty()){continue;}
+
+    if(token.find("F") != std::string::npos){
+      if(token.find("-") != std::string::npos){values.push_back(-9999);}else{values.push_back(9999);}
+    }else{
+      values.push_back(std::atof(token.c_str()));
     }
+  }
 }
-*/
 
-/*
-//FIX ME
-void Keyence::DataStorageStatus(std::string value)
+/*!
+  Status of the data storage (0: stopped, 1: storing) and number of stored values.
+*/
+void Keyence::DataStorageStatus(int & status, int & count)
 {
-  std::string response = SetValue("AN",value);
-    if(response != "PW"){
+  DEVICE_COMMAND_TIMER();
+
+  std::string response = SetValue("AN");
+  if(response.find("ER") != std::string::npos || response.compare(0, 3, "AN,") != 0){
     std::cout << "[Keyence::DataStorageStatus] ** ERROR: could not be executed, response : "
-    << response
-    << std::endl;
-        return;
-    }
+              << response
+              << std::endl;
+    return;
+  }
+
+  char comma;
+  std::istringstream is(response.substr(3));
+  is >> status >> comma >> count;
 }
-*/
 
 
@@ -58,12 +58,14 @@ class Keyence : public VKeyence
   /*
   void StatResultOutput(int out, std::string value);
   void ClearStat(int out);
+  */
   void StartDataStorage();
   void StopDataStorage();
   void InitDataStorage();
-  void OutputDataStorage(int out, std::vector<double> values);
-  void DataStorageStatus(std::string value);
-  */
+  void OutputDataStorage(int out, std::vector<double> & values);
+  void DataStorageStatus(int & status, int & count);
+
+  int SamplingPeriod() const { return samplingRate_; }
 
   //for initialization
   //communicationspeed;
@@ -27,7 +27,12 @@ KeyenceComHandler::KeyenceComHandler(ioport_t ioPort)
 {
     // save ioport 
     fIoPort = ioPort;
-    
+
+    // answers are terminated by <CR>
+    fPort.SetFeed( "\r" );
+    fPort.SetTerminator( "\r" );
+    fPort.SetTimeoutPolicy( SerialTimeoutPolicy( 1000, 20 ) );
+
     // initialize
     OpenIoPort();
     InitializeIoPort();
@@ -47,17 +52,8 @@ void KeyenceComHandler::SendCommand( const char *commandString )
 {
   if (!fDeviceAvailable) return;
 
-  char singleCharacter = 0; 
-
-  for ( unsigned int i = 0; i < strlen( commandString ); i++ ) {
-    
-    // scan command string character wise & write
-    singleCharacter = commandString[i];
-    write( fIoPortFileDescriptor, &singleCharacter, 1 );
-  }
-
-  // send feed characters
-  SendFeedString();
+  // command and feed string in a single write
+  fPort.SendCommand( commandString );
 }
 
 //! Read a string from device.
@@ -65,11 +61,7 @@ void KeyenceComHandler::SendCommand( const char *commandString )
 \par Input:
   <br><b>Receive string must be at least 41 characters long.</b>
 
-  This function must be placed right in time before
-  the device starts sending.
-
-
-  See example program in class description.
+  Returns as soon as the terminating <CR> was received.
 */
 void KeyenceComHandler::ReceiveString(std::string & receiveString, char *temp_output, int samplingRate, int averagingRate )
 {
@@ -79,38 +71,19 @@ void KeyenceComHandler::ReceiveString(std::string & receiveString, char *temp_ou
 
   temp_output[0] = 0;
 
-  usleep( 5000 );
-
-  int timeout = 0;
-  size_t readResult = 0;
-  int limit = 1000 + 2*samplingRate*averagingRate;
-  while ( timeout < limit)  {
-
-    readResult = read( fIoPortFileDescriptor, temp_output, 1024 );
-    if ( readResult > 0 ) {
-      receiveString += std::string(temp_output, readResult);
-      if(receiveString.find(13) != std::string::npos){
-	break;
-      }
-    }
-    usleep ( 5 );
-    readResult = 0;
-    temp_output[0] = 0;
-    timeout++;
-  }
+  // the answer to a measurement takes up to one averaging period
+  // (sampling period in us times number of samples) to arrive
+  int timeout = 1000 + ( 2L * samplingRate * averagingRate ) / 1000;
 
-#ifdef KEYENCEDEBUG
-  std::cout<<"[KeyenceComHandler::ReceiveString] waited for "<<timeout<<" microseconds"<<std::endl;
-#endif
+  std::string answer;
+  bool complete = fPort.ReceiveFrame( answer, timeout );
+  receiveString += answer;
 
-  if ( timeout == limit ) {
-    //      std::cerr << "[KeyenceComHandler::ReceiveString] ** ERROR: command timed out! "
-    //	    << std::endl;
+  if ( !complete ) {
       std::cout << "[KeyenceComHandler::ReceiveString] ** ERROR: command timed out! "
 	    << std::endl;
       return;
   }
-
 }
 
 //! Open I/O port.
@@ -120,7 +93,8 @@ void KeyenceComHandler::ReceiveString(std::string & receiveString, char *temp_ou
 void KeyenceComHandler::OpenIoPort( void )
 {
     // open io port ( read/write | no term control | no DCD line check )
-    fIoPortFileDescriptor = open( fIoPort, O_RDWR | O_NOCTTY  | O_NDELAY );
+    fPort.Open( fIoPort );
+    fIoPortFileDescriptor = fPort.FileDescriptor();
     
     // check if successful
     if ( fIoPortFileDescriptor == -1 ) {
@@ -130,12 +104,6 @@ void KeyenceComHandler::OpenIoPort( void )
 	      << std::endl;
         fDeviceAvailable = false;
         return;
-    } else {
-        // configure port with no delay
-        int flags = fcntl(fIoPortFileDescriptor, F_GETFL, 0);
-        flags |= O_NONBLOCK;
-        flags |= FNDELAY;
-        fcntl( fIoPortFileDescriptor, F_SETFL, flags );
     }
     
     fDeviceAvailable = true;
@@ -202,22 +170,7 @@ void KeyenceComHandler::CloseIoPort( void )
 {
   if (!fDeviceAvailable) return;
 
-  close( fIoPortFileDescriptor );
-}
-
-//! Send command termination string (<CR><NL>).
-/*!
-  \internal
-*/
-void KeyenceComHandler::SendFeedString( void )
-{
-  if (!fDeviceAvailable) return;
-
-  // feed string is <CR> ; see documentation page 4.1
-  char feedString = 13;
-
-  // write <CR> and get echo
-  write( fIoPortFileDescriptor, &feedString, 1 );
+  fPort.Close();
 }
 
 bool KeyenceComHandler::DeviceAvailable()
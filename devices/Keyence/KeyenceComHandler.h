@@ -20,6 +20,8 @@
 #include <unistd.h>
 #include <string.h>
 
+#include "../Serial/SerialPort.h"
+
 typedef const char* ioport_t;
 typedef struct termios termios_t;
 
@@ -52,7 +54,6 @@ class KeyenceComHandler {
   void InitializeIoPort( void );
   void RestoreIoPort( void );
   void CloseIoPort( void );
-  void SendFeedString( void );
 
   bool fDeviceAvailable;
   int fIoPortFileDescriptor;
@@ -60,6 +61,8 @@ class KeyenceComHandler {
   ioport_t fIoPort;
   termios_t fCurrentTermios, fThisTermios;
 
+  SerialPort fPort;
+
 };
 
 #endif
@@ -13,26 +13,30 @@
 #include <unistd.h>
 
 #include <cmath>
+#include <cstdio>
 #include <sstream>
 #include <iostream>
+#include <chrono>
+#include <algorithm>
 
 #include "KeyenceFake.h"
-
-#define KEYENCEDEBUG 1
+#include "../Serial/DeviceCommandStatistics.h"
 
 KeyenceFake::KeyenceFake( const ioport_t ioPort )
   :VKeyence(ioPort),
-   isDeviceAvailable_(false)
+   ioPort_(ioPort),
+   isDeviceAvailable_(false),
+   surfaceMap_([](double x, double y){ return 0.0002 * x + 0.005 * std::sin(2. * M_PI * x / 50.) * std::cos(2. * M_PI * y / 50.); }),
+   storageActive_(false)
 {
     samplingRate_ = 20;
     averagingRate_ = 1;
-    comHandler_ = new KeyenceComHandler( ioPort );
+    programNumber_ = 0;
     DeviceInit();
 }
 
 KeyenceFake::~KeyenceFake()
 {
-  if(comHandler_) {delete comHandler_; comHandler_ = NULL;}
 }
 
 bool KeyenceFake::DeviceAvailable() const
@@ -41,20 +45,24 @@ bool KeyenceFake::DeviceAvailable() const
 }
 
 // low level debugging methods
+// no serial port is opened: the controller answers are simulated from the last command
 void KeyenceFake::SendCommand(const std::string & command)
 {
+  DEVICE_COMMAND_TIMER();
+
 #ifdef KEYENCEDEBUG
   std::cout << "SendCommand: " << command << std::endl;
 #endif
-  comHandler_->SendCommand(command.c_str());
+  lastCommand_ = command;
 }
 
 void KeyenceFake::ReceiveString(std::string & buffer)
 {
+  DEVICE_COMMAND_TIMER();
+
   usleep(1000);
 
-  char temp[1000];
-  comHandler_->ReceiveString(buffer, temp, samplingRate_, averagingRate_);
+  buffer = SimulatedResponse(lastCommand_);
   StripBuffer(buffer);
 #ifdef KEYENCEDEBUG
   std::cout << "ReceiveCommand: " << buffer << std::endl;
@@ -67,6 +75,8 @@ void KeyenceFake::ReceiveString(std::string & buffer)
 //only in communication mode
 void KeyenceFake::SetABLE(bool on, int out)
 {
+    DEVICE_COMMAND_TIMER();
+
     if(!comMode_){ChangeToCommunicationMode(true);}
     std::string response = SetValue("SW,HA,M,",out,on);
     if(response != "SW,HA"){
@@ -88,6 +98,8 @@ void KeyenceFake::SetABLE(bool on, int out)
 */
 void KeyenceFake::SetMaterialMode(int out, int mode)
 {
+    DEVICE_COMMAND_TIMER();
+
     if(!comMode_){ChangeToCommunicationMode(true);}
     std::string response = SetValue("SW,HB,",out, mode);
     if(response != "SW,HB"){
@@ -106,6 +118,8 @@ mode = 1 -> mirror reflection mode
 */
 void KeyenceFake::SetDiffuseMode(int out, int mode)
 {
+    DEVICE_COMMAND_TIMER();
+
     if(!comMode_){ChangeToCommunicationMode(true);}
     std::string response = SetValue("SW,HE,",out,mode);
     if(response != "SW,HE"){
@@ -129,6 +143,8 @@ only in communication mode
 */
 void KeyenceFake::SetSamplingRate(int mode)
 {
+    DEVICE_COMMAND_TIMER();
+
     if(!comMode_){ChangeToCommunicationMode(true);}
     std::string response = SetValue("SW,CA,",mode);
     if(response != "SW,CA"){
@@ -167,6 +183,8 @@ only in communication mode
 */
 void KeyenceFake::SetAveraging(int out, int mode)
 {
+    DEVICE_COMMAND_TIMER();
+
     if(!comMode_){ChangeToCommunicationMode(true);}
     std::string response = SetValue("SW,OC,",out,"0",mode);
     if(response != "SW,OC"){
@@ -198,6 +216,8 @@ void KeyenceFake::SetAveraging(int out, int mode)
 //communication mode (commOn = 1) -> no measurement possible, writing and reading system settings is possible 
 void KeyenceFake::ChangeToCommunicationMode(bool commOn)
 {
+    DEVICE_COMMAND_TIMER();
+
     std::string response;
     if(commOn){
         response = SetValue("Q0");
@@ -222,6 +242,8 @@ void KeyenceFake::ChangeToCommunicationMode(bool commOn)
 
 void KeyenceFake::MeasurementValueOutput(int out, double & value)
 {
+    DEVICE_COMMAND_TIMER();
+
     std::string response = SetValue("M",out);
     if(response.find("ER") != std::string::npos || response.find("M") == std::string::npos ){
 	std::cerr << "[KeyenceFake::MeasurementValueOutput] ** ERROR: could not be executed, response : "
@@ -247,6 +269,8 @@ void KeyenceFake::MeasurementValueOutput(int out, double & value)
 //lock the panel on the controller to avoid accidental pushing of buttons
 void KeyenceFake::PanelLock(int status)
 {
+    DEVICE_COMMAND_TIMER();
+
     std::string response = SetValue("KL,", status);
     if(response != "KL"){
         std::cerr << "[KeyenceFake::PanelLock] ** ERROR: could not be executed, response : "
@@ -265,18 +289,46 @@ void KeyenceFake::StripBuffer(std::string &buffer) const
 //No version checking for KeyenceFake laser available
 void KeyenceFake::DeviceInit()
 {
-    isDeviceAvailable_ = false;
-    
-    if (comHandler_->DeviceAvailable()) {
-        
-        isDeviceAvailable_ = true;
-    }
+    isDeviceAvailable_ = true;
+
+    storageIntervals_.clear();
 
     this->ChangeToCommunicationMode(false);
 }
 
+/*
+  Answers of the controller to the commands used by KeyenceFake:
+  settings are acknowledged, measured values are the heights of the surface map under the stage
+*/
+std::string KeyenceFake::SimulatedResponse(const std::string & command) const
+{
+    std::ostringstream os;
+
+    if(command.compare(0, 3, "SW,") == 0){
+        os << command.substr(0, 5);
+    }else if(command == "Q0" || command == "R0"){
+        os << command;
+    }else if(command.compare(0, 1, "M") == 0 && command.size() > 1){
+        char value[16];
+        snprintf(value, sizeof(value), "%+08.4f", SimulatedHeight(StorageTime()));
+        os << "M" << command.substr(1, 1) << "," << value;
+    }else if(command.compare(0, 3, "KL,") == 0 || command.compare(0, 3, "VR,") == 0 || command.compare(0, 3, "PW,") == 0){
+        os << command.substr(0, 2);
+    }else if(command == "PR"){
+        os << "PR," << programNumber_;
+    }else{
+        os << "ER," << command.substr(0, 2) << ",00";
+    }
+
+    os << "\r";
+
+    return os.str();
+}
+
 void KeyenceFake::Reset(int out)
 {
+    DEVICE_COMMAND_TIMER();
+
     std::string response = SetValue("VR,", out);
     if(response != "VR"){
         std::cerr << "[KeyenceFake::Reset] ** ERROR: could not be executed, response : "
@@ -289,6 +341,8 @@ void KeyenceFake::Reset(int out)
 
 void KeyenceFake::ProgramChange(int prog_number)
 {
+    DEVICE_COMMAND_TIMER();
+
     std::string response = SetValue("PW,",prog_number);
     if(response != "PW"){
         std::cerr << "[KeyenceFake::ProgramChange] ** ERROR: could not be executed, response : "
@@ -296,12 +350,16 @@ void KeyenceFake::ProgramChange(int prog_number)
                   << std::endl;
         return;
     }
+
+    programNumber_ = prog_number;
 }
 
 
 
 void KeyenceFake::ProgramCheck(int & value)
 {
+    DEVICE_COMMAND_TIMER();
+
     std::string response = SetValue("PR");
     if(response.find("ER") != std::string::npos || response.find("PR") == std::string::npos ){
         std::cerr << "[KeyenceFake::ProgramCheck] ** ERROR: could not be executed, response : "
@@ -319,6 +377,8 @@ void KeyenceFake::ProgramCheck(int & value)
 /*
 void KeyenceFake::Timing(int out, int status)
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string response = SetValue("T", status, out);
   std::ostringstream os;
   os << "T" << status;
@@ -334,6 +394,8 @@ void KeyenceFake::Timing(int out, int status)
 /*
 void KeyenceFake::AutoZero(int out, bool status)
 {
+  DEVICE_COMMAND_TIMER();
+
 std::string response;
   if(status){
     response = SetValue("V", out);
@@ -363,6 +425,8 @@ std::string response;
 //FIX ME!!!
 void KeyenceFake::StatResultOutput(int out, std::string value)
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string response = SetValue("DO,", out, value);
     if(response != "PW"){
     std::cerr << "[KeyenceFake::StatResultOutput] ** ERROR: could not be executed, response : "
@@ -376,6 +440,8 @@ void KeyenceFake::StatResultOutput(int out, std::string value)
 /*
 void KeyenceFake::ClearStat(int out)
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string response = SetValue("DQ,", out);
   std::stringstream os;
   os << "DQ," << out;
@@ -388,71 +454,89 @@ void KeyenceFake::ClearStat(int out)
 }
 */
 
-/*
+double KeyenceFake::StorageTime()
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+double KeyenceFake::SimulatedHeight(double time) const
+{
+  double x = 0, y = 0;
+  if(positionSource_ && !positionSource_(time, x, y)){ x = y = 0; }
+
+  return surfaceMap_(x, y);
+}
+
+// the data storage is simulated: the stored values are generated from the
+// surface map when they are read back, one per sampling period, at the
+// position of the stage at the time the value was stored
 void KeyenceFake::StartDataStorage()
 {
-  std::string response = SetValue("AS");
-  if(response != "AS"){
-  std::cerr << "[KeyenceFake::StartDataStorage] ** ERROR: could not be executed, response : "
-  << response
-  << std::endl;
-  return;
-  }
+  DEVICE_COMMAND_TIMER();
+
+  if(!storageActive_){
+    storageActive_ = true;
+    const double now = StorageTime();
+    storageIntervals_.push_back(std::make_pair(now, now));
   }
-*/
+}
 
-/*
 void KeyenceFake::StopDataStorage()
 {
-  std::string response = SetValue("AP");
-  if(response != "AP"){
-  std::cerr << "[KeyenceFake::StopDataStorage] ** ERROR: could not be executed, response : "
-  << response
-  << std::endl;
-  return;
-  }
+  DEVICE_COMMAND_TIMER();
+
+  if(storageActive_){
+    storageActive_ = false;
+    storageIntervals_.back().second = StorageTime();
   }
-*/
+}
 
-/*
 void KeyenceFake::InitDataStorage()
 {
-  std::string response = SetValue("AQ");
-  if(response != "AQ"){
-  std::cerr << "[KeyenceFake::InitDataStorage] ** ERROR: could not be executed, response : "
-  << response
-  << std::endl;
-  return;
-  }
-  }
-*/
+  DEVICE_COMMAND_TIMER();
 
-/*
-//FIX ME
-void KeyenceFake::OutputDataStorage(int out, std::vector<double> values)
-{
-  std::string response = SetValue("AO,",out,values);
-    if(response != "PW"){
-    std::cerr << "[KeyenceFake::OutputDataStorage] ** ERROR: could not be executed, response : "
-    << response
-    << std::endl;
-        return;
-    }
+  storageActive_ = false;
+  storageIntervals_.clear();
 }
-*/
 
-/*
-//FIX ME
-void KeyenceFake::DataStorageStatus(std::string value)
+void KeyenceFake::OutputDataStorage(int /* out */, std::vector<double> & values)
 {
-  std::string response = SetValue("AN",value);
-    if(response != "PW"){
-    std::cerr << "[KeyenceFake::DataStorageStatus] ** ERROR: could not be executed, response : "
-    << response
-    << std::endl;
-        return;
+  DEVICE_COMMAND_TIMER();
+
+  int status, count;
+  DataStorageStatus(status, count);
+
+  const double period = samplingRate_ * 1e-6;
+
+  values.resize(count);
+
+  // value i was stored at the i-th sampling period of the storage intervals
+  unsigned int interval = 0;
+  double intervalOffset = 0;
+  for(int i = 0; i < count; ++i){
+    double t = i * period - intervalOffset;
+    while(interval + 1 < storageIntervals_.size() && t >= (storageIntervals_[interval].second - storageIntervals_[interval].first)){
+      intervalOffset += storageIntervals_[interval].second - storageIntervals_[interval].first;
+      ++interval;
+      t = i * period - intervalOffset;
     }
+    values[i] = SimulatedHeight(storageIntervals_[interval].first + t);
+  }
 }
-*/
 
+void KeyenceFake::DataStorageStatus(int & status, int & count)
+{
+  DEVICE_COMMAND_TIMER();
 
+  const double now = StorageTime();
+
+  double stored = 0;
+  for(unsigned int i = 0; i < storageIntervals_.size(); ++i){
+    const bool last = (i + 1 == storageIntervals_.size());
+    stored += ((last && storageActive_) ? now : storageIntervals_[i].second) - storageIntervals_[i].first;
+  }
+
+  // the controller stores at most 65536 values
+  status = storageActive_ ? 1 : 0;
+  count = std::min(65536, int(stored * 1e6 / samplingRate_));
+}
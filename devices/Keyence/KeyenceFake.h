@@ -20,9 +20,10 @@
 #include <utility>
 #include <fstream>
 #include <cmath>
+#include <functional>
+#include <vector>
 
 #include "VKeyence.h"
-#include "KeyenceComHandler.h"
 
 class KeyenceFake : public VKeyence
 {
@@ -58,12 +59,24 @@ class KeyenceFake : public VKeyence
   /*
   void StatResultOutput(int out, std::string value);
   void ClearStat(int out);
+  */
   void StartDataStorage();
   void StopDataStorage();
   void InitDataStorage();
-  void OutputDataStorage(int out, std::vector<double> values);
-  void DataStorageStatus(std::string value);
+  void OutputDataStorage(int out, std::vector<double> & values);
+  void DataStorageStatus(int & status, int & count);
+
+  int SamplingPeriod() const { return samplingRate_; }
+
+  //! Sets the height of the simulated surface at the stage position (x, y); in mm.
+  void SetSurfaceMap(const std::function<double(double, double)>& map) { surfaceMap_ = map; }
+
+  //! Sets the source of the stage position (x, y) at a given time (on the steady clock, in seconds).
+  /*!
+    The measured and stored values are the heights of the surface map under the stage
+    at the time of the measurement (of each stored value). Without a source, the stage stays at (0, 0).
   */
+  void SetPositionSource(const std::function<bool(double, double &, double &)>& source) { positionSource_ = source; }
 
   //for initialization
   //communicationspeed;
@@ -80,11 +93,27 @@ class KeyenceFake : public VKeyence
   void StripBuffer( std::string &) const;
   void DeviceInit();
 
-  KeyenceComHandler* comHandler_;
+  std::string SimulatedResponse(const std::string &) const;
+
+  std::string ioPort_;
+  std::string lastCommand_;
   bool isDeviceAvailable_;
   bool comMode_;
   int samplingRate_;
   int averagingRate_;
+  int programNumber_;
+
+  static double StorageTime();
+
+  double SimulatedHeight(double time) const;
+
+  // simulated surface, measured under the position of the stage
+  std::function<double(double, double)> surfaceMap_;
+  std::function<bool(double, double &, double &)> positionSource_;
+
+  // simulated data storage: intervals (start, stop) during which values were stored
+  bool storageActive_;
+  std::vector<std::pair<double, double> > storageIntervals_;
 };
 
 #endif
@@ -46,12 +46,17 @@ class VKeyence {
   /*
   virtual void StatResultOutput(int out, std::string value) = 0;
   virtual void ClearStat(int out) = 0;
+  */
+
+  // data storage: the controller buffers one value per sampling period
   virtual void StartDataStorage() = 0;
   virtual void StopDataStorage() = 0;
   virtual void InitDataStorage() = 0;
-  virtual void OutputDataStorage(int out, std::vector<double> values) = 0;
-  virtual void DataStorageStatus(std::string value) = 0;
-  */
+  virtual void OutputDataStorage(int out, std::vector<double> & values) = 0;
+  virtual void DataStorageStatus(int & status, int & count) = 0;
+
+  // sampling period of the internal measurements, in microseconds
+  virtual int SamplingPeriod() const = 0;
 
   // low level methods
   virtual void SendCommand(const std::string &) = 0;
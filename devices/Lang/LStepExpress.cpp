@@ -15,10 +15,12 @@
 
 #include <cstring>
 #include <cmath>
+#include <algorithm>
 #include <sstream>
 #include <iostream>
 
 #include "LStepExpress.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 //#define LSTEPDEBUG 0
 
@@ -33,12 +35,16 @@ LStepExpress::LStepExpress(const std::string& ioport, const std::string& lstep_v
 
 LStepExpress::~LStepExpress()
 {
+  comHandler_->StopReader();
+
   delete comHandler_;
 }
 
 //! Return name of port used to initialize LStepExpressComHandler
 std::string LStepExpress::ioPort() const
 {
+  DEVICE_COMMAND_TIMER();
+
   assert(comHandler_);
 
   return comHandler_->ioPort();
@@ -52,6 +58,8 @@ bool LStepExpress::DeviceAvailable() const
 // low level debugging methods
 void LStepExpress::SendCommand(const std::string & command)
 {
+  DEVICE_COMMAND_TIMER();
+
 #ifdef LSTEPDEBUG
   std::cout << "Device SendCommand: " << command << std::endl;
 #endif
@@ -61,6 +69,8 @@ void LStepExpress::SendCommand(const std::string & command)
 
 void LStepExpress::ReceiveString(std::string & buffer)
 {
+  DEVICE_COMMAND_TIMER();
+
   usleep(1000);
 
   char buf[1000];
@@ -74,6 +84,74 @@ void LStepExpress::ReceiveString(std::string & buffer)
   buffer = buf;
 }
 
+//! Answers of several queries, in the order of the queries.
+/*!
+  The queries are sent in batches of MaxCommandsPerExchange commands,
+  each batch in one write, and the answers of a batch are read back
+  together, instead of one round trip per query. The transfer stops at
+  the first batch without a complete set of answers: answers are never
+  padded, so &lt;values&gt; only holds the answers of the complete batches.
+*/
+bool LStepExpress::GetValues(const std::vector<std::string> & commands, std::vector<std::string> & values)
+{
+  DEVICE_COMMAND_TIMER();
+
+  values.clear();
+
+  std::vector<std::string> batch;
+  std::vector<std::string> answers;
+
+  for (size_t first=0; first<commands.size(); first+=MaxCommandsPerExchange) {
+    const size_t last = std::min(commands.size(), first + MaxCommandsPerExchange);
+
+    batch.assign(commands.begin() + first, commands.begin() + last);
+
+    if (!comHandler_->SendQueries(batch, answers) || answers.size()!=batch.size()) {
+#ifdef LSTEPDEBUG
+      std::cout << "Device GetValues: transfer failed at query " << batch[0] << std::endl;
+#endif
+      return false;
+    }
+
+#ifdef LSTEPDEBUG
+    for (size_t i=0; i<batch.size(); ++i) {
+      std::cout << "Device GetValues: " << batch[i] << " -> " << answers[i] << std::endl;
+    }
+#endif
+
+    values.insert(values.end(), answers.begin(), answers.end());
+  }
+
+  return true;
+}
+
+//! Several commands without answer (e.g. settings), in batches of MaxCommandsPerExchange commands per write.
+/*!
+  The transfer stops at the first batch that could not be written.
+*/
+bool LStepExpress::SetValues(const std::vector<std::string> & commands)
+{
+  DEVICE_COMMAND_TIMER();
+
+  std::vector<std::string> batch;
+
+  for (size_t first=0; first<commands.size(); first+=MaxCommandsPerExchange) {
+    const size_t last = std::min(commands.size(), first + MaxCommandsPerExchange);
+
+    batch.assign(commands.begin() + first, commands.begin() + last);
+
+#ifdef LSTEPDEBUG
+    for (size_t i=0; i<batch.size(); ++i) {
+      std::cout << "Device SetValues: " << batch[i] << std::endl;
+    }
+#endif
+
+    if (!comHandler_->SendCommands(batch)) return false;
+  }
+
+  return true;
+}
+
 void LStepExpress::StripBuffer(char* buffer) const
 {
   for (unsigned int c=0; c<strlen(buffer);++c) {
@@ -160,25 +238,98 @@ void LStepExpress::DeviceInit(const std::string& lstep_ver, const std::string& l
 
 void LStepExpress::GetAutoStatus(int & value)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("autostatus", value);
 }
 
 void LStepExpress::SetAutoStatus(int value)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!autostatus", value);
 }
 
+//! Pass the axis status reported by the controller at the end of a move to &lt;handler&gt;.
+/*!
+  With auto status enabled (see SetAutoStatus), the controller sends the
+  axis status on its own, in the format of the answer to "statusaxis",
+  when a positioning command has finished. A reader thread then reads all
+  input of the port: those reports are passed to &lt;handler&gt; (in the
+  reader thread), the answers to queries are returned as before.
+*/
+bool LStepExpress::StartAutoStatusReader(const AxisStatusHandler & handler)
+{
+  DEVICE_COMMAND_TIMER();
+
+  if (!isDeviceAvailable_ || !handler) return false;
+
+  return comHandler_->StartReader("statusaxis",
+                                  &LStepExpress::IsAxisStatus,
+                                  [this, handler](const std::string & line) {
+#ifdef LSTEPDEBUG
+                                    std::cout << "Device AutoStatus: " << line << std::endl;
+#endif
+                                    std::vector<int> values;
+                                    ParseAxisStatus(line, values);
+                                    handler(values);
+                                  });
+}
+
+void LStepExpress::StopAutoStatusReader()
+{
+  DEVICE_COMMAND_TIMER();
+
+  comHandler_->StopReader();
+}
+
 void LStepExpress::GetAxisStatus(std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string line;
   GetValue("statusaxis", line);
-  
-  std::string token;
 
+  ParseAxisStatus(line, values);
+}
+
+//! Axis status and position of all axes in a single exchange.
+/*!
+  Both queries are sent in one write and their answers are read back in
+  order, which saves one round trip (and the settling delay of
+  ReceiveString) on every status poll.
+*/
+void LStepExpress::GetAxisStatusAndPosition(std::vector<int> & status, std::vector<double> & position)
+{
+  DEVICE_COMMAND_TIMER();
+
+  const std::vector<std::string> queries{ "statusaxis", "pos" };
+
+  std::vector<std::string> answers;
+  comHandler_->SendQueries(queries, answers);
+
+  answers.resize(queries.size());
+
+#ifdef LSTEPDEBUG
+  std::cout << "Device GetAxisStatusAndPosition: " << answers[0] << " | " << answers[1] << std::endl;
+#endif
+
+  ParseAxisStatus(answers[0], status);
+
+  position.clear();
+  std::istringstream is(answers[1]);
+  double temp;
+  while (is >> temp) {
+    position.push_back(temp);
+  }
+}
+
+void LStepExpress::ParseAxisStatus(const std::string & line, std::vector<int> & values) const
+{
   values.clear();
 
   for (unsigned int i=0;i<4;++i) {
-    char token = line[i];
+    char token = (i < line.size()) ? line[i] : ' ';
   
     switch (token) {
     case '@': {
@@ -235,243 +386,347 @@ void LStepExpress::GetAxisStatus(std::vector<int> & values)
   }
 }
 
+//! True for lines made only of axis status characters (at least one per axis), as sent for "statusaxis".
+bool LStepExpress::IsAxisStatus(const std::string & line)
+{
+  if (line.size() < 4) return false;
+
+  return (line.find_first_not_of("@MJCSAEDUTF-") == std::string::npos);
+}
+
 void LStepExpress::GetAxisEnabled(std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("axis", values);
 }
 
 void LStepExpress::GetAxisEnabled(VLStepExpress::Axis axis, int & value)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("axis", axis, value);
 }
 
 void LStepExpress::SetAxisEnabled(const std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!axis", values);
 }
 
 void LStepExpress::SetAxisEnabled(VLStepExpress::Axis axis, int value)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!axis", axis, value);
 }
 
 void LStepExpress::GetAxisDirection(std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("axisdir", values);
 }
 
 void LStepExpress::GetAxisDirection(VLStepExpress::Axis axis, int & value)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("axisdir", axis, value);
 }
 
 void LStepExpress::SetAxisDirection(const std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!axisdir", values);
 }
 
 void LStepExpress::SetAxisDirection(VLStepExpress::Axis axis, int value)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!axisdir", axis, value);
 }
 
 void LStepExpress::GetDimension(std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("dim", values);
 }
 
 void LStepExpress::GetDimension(VLStepExpress::Axis axis, int & value)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("dim", axis, value);
 }
 
 void LStepExpress::SetDimension(const std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!dim", values);
 }
 
 void LStepExpress::SetDimension(VLStepExpress::Axis axis, int value)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!dim", axis, value);
 }
 
 void LStepExpress::GetPowerAmplifierStatus(std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("pa", values);
 }
 
 void LStepExpress::GetPowerAmplifierStatus(VLStepExpress::Axis axis, int & value)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("pa", axis, value);
 }
 
 void LStepExpress::SetPowerAmplifierStatus(const std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!pa", values);
 }
 
 void LStepExpress::SetPowerAmplifierStatus(VLStepExpress::Axis axis, int value)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!pa", axis, value);
 }
 
 void LStepExpress::GetAccelerationJerk(std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("acceljerk", values);
 }
 
 void LStepExpress::GetAccelerationJerk(VLStepExpress::Axis axis, double & value)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("acceljerk", axis, value);
 }
 
 void LStepExpress::SetAccelerationJerk(const std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("acceljerk", values);
 }
 
 void LStepExpress::SetAccelerationJerk(VLStepExpress::Axis axis, double value)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("acceljerk", axis, value);
 }
 
 void LStepExpress::GetDecelerationJerk(std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("deceljerk", values);
 }
 
 void LStepExpress::GetDecelerationJerk(VLStepExpress::Axis axis, double & value)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("deceljerk", axis, value);
 }
 
 void LStepExpress::SetDecelerationJerk(const std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("deceljerk", values);
 }
 
 void LStepExpress::SetDecelerationJerk(VLStepExpress::Axis axis, double value)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("deceljerk", axis, value);
 }
 
 void LStepExpress::GetAcceleration(std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("accel", values);
 }
 
 void LStepExpress::GetAcceleration(VLStepExpress::Axis axis, double & value)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("accel", axis, value);
 }
 
 void LStepExpress::SetAcceleration(const std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("accel", values);
 }
 
 void LStepExpress::SetAcceleration(VLStepExpress::Axis axis, double value)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("accel", axis, value);
 }
 
 void LStepExpress::GetDeceleration(std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("decel", values);
 }
 
 void LStepExpress::GetDeceleration(VLStepExpress::Axis axis, double & value)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("decel", axis, value);
 }
 
 void LStepExpress::SetDeceleration(const std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("decel", values);
 }
 
 void LStepExpress::SetDeceleration(VLStepExpress::Axis axis, double value)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("decel", axis, value);
 }
 
 void LStepExpress::GetVelocity(std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("vel", values);
 }
 
 void LStepExpress::GetVelocity(VLStepExpress::Axis axis, double & value)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("vel", axis, value);
 }
 
 void LStepExpress::SetVelocity(const std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("vel", values);
 }
 
 void LStepExpress::SetVelocity(VLStepExpress::Axis axis, double value)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("vel", axis, value);
 }
 
 void LStepExpress::GetPosition(std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("pos", values);
 }
 
 void LStepExpress::GetPosition(VLStepExpress::Axis axis, double & value)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("pos", axis, value);
 }
 
 void LStepExpress::SetPosition(const std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!pos", values);
 }
 
 void LStepExpress::SetPosition(VLStepExpress::Axis axis, double value)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!pos", axis, value);
 }
 
 void LStepExpress::MoveAbsolute(const std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!moa", values);
 }
 
 void LStepExpress::MoveAbsolute(double x, double y, double z, double a)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!moa", x, y, z, a);
 }
 
 void LStepExpress::MoveAbsolute(VLStepExpress::Axis axis, double value)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!moa", axis, value);
 }
 
 void LStepExpress::MoveRelative(const std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!mor", values);
 }
 
 void LStepExpress::MoveRelative(double x, double y, double z, double a)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!mor", x, y, z, a);
 }
 
 void LStepExpress::MoveRelative(VLStepExpress::Axis axis, double value)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!mor", axis, value);
 }
 
 void LStepExpress::MoveRelative()
 {
+  DEVICE_COMMAND_TIMER();
+
   this->SendCommand("!m");
 }
 
 bool LStepExpress::GetStatus()
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string value;
   this->GetValue("status", value);
 
@@ -481,21 +736,29 @@ bool LStepExpress::GetStatus()
 
 void LStepExpress::GetSystemStatus(std::vector<int>& values)
 {
+  DEVICE_COMMAND_TIMER();
+
   this->GetValue("?sysstat", values);
 }
 
 void LStepExpress::GetSystemStatusText(std::string& value)
 {
+  DEVICE_COMMAND_TIMER();
+
   this->GetValue("?sysstatus", value);
 }
 
 void LStepExpress::GetSystemStatus(VLStepExpress::Axis axis, int & value)
 {
+  DEVICE_COMMAND_TIMER();
+
   this->GetValue("?sysstat", axis, value);
 }
 
 bool LStepExpress::GetJoystickEnabled()
 {
+  DEVICE_COMMAND_TIMER();
+
   int value;
   this->GetValue("joy", value);
   if (value==1) return true;
@@ -504,6 +767,8 @@ bool LStepExpress::GetJoystickEnabled()
 
 void LStepExpress::SetJoystickEnabled(bool enabled)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (enabled) {
     this->SendCommand("!joy 1");
   } else {
@@ -513,16 +778,22 @@ void LStepExpress::SetJoystickEnabled(bool enabled)
 
 void LStepExpress::GetJoystickAxisEnabled(std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("joyenable", values);
 }
 
 void LStepExpress::GetJoystickAxisEnabled(VLStepExpress::Axis axis, int & value)
 {
+  DEVICE_COMMAND_TIMER();
+
   GetValue("joyenable", axis, value);
 }
 
 void LStepExpress::SetJoystickAxisEnabled(const std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!joyenable", values);
   usleep(100000);
   this->SendCommand("!joy 0");
@@ -532,6 +803,8 @@ void LStepExpress::SetJoystickAxisEnabled(const std::vector<int> & values)
 
 void LStepExpress::SetJoystickAxisEnabled(VLStepExpress::Axis axis, int value)
 {
+  DEVICE_COMMAND_TIMER();
+
   SetValue("!joyenable", axis, value);
   usleep(100000);
   this->SendCommand("!joy 0");
@@ -541,6 +814,8 @@ void LStepExpress::SetJoystickAxisEnabled(VLStepExpress::Axis axis, int value)
 
 int LStepExpress::GetError()
 {
+  DEVICE_COMMAND_TIMER();
+
   int value;
   this->GetValue("err", value);
   return value;
@@ -548,11 +823,15 @@ int LStepExpress::GetError()
 
 void LStepExpress::ErrorQuit()
 {
+  DEVICE_COMMAND_TIMER();
+
   this->SendCommand("!quit");
 }
 
 bool LStepExpress::GetPositionControllerEnabled()
 {
+  DEVICE_COMMAND_TIMER();
+
   int posctrl_status(-1);
   GetValue("?poscon", posctrl_status);
 
@@ -561,17 +840,23 @@ bool LStepExpress::GetPositionControllerEnabled()
 
 void LStepExpress::SetPositionControllerEnabled(const bool enable)
 {
+  DEVICE_COMMAND_TIMER();
+
   if(enable){ this->SendCommand("!poscon 1"); }
   else      { this->SendCommand("!poscon 0"); }
 }
 
 void LStepExpress::Reset()
 {
+  DEVICE_COMMAND_TIMER();
+
   this->SendCommand("!Reset");
 }
 
 void LStepExpress::ConfirmErrorRectification()
 {
+  DEVICE_COMMAND_TIMER();
+
   this->SendCommand("!quit");
 }
 
@@ -592,6 +877,8 @@ void LStepExpress::SaveConfig()
 
 void LStepExpress::Calibrate()
 {
+  DEVICE_COMMAND_TIMER();
+
   this->SendCommand("!cal");
 }
 
@@ -48,7 +48,11 @@ class LStepExpress : public VLStepExpress
   void GetAutoStatus(int & value);
   void SetAutoStatus(int value);
 
+  bool StartAutoStatusReader(const AxisStatusHandler & handler);
+  void StopAutoStatusReader();
+
   void GetAxisStatus(std::vector<int> & values);
+  void GetAxisStatusAndPosition(std::vector<int> & status, std::vector<double> & position);
 
   void GetAxisEnabled(std::vector<int> & values);
   void GetAxisEnabled(VLStepExpress::Axis axis, int & value);
@@ -135,13 +139,21 @@ class LStepExpress : public VLStepExpress
   void Calibrate();
   void EmergencyStop();
 
+  bool GetValues(const std::vector<std::string> & commands, std::vector<std::string> & values);
+  bool SetValues(const std::vector<std::string> & commands);
+
   // low level debugging methods
   void SendCommand(const std::string &);
   void ReceiveString(std::string &);
 
  private:
 
+  //! Maximum number of commands sent in one write (kept well below the input buffer of the controller).
+  static const unsigned int MaxCommandsPerExchange = 16;
+
   void StripBuffer( char* ) const;
+  void ParseAxisStatus(const std::string & line, std::vector<int> & values) const;
+  static bool IsAxisStatus(const std::string & line);
   void DeviceInit(const std::string& lstep_ver, const std::string& lstep_iver);
 
   LStepExpressComHandler* comHandler_;
@@ -13,6 +13,7 @@
 #include <string.h>
 
 #include <iostream>
+#include <chrono>
 
 #include "LStepExpressComHandler.h"
 
@@ -22,8 +23,16 @@
   "/dev/ttyUSB0" ... "/dev/ttyUSB3"
 */
 LStepExpressComHandler::LStepExpressComHandler(const std::string& ioPort)
- : fIoPort(ioPort)
+ : fIoPort(ioPort),
+   fReaderRunning(false),
+   fLateAnswers(0),
+   fStatusQueriesPending(0)
 {
+  // answers are terminated by <CR>
+  fPort.SetFeed( "\r" );
+  fPort.SetTerminator( "\r" );
+  fPort.SetTimeoutPolicy( SerialTimeoutPolicy( 1000, 20 ) );
+
   // initialize
   OpenIoPort();
   InitializeIoPort();
@@ -31,6 +40,8 @@ LStepExpressComHandler::LStepExpressComHandler(const std::string& ioPort)
 
 LStepExpressComHandler::~LStepExpressComHandler( void )
 {
+  StopReader();
+
   // restore ioport options as they were
   RestoreIoPort();
   
@@ -43,53 +54,268 @@ void LStepExpressComHandler::SendCommand( const char *commandString )
 {
   if (!fDeviceAvailable) return;
 
-  char singleCharacter = 0; 
+  if ( fReaderRunning ) {
+    DropStaleAnswers( "SendCommand" );
 
-  for ( unsigned int i = 0; i < strlen( commandString ); i++ ) {
-
-    // scan command string character wise & write
-    singleCharacter = commandString[i];
-    write( fIoPortFileDescriptor, &singleCharacter, 1 );
+    if ( fStatusQuery == commandString ) {
+      std::lock_guard<std::mutex> lock( fAnswerMutex );
+      ++fStatusQueriesPending;
+    }
   }
 
-  // send feed characters
-  SendFeedString();
+  // command and feed string in a single write
+  fPort.SendCommand( commandString );
 }
 
 //! Read a string from device.
 /*!
 \par Input:
-  <br><b>Receive string must be at least 41 characters long.</b>
+  <br><b>Receive string must be at least 1025 characters long.</b>
 
-  This function must be placed right in time before
-  the device starts sending.
-
-  See example program in class description.
+  Returns as soon as the terminating <CR> was received. The <CR> is
+  stripped from the answer.
 */
 void LStepExpressComHandler::ReceiveString( char *receiveString )
 {
-  if (!fDeviceAvailable) {
-    receiveString[0] = 0;
-    return;
+  receiveString[0] = 0;
+
+  if (!fDeviceAvailable) return;
+
+  std::string answer;
+
+  if ( fReaderRunning ) {
+    WaitForAnswer( answer );
+  } else {
+    fPort.ReceiveFrame( answer );
+
+    if ( !answer.empty() ) answer.erase( answer.size()-1 );
   }
 
-  receiveString[0] = 0;
+  size_t length = answer.copy( receiveString, 1024 );
+  receiveString[length] = 0;
+}
+
+//! Send several queries in one go and read back their answers.
+/*!
+  The controller buffers the commands and answers them in order, which
+  saves one round trip per additional query. Only queries that produce an
+  answer may be passed. The terminating <CR> is stripped from the answers.
+*/
+bool LStepExpressComHandler::SendQueries( const std::vector<std::string>& commands,
+                                          std::vector<std::string>& answers )
+{
+  answers.clear();
+
+  if (!fDeviceAvailable) return false;
+
+  if ( fReaderRunning ) {
+    DropStaleAnswers( "SendQueries" );
+    CountStatusQueries( commands );
+
+    if ( !fPort.SendCommands( commands ) ) return false;
+
+    bool result = true;
+    std::string answer;
+    for ( size_t i = 0; i < commands.size(); ++i ) {
+      result &= WaitForAnswer( answer );
+      answers.push_back( answer );
+    }
+
+    return result;
+  }
+
+  bool result = fPort.Query( commands, answers );
+
+  for ( std::vector<std::string>::iterator it = answers.begin();
+        it != answers.end();
+        ++it ) {
+    if ( !it->empty() ) it->erase( it->size()-1 );
+  }
+
+  return result;
+}
+
+//! Send several commands without answer in a single write.
+bool LStepExpressComHandler::SendCommands( const std::vector<std::string>& commands )
+{
+  if (!fDeviceAvailable) return false;
+
+  if ( fReaderRunning ) CountStatusQueries( commands );
+
+  return fPort.SendCommands( commands );
+}
+
+//! Read everything the device sends in a separate thread.
+/*!
+  Needed for devices that also send frames on their own, e.g. the axis
+  status at the end of a move (auto status). Frames for which
+  &lt;isStatus&gt; is true are taken as the answer to a pending
+  &lt;statusQuery&gt; if there is one, and are otherwise passed to
+  &lt;onStatus&gt; (in the reader thread). All other frames are answers,
+  which ReceiveString() and SendQueries() take from the reader in order.
+*/
+bool LStepExpressComHandler::StartReader( const std::string& statusQuery,
+                                          const FrameFilter& isStatus,
+                                          const FrameHandler& onStatus )
+{
+  if (!fDeviceAvailable) return false;
+
+  StopReader();
+
+  fStatusQuery = statusQuery;
+  fIsStatus = isStatus;
+  fOnStatus = onStatus;
+  fStatusQueriesPending = 0;
+  fAnswers.clear();
+  fLateAnswers = 0;
+
+  fReaderRunning = true;
+  fReader = std::thread( &LStepExpressComHandler::ReaderLoop, this );
+
+  return true;
+}
+
+//! Stop the reader thread; answers that were not picked up are dropped.
+void LStepExpressComHandler::StopReader()
+{
+  if ( !fReaderRunning ) return;
+
+  fReaderRunning = false;
+  if ( fReader.joinable() ) fReader.join();
+
+  std::lock_guard<std::mutex> lock( fAnswerMutex );
+  fAnswers.clear();
+  fLateAnswers = 0;
+  fStatusQueriesPending = 0;
+}
+
+//! Announce the status queries among &lt;commands&gt; to the reader thread, before they are sent.
+/*!
+  \internal
+*/
+void LStepExpressComHandler::CountStatusQueries( const std::vector<std::string>& commands )
+{
+  std::lock_guard<std::mutex> lock( fAnswerMutex );
+
+  for ( std::vector<std::string>::const_iterator it = commands.begin();
+        it != commands.end();
+        ++it ) {
+    if ( *it == fStatusQuery ) ++fStatusQueriesPending;
+  }
+}
+
+//! Drop answers nobody picked up before a new query is sent, so that they are not taken as its answer.
+/*!
+  \internal
+*/
+void LStepExpressComHandler::DropStaleAnswers( const char* caller )
+{
+  std::lock_guard<std::mutex> lock( fAnswerMutex );
+
+  if ( fAnswers.empty() ) return;
+
+  std::cout << "[LStepExpressComHandler::" << caller << "] ** WARNING: dropping "
+            << fAnswers.size() << " unexpected answer(s), first: \"" << fAnswers.front() << "\"" << std::endl;
 
-  usleep( 20000 );
+  fAnswers.clear();
+}
+
+//! Next answer collected by the reader thread, waiting at most the first byte timeout of the port.
+/*!
+  If no answer arrives in time, the answer is given up: should it still
+  arrive within another first byte timeout, the reader thread discards it
+  instead of handing it out as the answer to the next query.
+
+  \internal
+*/
+bool LStepExpressComHandler::WaitForAnswer( std::string& answer )
+{
+  std::unique_lock<std::mutex> lock( fAnswerMutex );
 
-  int timeout = 0;
-  size_t readResult = 0;
+  const bool received =
+    fAnswerCondition.wait_for( lock,
+                               std::chrono::milliseconds( fPort.TimeoutPolicy().firstByteTimeout ),
+                               [this](){ return !fAnswers.empty(); } );
 
-  while ( timeout < 100000 )  {
+  if ( !received ) {
+    ++fLateAnswers;
+    fLateAnswerDeadline = std::chrono::steady_clock::now()
+      + 2 * std::chrono::milliseconds( fPort.TimeoutPolicy().firstByteTimeout );
 
-    readResult = read( fIoPortFileDescriptor, receiveString, 1024 );
+    std::cout << "[LStepExpressComHandler::WaitForAnswer] ** WARNING: no answer within "
+              << fPort.TimeoutPolicy().firstByteTimeout << " ms" << std::endl;
 
-    if ( readResult > 0 ) {
-      receiveString[readResult-1] = '\0';
-      break;
+    answer.clear();
+    return false;
+  }
+
+  answer = fAnswers.front();
+  fAnswers.pop_front();
+
+  return true;
+}
+
+//! Reader thread: sorts the received frames into answers and status reports.
+/*!
+  \internal
+*/
+void LStepExpressComHandler::ReaderLoop( void )
+{
+  std::string frame;
+
+  while ( fReaderRunning ) {
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    fPort.ReceiveFrame( frame, ReaderPollInterval );
+
+    if ( frame.empty() ) {
+      // nothing received, or an I/O error: do not spin on a broken port
+      std::this_thread::sleep_until( start + std::chrono::milliseconds( ReaderPollInterval ) );
+      continue;
+    }
+
+    if ( frame[frame.size()-1] == '\r' ) frame.erase( frame.size()-1 );
+
+    bool isAnswer = true;
+
+    if ( fIsStatus && fIsStatus( frame ) ) {
+      std::lock_guard<std::mutex> lock( fAnswerMutex );
+
+      if ( fStatusQueriesPending > 0 ) {
+        --fStatusQueriesPending;
+      } else {
+        isAnswer = false;
+      }
+    }
+
+    if ( isAnswer ) {
+      bool late = false;
+      {
+        std::lock_guard<std::mutex> lock( fAnswerMutex );
+
+        if ( fLateAnswers > 0 && std::chrono::steady_clock::now() > fLateAnswerDeadline ) {
+          // the answers given up never arrived
+          fLateAnswers = 0;
+        }
+
+        if ( fLateAnswers > 0 ) {
+          --fLateAnswers;
+          late = true;
+        } else {
+          fAnswers.push_back( frame );
+        }
+      }
+
+      if ( late ) {
+        std::cout << "[LStepExpressComHandler::ReaderLoop] ** WARNING: discarding late answer \""
+                  << frame << "\"" << std::endl;
+      } else {
+        fAnswerCondition.notify_all();
+      }
+    } else if ( fOnStatus ) {
+      fOnStatus( frame );
     }
-    
-    timeout++;
   }
 }
 
@@ -100,7 +326,8 @@ void LStepExpressComHandler::ReceiveString( char *receiveString )
 void LStepExpressComHandler::OpenIoPort( void )
 {
   // open io port ( read/write | no term control | no DCD line check )
-  fIoPortFileDescriptor = open( fIoPort.c_str(), O_RDWR | O_NOCTTY  | O_NDELAY );
+  fPort.Open( fIoPort );
+  fIoPortFileDescriptor = fPort.FileDescriptor();
 
   // check if successful
   if(fIoPortFileDescriptor == -1)
@@ -112,14 +339,6 @@ void LStepExpressComHandler::OpenIoPort( void )
 
     return;
   }
-  else
-  {
-    // configure port with no delay
-    int flags = fcntl(fIoPortFileDescriptor, F_GETFL, 0);
-    flags |= O_NONBLOCK;
-    flags |= FNDELAY;
-    fcntl( fIoPortFileDescriptor, F_SETFL, flags );
-  }
 
   fDeviceAvailable = true;
 }
@@ -184,22 +403,7 @@ void LStepExpressComHandler::CloseIoPort( void )
 {
   if (!fDeviceAvailable) return;
 
-  close( fIoPortFileDescriptor );
-}
-
-//! Send command termination string (<CR><NL>).
-/*!
-  \internal
-*/
-void LStepExpressComHandler::SendFeedString( void )
-{
-  if (!fDeviceAvailable) return;
-
-  // feed string is <CR> ; see documentation page 4.1
-  char feedString = 13;
-
-  // write <CR> and get echo
-  write( fIoPortFileDescriptor, &feedString, 1 );
+  fPort.Close();
 }
 
 bool LStepExpressComHandler::DeviceAvailable()
@@ -19,6 +19,18 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <string>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+
+#include "../Serial/SerialPort.h"
+
 /** @addtogroup devices
  *  @{
  */
@@ -33,6 +45,10 @@ class LStepExpressComHandler {
 
  public:
 
+  //! Frames sent by the device on its own (see StartReader).
+  typedef std::function<bool(const std::string&)> FrameFilter;
+  typedef std::function<void(const std::string&)> FrameHandler;
+
   //! Constructor.
   LStepExpressComHandler(const std::string&);
 
@@ -46,22 +62,55 @@ class LStepExpressComHandler {
 
   void SendCommand( const char* );
   void ReceiveString( char* );
+  bool SendQueries( const std::vector<std::string>& commands,
+                    std::vector<std::string>& answers );
+  bool SendCommands( const std::vector<std::string>& commands );
+
+  bool StartReader( const std::string& statusQuery,
+                    const FrameFilter& isStatus,
+                    const FrameHandler& onStatus );
+  void StopReader();
+  bool ReaderRunning() const { return fReaderRunning; }
 
   bool DeviceAvailable();
 
+  //! Longest wait of the reader thread for input before it checks whether it has to stop (ms).
+  static constexpr int ReaderPollInterval = 50;
+
  private:
 
+  void CountStatusQueries( const std::vector<std::string>& commands );
+  void DropStaleAnswers( const char* caller );
+  bool WaitForAnswer( std::string& answer );
+  void ReaderLoop( void );
+
   void OpenIoPort( void );
   void InitializeIoPort( void );
   void RestoreIoPort( void );
   void CloseIoPort( void );
-  void SendFeedString( void );
 
   bool fDeviceAvailable;
   int fIoPortFileDescriptor;
 
   const std::string fIoPort;
   termios_t fCurrentTermios, fThisTermios;
+
+  SerialPort fPort;
+
+  // reader thread: answers to queries are queued in fAnswers,
+  // status frames nobody asked for go to fOnStatus
+  std::thread fReader;
+  std::atomic<bool> fReaderRunning;
+  std::mutex fAnswerMutex;
+  std::condition_variable fAnswerCondition;
+  std::deque<std::string> fAnswers;
+  // answers given up by WaitForAnswer: discarded if they still arrive until fLateAnswerDeadline
+  unsigned int fLateAnswers;
+  std::chrono::steady_clock::time_point fLateAnswerDeadline;
+  unsigned int fStatusQueriesPending;
+  std::string fStatusQuery;
+  FrameFilter fIsStatus;
+  FrameHandler fOnStatus;
 };
 
 /** @} */
@@ -10,14 +10,29 @@
 //                                                                             //
 /////////////////////////////////////////////////////////////////////////////////
 
+#include <unistd.h>
+
 #include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iterator>
 
 #include "LStepExpressFake.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 LStepExpressFake::LStepExpressFake(const std::string& ioPort, const std::string& /* lstep_ver */, const std::string& /* lstep_iver */)
  : VLStepExpress(ioPort)
  , ioPort_(ioPort)
+ , commandLatency_(0)
+ , simulateMotion_(false)
+ , inMotion_(false)
+ , motionStartTime_(0.0)
+ , motionDuration_(0.0)
  , autoStatus_(1)
+ , autoStatusRunning_(false)
+ , autoStatusTime_(-1.0)
 {
   axisStatus_ = std::vector<int>{
     VLStepExpress::AXISSTANDSANDREADY,
@@ -42,46 +57,263 @@ LStepExpressFake::LStepExpressFake(const std::string& ioPort, const std::string&
   joystickAxisEnabled_ = std::vector<int>{ 1, 1, 1, 1 };
 
   posCtrl_enabled_ = false;
+
+  RecordTrajectory(MotionTime(), 0.0, position_, position_);
 }
 
 //! Return name of port used to initialize LStepExpressFake
 std::string LStepExpressFake::ioPort() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return ioPort_;
 }
 
 LStepExpressFake::~LStepExpressFake()
 {
+  StopAutoStatusReader();
+}
+
+//! Models the serial round trip of a real controller, so that the cost of polling can be measured without hardware.
+void LStepExpressFake::SimulateRoundTrip() const
+{
+  if (commandLatency_ > 0) usleep(commandLatency_);
+}
+
+double LStepExpressFake::MotionTime()
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::mutex LStepExpressFake::trajectoryMutex_;
+std::deque<LStepExpressFake::TrajectorySegment> LStepExpressFake::trajectory_;
+
+//! Only the most recent moves are kept (enough for the data storage of the laser during a scan).
+void LStepExpressFake::RecordTrajectory(double time, double duration, const std::vector<double> & start, const std::vector<double> & target)
+{
+  std::lock_guard<std::mutex> lock(trajectoryMutex_);
+
+  trajectory_.push_back(TrajectorySegment{ time, duration, start, target });
 
+  while (trajectory_.size() > 1024) trajectory_.pop_front();
+}
+
+bool LStepExpressFake::SimulatedPosition(double time, std::vector<double> & position)
+{
+  std::lock_guard<std::mutex> lock(trajectoryMutex_);
+
+  if (trajectory_.empty()) return false;
+
+  // last move started before <time> (or the first one known)
+  std::deque<TrajectorySegment>::const_reverse_iterator it = trajectory_.rbegin();
+  while (std::next(it) != trajectory_.rend() && it->time > time) ++it;
+
+  const double elapsed = time - it->time;
+
+  if (elapsed <= 0.0) {
+    position = it->start;
+  } else if (elapsed >= it->duration) {
+    position = it->target;
+  } else {
+    const double fraction = elapsed / it->duration;
+
+    position.resize(it->start.size());
+    for (unsigned int i=0; i<position.size(); ++i) {
+      position[i] = it->start[i] + fraction * (it->target[i] - it->start[i]);
+    }
+  }
+
+  return true;
+}
+
+//! All axes start and stop together; the duration is set by the slowest axis.
+void LStepExpressFake::StartMotion(const std::vector<double> & target)
+{
+  UpdateMotion();
+
+  if (!simulateMotion_) {
+    RecordTrajectory(MotionTime(), 0.0, position_, target);
+    position_ = target;
+    ScheduleAutoStatus(MotionTime());
+    return;
+  }
+
+  motionStart_ = position_;
+  motionTarget_ = target;
+  motionStartTime_ = MotionTime();
+  motionDuration_ = 0.0;
+
+  for (unsigned int i=0; i<position_.size(); ++i) {
+    const double distance = std::fabs(motionTarget_[i] - motionStart_[i]);
+    if (distance == 0.0) continue;
+
+    if (velocity_[i] > 0.0) motionDuration_ = std::max(motionDuration_, distance / velocity_[i]);
+    if (axisStatus_[i] == VLStepExpress::AXISSTANDSANDREADY) axisStatus_[i] = VLStepExpress::AXISMOVING;
+  }
+
+  inMotion_ = true;
+
+  RecordTrajectory(motionStartTime_, motionDuration_, motionStart_, motionTarget_);
+
+  ScheduleAutoStatus(motionStartTime_ + motionDuration_);
+
+  UpdateMotion();
+}
+
+void LStepExpressFake::UpdateMotion()
+{
+  if (!inMotion_) return;
+
+  const double elapsed = MotionTime() - motionStartTime_;
+
+  if (elapsed < motionDuration_) {
+    const double fraction = elapsed / motionDuration_;
+    for (unsigned int i=0; i<position_.size(); ++i) {
+      position_[i] = motionStart_[i] + fraction * (motionTarget_[i] - motionStart_[i]);
+    }
+    return;
+  }
+
+  position_ = motionTarget_;
+  inMotion_ = false;
+
+  for (std::vector<int>::iterator it = axisStatus_.begin(); it!=axisStatus_.end(); ++it) {
+    if ((*it)==VLStepExpress::AXISMOVING) *it = VLStepExpress::AXISSTANDSANDREADY;
+  }
 }
 
 void LStepExpressFake::GetAutoStatus(int & value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   value = autoStatus_;
 }
 
 void LStepExpressFake::SetAutoStatus(int value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   autoStatus_ = value;
 }
 
+bool LStepExpressFake::StartAutoStatusReader(const AxisStatusHandler & handler)
+{
+  DEVICE_COMMAND_TIMER();
+
+  if (!handler) return false;
+
+  StopAutoStatusReader();
+
+  autoStatusHandler_ = handler;
+  autoStatusTime_ = -1.0;
+  autoStatusRunning_ = true;
+  autoStatusReader_ = std::thread(&LStepExpressFake::AutoStatusLoop, this);
+
+  return true;
+}
+
+void LStepExpressFake::StopAutoStatusReader()
+{
+  DEVICE_COMMAND_TIMER();
+
+  {
+    std::lock_guard<std::mutex> lock(autoStatusMutex_);
+    autoStatusRunning_ = false;
+  }
+  autoStatusCondition_.notify_all();
+
+  if (autoStatusReader_.joinable()) autoStatusReader_.join();
+}
+
+//! The axis status after the current move is reported at &lt;time&gt; (on the MotionTime() clock), if auto status is on.
+void LStepExpressFake::ScheduleAutoStatus(double time)
+{
+  if (autoStatus_ == 0) return;
+
+  std::vector<int> values = axisStatus_;
+  for (std::vector<int>::iterator it = values.begin(); it!=values.end(); ++it) {
+    if ((*it)==VLStepExpress::AXISMOVING) *it = VLStepExpress::AXISSTANDSANDREADY;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(autoStatusMutex_);
+    if (!autoStatusRunning_) return;
+
+    autoStatusTime_ = time;
+    autoStatusValues_ = values;
+  }
+  autoStatusCondition_.notify_all();
+}
+
+void LStepExpressFake::AutoStatusLoop()
+{
+  std::unique_lock<std::mutex> lock(autoStatusMutex_);
+
+  while (autoStatusRunning_) {
+
+    if (autoStatusTime_ < 0.0) {
+      autoStatusCondition_.wait(lock);
+      continue;
+    }
+
+    const double wait = autoStatusTime_ - MotionTime();
+    if (wait > 0.0) {
+      autoStatusCondition_.wait_for(lock, std::chrono::duration<double>(wait));
+      continue;
+    }
+
+    const std::vector<int> values = autoStatusValues_;
+    autoStatusTime_ = -1.0;
+
+    lock.unlock();
+    autoStatusHandler_(values);
+    lock.lock();
+  }
+}
+
 void LStepExpressFake::GetAxisStatus(std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+  UpdateMotion();
+
   values = axisStatus_;
 }
 
+//! Both answers come back in a single (simulated) round trip, as for the pipelined queries of LStepExpress
+void LStepExpressFake::GetAxisStatusAndPosition(std::vector<int> & status, std::vector<double> & position)
+{
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+  UpdateMotion();
+
+  status = axisStatus_;
+  position = position_;
+}
+
 void LStepExpressFake::GetAxisEnabled(std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   values = axis_;
 }
 
 void LStepExpressFake::GetAxisEnabled(VLStepExpress::Axis axis, int & value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   value = axis_[axis];
 }
 
 void LStepExpressFake::SetAxisEnabled(const std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   axis_ = values;
 
   std::vector<int>::iterator itaxis = axis_.begin();
@@ -98,6 +330,9 @@ void LStepExpressFake::SetAxisEnabled(const std::vector<int> & values)
 
 void LStepExpressFake::SetAxisEnabled(VLStepExpress::Axis axis, int value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   axis_[axis] = value;
 
   if (axis_[axis]==0) {
@@ -109,308 +344,615 @@ void LStepExpressFake::SetAxisEnabled(VLStepExpress::Axis axis, int value)
 
 void LStepExpressFake::GetAxisDirection(std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   values = axisDirection_;
 }
 
 void LStepExpressFake::GetAxisDirection(VLStepExpress::Axis axis, int & value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   value = axisDirection_[axis];
 }
 
 void LStepExpressFake::SetAxisDirection(const std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   axisDirection_ = values;
 }
 
 void LStepExpressFake::SetAxisDirection(VLStepExpress::Axis axis, int value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   axisDirection_[axis] = value;
 }
 
 void LStepExpressFake::GetDimension(std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   values = dim_;
 }
 
 void LStepExpressFake::GetDimension(VLStepExpress::Axis axis, int & value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   value = dim_[axis];
 }
 
 void LStepExpressFake::SetDimension(const std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   dim_ = values;
 }
 
 void LStepExpressFake::SetDimension(VLStepExpress::Axis axis, int value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   dim_[axis] = value;
 }
 
 void LStepExpressFake::GetPowerAmplifierStatus(std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   values = pa_;
 }
 
 void LStepExpressFake::GetPowerAmplifierStatus(VLStepExpress::Axis axis, int & value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   value = pa_[axis];
 }
 
 void LStepExpressFake::SetPowerAmplifierStatus(const std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   pa_ = values;
 }
 
 void LStepExpressFake::SetPowerAmplifierStatus(VLStepExpress::Axis axis, int value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   pa_[axis] = value;
 }
 
 void LStepExpressFake::GetAccelerationJerk(std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   values = accelerationJerk_;
 }
 
 void LStepExpressFake::GetAccelerationJerk(VLStepExpress::Axis axis, double & value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   value = accelerationJerk_[axis];
 }
 
 void LStepExpressFake::SetAccelerationJerk(const std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   accelerationJerk_ = values;
 }
 
 void LStepExpressFake::SetAccelerationJerk(VLStepExpress::Axis axis, double value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   accelerationJerk_[axis] = value;
 }
 
 void LStepExpressFake::GetDecelerationJerk(std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   values = decelerationJerk_;
 }
 
 void LStepExpressFake::GetDecelerationJerk(VLStepExpress::Axis axis, double & value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   value = decelerationJerk_[axis];
 }
 
 void LStepExpressFake::SetDecelerationJerk(const std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   decelerationJerk_ = values;
 }
 
 void LStepExpressFake::SetDecelerationJerk(VLStepExpress::Axis axis, double value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   decelerationJerk_[axis] = value;
 }
 
 void LStepExpressFake::GetAcceleration(std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   values = acceleration_;
 }
 
 void LStepExpressFake::GetAcceleration(VLStepExpress::Axis axis, double & value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   value = acceleration_[axis];
 }
 
 void LStepExpressFake::SetAcceleration(const std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   acceleration_ = values;
 }
 
 void LStepExpressFake::SetAcceleration(VLStepExpress::Axis axis, double value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   acceleration_[axis] = value;
 }
 
 void LStepExpressFake::GetDeceleration(std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   values = deceleration_;
 }
 
 void LStepExpressFake::GetDeceleration(VLStepExpress::Axis axis, double & value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   value = deceleration_[axis];
 }
 
 void LStepExpressFake::SetDeceleration(const std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   deceleration_ = values;
 }
 
 void LStepExpressFake::SetDeceleration(VLStepExpress::Axis axis, double value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   deceleration_[axis] = value;
 }
 
 void LStepExpressFake::GetVelocity(std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   values = velocity_;
 }
 
 void LStepExpressFake::GetVelocity(VLStepExpress::Axis axis, double & value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   value = velocity_[axis];
 }
 
 void LStepExpressFake::SetVelocity(const std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   velocity_ = values;
 }
 
 void LStepExpressFake::SetVelocity(VLStepExpress::Axis axis, double value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   velocity_[axis] = value;
 }
 
 void LStepExpressFake::GetPosition(std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+  UpdateMotion();
+
   values = position_;
 }
 
 void LStepExpressFake::GetPosition(VLStepExpress::Axis axis, double & value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+  UpdateMotion();
+
   value = position_[axis];
 }
 
 void LStepExpressFake::SetPosition(const std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   position_ = values;
+
+  RecordTrajectory(MotionTime(), 0.0, position_, position_);
 }
 
 void LStepExpressFake::SetPosition(VLStepExpress::Axis axis, double value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   position_[axis] = value;
+
+  RecordTrajectory(MotionTime(), 0.0, position_, position_);
 }
 
 void LStepExpressFake::MoveAbsolute(const std::vector<double> & values)
 {
-  position_ = values;
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
+  StartMotion(values);
 }
 
 void LStepExpressFake::MoveAbsolute(double x, double y, double z, double a)
 {
-  position_[VLStepExpress::X] = x;
-  position_[VLStepExpress::Y] = y;
-  position_[VLStepExpress::Z] = z;
-  position_[VLStepExpress::A] = a;
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
+  StartMotion(std::vector<double>{ x, y, z, a });
 }
 
 void LStepExpressFake::MoveAbsolute(VLStepExpress::Axis axis, double value)
 {
-  position_[axis] = value;
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
+  UpdateMotion();
+
+  std::vector<double> target = inMotion_ ? motionTarget_ : position_;
+  target[axis] = value;
+
+  StartMotion(target);
 }
 
 void LStepExpressFake::MoveRelative(const std::vector<double> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   moverel_ = values;
-  std::vector<double>::iterator itpos = position_.begin();
+  UpdateMotion();
+
+  std::vector<double> target = inMotion_ ? motionTarget_ : position_;
+  std::vector<double>::iterator itpos = target.begin();
   for (std::vector<double>::iterator it = moverel_.begin();
       it!=moverel_.end();
       ++it, ++itpos) {
       *itpos += *it;
   }
+
+  StartMotion(target);
 }
 
 void LStepExpressFake::MoveRelative(double x, double y, double z, double a)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   moverel_[VLStepExpress::X] = x;
   moverel_[VLStepExpress::Y] = y;
   moverel_[VLStepExpress::Z] = z;
   moverel_[VLStepExpress::A] = a;
-  std::vector<double>::iterator itpos = position_.begin();
+  UpdateMotion();
+
+  std::vector<double> target = inMotion_ ? motionTarget_ : position_;
+  std::vector<double>::iterator itpos = target.begin();
   for (std::vector<double>::iterator it = moverel_.begin();
       it!=moverel_.end();
       ++it, ++itpos) {
       *itpos += *it;
   }
+
+  StartMotion(target);
 }
 
 void LStepExpressFake::MoveRelative(VLStepExpress::Axis axis, double value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   moverel_[VLStepExpress::X] = 0.0;
   moverel_[VLStepExpress::Y] = 0.0;
   moverel_[VLStepExpress::Z] = 0.0;
   moverel_[VLStepExpress::A] = 0.0;
   moverel_[axis] = value;
-  std::vector<double>::iterator itpos = position_.begin();
+  UpdateMotion();
+
+  std::vector<double> target = inMotion_ ? motionTarget_ : position_;
+  std::vector<double>::iterator itpos = target.begin();
   for (std::vector<double>::iterator it = moverel_.begin();
        it!=moverel_.end();
        ++it, ++itpos) {
     *itpos += *it;
   }
+
+  StartMotion(target);
 }
 
 void LStepExpressFake::MoveRelative()
 {
-  std::vector<double>::iterator itpos = position_.begin();
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
+  UpdateMotion();
+
+  std::vector<double> target = inMotion_ ? motionTarget_ : position_;
+  std::vector<double>::iterator itpos = target.begin();
   for (std::vector<double>::iterator it = moverel_.begin();
       it!=moverel_.end();
       ++it, ++itpos) {
       *itpos += *it;
   }
+
+  StartMotion(target);
+}
+
+//! Stops a simulated move at the current position
+void LStepExpressFake::EmergencyStop()
+{
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
+  UpdateMotion();
+
+  if (inMotion_) {
+    motionTarget_ = position_;
+    motionDuration_ = 0.0;
+    UpdateMotion();
+
+    RecordTrajectory(MotionTime(), 0.0, position_, position_);
+
+    ScheduleAutoStatus(MotionTime());
+  }
 }
 
 void LStepExpressFake::GetSystemStatus(std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   values.resize(4, 5);
 }
 
 void LStepExpressFake::GetSystemStatusText(std::string& value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   value = "?sysstatus";
 }
 
 void LStepExpressFake::GetSystemStatus(VLStepExpress::Axis axis, int & value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   value = 5;
 }
 
 bool LStepExpressFake::GetJoystickEnabled()
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   return joystickEnabled_;
 }
 
 void LStepExpressFake::SetJoystickEnabled(bool enabled)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   joystickEnabled_ = enabled;
 }
 
 void LStepExpressFake::GetJoystickAxisEnabled(std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   values = joystickAxisEnabled_;
 }
 
 void LStepExpressFake::GetJoystickAxisEnabled(VLStepExpress::Axis axis, int & value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   value = joystickAxisEnabled_[axis];
 }
 
 void LStepExpressFake::SetJoystickAxisEnabled(const std::vector<int> & values)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   joystickAxisEnabled_ = values;
 }
 
 void LStepExpressFake::SetJoystickAxisEnabled(VLStepExpress::Axis axis, int value)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   joystickAxisEnabled_[axis] = value;
 }
 
 void LStepExpressFake::SendCommand(const std::string& command)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   std::cout << "SendCommand: " << command << std::endl;
+
+  if (!command.empty() && command[0] == '!') {
+    StoreSetting(command);
+  } else {
+    answers_.push_back(QuerySetting(command));
+  }
+}
+
+void LStepExpressFake::ReceiveString(std::string & value)
+{
+  DEVICE_COMMAND_TIMER();
+
+  value.clear();
+
+  if (answers_.empty()) return;
+
+  value = answers_.front();
+  answers_.pop_front();
+}
+
+bool LStepExpressFake::GetValues(const std::vector<std::string> & commands, std::vector<std::string> & values)
+{
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
+  values.clear();
+  for (std::vector<std::string>::const_iterator it = commands.begin();
+       it!=commands.end();
+       ++it) {
+    values.push_back(QuerySetting(*it));
+  }
+
+  return true;
+}
+
+bool LStepExpressFake::SetValues(const std::vector<std::string> & commands)
+{
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
+  for (std::vector<std::string>::const_iterator it = commands.begin();
+       it!=commands.end();
+       ++it) {
+    if (!it->empty() && (*it)[0] == '!') StoreSetting(*it);
+  }
+
+  return true;
+}
+
+//! Key of a setting command: its name, followed by the axis if the first argument is an axis name.
+/*!
+  The remaining arguments are returned in &lt;value&gt;.
+*/
+std::string LStepExpressFake::SettingKey(const std::string & command, std::string & value)
+{
+  std::istringstream is((!command.empty() && command[0] == '!') ? command.substr(1) : command);
+
+  std::string key;
+  is >> key;
+
+  std::vector<std::string> arguments;
+  std::string token;
+  while (is >> token) arguments.push_back(token);
+
+  unsigned int first = 0;
+  if (!arguments.empty() && arguments[0].size() == 1 && std::string("xyza").find(arguments[0][0]) != std::string::npos) {
+    key += " " + arguments[0];
+    first = 1;
+  }
+
+  value.clear();
+  for (unsigned int i=first; i<arguments.size(); ++i) {
+    if (!value.empty()) value += " ";
+    value += arguments[i];
+  }
+
+  return key;
+}
+
+void LStepExpressFake::StoreSetting(const std::string & command)
+{
+  std::string value;
+  const std::string key = SettingKey(command, value);
+
+  settings_[key] = value;
+}
+
+std::string LStepExpressFake::QuerySetting(const std::string & command) const
+{
+  std::string value;
+  const std::string key = SettingKey(command, value);
+
+  std::map<std::string, std::string>::const_iterator it = settings_.find(key);
+
+  return (it != settings_.end()) ? it->second : std::string("0");
 }
 
 bool LStepExpressFake::GetPositionControllerEnabled()
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   return posCtrl_enabled_;
 }
 
 void LStepExpressFake::SetPositionControllerEnabled(const bool enable)
 {
+  DEVICE_COMMAND_TIMER();
+  SimulateRoundTrip();
+
   posCtrl_enabled_ = enable;
 }
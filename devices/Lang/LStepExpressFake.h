@@ -15,6 +15,11 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include "VLStepExpress.h"
 
@@ -37,10 +42,35 @@ class LStepExpressFake : public VLStepExpress
 
   bool DeviceAvailable() const { return true; }
 
+  //! Simulated round trip time of every command to the controller; in microseconds.
+  void SetCommandLatency(int microseconds) { commandLatency_ = (microseconds > 0) ? microseconds : 0; }
+  int CommandLatency() const { return commandLatency_; }
+
+  //! Moves take time (distance over velocity of each axis) instead of completing at once.
+  /*!
+    During a simulated move, the positions are interpolated linearly in time
+    and the moving axes report AXISMOVING.
+  */
+  void SetMotionSimulation(bool enabled) { simulateMotion_ = enabled; }
+  bool MotionSimulation() const { return simulateMotion_; }
+
+  //! Position of the simulated stage at <time> (on the steady clock, in seconds), for the other simulated devices of the process.
+  /*!
+    The moves of all LStepExpressFake instances are recorded in one trajectory,
+    so that e.g. KeyenceFake can measure the height under the stage at the time of each stored value.
+    Returns false if no LStepExpressFake has been created.
+  */
+  static bool SimulatedPosition(double time, std::vector<double> & position);
+
   void GetAutoStatus(int & value);
   void SetAutoStatus(int value);
 
+  //! The end of every move (at the end of the simulated motion) is reported by a separate thread, as by the controller.
+  bool StartAutoStatusReader(const AxisStatusHandler & handler);
+  void StopAutoStatusReader();
+
   void GetAxisStatus(std::vector<int> & values);
+  void GetAxisStatusAndPosition(std::vector<int> & status, std::vector<double> & position);
 
   void GetAxisEnabled(std::vector<int> & values);
   void GetAxisEnabled(VLStepExpress::Axis axis, int & value);
@@ -125,16 +155,55 @@ class LStepExpressFake : public VLStepExpress
   void ValidParameter() {}
   void SaveConfig() {}
   void Calibrate() {}
-  void EmergencyStop() {}
+  void EmergencyStop();
+
+  //! Batched transfers cost a single simulated round trip, like the batched serial exchanges of LStepExpress.
+  bool GetValues(const std::vector<std::string> & commands, std::vector<std::string> & values);
+  bool SetValues(const std::vector<std::string> & commands);
 
   // low level debugging methods
   void SendCommand(const std::string & command);
-  void ReceiveString(std::string &) { }
+  void ReceiveString(std::string & value);
 
  private:
 
+  void SimulateRoundTrip() const;
+
+  static std::string SettingKey(const std::string & command, std::string & value);
+  void StoreSetting(const std::string & command);
+  std::string QuerySetting(const std::string & command) const;
+
+  void StartMotion(const std::vector<double> & target);
+  void UpdateMotion();
+  static double MotionTime();
+
+  void ScheduleAutoStatus(double time);
+
+  //! One move of the trajectory: linear from start to target in duration (0: instantaneous).
+  struct TrajectorySegment {
+    double time;
+    double duration;
+    std::vector<double> start;
+    std::vector<double> target;
+  };
+
+  static void RecordTrajectory(double time, double duration, const std::vector<double> & start, const std::vector<double> & target);
+
+  static std::mutex trajectoryMutex_;
+  static std::deque<TrajectorySegment> trajectory_;
+  void AutoStatusLoop();
+
   std::string ioPort_;
 
+  int commandLatency_;
+
+  bool simulateMotion_;
+  bool inMotion_;
+  double motionStartTime_;
+  double motionDuration_;
+  std::vector<double> motionStart_;
+  std::vector<double> motionTarget_;
+
   int autoStatus_;
   std::vector<int> axisStatus_;
   std::vector<int> axis_;
@@ -153,6 +222,19 @@ class LStepExpressFake : public VLStepExpress
   std::vector<int> joystickAxisEnabled_;
 
   bool posCtrl_enabled_;
+
+  //! Pending auto status report (time < 0: none), sent by autoStatusReader_.
+  std::thread autoStatusReader_;
+  std::mutex autoStatusMutex_;
+  std::condition_variable autoStatusCondition_;
+  bool autoStatusRunning_;
+  AxisStatusHandler autoStatusHandler_;
+  double autoStatusTime_;
+  std::vector<int> autoStatusValues_;
+
+  //! Generic settings ("!name [axis] value" / "name [axis]"), and the answers not yet read with ReceiveString.
+  std::map<std::string, std::string> settings_;
+  std::deque<std::string> answers_;
 };
 
 /** @} */
@@ -22,6 +22,17 @@ VLStepExpress::~VLStepExpress()
 {
 }
 
+//! Axis status and position of all axes.
+/*!
+  One round trip per quantity; controllers that can answer both queries
+  in a single exchange override this method.
+*/
+void VLStepExpress::GetAxisStatusAndPosition(std::vector<int> & status, std::vector<double> & position)
+{
+  this->GetAxisStatus(status);
+  this->GetPosition(position);
+}
+
 void VLStepExpress::ValidConfig()
 {
   this->SendCommand("!validconfig");
@@ -284,6 +295,56 @@ void VLStepExpress::GetValue(const std::string & command, VLStepExpress::Axis ax
   }
 }
 
+//! Send several queries and read back their answers in order.
+/*!
+  One exchange per query; controllers that buffer their input
+  send several queries per exchange instead. GetValue does not report
+  errors, so an empty answer is taken as a failed exchange.
+*/
+bool VLStepExpress::GetValues(const std::vector<std::string> & commands,
+                              std::vector<std::string> & values)
+{
+  values.clear();
+
+  std::string buffer;
+  for (std::vector<std::string>::const_iterator it = commands.begin();
+      it!=commands.end();
+      ++it) {
+    buffer.clear();
+    this->GetValue(*it, buffer);
+    if (buffer.empty()) return false;
+    values.push_back(buffer);
+  }
+
+  return true;
+}
+
+//! Send several commands that produce no answer.
+bool VLStepExpress::SetValues(const std::vector<std::string> & commands)
+{
+  for (std::vector<std::string>::const_iterator it = commands.begin();
+      it!=commands.end();
+      ++it) {
+    this->SendCommand(*it);
+  }
+
+  return true;
+}
+
+//! Start passing the axis status reported by the controller on its own to &lt;handler&gt;.
+/*!
+  Not available by default: the motion state is then only known from
+  polling GetAxisStatus.
+*/
+bool VLStepExpress::StartAutoStatusReader(const AxisStatusHandler & /* handler */)
+{
+  return false;
+}
+
+void VLStepExpress::StopAutoStatusReader()
+{
+}
+
 char VLStepExpress::GetAxisName(VLStepExpress::Axis axis)
 {
   switch (axis) {
@@ -15,6 +15,7 @@
 
 #include <string>
 #include <vector>
+#include <functional>
 
 /** @addtogroup devices
  *  @{
@@ -59,6 +60,9 @@ class VLStepExpress
     AXISSTATEUNKNOWN           = 0xff
   };
 
+  //! Receives the axis status reported by the controller on its own (auto status); called from a reader thread.
+  typedef std::function<void(const std::vector<int>&)> AxisStatusHandler;
+
   VLStepExpress(const std::string&);
 
   virtual ~VLStepExpress();
@@ -70,7 +74,12 @@ class VLStepExpress
   virtual void GetAutoStatus(int & value) = 0;
   virtual void SetAutoStatus(int value) = 0;
 
+  // asynchronous axis status reports (auto status), false if the device does not deliver them
+  virtual bool StartAutoStatusReader(const AxisStatusHandler & handler);
+  virtual void StopAutoStatusReader();
+
   virtual void GetAxisStatus(std::vector<int> & values) = 0;
+  virtual void GetAxisStatusAndPosition(std::vector<int> & status, std::vector<double> & position);
 
   virtual void GetAxisEnabled(std::vector<int> & values) = 0;
   virtual void GetAxisEnabled(VLStepExpress::Axis axis, int & value) = 0;
@@ -185,6 +194,11 @@ class VLStepExpress
   void GetValue(const std::string & command, VLStepExpress::Axis axis, double & value);
   void GetValue(const std::string & command, VLStepExpress::Axis axis, std::vector<double> & values);
 
+  // bulk transfer of complete commands (e.g. settings), answers in the order of the queries;
+  // false if the transfer failed (then values holds only the answers received before the failure)
+  virtual bool GetValues(const std::vector<std::string> & commands, std::vector<std::string> & values);
+  virtual bool SetValues(const std::vector<std::string> & commands);
+
   char GetAxisName(VLStepExpress::Axis axis);
   const char * GetAxisDimensionShortName(VLStepExpress::Dimension dimension);
   const char * GetAxisDimensionName(VLStepExpress::Dimension dimension);
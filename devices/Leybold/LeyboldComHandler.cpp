@@ -26,6 +26,10 @@ LeyboldComHandler::LeyboldComHandler(ioport_t ioPort)
   // save ioport 
   fIoPort = ioPort;
 
+  // commands carry their own <EOT>, answers are terminated by <EOT>
+  fPort.SetTerminator( "\x04" );
+  fPort.SetTimeoutPolicy( SerialTimeoutPolicy( 500, 50 ) );
+
   // initialize
   OpenIoPort();
   InitializeIoPort();
@@ -45,51 +49,28 @@ void LeyboldComHandler::SendCommand( const char *commandString )
 {
   if (!fDeviceAvailable) return;
 
-  char singleCharacter = 0; 
-
-  for (unsigned int i=0;i<strlen(commandString);i++) {
-    
-    // scan command string character wise & write
-    singleCharacter = commandString[i];
-    write( fIoPortFileDescriptor, &singleCharacter, 1 );
-  }
-
-  usleep(50000);
-  // std::cout << "command: |" << commandString << "|" << std::endl;
+  // the command is complete, no feed string
+  fPort.SendCommand( commandString );
 }
 
 //! Read a string from device.
 /*!
 \par Input:
-  <br><b>Receive string must be at least 41 characters long.</b>
-
-  This function must be placed right in time before
-  the device starts sending.
+  <br><b>Receive string must be at least 1000 characters long.</b>
 
-  See example program in class description.
+  Returns as soon as the answer is complete.
 */
 void LeyboldComHandler::ReceiveString( char *receiveString )
 {
-  if (!fDeviceAvailable) {
-    receiveString[0] = 0;
-    return;
-  }
-
-  usleep(25000);
-
-  int timeout = 0, readResult = 0;
+  receiveString[0] = 0;
 
-  while (timeout < 100000)  {
+  if (!fDeviceAvailable) return;
 
-    readResult = read( fIoPortFileDescriptor, receiveString, 1024 );
+  std::string answer;
+  fPort.ReceiveFrame( answer );
 
-    if (readResult > 0) {
-      receiveString[readResult] = 0;
-      break;
-    }
-    
-    timeout++;
-  }
+  size_t length = answer.copy( receiveString, 999 );
+  receiveString[length] = 0;
 }
 
 //! Open I/O port.
@@ -99,7 +80,8 @@ void LeyboldComHandler::ReceiveString( char *receiveString )
 void LeyboldComHandler::OpenIoPort( void )
 {
   // open io port ( read/write | no term control | no DCD line check )
-  fIoPortFileDescriptor = open( fIoPort, O_RDWR | O_NOCTTY  | O_NDELAY );
+  fPort.Open( fIoPort );
+  fIoPortFileDescriptor = fPort.FileDescriptor();
 
   // check if successful
   if (fIoPortFileDescriptor == -1) {
@@ -109,9 +91,6 @@ void LeyboldComHandler::OpenIoPort( void )
               << std::endl;
     fDeviceAvailable = false;
     return;
-  } else {
-    // configure port with no delay
-    fcntl( fIoPortFileDescriptor, F_SETFL, FNDELAY );
   }
 
   fDeviceAvailable = true;
@@ -182,7 +161,7 @@ void LeyboldComHandler::CloseIoPort( void )
 {
   if (!fDeviceAvailable) return;
 
-  close(fIoPortFileDescriptor);
+  fPort.Close();
 }
 
 bool LeyboldComHandler::DeviceAvailable()
@@ -20,6 +20,8 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#include "../Serial/SerialPort.h"
+
 typedef const char* ioport_t;
 typedef struct termios termios_t;
 
@@ -53,6 +55,8 @@ class LeyboldComHandler {
 
   ioport_t fIoPort;
   termios_t fCurrentTermios, fThisTermios;
+
+  SerialPort fPort;
 };
 
 #endif // _LEYBOLDCOMHANDLER_H_
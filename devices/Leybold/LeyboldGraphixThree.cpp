@@ -15,6 +15,7 @@
 #include <sstream>
 
 #include "LeyboldGraphixThree.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 LeyboldGraphixThree::LeyboldGraphixThree( const ioport_t ioPort )
   :VLeyboldGraphixThree(ioPort),
@@ -35,6 +36,8 @@ LeyboldGraphixThree::~LeyboldGraphixThree()
 
 std::string LeyboldGraphixThree::GetVersion() const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string command;
 
   command += SI;
@@ -52,6 +55,8 @@ std::string LeyboldGraphixThree::GetVersion() const
 
 int LeyboldGraphixThree::GetSerialNumber() const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string command;
 
   command += SI;
@@ -69,6 +74,8 @@ int LeyboldGraphixThree::GetSerialNumber() const
 
 std::string LeyboldGraphixThree::GetItemNumber() const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string command;
 
   command += SI;
@@ -86,6 +93,8 @@ std::string LeyboldGraphixThree::GetItemNumber() const
 
 int LeyboldGraphixThree::GetNumberOfChannels() const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string command;
 
   command += SI;
@@ -103,6 +112,8 @@ int LeyboldGraphixThree::GetNumberOfChannels() const
 
 VLeyboldGraphixThree::SensorDetectionMode LeyboldGraphixThree::GetSensorDetectionMode(int sensor) const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string command;
 
   command += SI;
@@ -124,6 +135,8 @@ VLeyboldGraphixThree::SensorDetectionMode LeyboldGraphixThree::GetSensorDetectio
 
 void LeyboldGraphixThree::SetSensorDetectionMode(int sensor, VLeyboldGraphixThree::SensorDetectionMode mode)
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string command;
 
   command += SO;
@@ -146,6 +159,8 @@ void LeyboldGraphixThree::SetSensorDetectionMode(int sensor, VLeyboldGraphixThre
 
 std::string LeyboldGraphixThree::GetSensorTypeName(int sensor) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sensor<1 || sensor>3) return std::string("out of range");
 
   std::string command;
@@ -165,6 +180,8 @@ std::string LeyboldGraphixThree::GetSensorTypeName(int sensor) const
 
 void LeyboldGraphixThree::SetSensorTypeName(int sensor, std::string type)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sensor<1 || sensor>3) return;
 
   std::string command;
@@ -184,6 +201,8 @@ void LeyboldGraphixThree::SetSensorTypeName(int sensor, std::string type)
 
 std::string LeyboldGraphixThree::GetSensorName(int sensor) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sensor<1 || sensor>3) return std::string("out of range");
 
   std::string command;
@@ -202,6 +221,8 @@ std::string LeyboldGraphixThree::GetSensorName(int sensor) const
 }
 void LeyboldGraphixThree::SetSensorName(int sensor, const std::string& name)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sensor<1 || sensor>3) return;
 
   std::string command;
@@ -221,6 +242,8 @@ void LeyboldGraphixThree::SetSensorName(int sensor, const std::string& name)
 
 LeyboldGraphixThree::SensorStatus LeyboldGraphixThree::GetSensorStatus(int sensor) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sensor<1 || sensor>3) return SensorStatus_nosen;
 
   std::string command;
@@ -246,6 +269,8 @@ LeyboldGraphixThree::SensorStatus LeyboldGraphixThree::GetSensorStatus(int senso
 
 double LeyboldGraphixThree::GetPressure(int sensor) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sensor<1 || sensor>3) return -1;
 
   std::string command;
@@ -270,6 +295,8 @@ double LeyboldGraphixThree::GetPressure(int sensor) const
 
 LeyboldGraphixThree::DisplayUnit LeyboldGraphixThree::GetDisplayUnit() const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string command;
 
   command += SI;
@@ -292,6 +319,8 @@ LeyboldGraphixThree::DisplayUnit LeyboldGraphixThree::GetDisplayUnit() const
 
 void LeyboldGraphixThree::SetDisplayUnit(LeyboldGraphixThree::DisplayUnit unit)
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string name;
 
   std::map<DisplayUnit,std::string>::const_iterator itFind = displayUnitNames_.find(unit);
@@ -318,6 +347,8 @@ void LeyboldGraphixThree::SetDisplayUnit(LeyboldGraphixThree::DisplayUnit unit)
 
 VLeyboldGraphixThree::SetPointChannel LeyboldGraphixThree::GetSetPointChannelAssignment(int sp) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sp<1 || sp>6) return SetPointChannelOff;
 
   std::string command;
@@ -347,6 +378,8 @@ VLeyboldGraphixThree::SetPointChannel LeyboldGraphixThree::GetSetPointChannelAss
 
 void LeyboldGraphixThree::SetSetPointChannelAssignment(int sp, VLeyboldGraphixThree::SetPointChannel channel)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sp<1 || sp>6) return;
 
   std::string command;
@@ -375,6 +408,8 @@ void LeyboldGraphixThree::SetSetPointChannelAssignment(int sp, VLeyboldGraphixTh
 
 double LeyboldGraphixThree::GetSetPointOnPressure(int sp) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sp<1 || sp>6) return -1;
 
   std::string command;
@@ -394,6 +429,8 @@ double LeyboldGraphixThree::GetSetPointOnPressure(int sp) const
 
 void LeyboldGraphixThree::SetSetPointOnPressure(int sp, double pressure)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sp<1 || sp>6) return;
 
   std::string command;
@@ -413,6 +450,8 @@ void LeyboldGraphixThree::SetSetPointOnPressure(int sp, double pressure)
 
 double LeyboldGraphixThree::GetSetPointOffPressure(int sp) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sp<1 || sp>6) return -1;
 
   std::string command;
@@ -432,6 +471,8 @@ double LeyboldGraphixThree::GetSetPointOffPressure(int sp) const
 
 void LeyboldGraphixThree::SetSetPointOffPressure(int sp, double pressure)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sp<1 || sp>6) return;
 
   std::string command;
@@ -451,6 +492,8 @@ void LeyboldGraphixThree::SetSetPointOffPressure(int sp, double pressure)
 
 bool LeyboldGraphixThree::GetSetPointStatus(int sp) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sp<1 || sp>6) return false;
 
   std::string command;
@@ -474,6 +517,8 @@ bool LeyboldGraphixThree::GetSetPointStatus(int sp) const
 
 std::string LeyboldGraphixThree::GetDate() const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string command;
 
   command += SI;
@@ -491,6 +536,8 @@ std::string LeyboldGraphixThree::GetDate() const
 
 void LeyboldGraphixThree::SetDate(const std::string& date)
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string command;
 
   command += SO;
@@ -508,6 +555,8 @@ void LeyboldGraphixThree::SetDate(const std::string& date)
 
 std::string LeyboldGraphixThree::GetTime() const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string command;
 
   command += SI;
@@ -525,6 +574,8 @@ std::string LeyboldGraphixThree::GetTime() const
 
 void LeyboldGraphixThree::SetTime(const std::string& time)
 {
+  DEVICE_COMMAND_TIMER();
+
   std::string command;
 
   command += SO;
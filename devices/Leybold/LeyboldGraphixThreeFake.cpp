@@ -16,6 +16,7 @@
 #include <cstdlib>
 
 #include "LeyboldGraphixThreeFake.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 LeyboldGraphixThreeFake::LeyboldGraphixThreeFake( const ioport_t ioPort )
   :VLeyboldGraphixThree(ioPort)
@@ -48,26 +49,36 @@ LeyboldGraphixThreeFake::~LeyboldGraphixThreeFake()
 
 std::string LeyboldGraphixThreeFake::GetVersion() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return std::string("HW:1.01 SW:1.10.00");
 }
 
 int LeyboldGraphixThreeFake::GetSerialNumber() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return 453;
 }
 
 std::string LeyboldGraphixThreeFake::GetItemNumber() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return std::string("230682V01");
 }
 
 int LeyboldGraphixThreeFake::GetNumberOfChannels() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return 3;
 }
 
 VLeyboldGraphixThree::SensorDetectionMode LeyboldGraphixThreeFake::GetSensorDetectionMode(int sensor) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sensor<1 || sensor>3) return SensorDetectionAuto;
 
   return sensorDetectionMode_[sensor-1];
@@ -75,6 +86,8 @@ VLeyboldGraphixThree::SensorDetectionMode LeyboldGraphixThreeFake::GetSensorDete
 
 void LeyboldGraphixThreeFake::SetSensorDetectionMode(int sensor, VLeyboldGraphixThree::SensorDetectionMode mode)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sensor<1 || sensor>3) return;
 
   sensorDetectionMode_[sensor-1] = mode;
@@ -82,6 +95,8 @@ void LeyboldGraphixThreeFake::SetSensorDetectionMode(int sensor, VLeyboldGraphix
 
 std::string LeyboldGraphixThreeFake::GetSensorTypeName(int sensor) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sensor<1 || sensor>3) return std::string("out of range");
 
   return sensorType_[sensor-1];
@@ -89,6 +104,8 @@ std::string LeyboldGraphixThreeFake::GetSensorTypeName(int sensor) const
 
 void LeyboldGraphixThreeFake::SetSensorTypeName(int sensor, std::string type)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sensor<1 || sensor>3) return;
 
   sensorType_[sensor-1] = type;
@@ -96,6 +113,8 @@ void LeyboldGraphixThreeFake::SetSensorTypeName(int sensor, std::string type)
 
 std::string LeyboldGraphixThreeFake::GetSensorName(int sensor) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sensor<1 || sensor>3) return std::string("out of range");
 
   return sensorName_[sensor-1];
@@ -103,6 +122,8 @@ std::string LeyboldGraphixThreeFake::GetSensorName(int sensor) const
 
 void LeyboldGraphixThreeFake::SetSensorName(int sensor, const std::string& name)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sensor<1 || sensor>3) return;
 
   sensorName_[sensor-1] = name;
@@ -110,6 +131,8 @@ void LeyboldGraphixThreeFake::SetSensorName(int sensor, const std::string& name)
 
 LeyboldGraphixThreeFake::SensorStatus LeyboldGraphixThreeFake::GetSensorStatus(int sensor) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sensor<1 || sensor>3) return SensorStatus_nosen;
 
   return SensorStatus_ok;
@@ -117,64 +140,86 @@ LeyboldGraphixThreeFake::SensorStatus LeyboldGraphixThreeFake::GetSensorStatus(i
 
 double LeyboldGraphixThreeFake::GetPressure(int sensor) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sensor<1 || sensor>3) return -1;
   return pressure_[sensor-1] + rand() % 10;
 }
 
 LeyboldGraphixThreeFake::DisplayUnit LeyboldGraphixThreeFake::GetDisplayUnit() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return displayUnit_;
 }
 
 void LeyboldGraphixThreeFake::SetDisplayUnit(LeyboldGraphixThreeFake::DisplayUnit unit)
 {
+  DEVICE_COMMAND_TIMER();
+
   displayUnit_ = unit;
 }
 
 VLeyboldGraphixThree::SetPointChannel LeyboldGraphixThreeFake::GetSetPointChannelAssignment(int sp) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sp<1 || sp>6) return SetPointChannelOff;
   return setPointChannel_[sp-1];
 }
 
 void LeyboldGraphixThreeFake::SetSetPointChannelAssignment(int sp, VLeyboldGraphixThree::SetPointChannel channel)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sp<1 || sp>6) return;
   setPointChannel_[sp-1] = channel;
 }
 
 double LeyboldGraphixThreeFake::GetSetPointOnPressure(int sp) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sp<1 || sp>6) return -1;
   return setPointOnPressure_[sp-1];
 }
 
 void LeyboldGraphixThreeFake::SetSetPointOnPressure(int sp, double pressure)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sp<1 || sp>6) return;
   setPointOnPressure_[sp-1] = pressure;
 }
 
 double LeyboldGraphixThreeFake::GetSetPointOffPressure(int sp) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sp<1 || sp>6) return -1;
   return setPointOffPressure_[sp-1];
 }
 
 void LeyboldGraphixThreeFake::SetSetPointOffPressure(int sp, double pressure)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sp<1 || sp>6) return;
   setPointOffPressure_[sp-1] = pressure;
 }
 
 bool LeyboldGraphixThreeFake::GetSetPointStatus(int sp) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (sp<1 || sp>6) return false;
   return false;
 }
 
 std::string LeyboldGraphixThreeFake::GetDate() const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::time_t t = std::time(NULL);
   char buffer[100];
 
@@ -185,11 +230,14 @@ std::string LeyboldGraphixThreeFake::GetDate() const
 
 void LeyboldGraphixThreeFake::SetDate(const std::string&)
 {
+  DEVICE_COMMAND_TIMER();
 
 }
 
 std::string LeyboldGraphixThreeFake::GetTime() const
 {
+  DEVICE_COMMAND_TIMER();
+
   std::time_t t = std::time(NULL);
   char buffer[100];
 
@@ -200,5 +248,6 @@ std::string LeyboldGraphixThreeFake::GetTime() const
 
 void LeyboldGraphixThreeFake::SetTime(const std::string&)
 {
+  DEVICE_COMMAND_TIMER();
 
 }
@@ -15,6 +15,7 @@
 #include <sstream>
 
 #include "NanotecSMCI36.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 NanotecSMCI36::NanotecSMCI36( const ioport_t ioPort )
   :VNanotecSMCI36(ioPort),
@@ -36,6 +37,8 @@ bool NanotecSMCI36::DeviceAvailable() const
 
 std::string NanotecSMCI36::GetFirmwareVersion() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dv", driveAddress_);
 
@@ -52,6 +55,8 @@ std::string NanotecSMCI36::GetFirmwareVersion() const
 
 int NanotecSMCI36::GetStatus() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%d$", driveAddress_);
 
@@ -68,6 +73,8 @@ int NanotecSMCI36::GetStatus() const
 
 void NanotecSMCI36::SetMotorType(int type)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (type < smciStepper || type > smciBLDCEncoder) return;
 
   char command[20];
@@ -80,6 +87,8 @@ void NanotecSMCI36::SetMotorType(int type)
 
 int NanotecSMCI36::GetMotorType() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%d:CL_motor_type", driveAddress_);
 
@@ -96,6 +105,8 @@ int NanotecSMCI36::GetMotorType() const
 
 void NanotecSMCI36::SetPhaseCurrent(int current)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (current < 0 || current >100) return;
 
   char command[20];
@@ -108,6 +119,8 @@ void NanotecSMCI36::SetPhaseCurrent(int current)
 
 int NanotecSMCI36::GetPhaseCurrent() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZi", driveAddress_);
 
@@ -126,6 +139,8 @@ int NanotecSMCI36::GetPhaseCurrent() const
 
 void NanotecSMCI36::SetStandStillPhaseCurrent(int current)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (current < 0 || current >100) return;
 
   char command[20];
@@ -138,6 +153,8 @@ void NanotecSMCI36::SetStandStillPhaseCurrent(int current)
 
 int NanotecSMCI36::GetStandStillPhaseCurrent() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZr", driveAddress_);
 
@@ -156,6 +173,8 @@ int NanotecSMCI36::GetStandStillPhaseCurrent() const
 
 void NanotecSMCI36::SetStepMode(int mode)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (mode != smci01MicroStepsPerFullStep &&
       mode != smci02MicroStepsPerFullStep &&
       mode != smci04MicroStepsPerFullStep &&
@@ -178,6 +197,8 @@ void NanotecSMCI36::SetStepMode(int mode)
 
 int NanotecSMCI36::GetStepMode() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZg", driveAddress_);
 
@@ -196,6 +217,8 @@ int NanotecSMCI36::GetStepMode() const
 
 void NanotecSMCI36::SetDriveAddress(int address)
 {
+  DEVICE_COMMAND_TIMER();
+
   driveAddress_ = address;
 
   char command[20];
@@ -208,6 +231,8 @@ void NanotecSMCI36::SetDriveAddress(int address)
 
 int NanotecSMCI36::GetDriveAddress()
 {
+  DEVICE_COMMAND_TIMER();
+
   comHandler_->SendCommand("#*m");
   char buffer[1000];
   comHandler_->ReceiveString(buffer);
@@ -225,6 +250,8 @@ int NanotecSMCI36::GetDriveAddress()
 
 void NanotecSMCI36::SetMotorID(int ID)
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%d:mt%d", driveAddress_, ID);
 
@@ -235,6 +262,8 @@ void NanotecSMCI36::SetMotorID(int ID)
 
 int NanotecSMCI36::GetMotorID() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%d:mt", driveAddress_);
 
@@ -253,6 +282,8 @@ int NanotecSMCI36::GetMotorID() const
 
 void NanotecSMCI36::SetErrorCorrectionMode(int mode)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (mode < smciErrCorrectionOff || mode > smciErrCorrectionDuringTravel) return;
 
   char command[20];
@@ -265,6 +296,8 @@ void NanotecSMCI36::SetErrorCorrectionMode(int mode)
 
 int NanotecSMCI36::GetErrorCorrectionMode() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZU", driveAddress_);
 
@@ -283,6 +316,8 @@ int NanotecSMCI36::GetErrorCorrectionMode() const
 
 void NanotecSMCI36::SetEncoderDirection(bool direction)
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dq%d", driveAddress_, (int)direction);
 
@@ -293,6 +328,8 @@ void NanotecSMCI36::SetEncoderDirection(bool direction)
 
 bool NanotecSMCI36::GetEncoderDirection() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZq", driveAddress_);
 
@@ -311,6 +348,8 @@ bool NanotecSMCI36::GetEncoderDirection() const
 
 void NanotecSMCI36::SetSwingOutTime(int time)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (time<0 || time > 255) return;
 
   char command[20];
@@ -323,6 +362,8 @@ void NanotecSMCI36::SetSwingOutTime(int time)
 
 int NanotecSMCI36::GetSwingOutTime() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZO", driveAddress_);
 
@@ -341,6 +382,8 @@ int NanotecSMCI36::GetSwingOutTime() const
 
 void NanotecSMCI36::SetMaxEncoderDeviation(int deviation)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (deviation < 0 || deviation > 255) return;
 
   char command[20];
@@ -353,6 +396,8 @@ void NanotecSMCI36::SetMaxEncoderDeviation(int deviation)
 
 int NanotecSMCI36::GetMaxEncoderDeviation() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZX", driveAddress_);
 
@@ -371,6 +416,8 @@ int NanotecSMCI36::GetMaxEncoderDeviation() const
 
 int NanotecSMCI36::GetPosition() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dC", driveAddress_);
 
@@ -389,6 +436,8 @@ int NanotecSMCI36::GetPosition() const
 
 int NanotecSMCI36::GetEncoderPosition() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dI", driveAddress_);
 
@@ -407,6 +456,8 @@ int NanotecSMCI36::GetEncoderPosition() const
 
 void NanotecSMCI36::ResetPositionError(int position)
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dD%d", driveAddress_, position);
 
@@ -417,6 +468,8 @@ void NanotecSMCI36::ResetPositionError(int position)
 
 void NanotecSMCI36::SetInputPinFunction(int pin, int function)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (pin<1 || pin>6) return;
   if (function<smciIPinUserDefined || function>smciIClockDirectionMode2) return;
 
@@ -430,6 +483,8 @@ void NanotecSMCI36::SetInputPinFunction(int pin, int function)
 
 int NanotecSMCI36::GetInputPinFunction(int pin) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (pin<1 || pin>6) return smciIInvalid;
 
   char command[20];
@@ -451,6 +506,8 @@ int NanotecSMCI36::GetInputPinFunction(int pin) const
 
 void NanotecSMCI36::SetOutputPinFunction(int pin, int function)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (pin<1 || pin>3) return;
   if (function<smciOPinUserDefined || function>smciOError) return;
 
@@ -464,6 +521,8 @@ void NanotecSMCI36::SetOutputPinFunction(int pin, int function)
 
 int NanotecSMCI36::GetOutputPinFunction(int pin) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (pin<1 || pin>3) return smciOInvalid;
 
   char command[20];
@@ -485,6 +544,8 @@ int NanotecSMCI36::GetOutputPinFunction(int pin) const
 
 void NanotecSMCI36::SetIOMask(unsigned int mask)
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dL%d", driveAddress_, mask);
 
@@ -495,6 +556,8 @@ void NanotecSMCI36::SetIOMask(unsigned int mask)
 
 unsigned int NanotecSMCI36::GetIOMask() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZL", driveAddress_);
 
@@ -514,6 +577,8 @@ unsigned int NanotecSMCI36::GetIOMask() const
 
 void NanotecSMCI36::SetReversePolarityMask(unsigned int mask)
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dh%d", driveAddress_, mask);
 
@@ -524,6 +589,8 @@ void NanotecSMCI36::SetReversePolarityMask(unsigned int mask)
 
 unsigned int NanotecSMCI36::GetReversePolarityMask() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZh", driveAddress_);
 
@@ -543,6 +610,8 @@ unsigned int NanotecSMCI36::GetReversePolarityMask() const
 
 void NanotecSMCI36::SetIO(unsigned int mask)
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dY%d", driveAddress_, mask);
 
@@ -553,6 +622,8 @@ void NanotecSMCI36::SetIO(unsigned int mask)
 
 unsigned int NanotecSMCI36::GetIO() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZY", driveAddress_);
 
@@ -572,6 +643,8 @@ unsigned int NanotecSMCI36::GetIO() const
 
 void NanotecSMCI36::SetRampMode(int ramp)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (ramp < smciTrapezoidalRamp || ramp > smciJerkFreeRamp) return;
 
   char command[20];
@@ -584,6 +657,8 @@ void NanotecSMCI36::SetRampMode(int ramp)
 
 int NanotecSMCI36::GetRampMode() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%d:ramp_mode", driveAddress_);
 
@@ -603,6 +678,8 @@ int NanotecSMCI36::GetRampMode() const
 
 void NanotecSMCI36::SetQuickstopRamp(int ramp)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (ramp < 0 || ramp > 8000) return;
 
   char command[20];
@@ -615,6 +692,8 @@ void NanotecSMCI36::SetQuickstopRamp(int ramp)
 
 int NanotecSMCI36::GetQuickstopRamp() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZH", driveAddress_);
 
@@ -634,6 +713,8 @@ int NanotecSMCI36::GetQuickstopRamp() const
 
 void NanotecSMCI36::SetQuickstopRampHzPerSecond(int ramp)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (ramp < 0 || ramp > 3000000) return;
 
   char command[20];
@@ -646,6 +727,8 @@ void NanotecSMCI36::SetQuickstopRampHzPerSecond(int ramp)
 
 int NanotecSMCI36::GetQuickstopRampHzPerSecond() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%d:decelquick", driveAddress_);
 
@@ -665,6 +748,8 @@ int NanotecSMCI36::GetQuickstopRampHzPerSecond() const
 
 void NanotecSMCI36::SetAccelerationRamp(int ramp)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (ramp < 1 || ramp > 65535) return;
 
   char command[20];
@@ -677,6 +762,8 @@ void NanotecSMCI36::SetAccelerationRamp(int ramp)
 
 int NanotecSMCI36::GetAccelerationRamp() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZb", driveAddress_);
 
@@ -696,6 +783,8 @@ int NanotecSMCI36::GetAccelerationRamp() const
 
 void NanotecSMCI36::SetAccelerationRampHzPerSecond(int ramp)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (ramp < 1 || ramp > 3000000) return;
 
   char command[20];
@@ -708,6 +797,8 @@ void NanotecSMCI36::SetAccelerationRampHzPerSecond(int ramp)
 
 int NanotecSMCI36::GetAccelerationRampHzPerSecond() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%d:accel", driveAddress_);
 
@@ -727,6 +818,8 @@ int NanotecSMCI36::GetAccelerationRampHzPerSecond() const
 
 void NanotecSMCI36::SetDecelerationRamp(int ramp)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (ramp < 0 || ramp > 65535) return;
 
   char command[20];
@@ -739,6 +832,8 @@ void NanotecSMCI36::SetDecelerationRamp(int ramp)
 
 int NanotecSMCI36::GetDecelerationRamp() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZB", driveAddress_);
 
@@ -758,6 +853,8 @@ int NanotecSMCI36::GetDecelerationRamp() const
 
 void NanotecSMCI36::SetDecelerationRampHzPerSecond(int ramp)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (ramp < 0 || ramp > 3000000) return;
 
   char command[20];
@@ -770,6 +867,8 @@ void NanotecSMCI36::SetDecelerationRampHzPerSecond(int ramp)
 
 int NanotecSMCI36::GetDecelerationRampHzPerSecond() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%d:decel", driveAddress_);
 
@@ -789,6 +888,8 @@ int NanotecSMCI36::GetDecelerationRampHzPerSecond() const
 
 void NanotecSMCI36::SetPositioningMode(int mode)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (mode < smciRelativePositioning || mode >= smciMaxPositioningMode) return;
 
   char command[20];
@@ -801,6 +902,8 @@ void NanotecSMCI36::SetPositioningMode(int mode)
 
 int NanotecSMCI36::GetPositioningMode() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZp", driveAddress_);
 
@@ -820,6 +923,8 @@ int NanotecSMCI36::GetPositioningMode() const
 
 void NanotecSMCI36::SetTravelDistance(int distance)
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%ds%d", driveAddress_, distance);
 
@@ -830,6 +935,8 @@ void NanotecSMCI36::SetTravelDistance(int distance)
 
 int NanotecSMCI36::GetTravelDistance() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZs", driveAddress_);
 
@@ -849,6 +956,8 @@ int NanotecSMCI36::GetTravelDistance() const
 
 void NanotecSMCI36::SetDirection(bool direction)
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dd%d", driveAddress_, (int)direction);
 
@@ -859,6 +968,8 @@ void NanotecSMCI36::SetDirection(bool direction)
 
 bool NanotecSMCI36::GetDirection() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZd", driveAddress_);
 
@@ -878,6 +989,8 @@ bool NanotecSMCI36::GetDirection() const
 
 void NanotecSMCI36::SetMinimumFrequency(int frequency)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (frequency < minFrequencyLimits_.first || frequency > minFrequencyLimits_.second) return;
 
   char command[20];
@@ -890,6 +1003,8 @@ void NanotecSMCI36::SetMinimumFrequency(int frequency)
 
 int NanotecSMCI36::GetMinimumFrequency() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZu", driveAddress_);
 
@@ -909,6 +1024,8 @@ int NanotecSMCI36::GetMinimumFrequency() const
 
 void NanotecSMCI36::SetMaximumFrequency(int frequency)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (frequency < maxFrequencyLimits_.first || frequency > maxFrequencyLimits_.second) return;
 
   char command[20];
@@ -921,6 +1038,8 @@ void NanotecSMCI36::SetMaximumFrequency(int frequency)
 
 int NanotecSMCI36::GetMaximumFrequency() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZo", driveAddress_);
 
@@ -940,6 +1059,8 @@ int NanotecSMCI36::GetMaximumFrequency() const
 
 void NanotecSMCI36::SetMaximumFrequency2(int frequency)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (frequency < maxFrequency2Limits_.first || frequency > maxFrequency2Limits_.second) return;
 
   char command[20];
@@ -952,6 +1073,8 @@ void NanotecSMCI36::SetMaximumFrequency2(int frequency)
 
 int NanotecSMCI36::GetMaximumFrequency2() const
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dZn", driveAddress_);
 
@@ -971,6 +1094,8 @@ int NanotecSMCI36::GetMaximumFrequency2() const
 
 void NanotecSMCI36::Start()
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dA", driveAddress_);
 
@@ -979,6 +1104,8 @@ void NanotecSMCI36::Start()
 
 void NanotecSMCI36::Stop(bool quickstop)
 {
+  DEVICE_COMMAND_TIMER();
+
   char command[20];
   sprintf(command, "#%dS%d", driveAddress_, (int)!quickstop);
 
@@ -14,6 +14,7 @@
 #include <iostream>
 
 #include "NanotecSMCI36Fake.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 NanotecSMCI36Fake::NanotecSMCI36Fake( const ioport_t ioPort )
   :VNanotecSMCI36(ioPort)
@@ -72,49 +73,67 @@ NanotecSMCI36Fake::~NanotecSMCI36Fake()
 
 std::string NanotecSMCI36Fake::GetFirmwareVersion() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return std::string("SMCI47-S_RS485_17-05-2011-rev3711");
 }
 
 int NanotecSMCI36Fake::GetStatus() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return status_;
 }
 
 void NanotecSMCI36Fake::SetMotorType(int type)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (type < smciStepper || type > smciBLDCEncoder) return;
   motorType_ = type;
 }
 
 int NanotecSMCI36Fake::GetMotorType() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return motorType_;
 }
 
 void NanotecSMCI36Fake::SetPhaseCurrent(int current)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (current < 0 || current >100) return;
   phaseCurrent_ = current;
 }
 
 int NanotecSMCI36Fake::GetPhaseCurrent() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return phaseCurrent_;
 }
 
 void NanotecSMCI36Fake::SetStandStillPhaseCurrent(int current)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (current < 0 || current >100) return;
   standStillPhaseCurrent_ = current;
 }
 
 int NanotecSMCI36Fake::GetStandStillPhaseCurrent() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return standStillPhaseCurrent_;
 }
 
 void NanotecSMCI36Fake::SetStepMode(int mode)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (mode != smci01MicroStepsPerFullStep &&
       mode != smci02MicroStepsPerFullStep &&
       mode != smci04MicroStepsPerFullStep &&
@@ -132,90 +151,124 @@ void NanotecSMCI36Fake::SetStepMode(int mode)
 
 int NanotecSMCI36Fake::GetStepMode() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return stepMode_;
 }
 
 void NanotecSMCI36Fake::SetDriveAddress(int address)
 {
+  DEVICE_COMMAND_TIMER();
+
   driveAddress_ = address;
 }
 
 int NanotecSMCI36Fake::GetDriveAddress()
 {
+  DEVICE_COMMAND_TIMER();
+
   return driveAddress_;
 }
 
 void NanotecSMCI36Fake::SetMotorID(int ID)
 {
+  DEVICE_COMMAND_TIMER();
+
   motorID_ = ID;
 }
 
 int NanotecSMCI36Fake::GetMotorID() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return motorID_;
 }
 
 void NanotecSMCI36Fake::SetErrorCorrectionMode(int mode)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (mode < smciErrCorrectionOff || mode > smciErrCorrectionDuringTravel) return;
   errorCorrectionMode_ = mode;
 }
 
 int NanotecSMCI36Fake::GetErrorCorrectionMode() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return errorCorrectionMode_;
 }
 
 void NanotecSMCI36Fake::SetEncoderDirection(bool direction)
 {
+  DEVICE_COMMAND_TIMER();
+
   encoderDirection_ = direction;
 }
 
 bool NanotecSMCI36Fake::GetEncoderDirection() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return encoderDirection_;
 }
 
 void NanotecSMCI36Fake::SetSwingOutTime(int time)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (time<0 || time > 255) return;
   swingOutTime_ = time;
 }
 
 int NanotecSMCI36Fake::GetSwingOutTime() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return swingOutTime_;
 }
 
 void NanotecSMCI36Fake::SetMaxEncoderDeviation(int deviation)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (deviation < 0 || deviation > 255) return;
   maxEncoderDeviation_ = deviation;
 }
 
 int NanotecSMCI36Fake::GetMaxEncoderDeviation() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return maxEncoderDeviation_;
 }
 
 int NanotecSMCI36Fake::GetPosition() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return position_;
 }
 
 int NanotecSMCI36Fake::GetEncoderPosition() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return encoderPosition_;
 }
 
 void NanotecSMCI36Fake::ResetPositionError(int position)
 {
+  DEVICE_COMMAND_TIMER();
+
   position_ = position;
   encoderPosition_ = position;
 }
 
 void NanotecSMCI36Fake::SetInputPinFunction(int pin, int function)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (pin<1 || pin>6) return;
   if (function<smciIPinUserDefined || function>smciIClockDirectionMode2) return;
   inputPinFunction_[pin] = function;
@@ -223,12 +276,16 @@ void NanotecSMCI36Fake::SetInputPinFunction(int pin, int function)
 
 int NanotecSMCI36Fake::GetInputPinFunction(int pin) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (pin<1 || pin>6) return smciIInvalid;
   return inputPinFunction_[pin];
 }
 
 void NanotecSMCI36Fake::SetOutputPinFunction(int pin, int function)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (pin<1 || pin>3) return;
   if (function<smciOPinUserDefined || function>smciOError) return;
   outputPinFunction_[pin] = function;
@@ -236,109 +293,149 @@ void NanotecSMCI36Fake::SetOutputPinFunction(int pin, int function)
 
 int NanotecSMCI36Fake::GetOutputPinFunction(int pin) const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (pin<1 || pin>3) return smciOInvalid;
   return outputPinFunction_[pin];
 }
 
 void NanotecSMCI36Fake::SetIOMask(unsigned int mask)
 {
+  DEVICE_COMMAND_TIMER();
+
   ioMask_ = mask;
 }
 
 unsigned int NanotecSMCI36Fake::GetIOMask() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return ioMask_;
 }
 
 void NanotecSMCI36Fake::SetReversePolarityMask(unsigned int mask)
 {
+  DEVICE_COMMAND_TIMER();
+
   reversePolarityMask_ = mask;
 }
 
 unsigned int NanotecSMCI36Fake::GetReversePolarityMask() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return reversePolarityMask_;
 }
 
 void NanotecSMCI36Fake::SetIO(unsigned int mask)
 {
+  DEVICE_COMMAND_TIMER();
+
   io_ = mask;
 }
 
 unsigned int NanotecSMCI36Fake::GetIO() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return io_;
 }
 
 void NanotecSMCI36Fake::SetRampMode(int ramp)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (ramp < smciTrapezoidalRamp || ramp > smciJerkFreeRamp) return;
   rampMode_ = ramp;
 }
 
 int NanotecSMCI36Fake::GetRampMode() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return rampMode_;
 }
 
 void NanotecSMCI36Fake::SetQuickstopRamp(int ramp)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (ramp < 0 || ramp > 8000) return;
   quickstopRamp_ = ramp;
 }
 
 int NanotecSMCI36Fake::GetQuickstopRamp() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return quickstopRamp_;
 }
 
 void NanotecSMCI36Fake::SetQuickstopRampHzPerSecond(int ramp)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (ramp < 0 || ramp > 3000000) return;
   quickstopRamp_ = std::pow(3000.0 / (static_cast<float>(ramp) / 1000 + 11.7), 2.0);
 }
 
 int NanotecSMCI36Fake::GetQuickstopRampHzPerSecond() const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (quickstopRamp_==0) return 3000000;
   return 1000 * (3000.0 / std::sqrt(static_cast<float>(quickstopRamp_)) - 11.7);
 }
 
 void NanotecSMCI36Fake::SetAccelerationRamp(int ramp)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (ramp < 1 || ramp > 65535) return;
   accelerationRamp_ = ramp;
 }
 
 int NanotecSMCI36Fake::GetAccelerationRamp() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return accelerationRamp_;
 }
 
 void NanotecSMCI36Fake::SetAccelerationRampHzPerSecond(int ramp)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (ramp < 1 || ramp > 3000000) return;
   accelerationRamp_ = std::pow(3000.0 / (static_cast<float>(ramp) / 1000 + 11.7), 2.0);
 }
 
 int NanotecSMCI36Fake::GetAccelerationRampHzPerSecond() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return 1000 * (3000.0 / std::sqrt(static_cast<float>(accelerationRamp_)) - 11.7);
 }
 
 void NanotecSMCI36Fake::SetDecelerationRamp(int ramp)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (ramp < 0 || ramp > 65535) return;
   decelerationRamp_ = ramp;
 }
 
 int NanotecSMCI36Fake::GetDecelerationRamp() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return decelerationRamp_;
 }
 
 void NanotecSMCI36Fake::SetDecelerationRampHzPerSecond(int ramp)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (ramp < 0 || ramp > 3000000) return;
   if (ramp==0) {
     decelerationRamp_ = 0;
@@ -349,76 +446,104 @@ void NanotecSMCI36Fake::SetDecelerationRampHzPerSecond(int ramp)
 
 int NanotecSMCI36Fake::GetDecelerationRampHzPerSecond() const
 {
+  DEVICE_COMMAND_TIMER();
+
   if (decelerationRamp_==0) return 0;
   return 1000 * (3000.0 / std::sqrt(static_cast<float>(decelerationRamp_)) - 11.7);
 }
 
 void NanotecSMCI36Fake::SetPositioningMode(int mode)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (mode < smciRelativePositioning || mode >= smciMaxPositioningMode) return;
   positioningMode_ = mode;
 }
 
 int NanotecSMCI36Fake::GetPositioningMode() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return positioningMode_;
 }
 
 void NanotecSMCI36Fake::SetTravelDistance(int distance)
 {
+  DEVICE_COMMAND_TIMER();
+
   travelDistance_ = distance;
 }
 
 int NanotecSMCI36Fake::GetTravelDistance() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return travelDistance_;
 }
 
 void NanotecSMCI36Fake::SetDirection(bool direction)
 {
+  DEVICE_COMMAND_TIMER();
+
   direction_ = direction;
 }
 
 bool NanotecSMCI36Fake::GetDirection() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return direction_;
 }
 
 void NanotecSMCI36Fake::SetMinimumFrequency(int frequency)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (frequency < minFrequencyLimits_.first || frequency > minFrequencyLimits_.second) return;
   minFrequency_ = frequency;
 }
 
 int NanotecSMCI36Fake::GetMinimumFrequency() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return minFrequency_;
 }
 
 void NanotecSMCI36Fake::SetMaximumFrequency(int frequency)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (frequency < maxFrequencyLimits_.first || frequency > maxFrequencyLimits_.second) return;
   maxFrequency_ = frequency;
 }
 
 int NanotecSMCI36Fake::GetMaximumFrequency() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return maxFrequency_;
 }
 
 void NanotecSMCI36Fake::SetMaximumFrequency2(int frequency)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (frequency < maxFrequency2Limits_.first || frequency > maxFrequency2Limits_.second) return;
   maxFrequency2_ = frequency;
 }
 
 int NanotecSMCI36Fake::GetMaximumFrequency2() const
 {
+  DEVICE_COMMAND_TIMER();
+
   return maxFrequency2_;
 }
 
 void NanotecSMCI36Fake::Start()
 {
+  DEVICE_COMMAND_TIMER();
+
   if (positioningMode_==smciExternalRefRun) {
     position_ = 0;
   } else if (positioningMode_==smciRelativePositioning) {
@@ -436,5 +561,6 @@ void NanotecSMCI36Fake::Start()
 
 void NanotecSMCI36Fake::Stop(bool /* quickstop */)
 {
+  DEVICE_COMMAND_TIMER();
 
 }
@@ -6,6 +6,7 @@
 #include "TPG262ComHandler.h"
 
 #include "PfeifferTPG262.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 //#define __PfeifferTPG262_DEBUG 1
 
@@ -41,6 +42,8 @@ PfeifferTPG262::~PfeifferTPG262()
 /// Cheking the error flags
 int PfeifferTPG262::GetErrorStatus( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
 #ifdef  __PfeifferTPG262_DEBUG
   std::cout << "[PfeifferTPG262::GetErrorStatus] -- DEBUG: Called." << std::endl;
 #endif
@@ -84,6 +87,8 @@ int PfeifferTPG262::GetErrorStatus( void ) const
 /// Getting the pressure measurement results for gauge 1
 bool PfeifferTPG262::GetPressure1(reading_t & reading)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (!isCommunication_) return false;
 
   char buffer[1000];
@@ -131,6 +136,8 @@ bool PfeifferTPG262::GetPressure1(reading_t & reading)
 /// Getting the pressure measurement results for guage 2
 bool PfeifferTPG262::GetPressure2(reading_t &reading)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (!isCommunication_) return false;
 
   char buffer[1000];
@@ -179,6 +186,8 @@ bool PfeifferTPG262::GetPressure2(reading_t &reading)
 ///
 bool PfeifferTPG262::GetPressures(reading_t & reading1, reading_t & reading2)
 {
+  DEVICE_COMMAND_TIMER();
+
   if (!isCommunication_) return false;
 
   char buffer[1000];
@@ -6,6 +6,7 @@
 #include <cstdlib>
 
 #include "PfeifferTPG262Fake.h"
+#include "../Serial/DeviceCommandStatistics.h"
 
 ///
 ///
@@ -18,11 +19,15 @@ PfeifferTPG262Fake::PfeifferTPG262Fake( const ioport_t ioPort )
 
 int PfeifferTPG262Fake::GetErrorStatus( void ) const
 {
+  DEVICE_COMMAND_TIMER();
+
   return tgp262NoError;
 }
 
 bool PfeifferTPG262Fake::GetPressure1(reading_t & reading)
 {
+  DEVICE_COMMAND_TIMER();
+
   reading.first = tpg262GaugeOkay;
   reading.second = 5.e-3;
   return true;
@@ -30,6 +35,8 @@ bool PfeifferTPG262Fake::GetPressure1(reading_t & reading)
 
 bool PfeifferTPG262Fake::GetPressure2(reading_t & reading)
 {
+  DEVICE_COMMAND_TIMER();
+
   reading.first = tpg262GaugeOkay;
   reading.second = 5.e-3;
   return true;
@@ -37,6 +44,8 @@ bool PfeifferTPG262Fake::GetPressure2(reading_t & reading)
 
 bool PfeifferTPG262Fake::GetPressures(reading_t & reading1, reading_t & reading2)
 {
+  DEVICE_COMMAND_TIMER();
+
   reading1.first = tpg262GaugeOkay;
   reading1.second = 5.e-3;
   reading2.first = tpg262GaugeOkay;
@@ -23,6 +23,11 @@ TPG262ComHandler::TPG262ComHandler( const ioport_t ioPort )
   // save ioport 
   fIoPort = ioPort;
 
+  // canonical mode; answers are read line by line
+  fPort.SetFeed( "\r\n" );
+  fPort.SetTerminator( "\n" );
+  fPort.SetTimeoutPolicy( SerialTimeoutPolicy( 500, 50 ) );
+
   // initialize
   OpenIoPort();
   InitializeIoPort();
@@ -45,63 +50,36 @@ void TPG262ComHandler::SendCommand( const char *commandString )
 {
   if (!fDeviceAvailable) return;
 
-  char singleCharacter = 0; 
-
-  for ( unsigned int i = 0; i < strlen( commandString ); i++ ) {
-    
-    // scan command string character wise & write
-    singleCharacter = commandString[i];
-    write( fIoPortFileDescriptor, &singleCharacter, 1 );
-  }
-
-  // send feed characters
-  SendFeedString();
+  // command and feed string in a single write
+  fPort.SendCommand( commandString );
 }
 
 void TPG262ComHandler::SendEnquiry( )
 {
   if (!fDeviceAvailable) return;
 
-  char singleCharacter = 0x05; 
-
-  write( fIoPortFileDescriptor, &singleCharacter, 1 );
-
-  // send feed characters
-  SendFeedString();
+  // <ENQ> followed by the feed string
+  fPort.SendCommand( std::string( 1, 0x05 ) );
 }
 
 //! Read a string from device.
 /*!
 \par Input:
-  <br><b>Receive string must be at least 41 characters long.</b>
-
-  This function must be placed right in time before
-  the device starts sending.
+  <br><b>Receive string must be at least 1001 characters long.</b>
 
-  See example program in class description.
+  Returns as soon as the answer is complete.
 */
 void TPG262ComHandler::ReceiveString( char *receiveString )
 {
-  if (!fDeviceAvailable) {
-    receiveString[0] = 0;
-    return;
-  }
-
-  usleep( ComHandlerDelay );
-
-  int timeout = 0, readResult = 0;
+  receiveString[0] = 0;
 
-  while ( timeout < 100000 )  {
+  if (!fDeviceAvailable) return;
 
-    readResult = read( fIoPortFileDescriptor, receiveString, 1000 );
+  std::string answer;
+  fPort.ReceiveFrame( answer );
 
-    if ( readResult > 0 )   {
-      receiveString[readResult] = 0;
-      break;
-    }
-    
-    timeout++;
-  }
+  size_t length = answer.copy( receiveString, 1000 );
+  receiveString[length] = 0;
 }
 
 //! Open I/O port.
@@ -111,7 +89,8 @@ void TPG262ComHandler::ReceiveString( char *receiveString )
 void TPG262ComHandler::OpenIoPort( void )
 {
   // open io port ( read/write | no term control | no DCD line check )
-  fIoPortFileDescriptor = open( fIoPort, O_RDWR | O_NOCTTY  | O_NDELAY );
+  fPort.Open( fIoPort );
+  fIoPortFileDescriptor = fPort.FileDescriptor();
 
   // check if successful
   if ( fIoPortFileDescriptor == -1 ) {
@@ -122,10 +101,6 @@ void TPG262ComHandler::OpenIoPort( void )
     fDeviceAvailable = false;
     return;
   }
-  else {
-    // configure port with no delay
-    fcntl( fIoPortFileDescriptor, F_SETFL, FNDELAY );
-  }
 
   fDeviceAvailable = true;
 }
@@ -229,35 +204,15 @@ void TPG262ComHandler::RestoreIoPort( void )
 */
 void TPG262ComHandler::CloseIoPort( void )
 {
-  close( fIoPortFileDescriptor );
-}
-
-//! Send command termination string (<CR><NL>).
-/*!
-  \internal
-*/
-void TPG262ComHandler::SendFeedString( void )
-{
-  // feed string is <NL>
-  char feedString = 13;
-
-  // write <CR> and get echo
-  write( fIoPortFileDescriptor, &feedString, 1 );
-
-  feedString = 10;
-
-  // write <LF> and get echo
-  write( fIoPortFileDescriptor, &feedString, 1 );
-
+  fPort.Close();
 }
 
 void TPG262ComHandler::SendResetInterface()
 {
-  char singleCharacter=0x03;
-  write( fIoPortFileDescriptor, &singleCharacter, 1);
-  
-  // send feed characters
-  SendFeedString();
+  if (!fDeviceAvailable) return;
+
+  // <ETX> followed by the feed string
+  fPort.SendCommand( std::string( 1, 0x03 ) );
 }
 
 bool TPG262ComHandler::DeviceAvailable()
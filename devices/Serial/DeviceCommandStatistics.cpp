@@ -0,0 +1,289 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <ctime>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "DeviceCommandStatistics.h"
+
+DeviceCommandCounter::DeviceCommandCounter( const std::string& name )
+  : fName( name )
+{
+  Reset();
+}
+
+void DeviceCommandCounter::Record( std::chrono::steady_clock::duration duration )
+{
+  unsigned long long ns = std::chrono::duration_cast<std::chrono::nanoseconds>( duration ).count();
+
+  fCalls.fetch_add( 1, std::memory_order_relaxed );
+  fTotal.fetch_add( ns, std::memory_order_relaxed );
+
+  unsigned long long max = fMax.load( std::memory_order_relaxed );
+  while ( ns > max && !fMax.compare_exchange_weak( max, ns, std::memory_order_relaxed ) ) { }
+
+  int bin = 0;
+  for ( unsigned long long us = ns / 1000; us > 0 && bin < NBins - 1; us >>= 1 ) bin++;
+
+  fBins[bin].fetch_add( 1, std::memory_order_relaxed );
+}
+
+void DeviceCommandCounter::Reset()
+{
+  fCalls = 0;
+  fTotal = 0;
+  fMax = 0;
+  for ( int i = 0; i < NBins; ++i ) fBins[i] = 0;
+}
+
+//! Mean latency in ms.
+double DeviceCommandCounter::MeanLatency() const
+{
+  unsigned long calls = fCalls;
+  if ( calls == 0 ) return 0.;
+
+  return 1.e-6 * fTotal / calls;
+}
+
+//! Maximum latency in ms.
+double DeviceCommandCounter::MaxLatency() const
+{
+  return 1.e-6 * fMax;
+}
+
+//! Upper edge in ms of the bin containing the &lt;fraction&gt; quantile, at most the maximum.
+double DeviceCommandCounter::Percentile( double fraction ) const
+{
+  unsigned long calls = fCalls;
+  if ( calls == 0 ) return 0.;
+
+  unsigned long sum = 0;
+  for ( int i = 0; i < NBins; ++i ) {
+    sum += fBins[i];
+    if ( sum >= fraction * calls ) return std::min( 1.e-3 * ( 1UL << i ), MaxLatency() );
+  }
+
+  return MaxLatency();
+}
+
+int DeviceCommandStatistics::fSignalPipe[2] = { -1, -1 };
+
+DeviceCommandStatistics::DeviceCommandStatistics()
+{
+
+}
+
+DeviceCommandStatistics* DeviceCommandStatistics::instance()
+{
+  static DeviceCommandStatistics statistics;
+  return &statistics;
+}
+
+//! Counter for the function &lt;function&gt; as given by __PRETTY_FUNCTION__.
+DeviceCommandCounter* DeviceCommandStatistics::Counter( const std::string& function )
+{
+  std::string name = CommandName( function );
+
+  std::lock_guard<std::mutex> lock( fMutex );
+
+  std::map<std::string,DeviceCommandCounter*>::iterator it = fCounters.find( name );
+  if ( it != fCounters.end() ) return it->second;
+
+  DeviceCommandCounter* counter = new DeviceCommandCounter( name );
+  fCounters[name] = counter;
+
+  return counter;
+}
+
+//! All counters, sorted by name.
+std::vector<const DeviceCommandCounter*> DeviceCommandStatistics::Counters() const
+{
+  std::lock_guard<std::mutex> lock( fMutex );
+
+  std::vector<const DeviceCommandCounter*> counters;
+  for ( std::map<std::string,DeviceCommandCounter*>::const_iterator it = fCounters.begin();
+        it != fCounters.end();
+        ++it ) {
+    counters.push_back( it->second );
+  }
+
+  return counters;
+}
+
+void DeviceCommandStatistics::Reset()
+{
+  std::lock_guard<std::mutex> lock( fMutex );
+
+  for ( std::map<std::string,DeviceCommandCounter*>::iterator it = fCounters.begin();
+        it != fCounters.end();
+        ++it ) {
+    it->second->Reset();
+  }
+}
+
+//! Write a table of all commands that were called at least once.
+/*!
+  Latencies are given in ms. The histogram columns sum the power of two
+  bins to roughly logarithmic steps from 8 us to 1 s.
+*/
+void DeviceCommandStatistics::Dump( std::ostream& stream ) const
+{
+  std::vector<const DeviceCommandCounter*> counters = Counters();
+
+  stream << "# " << std::left << std::setw( 46 ) << "command" << std::right
+         << std::setw( 10 ) << "calls"
+         << std::setw( 10 ) << "mean"
+         << std::setw( 10 ) << "p50"
+         << std::setw( 10 ) << "p90"
+         << std::setw( 10 ) << "p99"
+         << std::setw( 10 ) << "max"
+         << "  <8us <128us <1ms <16ms <128ms <1s >=1s" << std::endl;
+
+  // first bin above 8 us, 128 us, 1 ms, 16 ms, 128 ms and 1 s
+  static const int decades[] = { 4, 8, 11, 15, 18, 21, DeviceCommandCounter::NBins };
+
+  stream << std::fixed << std::setprecision( 3 );
+
+  for ( std::vector<const DeviceCommandCounter*>::const_iterator it = counters.begin();
+        it != counters.end();
+        ++it ) {
+
+    const DeviceCommandCounter* counter = *it;
+    if ( counter->Calls() == 0 ) continue;
+
+    stream << "  " << std::left << std::setw( 46 ) << counter->Name() << std::right
+           << std::setw( 10 ) << counter->Calls()
+           << std::setw( 10 ) << counter->MeanLatency()
+           << std::setw( 10 ) << counter->Percentile( 0.50 )
+           << std::setw( 10 ) << counter->Percentile( 0.90 )
+           << std::setw( 10 ) << counter->Percentile( 0.99 )
+           << std::setw( 10 ) << counter->MaxLatency()
+           << " ";
+
+    int bin = 0;
+    for ( int d = 0; d < 7; ++d ) {
+      unsigned long sum = 0;
+      for ( ; bin < decades[d]; ++bin ) sum += counter->BinContent( bin );
+      stream << " " << sum;
+    }
+
+    stream << std::endl;
+  }
+}
+
+bool DeviceCommandStatistics::Dump( const std::string& filename ) const
+{
+  std::ofstream file( filename.c_str() );
+  if ( !file.good() ) {
+    std::cerr << "[DeviceCommandStatistics::Dump] ** ERROR: could not open "
+              << filename << "." << std::endl;
+    return false;
+  }
+
+  time_t now = time( 0 );
+  char buffer[64];
+  strftime( buffer, sizeof( buffer ), "%Y-%m-%d %H:%M:%S", localtime( &now ) );
+
+  file << "# device command latency " << buffer << std::endl;
+  Dump( file );
+
+  return true;
+}
+
+//! Write the statistics to &lt;filename&gt; whenever &lt;signal&gt; is received.
+/*!
+  The signal handler only writes a byte to a pipe; the file is written by a
+  separate thread, so the dump is safe whatever the process is doing.
+*/
+bool DeviceCommandStatistics::DumpOnSignal( int signal, const std::string& filename )
+{
+  if ( fSignalPipe[0] != -1 ) {
+    std::cerr << "[DeviceCommandStatistics::DumpOnSignal] ** ERROR: dump already installed."
+              << std::endl;
+    return false;
+  }
+
+  if ( pipe( fSignalPipe ) != 0 ) {
+    std::cerr << "[DeviceCommandStatistics::DumpOnSignal] ** ERROR: could not create pipe."
+              << std::endl;
+    return false;
+  }
+  fcntl( fSignalPipe[1], F_SETFL, O_NONBLOCK );
+
+  fDumpFilename = filename;
+
+  struct sigaction action;
+  memset( &action, 0, sizeof( action ) );
+  action.sa_handler = &DeviceCommandStatistics::SignalHandler;
+  sigemptyset( &action.sa_mask );
+  action.sa_flags = SA_RESTART;
+
+  if ( sigaction( signal, &action, 0 ) != 0 ) {
+    std::cerr << "[DeviceCommandStatistics::DumpOnSignal] ** ERROR: could not install signal handler."
+              << std::endl;
+    return false;
+  }
+
+  std::thread( &DeviceCommandStatistics::DumpLoop, this ).detach();
+
+  return true;
+}
+
+//! Strip return type and arguments from a __PRETTY_FUNCTION__ string.
+/*!
+  \internal
+*/
+std::string DeviceCommandStatistics::CommandName( const std::string& function )
+{
+  std::string name = function.substr( 0, function.find( '(' ) );
+
+  std::string::size_type pos = name.rfind( ' ' );
+  if ( pos != std::string::npos ) name.erase( 0, pos + 1 );
+
+  // pointer or reference return types
+  pos = name.find_first_not_of( "*&" );
+  if ( pos != std::string::npos ) name.erase( 0, pos );
+
+  return name;
+}
+
+void DeviceCommandStatistics::SignalHandler( int )
+{
+  int savedErrno = errno;
+  char c = 0;
+  if ( write( fSignalPipe[1], &c, 1 ) < 0 ) { }
+  errno = savedErrno;
+}
+
+//! Dump thread.
+/*!
+  \internal
+*/
+void DeviceCommandStatistics::DumpLoop()
+{
+  char c;
+  while ( true ) {
+    ssize_t result = read( fSignalPipe[0], &c, 1 );
+    if ( result < 0 && errno == EINTR ) continue;
+    if ( result <= 0 ) break;
+    Dump( fDumpFilename );
+  }
+}
@@ -0,0 +1,132 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _DEVICECOMMANDSTATISTICS_H_
+#define _DEVICECOMMANDSTATISTICS_H_
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <ostream>
+
+/** @addtogroup devices
+ *  @{
+ */
+
+/** @addtogroup Serial
+ *  @{
+ */
+
+/**
+  \brief Call count and round trip latency of a single device command.
+  Latencies are histogrammed in power of two bins of microseconds, bin i
+  holding calls of [2^(i-1), 2^i) us. All members are updated with relaxed
+  atomics, so recording a call costs two clock reads and a few increments.
+  */
+class DeviceCommandCounter
+{
+ public:
+
+  static const int NBins = 26;
+
+  DeviceCommandCounter( const std::string& name );
+
+  const std::string& Name() const { return fName; }
+
+  void Record( std::chrono::steady_clock::duration duration );
+  void Reset();
+
+  unsigned long Calls() const { return fCalls; }
+  double MeanLatency() const;
+  double MaxLatency() const;
+  double Percentile( double fraction ) const;
+  unsigned long BinContent( int bin ) const { return fBins[bin]; }
+
+ protected:
+
+  std::string fName;
+
+  std::atomic<unsigned long> fCalls;
+  std::atomic<unsigned long long> fTotal;
+  std::atomic<unsigned long long> fMax;
+  std::atomic<unsigned long> fBins[NBins];
+};
+
+/**
+  \brief Measures the time between its construction and destruction.
+  */
+class DeviceCommandTimer
+{
+ public:
+
+  DeviceCommandTimer( DeviceCommandCounter* counter )
+    : fCounter( counter ),
+      fStart( std::chrono::steady_clock::now() ) { }
+  ~DeviceCommandTimer() { fCounter->Record( std::chrono::steady_clock::now() - fStart ); }
+
+ protected:
+
+  DeviceCommandCounter* fCounter;
+  std::chrono::steady_clock::time_point fStart;
+};
+
+/**
+  \brief Registry of the command counters of all devices in the process.
+  Counters are created once per call site by DEVICE_COMMAND_TIMER() and
+  named "Class::Method", which keeps real devices and their fake
+  implementations apart. Counters are never deleted.
+  */
+class DeviceCommandStatistics
+{
+ public:
+
+  static DeviceCommandStatistics* instance();
+
+  DeviceCommandCounter* Counter( const std::string& function );
+  std::vector<const DeviceCommandCounter*> Counters() const;
+
+  void Reset();
+  void Dump( std::ostream& stream ) const;
+  bool Dump( const std::string& filename ) const;
+
+  bool DumpOnSignal( int signal, const std::string& filename );
+
+ protected:
+
+  DeviceCommandStatistics();
+
+  static std::string CommandName( const std::string& function );
+  static void SignalHandler( int signal );
+  void DumpLoop();
+
+  mutable std::mutex fMutex;
+  std::map<std::string,DeviceCommandCounter*> fCounters;
+
+  static int fSignalPipe[2];
+  std::string fDumpFilename;
+};
+
+//! Time the enclosing device command.
+#define DEVICE_COMMAND_TIMER()                                          \
+  static DeviceCommandCounter* deviceCommandCounter_ =                  \
+    DeviceCommandStatistics::instance()->Counter( __PRETTY_FUNCTION__ ); \
+  DeviceCommandTimer deviceCommandTimer_( deviceCommandCounter_ )
+
+/** @} */
+
+/** @} */
+
+#endif
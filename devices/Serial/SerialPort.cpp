@@ -0,0 +1,328 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <thread>
+#include <iostream>
+
+#include "SerialPort.h"
+
+SerialPort::SerialPort()
+  : fFileDescriptor( -1 ),
+    fHasSavedTermios( false ),
+    fLastCommand( std::chrono::steady_clock::now() )
+{
+
+}
+
+SerialPort::~SerialPort()
+{
+  Close();
+}
+
+//! Open the device file &lt;ioPort&gt; in non-blocking mode.
+/*!
+  The current termios settings of the port are saved and put back by Restore().
+*/
+bool SerialPort::Open( const std::string& ioPort )
+{
+  Close();
+
+  fIoPort = ioPort;
+
+  // open io port ( read/write | no term control | no DCD line check )
+  fFileDescriptor = open( fIoPort.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK );
+  if ( fFileDescriptor == -1 ) return false;
+
+  fHasSavedTermios = ( tcgetattr( fFileDescriptor, &fSavedTermios ) == 0 );
+
+  fPending.clear();
+
+  return true;
+}
+
+bool SerialPort::Configure( const termios& settings, int optionalActions )
+{
+  if ( fFileDescriptor == -1 ) return false;
+
+  return tcsetattr( fFileDescriptor, optionalActions, &settings ) == 0;
+}
+
+//! Restore the termios settings found when the port was opened.
+void SerialPort::Restore()
+{
+  if ( fFileDescriptor == -1 || !fHasSavedTermios ) return;
+
+  tcsetattr( fFileDescriptor, TCSANOW, &fSavedTermios );
+}
+
+void SerialPort::Close()
+{
+  if ( fFileDescriptor == -1 ) return;
+
+  close( fFileDescriptor );
+  fFileDescriptor = -1;
+  fPending.clear();
+}
+
+//! Write &lt;length&gt; bytes to the device.
+/*!
+  The data is handed to the kernel in as few write() calls as the output
+  queue allows, normally exactly one. With a command gap the output is
+  drained first, so that the gap starts when the command has been
+  transmitted.
+*/
+bool SerialPort::Write( const char* data, size_t length )
+{
+  if ( fFileDescriptor == -1 ) return false;
+
+  WaitCommandGap();
+
+  struct pollfd pfd;
+  pfd.fd = fFileDescriptor;
+  pfd.events = POLLOUT;
+
+  size_t written = 0;
+  while ( written < length ) {
+
+    ssize_t result = write( fFileDescriptor, data + written, length - written );
+
+    if ( result > 0 ) {
+      written += result;
+      continue;
+    }
+
+    if ( result < 0 && errno != EAGAIN && errno != EINTR ) {
+      std::cerr << "[SerialPort::Write] ** ERROR: write to "
+                << fIoPort << " failed." << std::endl;
+      return false;
+    }
+
+    // output queue full
+    if ( poll( &pfd, 1, fPolicy.firstByteTimeout ) <= 0 ) {
+      std::cerr << "[SerialPort::Write] ** ERROR: write to "
+                << fIoPort << " timed out." << std::endl;
+      return false;
+    }
+  }
+
+  if ( fPolicy.commandGap > 0 ) tcdrain( fFileDescriptor );
+
+  fLastCommand = std::chrono::steady_clock::now();
+
+  return true;
+}
+
+//! Send the command string &lt;command&gt; followed by the feed string.
+bool SerialPort::SendCommand( const std::string& command )
+{
+  std::string buffer = command + fFeed;
+
+  return Write( buffer.c_str(), buffer.size() );
+}
+
+//! Send several commands in a single write.
+bool SerialPort::SendCommands( const std::vector<std::string>& commands )
+{
+  std::string buffer;
+  for ( std::vector<std::string>::const_iterator it = commands.begin();
+        it != commands.end();
+        ++it ) {
+    buffer += *it;
+    buffer += fFeed;
+  }
+
+  return Write( buffer.c_str(), buffer.size() );
+}
+
+//! Read one answer, including its terminator.
+/*!
+  Returns false if no terminator was found. Whatever was received up to
+  the first byte timeout or the inter byte timeout is still returned in
+  &lt;answer&gt;. Without a terminator every answer ends on silence.
+*/
+bool SerialPort::ReceiveFrame( std::string& answer )
+{
+  return ReceiveFrame( answer, fPolicy.firstByteTimeout );
+}
+
+bool SerialPort::ReceiveFrame( std::string& answer, int firstByteTimeout )
+{
+  answer.clear();
+
+  if ( fFileDescriptor == -1 ) return false;
+
+  const std::chrono::steady_clock::time_point deadline =
+    std::chrono::steady_clock::now() + std::chrono::milliseconds( firstByteTimeout );
+
+  while ( true ) {
+
+    if ( !fTerminator.empty() ) {
+      std::string::size_type pos = fPending.find( fTerminator );
+      if ( pos != std::string::npos ) {
+        pos += fTerminator.size();
+        answer = fPending.substr( 0, pos );
+        fPending.erase( 0, pos );
+        return true;
+      }
+    }
+
+    int timeout = fPolicy.interByteTimeout;
+    if ( fPending.empty() ) {
+      timeout = std::chrono::duration_cast<std::chrono::milliseconds>
+        ( deadline - std::chrono::steady_clock::now() ).count();
+      if ( timeout <= 0 ) return false;
+    }
+
+    int readResult = Fill( timeout );
+
+    if ( readResult > 0 ) continue;
+
+    if ( !fPending.empty() ) {
+      // device went silent before sending a terminator
+      answer.swap( fPending );
+      fPending.clear();
+      return fTerminator.empty();
+    }
+
+    if ( readResult < 0 ) return false;
+  }
+}
+
+//! Read an answer of exactly &lt;length&gt; bytes.
+bool SerialPort::ReceiveBytes( std::string& answer, size_t length )
+{
+  answer.clear();
+
+  if ( fFileDescriptor == -1 ) return false;
+
+  const std::chrono::steady_clock::time_point deadline =
+    std::chrono::steady_clock::now() + std::chrono::milliseconds( fPolicy.firstByteTimeout );
+
+  while ( fPending.size() < length ) {
+
+    int timeout = fPolicy.interByteTimeout;
+    if ( fPending.empty() ) {
+      timeout = std::chrono::duration_cast<std::chrono::milliseconds>
+        ( deadline - std::chrono::steady_clock::now() ).count();
+      if ( timeout <= 0 ) return false;
+    }
+
+    int readResult = Fill( timeout );
+
+    if ( readResult > 0 ) continue;
+
+    if ( !fPending.empty() || readResult < 0 ) {
+      answer.swap( fPending );
+      fPending.clear();
+      return false;
+    }
+  }
+
+  answer = fPending.substr( 0, length );
+  fPending.erase( 0, length );
+
+  return true;
+}
+
+bool SerialPort::Query( const std::string& command, std::string& answer )
+{
+  if ( !SendCommand( command ) ) {
+    answer.clear();
+    return false;
+  }
+
+  return ReceiveFrame( answer );
+}
+
+//! Send several queries in one go and read back their answers in order.
+/*!
+  Only for protocols that answer every command with exactly one frame and
+  buffer incoming commands while an answer is being sent.
+*/
+bool SerialPort::Query( const std::vector<std::string>& commands,
+                        std::vector<std::string>& answers )
+{
+  answers.clear();
+
+  if ( !SendCommands( commands ) ) return false;
+
+  bool result = true;
+  std::string answer;
+  for ( size_t i = 0; i < commands.size(); ++i ) {
+    result &= ReceiveFrame( answer );
+    answers.push_back( answer );
+  }
+
+  return result;
+}
+
+//! Discard all unread input.
+void SerialPort::Flush()
+{
+  fPending.clear();
+
+  if ( fFileDescriptor == -1 ) return;
+
+  tcflush( fFileDescriptor, TCIFLUSH );
+}
+
+//! Wait up to &lt;timeout&gt; ms for input and append everything available.
+/*!
+  \internal
+  Returns the number of bytes read, 0 on timeout and -1 on error.
+*/
+int SerialPort::Fill( int timeout )
+{
+  struct pollfd pfd;
+  pfd.fd = fFileDescriptor;
+  pfd.events = POLLIN;
+
+  int pollResult = poll( &pfd, 1, timeout );
+  if ( pollResult < 0 ) return ( errno == EINTR ) ? 0 : -1;
+  if ( pollResult == 0 ) return 0;
+
+  char buffer[1024];
+  int total = 0;
+
+  while ( true ) {
+    ssize_t readResult = read( fFileDescriptor, buffer, sizeof( buffer ) );
+    if ( readResult > 0 ) {
+      fPending.append( buffer, readResult );
+      total += readResult;
+      continue;
+    }
+    if ( readResult < 0 && ( errno == EAGAIN || errno == EINTR ) ) break;
+    if ( total == 0 ) return -1;
+    break;
+  }
+
+  return total;
+}
+
+//! Keep the minimum time between two commands required by the device.
+/*!
+  \internal
+*/
+void SerialPort::WaitCommandGap()
+{
+  if ( fPolicy.commandGap <= 0 ) return;
+
+  const std::chrono::steady_clock::time_point next =
+    fLastCommand + std::chrono::milliseconds( fPolicy.commandGap );
+
+  if ( std::chrono::steady_clock::now() < next ) std::this_thread::sleep_until( next );
+}
@@ -0,0 +1,113 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _SERIALPORT_H_
+#define _SERIALPORT_H_
+
+#include <string>
+#include <vector>
+#include <chrono>
+
+#include <termios.h>
+
+/** @addtogroup devices
+ *  @{
+ */
+
+/** @addtogroup Serial
+ *  @{
+ */
+
+/**
+  Timing of the answers of a serial device. All values in ms.
+  */
+struct SerialTimeoutPolicy
+{
+  SerialTimeoutPolicy( int firstByte = 1000, int interByte = 50, int gap = 0 )
+    : firstByteTimeout( firstByte ),
+      interByteTimeout( interByte ),
+      commandGap( gap ) { }
+
+  int firstByteTimeout; ///< maximum wait for the first byte of an answer
+  int interByteTimeout; ///< silence that ends an answer without terminator
+  int commandGap;       ///< minimum time between two commands sent to the device
+};
+
+/**
+  \brief Framed I/O on a termios serial port.
+  Commands (including the feed string) are written in a single write().
+  Answers are collected with poll() and returned as soon as the terminator
+  or the expected number of bytes has arrived; a device that stops sending
+  ends the answer after the inter byte timeout. Bytes received after the
+  terminator are kept for the next answer, so several queries may be sent
+  in one go and their answers read back in order (pipelining).
+
+  The termios settings themselves stay with the device ComHandler, which
+  applies them through Configure() or directly on FileDescriptor().
+  */
+class SerialPort
+{
+ public:
+
+  SerialPort();
+  ~SerialPort();
+
+  bool Open( const std::string& ioPort );
+  bool Configure( const termios& settings, int optionalActions = TCSANOW );
+  void Restore();
+  void Close();
+
+  bool IsOpen() const { return fFileDescriptor != -1; }
+  int FileDescriptor() const { return fFileDescriptor; }
+  const std::string& IoPort() const { return fIoPort; }
+
+  void SetFeed( const std::string& feed ) { fFeed = feed; }
+  void SetTerminator( const std::string& terminator ) { fTerminator = terminator; }
+  void SetTimeoutPolicy( const SerialTimeoutPolicy& policy ) { fPolicy = policy; }
+  const SerialTimeoutPolicy& TimeoutPolicy() const { return fPolicy; }
+
+  bool Write( const char* data, size_t length );
+  bool SendCommand( const std::string& command );
+  bool SendCommands( const std::vector<std::string>& commands );
+
+  bool ReceiveFrame( std::string& answer );
+  bool ReceiveFrame( std::string& answer, int firstByteTimeout );
+  bool ReceiveBytes( std::string& answer, size_t length );
+
+  bool Query( const std::string& command, std::string& answer );
+  bool Query( const std::vector<std::string>& commands, std::vector<std::string>& answers );
+
+  void Flush();
+
+ protected:
+
+  int Fill( int timeout );
+  void WaitCommandGap();
+
+  std::string fIoPort;
+  int fFileDescriptor;
+  termios fSavedTermios;
+  bool fHasSavedTermios;
+
+  std::string fFeed;
+  std::string fTerminator;
+  SerialTimeoutPolicy fPolicy;
+
+  std::string fPending;
+  std::chrono::steady_clock::time_point fLastCommand;
+};
+
+/** @} */
+
+/** @} */
+
+#endif
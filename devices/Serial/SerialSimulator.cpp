@@ -0,0 +1,146 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <iostream>
+
+#include "SerialSimulator.h"
+
+//! Constructor.
+/*!
+  &lt;latency&gt; is the delay between the end of a command and the answer
+  in ms. An empty answer of the responder is not sent at all.
+*/
+SerialSimulator::SerialSimulator( const std::string& terminator, Responder responder, int latency )
+  : fTerminator( terminator ),
+    fCommandLength( 0 ),
+    fResponder( responder ),
+    fLatency( latency ),
+    fMasterFileDescriptor( -1 ),
+    fRunning( false ),
+    fCommands( 0 )
+{
+
+}
+
+SerialSimulator::~SerialSimulator()
+{
+  Stop();
+}
+
+//! Create the pseudo terminal and start answering commands.
+bool SerialSimulator::Start()
+{
+  if ( fRunning ) return true;
+
+  fMasterFileDescriptor = posix_openpt( O_RDWR | O_NOCTTY );
+  if ( fMasterFileDescriptor == -1 ||
+       grantpt( fMasterFileDescriptor ) != 0 ||
+       unlockpt( fMasterFileDescriptor ) != 0 ) {
+    std::cerr << "[SerialSimulator::Start] ** ERROR: could not create pseudo terminal."
+              << std::endl;
+    if ( fMasterFileDescriptor != -1 ) close( fMasterFileDescriptor );
+    fMasterFileDescriptor = -1;
+    return false;
+  }
+
+  fSlaveName = ptsname( fMasterFileDescriptor );
+
+  // the simulated device talks raw bytes, like a real serial line
+  termios settings;
+  tcgetattr( fMasterFileDescriptor, &settings );
+  cfmakeraw( &settings );
+  tcsetattr( fMasterFileDescriptor, TCSANOW, &settings );
+
+  fRunning = true;
+  fThread = std::thread( &SerialSimulator::Run, this );
+
+  return true;
+}
+
+void SerialSimulator::Stop()
+{
+  if ( !fRunning ) return;
+
+  fRunning = false;
+  if ( fThread.joinable() ) fThread.join();
+
+  close( fMasterFileDescriptor );
+  fMasterFileDescriptor = -1;
+}
+
+//! Simulator loop.
+/*!
+  \internal
+*/
+void SerialSimulator::Run()
+{
+  struct pollfd pfd;
+  pfd.fd = fMasterFileDescriptor;
+  pfd.events = POLLIN;
+
+  std::string input;
+  char buffer[1024];
+
+  while ( fRunning ) {
+
+    if ( poll( &pfd, 1, 20 ) <= 0 ) continue;
+
+    // the slave side is not opened yet or was closed again
+    if ( pfd.revents & POLLHUP ) {
+      usleep( 10000 );
+      continue;
+    }
+
+    ssize_t readResult = read( fMasterFileDescriptor, buffer, sizeof( buffer ) );
+    if ( readResult <= 0 ) continue;
+
+    input.append( buffer, readResult );
+
+    while ( true ) {
+
+      std::string command;
+
+      if ( fCommandLength > 0 ) {
+        if ( input.size() < fCommandLength ) break;
+        command = input.substr( 0, fCommandLength );
+        input.erase( 0, fCommandLength );
+      } else {
+        std::string::size_type pos = input.find( fTerminator );
+        if ( pos == std::string::npos ) break;
+        command = input.substr( 0, pos );
+        input.erase( 0, pos + fTerminator.size() );
+      }
+
+      fCommands++;
+
+      std::string answer = fResponder( command );
+      if ( answer.empty() ) continue;
+
+      if ( fLatency > 0 ) std::this_thread::sleep_for( std::chrono::milliseconds( fLatency ) );
+
+      size_t written = 0;
+      while ( written < answer.size() ) {
+        ssize_t result = write( fMasterFileDescriptor, answer.c_str() + written,
+                                answer.size() - written );
+        if ( result <= 0 ) break;
+        written += result;
+      }
+    }
+  }
+}
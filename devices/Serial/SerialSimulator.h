@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _SERIALSIMULATOR_H_
+#define _SERIALSIMULATOR_H_
+
+#include <string>
+#include <thread>
+#include <atomic>
+#include <functional>
+
+/** @addtogroup devices
+ *  @{
+ */
+
+/** @addtogroup Serial
+ *  @{
+ */
+
+/**
+  \brief Serial device simulated on a pseudo terminal.
+  The slave side of the pseudo terminal (SlaveName()) can be handed to any
+  ComHandler in place of a /dev/ttyUSBx device. Every command received on
+  the master side is passed to the responder, whose answer is sent back
+  after the configured latency. Commands are split at the command
+  terminator or, for binary protocols, after a fixed number of bytes.
+  */
+class SerialSimulator
+{
+ public:
+
+  typedef std::function<std::string(const std::string&)> Responder;
+
+  SerialSimulator( const std::string& terminator, Responder responder, int latency = 0 );
+  ~SerialSimulator();
+
+  void SetCommandLength( size_t length ) { fCommandLength = length; }
+
+  bool Start();
+  void Stop();
+
+  const std::string& SlaveName() const { return fSlaveName; }
+  unsigned long Commands() const { return fCommands; }
+
+ protected:
+
+  void Run();
+
+  std::string fTerminator;
+  size_t fCommandLength;
+  Responder fResponder;
+  int fLatency;
+
+  int fMasterFileDescriptor;
+  std::string fSlaveName;
+
+  std::thread fThread;
+  std::atomic<bool> fRunning;
+  std::atomic<unsigned long> fCommands;
+};
+
+/** @} */
+
+/** @} */
+
+#endif
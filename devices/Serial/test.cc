@@ -0,0 +1,160 @@
+/////////////////////////////////////////////////////////////////////////////////
+//                                                                             //
+//               Copyright (C) 2011-2017 - The DESY CMS Group                  //
+//                           All rights reserved                               //
+//                                                                             //
+//      The CMStkModLab source code is licensed under the GNU GPL v3.0.        //
+//      You have the right to modify and/or redistribute this source code      //
+//      under the terms specified in the license, which may be found online    //
+//      at http://www.gnu.org/licenses or at License.txt.                      //
+//                                                                             //
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <termios.h>
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <iostream>
+
+#include "SerialPort.h"
+#include "SerialSimulator.h"
+
+std::string stepperAnswer(const std::string& command)
+{
+  if (command=="?ver") return "PE43 1.00.01\r";
+  if (command=="?pos") return "1.0000 2.0000 3.0000 0.0000\r";
+  if (command=="?statusaxis") return "@@@-\r";
+  if (command=="!silent") return "";
+  return "ERR\r";
+}
+
+std::string binaryAnswer(const std::string& command)
+{
+  std::string answer(command);
+  answer[0] = ~answer[0];
+  answer[3] = answer[0] ^ answer[1] ^ answer[2];
+  return answer;
+}
+
+double elapsed(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int failures = 0;
+
+void check(bool condition, const std::string& what)
+{
+  if (condition) return;
+  std::cerr << "FAILED: " << what << std::endl;
+  ++failures;
+}
+
+void openRaw(SerialPort& port, const std::string& name)
+{
+  port.Open(name);
+
+  termios settings;
+  tcgetattr(port.FileDescriptor(), &settings);
+  cfmakeraw(&settings);
+  port.Configure(settings);
+}
+
+int main()
+{
+  // line based protocol with 2 ms device latency
+  SerialSimulator stepper("\r", stepperAnswer, 2);
+  if (!stepper.Start()) return -1;
+
+  SerialPort port;
+  openRaw(port, stepper.SlaveName());
+  port.SetFeed("\r");
+  port.SetTerminator("\r");
+  port.SetTimeoutPolicy(SerialTimeoutPolicy(200, 20));
+
+  std::string answer;
+  bool result;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int i=0;i<100;++i) {
+    result = port.Query("?pos", answer);
+    check(result && answer==stepperAnswer("?pos"), "single query answer");
+  }
+  double duration = elapsed(start)/100.;
+  std::cout << "single query:    " << duration << " ms  " << answer << std::endl;
+  check(duration < 200., "single query ends on the terminator, not on a timeout");
+
+  std::vector<std::string> commands;
+  commands.push_back("?statusaxis");
+  commands.push_back("?pos");
+  commands.push_back("?ver");
+  std::vector<std::string> answers;
+
+  start = std::chrono::steady_clock::now();
+  for (int i=0;i<100;++i) {
+    result = port.Query(commands, answers);
+    check(result && answers.size()==commands.size(), "pipelined query answers");
+    for (size_t j=0;j<answers.size() && j<commands.size();++j)
+      check(answers[j]==stepperAnswer(commands[j]), "pipelined answer order");
+  }
+  duration = elapsed(start)/100.;
+  std::cout << "pipelined query: " << duration << " ms  ";
+  for (size_t i=0;i<answers.size();++i) std::cout << answers[i] << " ";
+  std::cout << std::endl;
+  check(duration < 200., "pipelined query ends on the terminators, not on a timeout");
+
+  start = std::chrono::steady_clock::now();
+  result = port.Query("!silent", answer);
+  duration = elapsed(start);
+  std::cout << "no answer:       " << duration << " ms  " << result << std::endl;
+  check(!result && answer.empty(), "missing answer is reported");
+  check(duration >= 190. && duration < 400., "missing answer ends after the first byte timeout");
+
+  std::cout << "commands seen:   " << stepper.Commands() << std::endl;
+  check(stepper.Commands()==100+300+1, "every command reaches the device once");
+
+  port.Close();
+  stepper.Stop();
+
+  // binary protocol with fixed frame length and a command gap
+  SerialSimulator relay("", binaryAnswer, 5);
+  relay.SetCommandLength(4);
+  if (!relay.Start()) return -1;
+
+  openRaw(port, relay.SlaveName());
+  port.SetTimeoutPolicy(SerialTimeoutPolicy(200, 20, 100));
+
+  char frame[4] = { 3, 1, 0, 2 };
+  check(port.Write(frame, 4), "binary frame sent");
+
+  start = std::chrono::steady_clock::now();
+  result = port.ReceiveBytes(answer, 4);
+  std::cout << "binary frame:    " << elapsed(start) << " ms  " << result;
+  for (size_t i=0;i<answer.size();++i) std::cout << " " << (int)(unsigned char)answer[i];
+  std::cout << std::endl;
+  check(result && answer==binaryAnswer(std::string(frame, 4)), "binary frame answer");
+
+  start = std::chrono::steady_clock::now();
+  check(port.Write(frame, 4), "second binary frame sent");
+  duration = elapsed(start);
+  std::cout << "command gap:     " << duration << " ms" << std::endl;
+  check(duration >= 80., "command gap is kept");
+  check(port.ReceiveBytes(answer, 4) && answer==binaryAnswer(std::string(frame, 4)), "second binary frame answer");
+
+  start = std::chrono::steady_clock::now();
+  result = port.ReceiveBytes(answer, 4);
+  duration = elapsed(start);
+  check(!result && answer.empty(), "missing binary frame is reported");
+  check(duration >= 190. && duration < 400., "missing binary frame ends after the first byte timeout");
+
+  port.Close();
+  relay.Stop();
+
+  if (failures) {
+    std::cerr << failures << " check(s) failed" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -33,9 +33,9 @@ WatchDog::WatchDog(PumpStationModel* model,
                    QObject *parent)
 : QObject(parent),
   model_(model),
-  pressure1_(HistoryFifo<double>(history)),
-  pressure2_(HistoryFifo<double>(history)),
-  pressure3_(HistoryFifo<double>(history))
+  pressure1_(history),
+  pressure2_(history),
+  pressure3_(history)
 {
   connect(model_, SIGNAL(dataValid()),
           this, SLOT(initialize()));
@@ -22,7 +22,7 @@
 #include <QXmlStreamWriter>
 #include <QSocketNotifier>
 
-#include <HistoryFifo.h>
+#include <Ringbuffer.h>
 
 #include <PumpStationModel.h>
 
@@ -55,9 +55,9 @@ protected:
   QMutex mutex_;
 
   std::array<State,5> switchState_;
-  HistoryFifo<double> pressure1_;
-  HistoryFifo<double> pressure2_;
-  HistoryFifo<double> pressure3_;
+  TimedRingbuffer<double> pressure1_;
+  TimedRingbuffer<double> pressure2_;
+  TimedRingbuffer<double> pressure3_;
 
 signals:
 
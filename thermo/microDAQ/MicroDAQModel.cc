@@ -8,6 +8,8 @@
 
 #include <nqlogger.h>
 
+#include "DeviceCommandReport.h"
+
 #include "MicroDAQModel.h"
 
 MicroDAQModel::MicroDAQModel(IotaModel* iotaModel,
@@ -41,9 +43,8 @@ MicroDAQModel::MicroDAQModel(IotaModel* iotaModel,
 
 void MicroDAQModel::myMoveToThread(QThread *thread)
 {
-    iotaModel_->moveToThread(thread);
-    arduinoPresModel_->moveToThread(thread);
-    coriModel_->moveToThread(thread);
+    // the device models are polled in their own I/O threads,
+    // see DevicePollScheduler
     this->moveToThread(thread);
 }
 
@@ -92,6 +93,8 @@ void MicroDAQModel::createDAQStatusMessage(QString &buffer)
     xml.writeAttribute("Flow", QString::number(coriMeasure_, 'e', 3));
     xml.writeEndElement();
 
+    DeviceCommandReport::writeDAQStatus(xml, utime);
+
     xml.writeStartElement("DAQStarted");
     xml.writeAttribute("time", utime.toString(Qt::ISODate));
     xml.writeEndElement();
@@ -1,3 +1,5 @@
+#include <csignal>
+
 #include <QApplication>
 #include <QProcess>
 #include <QFile>
@@ -12,6 +14,7 @@
 
 #include "SingletonApplication.h"
 #include "ApplicationConfig.h"
+#include "DeviceCommandReport.h"
 
 #include "MicroMainWindow.h"
 
@@ -40,6 +43,8 @@ int main( int argc, char** argv )
         NQLogger::instance()->addDestiniation(logfile, NQLog::Message);
     }
 
+    DeviceCommandReport::dumpOnSignal(SIGUSR1, logdir + "/microDAQ-devices.txt");
+
     qRegisterMetaType<State>("State");
 
 #ifdef SINGLETON
@@ -20,6 +20,8 @@
 
 #include <nqlogger.h>
 
+#include "DeviceCommandReport.h"
+
 #include "ThermoDAQModel.h"
 
 ThermoDAQModel::ThermoDAQModel(HuberPetiteFleurModel* huberModel,
@@ -91,12 +93,8 @@ ThermoDAQModel::ThermoDAQModel(HuberPetiteFleurModel* huberModel,
 
 void ThermoDAQModel::myMoveToThread(QThread *thread)
 {
-    huberModel_->moveToThread(thread);
-    keithleyModel_->moveToThread(thread);
-    hamegModel_->moveToThread(thread);
-    pfeifferModel_->moveToThread(thread);
-    iotaModel_->moveToThread(thread);
-    arduinoPresModel_->moveToThread(thread);
+    // the device models are polled in their own I/O threads,
+    // see DevicePollScheduler
     this->moveToThread(thread);
 }
 
@@ -215,6 +213,8 @@ void ThermoDAQModel::createDAQStatusMessage(QString &buffer)
     xml.writeAttribute("pB", QString::number(arduinoPressureB_, 'e', 6));
     xml.writeEndElement();
 
+    DeviceCommandReport::writeDAQStatus(xml, utime);
+
     xml.writeStartElement("DAQStarted");
     xml.writeAttribute("time", utime.toString(Qt::ISODate));
     xml.writeEndElement();
@@ -38,6 +38,9 @@ ThermoMainWindow::ThermoMainWindow(QWidget *parent) :
     // KEITHLEY MODEL
     keithleyModel_ = new KeithleyModel(config->getValue<std::string>("KeithleyDevice").c_str(),
                                        20, this);
+    QMetaObject::invokeMethod(keithleyModel_, "setContinuousScan", Qt::QueuedConnection,
+                              Q_ARG(bool, config->getValue<int>("KeithleyContinuousScan", 0) != 0),
+                              Q_ARG(double, config->getValue<double>("KeithleyContinuousScanInterval", 1.0)));
 
     // HAMEG MODEL
     hamegModel_ = new HamegModel(config->getValue<std::string>("HamegDevice").c_str(),
@@ -10,6 +10,8 @@
 //                                                                             //
 /////////////////////////////////////////////////////////////////////////////////
 
+#include <csignal>
+
 #include <QApplication>
 #include <QProcess>
 #include <QFile>
@@ -24,6 +26,7 @@
 
 #include "SingletonApplication.h"
 #include "ApplicationConfig.h"
+#include "DeviceCommandReport.h"
 
 #include "ThermoMainWindow.h"
 #include "TestWindow.h"
@@ -55,6 +58,8 @@ int main( int argc, char** argv )
         NQLogger::instance()->addDestiniation(logfile, NQLog::Message);
     }
 
+    DeviceCommandReport::dumpOnSignal(SIGUSR1, logdir + "/thermoDAQ-devices.txt");
+
     qRegisterMetaType<State>("State");
 
 #ifdef SINGLETON